@@ -27,6 +27,11 @@ namespace AZ::Data
             AZStd::vector<AZ::u8> m_preloadedData;
             //! The current active streamer read request - tracked in case we need to cancel it prematurely
             AZ::IO::FileRequestPtr m_curReadRequest{ nullptr };
+            //! The read request for the asset data. If it was completed with a mapped view, it's kept alive until the stream is
+            //! closed because the view is only valid as long as the request exists.
+            AZ::IO::FileRequestPtr m_readRequest{ nullptr };
+            //! True if the asset buffer is a read-only view owned by the read request instead of memory from the buffer allocator.
+            bool m_isMappedView{ false };
 
             //! Synchronization for the read request, so that it's possible to block until completion.
             AZStd::mutex m_readRequestMutex;
@@ -64,6 +69,7 @@ namespace AZ::Data
     AssetDataStream::AssetDataStream(AZ::IO::IStreamerTypes::RequestMemoryAllocator* bufferAllocator)
         : m_privateData(AZStd::make_unique<DataStreamInternal::AssetDataStreamPrivate>())
         , m_bufferAllocator(bufferAllocator ? bufferAllocator : &m_defaultAllocator)
+        , m_defaultAllocator(AZ::AllocatorInstance<AZ::SystemAllocator>::Get(), true)
     {
         ClearInternalStateData();
     }
@@ -137,8 +143,15 @@ namespace AZ::Data
                 // Get the results
                 auto streamer = AZ::Interface<AZ::IO::IStreamer>::Get();
                 AZ::u64 bytesRead = 0;
+                // Mapped views can't be claimed, so the request is kept alive instead until the stream is closed.
+                m_privateData->m_isMappedView =
+                    streamer->GetReadRequestMemoryType(fileHandle) == AZ::IO::IStreamerTypes::MemoryType::MappedView;
                 streamer->GetReadRequestResult(fileHandle, m_buffer, bytesRead,
-                                               AZ::IO::IStreamerTypes::ClaimMemory::Yes);
+                    m_privateData->m_isMappedView ? AZ::IO::IStreamerTypes::ClaimMemory::No : AZ::IO::IStreamerTypes::ClaimMemory::Yes);
+                if (!m_privateData->m_isMappedView)
+                {
+                    m_privateData->m_readRequest = nullptr;
+                }
                 auto status = streamer->GetRequestStatus(fileHandle);
                 m_loadedSize = aznumeric_cast<size_t>(bytesRead);
 
@@ -174,6 +187,7 @@ namespace AZ::Data
                 *m_bufferAllocator,
                 m_requestedAssetSize,
                 deadline, priority, m_fileOffset);
+            m_privateData->m_readRequest = m_privateData->m_curReadRequest;
             m_curDeadline = deadline;
             m_curPriority = priority;
             streamer->SetRequestCompleteCallback(m_privateData->m_curReadRequest, streamerCallback);
@@ -215,6 +229,8 @@ namespace AZ::Data
     {
         // Clear all our internal state data.
         m_privateData->m_preloadedData.resize(0);
+        m_privateData->m_readRequest = nullptr;
+        m_privateData->m_isMappedView = false;
         m_buffer = nullptr;
         m_loadedSize = 0;
         m_requestedAssetSize = 0;
@@ -254,7 +270,8 @@ namespace AZ::Data
         AZ_Assert(m_privateData->m_curReadRequest == nullptr, "Attempting to close a stream with a read request in flight.");
 
         // Destroy the asset buffer and unlock the allocator, so the allocator itself knows that it is no longer needed.
-        if (m_buffer != m_privateData->m_preloadedData.data())
+        // Mapped views are released together with the read request.
+        if (m_buffer != m_privateData->m_preloadedData.data() && !m_privateData->m_isMappedView)
         {
             m_bufferAllocator->Release(m_buffer);
         }
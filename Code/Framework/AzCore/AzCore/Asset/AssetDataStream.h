@@ -105,7 +105,8 @@ namespace AZ::Data
         //! The allocator to use for allocating / deallocating asset buffers
         AZ::IO::IStreamerTypes::RequestMemoryAllocator* m_bufferAllocator{ nullptr };
 
-        //! The default allocator to use if no specialized allocators are passed in.
+        //! The default allocator to use if no specialized allocators are passed in. It accepts mapped views so asset data stored
+        //! uncompressed in memory mapped archives doesn't need to be copied.
         AZ::IO::IStreamerTypes::DefaultRequestMemoryAllocator m_defaultAllocator;
 
         //! The path and file name of the asset being loaded
@@ -21,6 +21,7 @@
 #include <AzCore/Memory/AllocationRecords.h>
 
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Metrics/EventLoggerFactoryImpl.h>
 #include <AzCore/Metrics/JsonTraceEventLogger.h>
@@ -988,6 +989,9 @@ namespace AZ
 
         AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::Finalize);
 
+        // The retained parallel tick graph must be released while the task executor is still alive
+        m_parallelTickScheduler.Reset();
+
         // deactivate all entities
         while (!m_entities.empty())
         {
@@ -1637,13 +1641,22 @@ namespace AZ
             TickBus::ExecuteQueuedEvents();
         }
 
+        const AZ::TimeUs deltaTimeUs = m_timeSystem->AdvanceTickDeltaTimes();
+        const float deltaTimeSeconds = AZ::TimeUsToSeconds(deltaTimeUs);
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:OnTick");
-            const AZ::TimeUs deltaTimeUs = m_timeSystem->AdvanceTickDeltaTimes();
-            const float deltaTimeSeconds = AZ::TimeUsToSeconds(deltaTimeUs);
             AZ::TickBus::Broadcast(&TickEvents::OnTick, deltaTimeSeconds, GetTimeAtCurrentTick());
         }
 
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:OnParallelTick");
+            m_parallelTickScheduler.Tick(deltaTimeSeconds, GetTimeAtCurrentTick());
+        }
+
+        // Temporary allocations made during the previous tick can't be used anymore. Those of this tick stay valid during the
+        // next one, for the jobs and tasks started during this tick that are still running.
+        static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get()).ResetFrame();
+
         m_timeSystem->ApplyTickRateLimiterIfNeeded();
     }
 
@@ -11,6 +11,7 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/ParallelTickScheduler.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/BudgetTracker.h>
@@ -413,6 +414,9 @@ namespace AZ
         using TickTimepoint = AZStd::chrono::steady_clock::time_point;
         TickTimepoint m_lastTickTime{};
 
+        //! Runs the AZ::ParallelTickBus phase after the TickBus::OnTick broadcast
+        ParallelTickScheduler m_parallelTickScheduler;
+
         //! Callback function for determining whether a call to record metrics in the Tick() member function
         //! functionshould take place
         //! @param currentMonotonicTime - The monotonic tick time of the application since launch
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+/** @file
+ * Header file for the bus that dispatches the parallel tick phase.
+ * Handlers on this bus declare the resources they read and write during the tick,
+ * which allows handlers that don't conflict to be ticked concurrently.
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Resources a handler accesses during AZ::ParallelTickEvents::OnParallelTick.
+     * A resource is any shared state identified by a Crc32. Service names (for example AZ_CRC_CE("TransformService"))
+     * are a good fit for state owned by a system, while finer grained ids can be built for state owned by a single entity.
+     * Handlers that only read a resource may tick concurrently with each other, but never with a handler that writes it.
+     */
+    struct ParallelTickAccess
+    {
+        using ResourceList = AZStd::vector<Crc32>;
+
+        ResourceList m_reads;   ///< Resources read during the tick.
+        ResourceList m_writes;  ///< Resources written during the tick. A handler writing a resource may also read it.
+    };
+
+    /**
+     * Interface for AZ::ParallelTickBus, the EBus that dispatches the parallel tick phase.
+     * The phase runs on the main thread right after AZ::TickBus::OnTick, and is scheduled as an AZ::TaskGraph
+     * when the task graph is active. Otherwise handlers are ticked serially in tick order.
+     *
+     * Handlers are ordered by GetTickOrder(), the same way they are on AZ::TickBus:
+     * - A handler that doesn't declare its access is ticked after every handler before it in tick order
+     *   and before every handler after it, so it can safely access anything.
+     * - A handler that declares its access is ticked after the handlers before it that write a resource it reads,
+     *   or access a resource it writes. It may run concurrently with any other handler, on any thread.
+     *
+     * Handlers must not connect to or disconnect from this bus during the phase. Use AZ::TickBus::QueueFunction instead.
+     */
+    class ParallelTickEvents
+        : public AZ::EBusTraits
+    {
+    public:
+        AZ_RTTI(ParallelTickEvents, "{4C8A3D52-3E0B-4F0C-9C27-1A5F6B8E2D17}");
+
+        virtual ~ParallelTickEvents() = default;
+
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides - application is a singleton
+        static const AZ::EBusHandlerPolicy HandlerPolicy = EBusHandlerPolicy::MultipleAndOrdered;
+
+        struct BusHandlerOrderCompare
+        {
+            AZ_FORCE_INLINE bool operator()(ParallelTickEvents* left, ParallelTickEvents* right) const { return left->GetTickOrder() < right->GetTickOrder(); }
+        };
+        //////////////////////////////////////////////////////////////////////////
+
+        /**
+         * Signals the parallel tick phase of the current tick.
+         * Unless the handler doesn't declare its access, this can be called from any thread.
+         * @param deltaTime The delta (in seconds) from the previous tick and the current time.
+         * @param time The current time.
+         */
+        virtual void OnParallelTick(float deltaTime, ScriptTimePoint time) = 0;
+
+        /**
+         * Specifies the order in which a handler is ticked relative to the handlers it conflicts with.
+         * This value should not be changed while the handler is connected.
+         * See the ComponentTickBus enum for recommended values.
+         * @return a value specifying this handler's relative order.
+         */
+        virtual int GetTickOrder()
+        {
+            return TICK_DEFAULT;
+        }
+
+        /**
+         * Declares the resources the handler accesses during OnParallelTick.
+         * This is queried when the set of handlers connected to the bus changes, and should not change while the handler is connected.
+         * @param access Filled in with the resources read and written by the handler.
+         * @return true if the handler declared its access, false to be ticked exclusively.
+         */
+        virtual bool GetParallelTickAccess([[maybe_unused]] ParallelTickAccess& access)
+        {
+            return false;
+        }
+    };
+
+    /**
+     * The EBus for the parallel tick phase.
+     * The events are defined in the AZ::ParallelTickEvents class.
+     */
+    using ParallelTickBus = AZ::EBus<ParallelTickEvents>;
+} // namespace AZ
+
+DECLARE_EBUS_EXTERN(ParallelTickEvents);
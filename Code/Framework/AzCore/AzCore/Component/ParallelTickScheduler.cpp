@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Component/ParallelTickScheduler.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/sort.h>
+
+DECLARE_EBUS_INSTANTIATION(ParallelTickEvents);
+
+namespace AZ
+{
+    namespace ParallelTickInternal
+    {
+        // Handlers that touched a resource since it was last written
+        struct ResourceState
+        {
+            uint32_t m_lastWriter = NoHandler;
+            AZStd::vector<uint32_t> m_readers;
+
+            static constexpr uint32_t NoHandler = AZStd::numeric_limits<uint32_t>::max();
+        };
+    } // namespace ParallelTickInternal
+
+    ParallelTickScheduler::ParallelTickScheduler() = default;
+
+    ParallelTickScheduler::~ParallelTickScheduler() = default;
+
+    void ParallelTickScheduler::Tick(float deltaTime, ScriptTimePoint time)
+    {
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        const bool taskGraphActive = taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+        if (taskGraphActive)
+        {
+            TickOnExecutor(TaskExecutor::Instance(), deltaTime, time);
+        }
+        else
+        {
+            TickSerial(deltaTime, time);
+        }
+    }
+
+    void ParallelTickScheduler::TickSerial(float deltaTime, ScriptTimePoint time)
+    {
+        UpdateSchedule();
+
+        for (ParallelTickEvents* handler : m_handlers)
+        {
+            handler->OnParallelTick(deltaTime, time);
+        }
+    }
+
+    void ParallelTickScheduler::TickOnExecutor(TaskExecutor& executor, float deltaTime, ScriptTimePoint time)
+    {
+        UpdateSchedule();
+
+        // A graph only pays off if some handlers can tick concurrently
+        if (!m_canTickConcurrently)
+        {
+            for (ParallelTickEvents* handler : m_handlers)
+            {
+                handler->OnParallelTick(deltaTime, time);
+            }
+            return;
+        }
+
+        m_deltaTime = deltaTime;
+        m_time = time;
+        for (TickSegment& segment : m_segments)
+        {
+            TickSegmentOnExecutor(executor, segment);
+
+            // Handlers that don't declare their access may touch anything, including state that is only safe to access
+            // from the main thread
+            if (segment.m_endHandler < m_handlers.size())
+            {
+                m_handlers[segment.m_endHandler]->OnParallelTick(deltaTime, time);
+            }
+        }
+
+        AZ_Assert(ParallelTickBus::GetTotalNumOfEventHandlers() == m_handlers.size(),
+            "Handlers connected to or disconnected from the ParallelTickBus during OnParallelTick. Use TickBus::QueueFunction instead.");
+    }
+
+    void ParallelTickScheduler::TickSegmentOnExecutor(TaskExecutor& executor, TickSegment& segment)
+    {
+        if (segment.m_endHandler - segment.m_firstHandler < 2)
+        {
+            if (segment.m_firstHandler != segment.m_endHandler)
+            {
+                m_handlers[segment.m_firstHandler]->OnParallelTick(m_deltaTime, m_time);
+            }
+            return;
+        }
+
+        if (!segment.m_graph)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ParallelTickScheduler::BuildGraph");
+            static const TaskDescriptor parallelTickDescriptor{ "AZ::ParallelTickScheduler::OnParallelTick", "Core" };
+            segment.m_graph = AZStd::make_unique<TaskGraph>("ParallelTick");
+            AZStd::vector<TaskToken> tokens;
+            tokens.reserve(segment.m_endHandler - segment.m_firstHandler);
+            for (uint32_t index = segment.m_firstHandler; index < segment.m_endHandler; ++index)
+            {
+                ParallelTickEvents* handler = m_handlers[index];
+                TaskToken& token = tokens.emplace_back(segment.m_graph->AddTask(
+                    parallelTickDescriptor,
+                    [this, handler]()
+                    {
+                        handler->OnParallelTick(m_deltaTime, m_time);
+                    }));
+
+                // Handlers before the segment have completed by the time it is submitted
+                for (uint32_t dependency = m_dependencyOffsets[index]; dependency < m_dependencyOffsets[index + 1]; ++dependency)
+                {
+                    if (m_dependencies[dependency] >= segment.m_firstHandler)
+                    {
+                        tokens[m_dependencies[dependency] - segment.m_firstHandler].Precedes(token);
+                    }
+                }
+            }
+        }
+
+        TaskGraphEvent parallelTickEvent{ "ParallelTick Wait" };
+        segment.m_graph->SubmitOnExecutor(executor, &parallelTickEvent);
+        parallelTickEvent.Wait();
+    }
+
+    size_t ParallelTickScheduler::GetDependencyCount() const
+    {
+        return m_dependencies.size();
+    }
+
+    void ParallelTickScheduler::Reset()
+    {
+        m_segments.clear();
+        m_handlers.clear();
+        m_dependencyOffsets.clear();
+        m_dependencies.clear();
+        m_canTickConcurrently = false;
+    }
+
+    void ParallelTickScheduler::UpdateSchedule()
+    {
+        m_connectedHandlers.clear();
+        ParallelTickBus::EnumerateHandlers(
+            [this](ParallelTickEvents* handler)
+            {
+                m_connectedHandlers.push_back(handler);
+                return true;
+            });
+
+        if (m_connectedHandlers != m_handlers)
+        {
+            AZ_PROFILE_SCOPE(AzCore, "ParallelTickScheduler::UpdateSchedule");
+            m_handlers.swap(m_connectedHandlers);
+            BuildDependencies();
+        }
+    }
+
+    void ParallelTickScheduler::BuildDependencies()
+    {
+        using ParallelTickInternal::ResourceState;
+
+        m_dependencyOffsets.clear();
+        m_dependencies.clear();
+        m_segments.clear();
+        m_canTickConcurrently = false;
+        m_segments.emplace_back();
+        m_dependencyOffsets.reserve(m_handlers.size() + 1);
+        m_dependencyOffsets.push_back(0);
+
+        AZStd::unordered_map<Crc32, ResourceState> resources;
+        // Last handler that didn't declare its access. Every handler after it depends on it.
+        uint32_t exclusiveHandler = ResourceState::NoHandler;
+        // Handlers since the last exclusive one that no other handler depends on yet
+        AZStd::vector<uint32_t> unfinishedHandlers;
+        AZStd::vector<bool> hasDependents(m_handlers.size(), false);
+
+        ParallelTickAccess access;
+        for (uint32_t index = 0; index < aznumeric_cast<uint32_t>(m_handlers.size()); ++index)
+        {
+            const size_t firstDependency = m_dependencies.size();
+
+            access.m_reads.clear();
+            access.m_writes.clear();
+            if (!m_handlers[index]->GetParallelTickAccess(access))
+            {
+                // Undeclared handlers keep the TickBus ordering: wait for everything before, and block everything after
+                for (uint32_t unfinished : unfinishedHandlers)
+                {
+                    if (!hasDependents[unfinished])
+                    {
+                        m_dependencies.push_back(unfinished);
+                    }
+                }
+                if (m_dependencies.size() == firstDependency && exclusiveHandler != ResourceState::NoHandler)
+                {
+                    m_dependencies.push_back(exclusiveHandler);
+                }
+                exclusiveHandler = index;
+                unfinishedHandlers.clear();
+                m_segments.back().m_endHandler = index;
+                m_segments.emplace_back().m_firstHandler = index + 1;
+                resources.clear();
+            }
+            else
+            {
+                for (const Crc32& resource : access.m_writes)
+                {
+                    ResourceState& state = resources[resource];
+                    if (state.m_lastWriter != ResourceState::NoHandler)
+                    {
+                        m_dependencies.push_back(state.m_lastWriter);
+                    }
+                    m_dependencies.insert(m_dependencies.end(), state.m_readers.begin(), state.m_readers.end());
+                }
+                for (const Crc32& resource : access.m_reads)
+                {
+                    ResourceState& state = resources[resource];
+                    if (state.m_lastWriter != ResourceState::NoHandler)
+                    {
+                        m_dependencies.push_back(state.m_lastWriter);
+                    }
+                }
+
+                // Readers are recorded before writers, so a handler that reads and writes a resource only counts as its writer
+                for (const Crc32& resource : access.m_reads)
+                {
+                    resources[resource].m_readers.push_back(index);
+                }
+                for (const Crc32& resource : access.m_writes)
+                {
+                    ResourceState& state = resources[resource];
+                    state.m_lastWriter = index;
+                    state.m_readers.clear();
+                }
+
+                // Depending on any handler after the exclusive one already orders this handler after it
+                if (m_dependencies.size() == firstDependency && exclusiveHandler != ResourceState::NoHandler)
+                {
+                    m_dependencies.push_back(exclusiveHandler);
+                }
+                unfinishedHandlers.push_back(index);
+            }
+
+            // Remove duplicates, which occur when a handler accesses several resources of another one
+            auto dependenciesBegin = m_dependencies.begin() + firstDependency;
+            AZStd::sort(dependenciesBegin, m_dependencies.end());
+            m_dependencies.erase(AZStd::unique(dependenciesBegin, m_dependencies.end()), m_dependencies.end());
+
+            // Ticking is serial if every handler depends on the previous one
+            if (index > 0 && (m_dependencies.size() == firstDependency || m_dependencies.back() != index - 1))
+            {
+                m_canTickConcurrently = true;
+            }
+            for (auto dependency = m_dependencies.begin() + firstDependency; dependency != m_dependencies.end(); ++dependency)
+            {
+                hasDependents[*dependency] = true;
+            }
+
+            m_dependencyOffsets.push_back(aznumeric_cast<uint32_t>(m_dependencies.size()));
+        }
+        m_segments.back().m_endHandler = aznumeric_cast<uint32_t>(m_handlers.size());
+    }
+} // namespace AZ
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/ParallelTickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+    class TaskGraph;
+
+    /**
+     * Runs the parallel tick phase for the handlers connected to AZ::ParallelTickBus.
+     * The dependencies between handlers are derived from their declared access, and only rebuilt when the
+     * handlers connected to the bus change. Handlers that don't declare their access always tick on the calling thread,
+     * so the handlers between two of them are ticked as a task graph, which is retained and resubmitted every tick
+     * until then. The ComponentApplication owns the scheduler and runs it every tick.
+     */
+    class ParallelTickScheduler
+    {
+    public:
+        ParallelTickScheduler();
+        ~ParallelTickScheduler();
+        ParallelTickScheduler(const ParallelTickScheduler&) = delete;
+        ParallelTickScheduler& operator=(const ParallelTickScheduler&) = delete;
+
+        //! Ticks every handler, as a task graph if the task graph is active or serially otherwise.
+        void Tick(float deltaTime, ScriptTimePoint time);
+
+        //! Ticks every handler serially on the calling thread, in tick order.
+        void TickSerial(float deltaTime, ScriptTimePoint time);
+
+        //! Ticks the handlers that declare their access as task graphs submitted on @executor, and waits for them to complete.
+        //! Handlers that don't declare their access are ticked on the calling thread in between.
+        void TickOnExecutor(TaskExecutor& executor, float deltaTime, ScriptTimePoint time);
+
+        //! Returns the number of dependencies in the current schedule, between handlers that can't tick concurrently.
+        size_t GetDependencyCount() const;
+
+        //! Clears the schedule and releases the retained task graphs.
+        //! Must be called before the task executor is destroyed if the scheduler outlives it.
+        void Reset();
+
+    private:
+        //! Handlers that declare their access, ticked after the previous handler that doesn't declare it
+        //! and before the next one, at index m_endHandler (or after the last handler).
+        struct TickSegment
+        {
+            uint32_t m_firstHandler = 0;
+            uint32_t m_endHandler = 0;
+            //! Graph ticking the handlers, built the first time they tick on an executor after the schedule changed
+            AZStd::unique_ptr<TaskGraph> m_graph;
+        };
+
+        //! Gathers the connected handlers, and rebuilds the dependencies if they changed since the last tick.
+        void UpdateSchedule();
+        void BuildDependencies();
+        void TickSegmentOnExecutor(TaskExecutor& executor, TickSegment& segment);
+
+        //! Handlers connected to the bus in tick order
+        AZStd::vector<ParallelTickEvents*> m_handlers;
+        AZStd::vector<ParallelTickEvents*> m_connectedHandlers;
+
+        //! The handlers that must complete before handler i ticks are m_dependencies[m_dependencyOffsets[i]...m_dependencyOffsets[i + 1]].
+        //! Dependencies always refer to handlers earlier in tick order, so ticking in tick order satisfies all of them.
+        AZStd::vector<uint32_t> m_dependencyOffsets;
+        AZStd::vector<uint32_t> m_dependencies;
+        bool m_canTickConcurrently = false;
+
+        //! Handlers between the handlers that don't declare their access, in tick order
+        AZStd::vector<TickSegment> m_segments;
+        //! Arguments of the tick in progress, read by the tasks of the retained graphs
+        float m_deltaTime = 0.0f;
+        ScriptTimePoint m_time;
+    };
+} // namespace AZ
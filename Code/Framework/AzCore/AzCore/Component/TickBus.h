@@ -94,6 +94,11 @@ namespace AZ
          * Enables the event queue, which you can use to execute actions just before the OnTick event.
          */
         static const bool EnableEventQueue = true;        
+
+        /**
+         * Ticks iterate over a flat snapshot of the handlers, which is only rebuilt after handlers connect or disconnect.
+         */
+        static const bool EnableDispatchSnapshot = true;
         
         /**
          * Specifies the mutex that is used when adding and removing events from the event queue.
@@ -318,6 +318,10 @@ namespace AZ
         //! Destroys the instance of the class.
         virtual ~TransformNotification() {}
 
+        //! Transform changes are dispatched through a flat snapshot of the handlers, which is only rebuilt after handlers
+        //! connect or disconnect. Handlers connected during a dispatch receive events starting with the next top level dispatch.
+        static const bool EnableDispatchSnapshot = true;
+
         //! Signals that the local or world transform of the entity changed.
         //! @param local A reference to the new local transform of the entity.
         //! @param world A reference to the new world transform of the entity.
@@ -7,10 +7,90 @@
  */
 
 #include <AzCore/DOM/DomPatch.h>
+#include <AzCore/DOM/DomPrefixTree.h>
 #include <AzCore/DOM/DomUtils.h>
 
 namespace AZ::Dom
 {
+    struct PatchOperation::BatchState
+    {
+        explicit BatchState(Value& rootElement)
+            : m_rootElement(rootElement)
+        {
+        }
+
+        //! Returns the value at path, resolving it from the most specific value that's already been resolved.
+        Value* FindMutableValue(const Path& path);
+        //! Drops the resolved values below path. Mutating the value at path may move or replace any of its descendants.
+        void InvalidateChildren(const Path& path);
+        //! Drops the resolved values below the parent of path.
+        void InvalidateSiblings(const Path& path);
+
+        Value& m_rootElement;
+        DomPrefixTree<Value*> m_resolvedValues;
+    };
+
+    Value* PatchOperation::BatchState::FindMutableValue(const Path& path)
+    {
+        Value* value = &m_rootElement;
+        size_t resolvedEntries = 0;
+        m_resolvedValues.VisitPath(
+            path,
+            [&value, &resolvedEntries](const Path& resolvedPath, Value* resolvedValue)
+            {
+                value = resolvedValue;
+                resolvedEntries = resolvedPath.Size();
+                return true;
+            });
+
+        Path resolvedPath(path.begin(), path.begin() + resolvedEntries);
+        for (size_t i = resolvedEntries; i < path.Size() && value != nullptr; ++i)
+        {
+            const PathEntry& entry = path[i];
+            if (entry.IsEndOfArray())
+            {
+                // Looking up an EndOfArray entry appends to the array, which can't be cached
+                InvalidateChildren(resolvedPath);
+                return value->FindMutableChild(Path(path.begin() + i, path.end()));
+            }
+
+            value = value->FindMutableChild(entry);
+            resolvedPath.Push(entry);
+            if (value != nullptr)
+            {
+                m_resolvedValues.SetValue(resolvedPath, value);
+            }
+        }
+        return value;
+    }
+
+    void PatchOperation::BatchState::InvalidateChildren(const Path& path)
+    {
+        if (path.IsEmpty())
+        {
+            m_resolvedValues.Clear();
+            return;
+        }
+
+        Value** resolvedValue = m_resolvedValues.ValueAtPath(path, PrefixTreeMatch::ExactPath);
+        Value* value = resolvedValue != nullptr ? *resolvedValue : nullptr;
+        m_resolvedValues.EraseValue(path, true);
+        if (value != nullptr)
+        {
+            m_resolvedValues.SetValue(path, value);
+        }
+    }
+
+    void PatchOperation::BatchState::InvalidateSiblings(const Path& path)
+    {
+        Path parentPath = path;
+        if (!parentPath.IsEmpty())
+        {
+            parentPath.Pop();
+        }
+        InvalidateChildren(parentPath);
+    }
+
     PatchOperation::PatchOperation(Path destinationPath, Type type, Value value)
         : m_domPath(AZStd::move(destinationPath))
         , m_type(type)
@@ -114,25 +194,81 @@ namespace AZ::Dom
     }
 
     PatchOutcome PatchOperation::ApplyInPlace(Value& rootElement) const
+    {
+        return ApplyInPlace(rootElement, nullptr);
+    }
+
+    PatchOutcome PatchOperation::ApplyInPlace(Value& rootElement, BatchState* batchState) const
     {
         switch (m_type)
         {
         case Type::Add:
-            return ApplyAdd(rootElement);
+            return ApplyAdd(rootElement, batchState);
         case Type::Remove:
-            return ApplyRemove(rootElement);
+            return ApplyRemove(rootElement, batchState);
         case Type::Replace:
-            return ApplyReplace(rootElement);
+            return ApplyReplace(rootElement, batchState);
         case Type::Copy:
-            return ApplyCopy(rootElement);
+            return ApplyCopy(rootElement, batchState);
         case Type::Move:
-            return ApplyMove(rootElement);
+            return ApplyMove(rootElement, batchState);
         case Type::Test:
-            return ApplyTest(rootElement);
+            return ApplyTest(rootElement, batchState);
         }
         return AZ::Failure<AZStd::string>("Unsupported DOM patch operation specified");
     }
 
+    PatchOutcome PatchOperation::ApplyInPlaceBatched(BatchState& batchState, Patch* inversePatch) const
+    {
+        // The inverse needs the state before this operation is applied
+        AZ::Outcome<InversePatches, AZStd::string> inverse = AZ::Failure<AZStd::string>("");
+        if (inversePatch != nullptr)
+        {
+            inverse = GetInverse(batchState.m_rootElement, &batchState);
+        }
+
+        PatchOutcome outcome = ApplyInPlace(batchState.m_rootElement, &batchState);
+
+        // Drop any resolved values this operation may have moved
+        switch (m_type)
+        {
+        case Type::Add:
+        case Type::Remove:
+        case Type::Replace:
+            batchState.InvalidateSiblings(m_domPath);
+            break;
+        case Type::Copy:
+            // The source now shares its contents with the copy, so its descendants have to be looked up again before
+            // they can be mutated
+            batchState.InvalidateChildren(GetSourcePath());
+            batchState.InvalidateSiblings(m_domPath);
+            break;
+        case Type::Move:
+            batchState.InvalidateSiblings(GetSourcePath());
+            batchState.InvalidateSiblings(m_domPath);
+            break;
+        case Type::Test:
+            break;
+        }
+
+        if (outcome.IsSuccess() && inversePatch != nullptr)
+        {
+            if (!inverse.IsSuccess())
+            {
+                CombinePatchOutcomes(outcome, AZ::Failure(inverse.TakeError()));
+                return outcome;
+            }
+
+            // The inverse patch reverts the operations from last to first
+            InversePatches& inverseOperations = inverse.GetValue();
+            for (size_t i = inverseOperations.size(); i > 0; --i)
+            {
+                inversePatch->PushFront(AZStd::move(inverseOperations[i - 1]));
+            }
+        }
+        return outcome;
+    }
+
     AZ::Outcome<Value, AZStd::string> PatchOperation::ApplyAndDenormalize(Value rootElement)
     {
         PatchOutcome outcome = ApplyInPlaceAndDenormalize(rootElement);
@@ -365,6 +501,52 @@ namespace AZ::Dom
     }
 
     AZ::Outcome<AZStd::fixed_vector<PatchOperation, 2>, AZStd::string> PatchOperation::GetInverse(Value stateBeforeApplication) const
+    {
+        return GetInverse(stateBeforeApplication, nullptr);
+    }
+
+    const Value* PatchOperation::FindValue(const Value& rootElement, const Path& path, BatchState* batchState)
+    {
+        if (batchState == nullptr || path.IsEmpty() || path.ContainsNormalizedEntries())
+        {
+            return rootElement.FindChild(path);
+        }
+
+        // Only the parent is resolved through the batch state, as it's the value the operation is about to mutate
+        Path parentPath = path;
+        parentPath.Pop();
+        const Value* parentValue = batchState->FindMutableValue(parentPath);
+        if (parentValue == nullptr)
+        {
+            return nullptr;
+        }
+        const PathEntry& entry = path[path.Size() - 1];
+        if (entry.IsIndex() ? !parentValue->IsArray() && !parentValue->IsNode() : !parentValue->IsObject() && !parentValue->IsNode())
+        {
+            return nullptr;
+        }
+        return parentValue->FindChild(entry);
+    }
+
+    bool PatchOperation::ResolveEndOfArray(Path& path, const Value& rootElement, BatchState* batchState)
+    {
+        if (path.IsEmpty() || !path[path.Size() - 1].IsEndOfArray())
+        {
+            return true;
+        }
+
+        path.Pop();
+        const Value* arrayValue = FindValue(rootElement, path, batchState);
+        if (arrayValue == nullptr || (!arrayValue->IsArray() && !arrayValue->IsNode()))
+        {
+            return false;
+        }
+        path.Push(arrayValue->ArraySize());
+        return true;
+    }
+
+    AZ::Outcome<PatchOperation::InversePatches, AZStd::string> PatchOperation::GetInverse(
+        const Value& stateBeforeApplication, BatchState* batchState) const
     {
         switch (m_type)
         {
@@ -374,18 +556,26 @@ namespace AZ::Dom
                 // Add -> Remove
                 if (m_domPath.Size() > 0 && m_domPath[m_domPath.Size() - 1].IsKey())
                 {
-                    const Value* existingValue = stateBeforeApplication.FindChild(m_domPath);
+                    const Value* existingValue = FindValue(stateBeforeApplication, m_domPath, batchState);
                     if (existingValue != nullptr)
                     {
                         return AZ::Success<InversePatches>({PatchOperation::ReplaceOperation(m_domPath, *existingValue)});
                     }
                 }
-                return AZ::Success<InversePatches>({PatchOperation::RemoveOperation(m_domPath)});
+                // Appends can't be removed via "-", so resolve the index the new entry was inserted at
+                Path insertedPath = m_domPath;
+                if (!ResolveEndOfArray(insertedPath, stateBeforeApplication, batchState))
+                {
+                    AZStd::string errorMessage = "Unable to invert DOM add patch, array not found: ";
+                    m_domPath.AppendToString(errorMessage);
+                    return AZ::Failure(AZStd::move(errorMessage));
+                }
+                return AZ::Success<InversePatches>({ PatchOperation::RemoveOperation(AZStd::move(insertedPath)) });
             }
         case Type::Remove:
             {
                 // Remove -> Add
-                const Value* existingValue = stateBeforeApplication.FindChild(m_domPath);
+                const Value* existingValue = FindValue(stateBeforeApplication, m_domPath, batchState);
                 if (existingValue == nullptr)
                 {
                     AZStd::string errorMessage = "Unable to invert DOM remove patch, source path not found: ";
@@ -397,7 +587,7 @@ namespace AZ::Dom
         case Type::Replace:
             {
                 // Replace -> Replace (with old value)
-                const Value* existingValue = stateBeforeApplication.FindChild(m_domPath);
+                const Value* existingValue = FindValue(stateBeforeApplication, m_domPath, batchState);
                 if (existingValue == nullptr)
                 {
                     AZStd::string errorMessage = "Unable to invert DOM replace patch, source path not found: ";
@@ -409,7 +599,23 @@ namespace AZ::Dom
         case Type::Copy:
             {
                 // Copy -> Replace (with old value)
-                const Value* existingValue = stateBeforeApplication.FindChild(m_domPath);
+                // Copy -> Remove (if the destination was a new object key or an append)
+                if (m_domPath.Size() > 0 && m_domPath[m_domPath.Size() - 1].IsEndOfArray())
+                {
+                    Path insertedPath = m_domPath;
+                    if (!ResolveEndOfArray(insertedPath, stateBeforeApplication, batchState))
+                    {
+                        AZStd::string errorMessage = "Unable to invert DOM copy patch, array not found: ";
+                        m_domPath.AppendToString(errorMessage);
+                        return AZ::Failure(AZStd::move(errorMessage));
+                    }
+                    return AZ::Success<InversePatches>({ PatchOperation::RemoveOperation(AZStd::move(insertedPath)) });
+                }
+                const Value* existingValue = FindValue(stateBeforeApplication, m_domPath, batchState);
+                if (existingValue == nullptr && m_domPath.Size() > 0 && m_domPath[m_domPath.Size() - 1].IsKey())
+                {
+                    return AZ::Success<InversePatches>({ PatchOperation::RemoveOperation(m_domPath) });
+                }
                 if (existingValue == nullptr)
                 {
                     AZStd::string errorMessage = "Unable to invert DOM copy patch, source path not found: ";
@@ -420,7 +626,7 @@ namespace AZ::Dom
             }
         case Type::Move:
             {
-                const Value* sourceValue = stateBeforeApplication.FindChild(GetSourcePath());
+                const Value* sourceValue = FindValue(stateBeforeApplication, GetSourcePath(), batchState);
                 if (sourceValue == nullptr)
                 {
                     AZStd::string errorMessage = "Unable to invert DOM copy patch, source path not found: ";
@@ -429,18 +635,35 @@ namespace AZ::Dom
                 }
 
                 // If there was a value at the destination path, invert with an add / replace
-                const Value* destinationValue = stateBeforeApplication.FindChild(GetDestinationPath());
+                const Value* destinationValue = FindValue(stateBeforeApplication, GetDestinationPath(), batchState);
                 if (destinationValue != nullptr)
                 {
-                    InversePatches result({PatchOperation::AddOperation(GetSourcePath(), *sourceValue)});
-                    result.push_back(PatchOperation::ReplaceOperation(GetDestinationPath(), *destinationValue));
                     return AZ::Success<InversePatches>({
                         PatchOperation::AddOperation(GetSourcePath(), *sourceValue),
                         PatchOperation::ReplaceOperation(GetDestinationPath(), *destinationValue),
                     });
                 }
-                // Otherwise, just do a move
-                return AZ::Success<InversePatches>({PatchOperation::MoveOperation(GetDestinationPath(), GetSourcePath())});
+                // Otherwise, just do a move back from wherever the value ended up. An append lands after the entries left
+                // once the source has been removed, which is one fewer if the source was in the same array.
+                Path movedPath = GetDestinationPath();
+                if (!ResolveEndOfArray(movedPath, stateBeforeApplication, batchState))
+                {
+                    AZStd::string errorMessage = "Unable to invert DOM move patch, array not found: ";
+                    m_domPath.AppendToString(errorMessage);
+                    return AZ::Failure(AZStd::move(errorMessage));
+                }
+                if (movedPath != GetDestinationPath())
+                {
+                    Path sourceParentPath = GetSourcePath();
+                    sourceParentPath.Pop();
+                    Path destinationParentPath = GetDestinationPath();
+                    destinationParentPath.Pop();
+                    if (sourceParentPath == destinationParentPath)
+                    {
+                        movedPath[movedPath.Size() - 1] = PathEntry(movedPath[movedPath.Size() - 1].GetIndex() - 1);
+                    }
+                }
+                return AZ::Success<InversePatches>({ PatchOperation::MoveOperation(GetSourcePath(), AZStd::move(movedPath)) });
             }
         case Type::Test:
             {
@@ -453,7 +676,7 @@ namespace AZ::Dom
     }
 
     AZ::Outcome<PatchOperation::PathContext, AZStd::string> PatchOperation::LookupPath(
-        Value& rootElement, const Path& path, ExistenceCheckFlags flags)
+        Value& rootElement, const Path& path, ExistenceCheckFlags flags, BatchState* batchState)
     {
         const bool verifyFullPath = (flags & ExistenceCheckFlags::VerifyFullPath) != ExistenceCheckFlags::DefaultExistenceCheck;
         const bool allowEndOfArray = (flags & ExistenceCheckFlags::AllowEndOfArray) != ExistenceCheckFlags::DefaultExistenceCheck;
@@ -481,7 +704,7 @@ namespace AZ::Dom
         PathEntry destinationIndex = target[target.Size() - 1];
         target.Pop();
 
-        Value* targetValue = rootElement.FindMutableChild(target);
+        Value* targetValue = batchState != nullptr ? batchState->FindMutableValue(target) : rootElement.FindMutableChild(target);
         if (targetValue == nullptr)
         {
             AZStd::string errorMessage = "Path not found: ";
@@ -529,9 +752,9 @@ namespace AZ::Dom
         return AZ::Success<PathContext>({ *targetValue, AZStd::move(destinationIndex) });
     }
 
-    PatchOutcome PatchOperation::ApplyAdd(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyAdd(Value& rootElement, BatchState* batchState) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray, batchState);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
@@ -560,9 +783,9 @@ namespace AZ::Dom
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyRemove(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyRemove(Value& rootElement, BatchState* batchState) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath, batchState);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
@@ -584,45 +807,73 @@ namespace AZ::Dom
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyReplace(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyReplace(Value& rootElement, BatchState* batchState) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath, batchState);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
         }
 
-        rootElement[m_domPath] = GetValue();
+        if (m_domPath.IsEmpty())
+        {
+            rootElement = GetValue();
+        }
+        else
+        {
+            const PathContext& context = pathLookup.GetValue();
+            context.m_value[context.m_key] = GetValue();
+        }
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyCopy(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyCopy(Value& rootElement, BatchState* batchState) const
     {
-        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
+        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath, batchState);
         if (!sourceLookup.IsSuccess())
         {
             return AZ::Failure(sourceLookup.TakeError());
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck);
+        // Take the value before looking up the destination, which may move the source
+        const PathContext& sourceContext = sourceLookup.GetValue();
+        const Value& sourceContainer = sourceContext.m_value;
+        Value valueToCopy = GetSourcePath().IsEmpty() ? rootElement : sourceContainer[sourceContext.m_key];
+
+        // Like an add, a copy can append to an array, but otherwise replaces the value at the destination
+        const ExistenceCheckFlags destinationFlags = !m_domPath.IsEmpty() && m_domPath[m_domPath.Size() - 1].IsEndOfArray()
+            ? ExistenceCheckFlags::AllowEndOfArray
+            : ExistenceCheckFlags::DefaultExistenceCheck;
+        auto destLookup = LookupPath(rootElement, m_domPath, destinationFlags, batchState);
         if (!destLookup.IsSuccess())
         {
             return AZ::Failure(destLookup.TakeError());
         }
 
-        rootElement[m_domPath] = rootElement[GetSourcePath()];
+        if (m_domPath.IsEmpty())
+        {
+            rootElement = AZStd::move(valueToCopy);
+        }
+        else
+        {
+            const PathContext& destContext = destLookup.GetValue();
+            destContext.m_value[destContext.m_key] = AZStd::move(valueToCopy);
+        }
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyMove(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyMove(Value& rootElement, BatchState* batchState) const
     {
-        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath);
+        auto sourceLookup = LookupPath(rootElement, GetSourcePath(), ExistenceCheckFlags::VerifyFullPath, batchState);
         if (!sourceLookup.IsSuccess())
         {
             return AZ::Failure(sourceLookup.TakeError());
         }
 
-        auto destLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::DefaultExistenceCheck);
+        const ExistenceCheckFlags destinationFlags = !m_domPath.IsEmpty() && m_domPath[m_domPath.Size() - 1].IsEndOfArray()
+            ? ExistenceCheckFlags::AllowEndOfArray
+            : ExistenceCheckFlags::DefaultExistenceCheck;
+        auto destLookup = LookupPath(rootElement, m_domPath, destinationFlags, batchState);
         if (!destLookup.IsSuccess())
         {
             return AZ::Failure(destLookup.TakeError());
@@ -643,7 +894,13 @@ namespace AZ::Dom
             sourceContext.m_value.EraseMember(sourceContext.m_key.GetKey());
         }
 
-        auto newDestLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray);
+        if (batchState != nullptr)
+        {
+            // Removing the source may have moved its siblings
+            batchState->InvalidateSiblings(GetSourcePath());
+        }
+
+        auto newDestLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::AllowEndOfArray, batchState);
         const PathContext& destContext = newDestLookup.GetValue();
         const PathEntry& destinationIndex = destContext.m_key;
         Value& targetValue = destContext.m_value;
@@ -669,15 +926,17 @@ namespace AZ::Dom
         return AZ::Success();
     }
 
-    PatchOutcome PatchOperation::ApplyTest(Value& rootElement) const
+    PatchOutcome PatchOperation::ApplyTest(Value& rootElement, BatchState* batchState) const
     {
-        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath);
+        auto pathLookup = LookupPath(rootElement, m_domPath, ExistenceCheckFlags::VerifyFullPath, batchState);
         if (!pathLookup.IsSuccess())
         {
             return AZ::Failure(pathLookup.TakeError());
         }
 
-        if (!Utils::DeepCompareIsEqual(rootElement[m_domPath], GetValue()))
+        const PathContext& context = pathLookup.GetValue();
+        const Value& container = context.m_value;
+        if (!Utils::DeepCompareIsEqual(m_domPath.IsEmpty() ? rootElement : container[context.m_key], GetValue()))
         {
             return AZ::Failure<AZStd::string>("Test failed, values don't match");
         }
@@ -854,6 +1113,31 @@ namespace AZ::Dom
         return state.m_outcome;
     }
 
+    PatchOutcome Patch::ApplyInPlaceBatched(Value& rootElement, Patch* inversePatch, StrategyFunctor strategy) const
+    {
+        PatchApplicationState state;
+        state.m_currentState = &rootElement;
+        state.m_patch = this;
+
+        if (inversePatch != nullptr)
+        {
+            inversePatch->Clear();
+        }
+
+        PatchOperation::BatchState batchState(rootElement);
+        for (const PatchOperation& operation : m_operations)
+        {
+            state.m_lastOperation = &operation;
+            CombinePatchOutcomes(state.m_outcome, operation.ApplyInPlaceBatched(batchState, inversePatch));
+            strategy(state);
+            if (!state.m_shouldContinue)
+            {
+                break;
+            }
+        }
+        return state.m_outcome;
+    }
+
     AZ::Outcome<Value, AZStd::string> Patch::ApplyAndDenormalize(Value rootElement, StrategyFunctor strategy)
     {
         auto result = ApplyInPlaceAndDenormalize(rootElement, strategy);
@@ -17,6 +17,8 @@ namespace AZ::Dom
     using PatchOutcome = AZ::Outcome<void, AZStd::string>;
     void CombinePatchOutcomes(PatchOutcome& lhs, PatchOutcome&& rhs);
 
+    class Patch;
+
     //! A patch operation that represents an atomic operation for mutating or validating a Value.
     //! PatchOperations can be created with helper methods in Patch. /see Patch
     class PatchOperation final
@@ -89,24 +91,40 @@ namespace AZ::Dom
         };
 
     private:
+        friend class Patch;
+
         struct PathContext
         {
             Value& m_value;
             PathEntry m_key;
         };
 
+        //! State shared by the operations of a patch applied by Patch::ApplyInPlaceBatched.
+        struct BatchState;
+
         // For a given path and target value, removes any EndOfArray entries 
         // and replaces them with the resolved path
         static bool DenormalizePath(Dom::Path& path, const Dom::Value& sourceValue);
         static AZ::Outcome<PathContext, AZStd::string> LookupPath(
-            Value& rootElement, const Path& path, ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck);
-
-        PatchOutcome ApplyAdd(Value& rootElement) const;
-        PatchOutcome ApplyRemove(Value& rootElement) const;
-        PatchOutcome ApplyReplace(Value& rootElement) const;
-        PatchOutcome ApplyCopy(Value& rootElement) const;
-        PatchOutcome ApplyMove(Value& rootElement) const;
-        PatchOutcome ApplyTest(Value& rootElement) const;
+            Value& rootElement,
+            const Path& path,
+            ExistenceCheckFlags existenceCheckFlags = ExistenceCheckFlags::DefaultExistenceCheck,
+            BatchState* batchState = nullptr);
+        static const Value* FindValue(const Value& rootElement, const Path& path, BatchState* batchState);
+        //! Replaces a trailing EndOfArray entry in path with the index an append to rootElement would insert at.
+        static bool ResolveEndOfArray(Path& path, const Value& rootElement, BatchState* batchState);
+
+        PatchOutcome ApplyInPlace(Value& rootElement, BatchState* batchState) const;
+        //! Applies this operation as part of a batch, prepending its inverse to inversePatch if one is provided.
+        PatchOutcome ApplyInPlaceBatched(BatchState& batchState, Patch* inversePatch) const;
+        AZ::Outcome<InversePatches, AZStd::string> GetInverse(const Value& stateBeforeApplication, BatchState* batchState) const;
+
+        PatchOutcome ApplyAdd(Value& rootElement, BatchState* batchState) const;
+        PatchOutcome ApplyRemove(Value& rootElement, BatchState* batchState) const;
+        PatchOutcome ApplyReplace(Value& rootElement, BatchState* batchState) const;
+        PatchOutcome ApplyCopy(Value& rootElement, BatchState* batchState) const;
+        PatchOutcome ApplyMove(Value& rootElement, BatchState* batchState) const;
+        PatchOutcome ApplyTest(Value& rootElement, BatchState* batchState) const;
 
         AZStd::variant<AZStd::monostate, Value, Path> m_value;
         Path m_domPath;
@@ -115,8 +133,6 @@ namespace AZ::Dom
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(PatchOperation::ExistenceCheckFlags);
 
-    class Patch;
-
     //! The current state of a Patch application operation.
     struct PatchApplicationState
     {
@@ -211,6 +227,19 @@ namespace AZ::Dom
         //! \return an outcome with either the patched element or an error string
         PatchOutcome ApplyInPlaceAndDenormalize(Value& rootElement, StrategyFunctor strategy = PatchApplicationStrategy::HaltOnFailure);
 
+        //! Applies this patch to the given DOM element in place, in a single traversal.
+        //! The values targeted by the operations are cached by path, so operations that share a path prefix only
+        //! look the prefix up once instead of resolving every path from the root.
+        //! Operations are still applied in order, as array indices and Copy, Move and Test operations depend on
+        //! the operations before them.
+        //! \param rootElement The DOM element to patch.
+        //! \param inversePatch If provided, is set to a patch that reverts the operations that were successfully applied.
+        //! The inverse is generated while the patch is applied, it doesn't require a copy of the original DOM.
+        //! \param strategy A callback to be run after every patch application, see PatchApplicationState.
+        //! \return an outcome with success or an error string
+        PatchOutcome ApplyInPlaceBatched(
+            Value& rootElement, Patch* inversePatch = nullptr, StrategyFunctor strategy = PatchApplicationStrategy::HaltOnFailure) const;
+
         Value GetDomRepresentation() const;
         static AZ::Outcome<Patch, AZStd::string> CreateFromDomRepresentation(Value domValue);
 
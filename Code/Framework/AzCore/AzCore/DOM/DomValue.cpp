@@ -9,7 +9,9 @@
 #include <AzCore/DOM/DomPath.h>
 #include <AzCore/DOM/DomValue.h>
 #include <AzCore/DOM/DomValueWriter.h>
+#include <AzCore/std/functional_basic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/utility/as_const.h>
 
 namespace AZ::Dom
 {
@@ -29,6 +31,35 @@ namespace AZ::Dom
             }
         }
 
+        template<class ContainerType>
+        void EraseAndReserve(ContainerType& values, size_t eraseBegin, size_t eraseEnd, size_t reserveCapacity, bool reserveInPlace)
+        {
+            if (eraseBegin != eraseEnd)
+            {
+                values.erase(values.begin() + eraseBegin, values.begin() + eraseEnd);
+            }
+            if (reserveInPlace)
+            {
+                values.reserve(reserveCapacity);
+            }
+        }
+
+        template<class ContainerType>
+        void CopyAndReserve(ContainerType& result, const ContainerType& values, size_t eraseBegin, size_t eraseEnd, size_t reserveCapacity)
+        {
+            result.reserve(AZStd::max(reserveCapacity, values.size() - (eraseEnd - eraseBegin)));
+            result.insert(result.end(), values.begin(), values.begin() + eraseBegin);
+            result.insert(result.end(), values.begin() + eraseEnd, values.end());
+        }
+
+        // Checks if a range of values points into the storage of values
+        template<class ContainerType>
+        bool IsRangeInContainer(const ContainerType& values, const Value* first, const Value* last)
+        {
+            return first != last && !values.empty() && AZStd::less_equal<const Value*>()(values.data(), first) &&
+                AZStd::less<const Value*>()(first, values.data() + values.size());
+        }
+
         template<class TestType>
         constexpr size_t GetTypeIndexInternal(size_t index = 0);
 
@@ -526,6 +557,80 @@ namespace AZ::Dom
         }
     }
 
+    Object::ContainerType& Value::ResizeObjectInternal(size_t eraseBegin, size_t eraseEnd, size_t reserveCapacity, bool reserveInPlace)
+    {
+        const Type type = GetType();
+        AZ_Assert(
+            type == Type::Object || type == Type::Node,
+            "AZ::Dom::Value: attempted to retrieve an object from a value that isn't an object or a node");
+        if (type == Type::Object)
+        {
+            ObjectPtr& object = AZStd::get<ObjectPtr>(m_value);
+            if (object.use_count() == 1)
+            {
+                Internal::EraseAndReserve(object->m_values, eraseBegin, eraseEnd, reserveCapacity, reserveInPlace);
+                return object->m_values;
+            }
+
+            ObjectPtr newObject = AZStd::allocate_shared<Object>(ValueAllocator_for_std_t());
+            Internal::CopyAndReserve(newObject->m_values, object->m_values, eraseBegin, eraseEnd, reserveCapacity);
+            object = AZStd::move(newObject);
+            return object->m_values;
+        }
+        else
+        {
+            NodePtr& node = AZStd::get<NodePtr>(m_value);
+            if (node.use_count() == 1)
+            {
+                Internal::EraseAndReserve(node->m_properties, eraseBegin, eraseEnd, reserveCapacity, reserveInPlace);
+                return node->m_properties;
+            }
+
+            NodePtr newNode = AZStd::allocate_shared<Node>(ValueAllocator_for_std_t(), node->m_name);
+            newNode->m_children = node->m_children;
+            Internal::CopyAndReserve(newNode->m_properties, node->m_properties, eraseBegin, eraseEnd, reserveCapacity);
+            node = AZStd::move(newNode);
+            return node->m_properties;
+        }
+    }
+
+    Array::ContainerType& Value::ResizeArrayInternal(size_t eraseBegin, size_t eraseEnd, size_t reserveCapacity, bool reserveInPlace)
+    {
+        const Type type = GetType();
+        AZ_Assert(
+            type == Type::Array || type == Type::Node,
+            "AZ::Dom::Value: attempted to retrieve an array from a value that isn't an array or node");
+        if (type == Type::Array)
+        {
+            ArrayPtr& array = AZStd::get<ArrayPtr>(m_value);
+            if (array.use_count() == 1)
+            {
+                Internal::EraseAndReserve(array->m_values, eraseBegin, eraseEnd, reserveCapacity, reserveInPlace);
+                return array->m_values;
+            }
+
+            ArrayPtr newArray = AZStd::allocate_shared<Array>(ValueAllocator_for_std_t());
+            Internal::CopyAndReserve(newArray->m_values, array->m_values, eraseBegin, eraseEnd, reserveCapacity);
+            array = AZStd::move(newArray);
+            return array->m_values;
+        }
+        else
+        {
+            NodePtr& node = AZStd::get<NodePtr>(m_value);
+            if (node.use_count() == 1)
+            {
+                Internal::EraseAndReserve(node->m_children, eraseBegin, eraseEnd, reserveCapacity, reserveInPlace);
+                return node->m_children;
+            }
+
+            NodePtr newNode = AZStd::allocate_shared<Node>(ValueAllocator_for_std_t(), node->m_name);
+            newNode->m_properties = node->m_properties;
+            Internal::CopyAndReserve(newNode->m_children, node->m_children, eraseBegin, eraseEnd, reserveCapacity);
+            node = AZStd::move(newNode);
+            return node->m_children;
+        }
+    }
+
     size_t Value::MemberCount() const
     {
         return GetObjectInternal().size();
@@ -543,19 +648,16 @@ namespace AZ::Dom
 
     Value& Value::operator[](KeyType name)
     {
-        Object::ContainerType& object = GetObjectInternal();
-        auto existingEntry = AZStd::find_if(
-            object.begin(), object.end(),
-            [&name](const Object::EntryType& entry)
-            {
-                return entry.first == name;
-            });
-        if (existingEntry != object.end())
+        // Look the member up before detaching, so a shared object is only copied once, with room for a new member
+        const size_t memberCount = MemberCount();
+        const size_t memberIndex = FindMember(name) - MemberBegin();
+        if (memberIndex != memberCount)
         {
-            return existingEntry->second;
+            return GetObjectInternal()[memberIndex].second;
         }
         else
         {
+            Object::ContainerType& object = ResizeObjectInternal(memberCount, memberCount, memberCount + 1, false);
             object.emplace_back(name, Value());
             return object[object.size() - 1].second;
         }
@@ -630,7 +732,8 @@ namespace AZ::Dom
 
     Value& Value::MemberReserve(size_t newCapacity)
     {
-        GetObjectInternal().reserve(newCapacity);
+        const size_t memberCount = MemberCount();
+        ResizeObjectInternal(memberCount, memberCount, newCapacity);
         return *this;
     }
 
@@ -646,16 +749,17 @@ namespace AZ::Dom
 
     Value& Value::AddMember(KeyType name, Value value)
     {
-        Object::ContainerType& object = GetObjectInternal();
-        // Reserve in ReserveIncrement chunks instead of the default vector doubling strategy
-        // Profiling has found that this is an aggregate performance gain for typical workflows
-        object.reserve(AZ_SIZE_ALIGN_UP(object.size() + 1, Object::ReserveIncrement));
-        if (auto memberIt = FindMutableMember(name); memberIt != object.end())
+        const size_t memberCount = MemberCount();
+        if (const size_t memberIndex = FindMember(name) - MemberBegin(); memberIndex != memberCount)
         {
-            memberIt->second = AZStd::move(value);
+            GetObjectInternal()[memberIndex].second = AZStd::move(value);
         }
         else
         {
+            // Reserve in ReserveIncrement chunks instead of the default vector doubling strategy
+            // Profiling has found that this is an aggregate performance gain for typical workflows
+            Object::ContainerType& object =
+                ResizeObjectInternal(memberCount, memberCount, AZ_SIZE_ALIGN_UP(memberCount + 1, Object::ReserveIncrement));
             object.emplace_back(AZStd::move(name), AZStd::move(value));
         }
         return *this;
@@ -668,18 +772,12 @@ namespace AZ::Dom
 
     void Value::RemoveAllMembers()
     {
-        GetObjectInternal().clear();
+        ResizeObjectInternal(0, MemberCount(), 0);
     }
 
     void Value::RemoveMember(KeyType name)
     {
-        Object::ContainerType& object = GetObjectInternal();
-        object.erase(AZStd::remove_if(
-            object.begin(), object.end(),
-            [&name](const Object::EntryType& entry)
-            {
-                return entry.first == name;
-            }));
+        EraseMember(name);
     }
 
     void Value::RemoveMember(AZStd::string_view name)
@@ -700,17 +798,24 @@ namespace AZ::Dom
 
     Object::Iterator Value::EraseMember(Object::Iterator pos)
     {
-        return GetObjectInternal().erase(pos);
+        return EraseMember(pos, pos + 1);
     }
 
     Object::Iterator Value::EraseMember(Object::Iterator first, Object::Iterator last)
     {
-        return GetObjectInternal().erase(first, last);
+        const size_t eraseBegin = Object::ConstIterator(first) - MemberBegin();
+        const size_t eraseEnd = Object::ConstIterator(last) - MemberBegin();
+        return ResizeObjectInternal(eraseBegin, eraseEnd, 0).begin() + eraseBegin;
     }
 
     Object::Iterator Value::EraseMember(KeyType name)
     {
-        return GetObjectInternal().erase(FindMember(name));
+        const size_t memberIndex = FindMember(name) - MemberBegin();
+        if (memberIndex == MemberCount())
+        {
+            return GetObjectInternal().end();
+        }
+        return ResizeObjectInternal(memberIndex, memberIndex + 1, 0).begin() + memberIndex;
     }
 
     Object::Iterator Value::EraseMember(AZStd::string_view name)
@@ -751,7 +856,7 @@ namespace AZ::Dom
 
     void Value::ClearArray()
     {
-        GetArrayInternal().clear();
+        ResizeArrayInternal(0, ArraySize(), 0);
     }
 
     Value& Value::operator[](size_t index)
@@ -796,54 +901,84 @@ namespace AZ::Dom
 
     Value& Value::ArrayReserve(size_t newCapacity)
     {
-        GetArrayInternal().reserve(newCapacity);
+        const size_t size = ArraySize();
+        ResizeArrayInternal(size, size, newCapacity);
         return *this;
     }
 
     Value& Value::ArrayPushBack(Value value)
     {
-        Array::ContainerType& array = GetArrayInternal();
         // Reserve in ReserveIncremenet chunks instead of the default vector doubling strategy
         // Profiling has found that this is an aggregate performance gain for typical workflows
-        array.reserve(AZ_SIZE_ALIGN_UP(array.size() + 1, Array::ReserveIncrement));
+        const size_t size = ArraySize();
+        Array::ContainerType& array = ResizeArrayInternal(size, size, AZ_SIZE_ALIGN_UP(size + 1, Array::ReserveIncrement));
         array.push_back(AZStd::move(value));
         return *this;
     }
 
     Value& Value::ArrayPopBack()
     {
-        GetArrayInternal().pop_back();
+        const size_t size = ArraySize();
+        ResizeArrayInternal(size - 1, size, 0);
         return *this;
     }
 
     Array::Iterator Value::ArrayInsertRange(Array::ConstIterator insertPos, AZStd::span<Value> values)
     {
-        return GetArrayInternal().insert(insertPos, values.begin(), values.end());
+        if (Internal::IsRangeInContainer(AZStd::as_const(*this).GetArrayInternal(), values.data(), values.data() + values.size()))
+        {
+            // Growing the array may free the storage the values are in, so insert a copy of them instead
+            Array::ContainerType valuesCopy(values.begin(), values.end());
+            return ArrayInsertRange(insertPos, valuesCopy);
+        }
+
+        const size_t size = ArraySize();
+        const size_t insertIndex = insertPos - ArrayBegin();
+        Array::ContainerType& array = ResizeArrayInternal(size, size, size + values.size(), false);
+        return array.insert(array.begin() + insertIndex, values.begin(), values.end());
     }
 
     Array::Iterator Value::ArrayInsert(Array::ConstIterator insertPos, Array::ConstIterator first, Array::ConstIterator last)
     {
-        return GetArrayInternal().insert(insertPos, first, last);
+        if (first != last && Internal::IsRangeInContainer(AZStd::as_const(*this).GetArrayInternal(), &*first, &*first + AZStd::distance(first, last)))
+        {
+            // Growing the array may free the storage the range is in, so insert a copy of it instead
+            Array::ContainerType valuesCopy(first, last);
+            return ArrayInsertRange(insertPos, valuesCopy);
+        }
+
+        const size_t size = ArraySize();
+        const size_t insertIndex = insertPos - ArrayBegin();
+        Array::ContainerType& array = ResizeArrayInternal(size, size, size + AZStd::distance(first, last), false);
+        return array.insert(array.begin() + insertIndex, first, last);
     }
 
     Array::Iterator Value::ArrayInsert(Array::ConstIterator insertPos, AZStd::initializer_list<Value> initList)
     {
-        return GetArrayInternal().insert(insertPos, initList);
+        const size_t size = ArraySize();
+        const size_t insertIndex = insertPos - ArrayBegin();
+        Array::ContainerType& array = ResizeArrayInternal(size, size, size + initList.size(), false);
+        return array.insert(array.begin() + insertIndex, initList);
     }
 
     Array::Iterator Value::ArrayInsert(Array::ConstIterator insertPos, Value value)
     {
-        return GetArrayInternal().insert(insertPos, value);
+        const size_t size = ArraySize();
+        const size_t insertIndex = insertPos - ArrayBegin();
+        Array::ContainerType& array = ResizeArrayInternal(size, size, size + 1, false);
+        return array.insert(array.begin() + insertIndex, AZStd::move(value));
     }
 
     Array::Iterator Value::ArrayErase(Array::Iterator pos)
     {
-        return GetArrayInternal().erase(pos);
+        return ArrayErase(pos, pos + 1);
     }
 
     Array::Iterator Value::ArrayErase(Array::Iterator first, Array::Iterator last)
     {
-        return GetArrayInternal().erase(first, last);
+        const size_t eraseBegin = Array::ConstIterator(first) - ArrayBegin();
+        const size_t eraseEnd = Array::ConstIterator(last) - ArrayBegin();
+        return ResizeArrayInternal(eraseBegin, eraseEnd, 0).begin() + eraseBegin;
     }
 
     Array::ContainerType& Value::GetMutableArray()
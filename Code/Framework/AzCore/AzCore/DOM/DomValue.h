@@ -411,6 +411,12 @@ namespace AZ::Dom
         Object::ContainerType& GetObjectInternal();
         const Array::ContainerType& GetArrayInternal() const;
         Array::ContainerType& GetArrayInternal();
+        //! Mutable access for operations that change the size of the container.
+        //! Removes the entries in [eraseBegin, eraseEnd) and ensures there's capacity for reserveCapacity entries. If the container
+        //! is shared, only the entries that are kept get copied, directly into storage of the requested capacity.
+        //! If reserveInPlace is false, a container that isn't shared keeps its capacity, so inserting into it grows it geometrically.
+        Object::ContainerType& ResizeObjectInternal(size_t eraseBegin, size_t eraseEnd, size_t reserveCapacity, bool reserveInPlace = true);
+        Array::ContainerType& ResizeArrayInternal(size_t eraseBegin, size_t eraseEnd, size_t reserveCapacity, bool reserveInPlace = true);
 
         explicit Value(AZStd::any opaqueValue);
 
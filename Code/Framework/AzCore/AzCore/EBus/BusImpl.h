@@ -857,6 +857,7 @@ namespace AZ
         }
 
 #undef EBUS_DO_ROUTING
+#undef EBUS_DO_SNAPSHOT_DISPATCH
 
         template <class Bus, class Traits>
         template <class Function, class ... InputArgs>
@@ -206,6 +206,20 @@ namespace AZ
         */
         static constexpr bool LocklessDispatch = false;
 
+        /**
+        * Determines whether dispatches iterate over a flat snapshot of the connected handlers instead of the handler storage.
+        * The snapshot is rebuilt under the dispatch lock on the first dispatch after a connect or disconnect; while it is up to
+        * date, dispatches don't lock the context mutex at all. This suits hot buses with many handlers that rarely change,
+        * such as per-frame notification buses.
+        * Only supported with EBusHandlerPolicy::Multiple or EBusHandlerPolicy::MultipleAndOrdered, and not with LocklessDispatch.
+        * Limitations:
+        * - Handlers connected during a dispatch are not called by any dispatch nested in it, even on other addresses.
+        * - A handler disconnecting from another thread than the dispatching ones waits for the dispatches in progress once
+        *   it released the context mutex, so it must not disconnect while holding the context mutex in another way.
+        * - Events are not routed while the snapshot is used, so the snapshot is bypassed while routers are connected.
+        */
+        static constexpr bool EnableDispatchSnapshot = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -592,6 +606,10 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::EnableDispatchSnapshot || BusTraits::HandlerPolicy != EBusHandlerPolicy::Single),
+            "EnableDispatchSnapshot requires EBusHandlerPolicy::Multiple or EBusHandlerPolicy::MultipleAndOrdered!");
+        static_assert((!BusTraits::EnableDispatchSnapshot || !BusTraits::LocklessDispatch),
+            "EnableDispatchSnapshot can't be combined with LocklessDispatch, the snapshot already lets dispatches run without locking!");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -617,8 +635,16 @@ namespace AZ
          * Disconnects a handler from an EBus address without locking the mutex
          * Only call this if the context mutex is held already
          * @param handler The handler to disconnect from the EBus address.
+         * @return True if WaitForDisconnectedHandlers must be called once the context mutex is released.
+         */
+        static bool DisconnectInternal(Context& context, HandlerNode& handler);
+
+        /**
+         * Waits for the dispatches on other threads that may still call handlers disconnected by DisconnectInternal.
+         * Only needed on buses with a dispatch snapshot. Must be called after releasing the context mutex, since those
+         * dispatches may need it to connect or disconnect handlers themselves.
          */
-        static void DisconnectInternal(Context& context, HandlerNode& handler);
+        static void WaitForDisconnectedHandlers(Context& context);
         /// @endcond
 
         /**
@@ -1100,6 +1126,10 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual connection
         context.m_buses.Connect(handler, id);
+        if constexpr (Traits::EnableDispatchSnapshot)
+        {
+            context.m_buses.m_dispatchSnapshot.Invalidate();
+        }
 
         BusPtr ptr;
         if constexpr (EBus::HasId)
@@ -1119,9 +1149,16 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
         // To call Disconnect() from a message while being thread safe, you need to make sure the context.m_contextMutex is AZStd::recursive_mutex. Otherwise, a deadlock will occur.
         if (Context* context = GetContext())
         {
-            // scoped lock guard in case of exception / other odd situation
-            ConnectLockGuard lock(context->m_contextMutex);
-            DisconnectInternal(*context, handler);
+            bool waitForDispatches = false;
+            {
+                // scoped lock guard in case of exception / other odd situation
+                ConnectLockGuard lock(context->m_contextMutex);
+                waitForDispatches = DisconnectInternal(*context, handler);
+            }
+            if (waitForDispatches)
+            {
+                WaitForDisconnectedHandlers(*context);
+            }
         }
     }
 
@@ -1129,7 +1166,7 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
     // DisconnectInternal
     //=========================================================================
     template<class Interface, class Traits>
-    inline void EBus<Interface, Traits>::DisconnectInternal(Context& context, HandlerNode& handler)
+    inline bool EBus<Interface, Traits>::DisconnectInternal(Context& context, HandlerNode& handler)
     {
         // To call this while executing a message, you need to make sure this mutex is AZStd::recursive_mutex. Otherwise, a deadlock will occur.
         AZ_Assert(!Traits::LocklessDispatch || !IsInDispatch(&context), "It is not safe to disconnect during dispatch on a lockless dispatch EBus");
@@ -1140,6 +1177,13 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
             callstack->OnRemoveHandler(handler);
         }
 
+        bool waitForDispatches = false;
+        if constexpr (Traits::EnableDispatchSnapshot)
+        {
+            // Must happen before the callstack entry below, which would make this thread look like it's dispatching
+            waitForDispatches = context.m_buses.m_dispatchSnapshot.RemoveHandler(handler, IsInDispatchThisThread(&context));
+        }
+
         BusPtr ptr;
         if constexpr (EBus::HasId)
         {
@@ -1158,6 +1202,19 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
         }
 
         handler = nullptr;
+        return waitForDispatches;
+    }
+
+    //=========================================================================
+    // WaitForDisconnectedHandlers
+    //=========================================================================
+    template<class Interface, class Traits>
+    inline void EBus<Interface, Traits>::WaitForDisconnectedHandlers([[maybe_unused]] Context& context)
+    {
+        if constexpr (Traits::EnableDispatchSnapshot)
+        {
+            context.m_buses.m_dispatchSnapshot.WaitForReaders();
+        }
     }
 
 AZ_POP_DISABLE_WARNING
@@ -1411,10 +1468,17 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
-                if (BusIsConnected())
+                bool waitForDispatches = false;
                 {
-                    BusType::DisconnectInternal(*context, m_node);
+                    typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
+                    if (BusIsConnected())
+                    {
+                        waitForDispatches = BusType::DisconnectInternal(*context, m_node);
+                    }
+                }
+                if (waitForDispatches)
+                {
+                    BusType::WaitForDisconnectedHandlers(*context);
                 }
             }
         }
@@ -1425,30 +1489,44 @@ AZ_POP_DISABLE_WARNING
         void IdHandler<Interface, Traits, ContainerType>::BusConnect(const IdType& id)
         {
             typename BusType::Context& context = BusType::GetOrCreateContext();
-            typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
-            if (BusIsConnected())
+            bool waitForDispatches = false;
             {
-                // Connecting on the BusId that is already connected is a no-op
-                if (m_node.GetBusId() == id)
+                typename BusType::Context::ConnectLockGuard contextLock(context.m_contextMutex);
+                if (BusIsConnected())
                 {
-                    return;
+                    // Connecting on the BusId that is already connected is a no-op
+                    if (m_node.GetBusId() == id)
+                    {
+                        return;
+                    }
+                    AZ_Assert(false, "Connecting to a different id on this bus without disconnecting first! Please ensure you call BusDisconnect before calling BusConnect again, or if multiple connections are desired you must use a MultiHandler instead.");
+                    waitForDispatches = BusType::DisconnectInternal(context, m_node);
                 }
-                AZ_Assert(false, "Connecting to a different id on this bus without disconnecting first! Please ensure you call BusDisconnect before calling BusConnect again, or if multiple connections are desired you must use a MultiHandler instead.");
-                BusType::DisconnectInternal(context, m_node);
-            }
 
-            m_node = this;
-            BusType::ConnectInternal(context, m_node, contextLock, id);
+                m_node = this;
+                BusType::ConnectInternal(context, m_node, contextLock, id);
+            }
+            if (waitForDispatches)
+            {
+                BusType::WaitForDisconnectedHandlers(context);
+            }
         }
         template <typename Interface, typename Traits, typename ContainerType>
         void IdHandler<Interface, Traits, ContainerType>::BusDisconnect(const IdType& id)
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
-                if (BusIsConnectedId(id))
+                bool waitForDispatches = false;
                 {
-                    BusType::DisconnectInternal(*context, m_node);
+                    typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
+                    if (BusIsConnectedId(id))
+                    {
+                        waitForDispatches = BusType::DisconnectInternal(*context, m_node);
+                    }
+                }
+                if (waitForDispatches)
+                {
+                    BusType::WaitForDisconnectedHandlers(*context);
                 }
             }
         }
@@ -1457,10 +1535,17 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
-                if (BusIsConnected())
+                bool waitForDispatches = false;
                 {
-                    BusType::DisconnectInternal(*context, m_node);
+                    typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
+                    if (BusIsConnected())
+                    {
+                        waitForDispatches = BusType::DisconnectInternal(*context, m_node);
+                    }
+                }
+                if (waitForDispatches)
+                {
+                    BusType::WaitForDisconnectedHandlers(*context);
                 }
             }
         }
@@ -1485,15 +1570,22 @@ AZ_POP_DISABLE_WARNING
         {
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
-                auto nodeIt = m_handlerNodes.find(id);
-                if (nodeIt != m_handlerNodes.end())
+                bool waitForDispatches = false;
                 {
-                    HandlerNode* handlerNode = nodeIt->second;
-                    BusType::DisconnectInternal(*context, *handlerNode);
-                    m_handlerNodes.erase(nodeIt);
-                    handlerNode->~HandlerNode();
-                    m_handlerNodes.get_allocator().deallocate(handlerNode, sizeof(HandlerNode), alignof(HandlerNode));
+                    typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
+                    auto nodeIt = m_handlerNodes.find(id);
+                    if (nodeIt != m_handlerNodes.end())
+                    {
+                        HandlerNode* handlerNode = nodeIt->second;
+                        waitForDispatches = BusType::DisconnectInternal(*context, *handlerNode);
+                        m_handlerNodes.erase(nodeIt);
+                        handlerNode->~HandlerNode();
+                        m_handlerNodes.get_allocator().deallocate(handlerNode, sizeof(HandlerNode), alignof(HandlerNode));
+                    }
+                }
+                if (waitForDispatches)
+                {
+                    BusType::WaitForDisconnectedHandlers(*context);
                 }
             }
         }
@@ -1503,15 +1595,22 @@ AZ_POP_DISABLE_WARNING
             decltype(m_handlerNodes) handlerNodesToDisconnect;
             if (typename BusType::Context* context = BusType::GetContext())
             {
-                typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
-                handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
-
-                for (const auto& nodePair : handlerNodesToDisconnect)
+                bool waitForDispatches = false;
                 {
-                    BusType::DisconnectInternal(*context, *nodePair.second);
+                    typename BusType::Context::ConnectLockGuard contextLock(context->m_contextMutex);
+                    handlerNodesToDisconnect = AZStd::move(m_handlerNodes);
 
-                    nodePair.second->~HandlerNode();
-                    handlerNodesToDisconnect.get_allocator().deallocate(nodePair.second, sizeof(HandlerNode), AZStd::alignment_of<HandlerNode>::value);
+                    for (const auto& nodePair : handlerNodesToDisconnect)
+                    {
+                        waitForDispatches |= BusType::DisconnectInternal(*context, *nodePair.second);
+
+                        nodePair.second->~HandlerNode();
+                        handlerNodesToDisconnect.get_allocator().deallocate(nodePair.second, sizeof(HandlerNode), AZStd::alignment_of<HandlerNode>::value);
+                    }
+                }
+                if (waitForDispatches)
+                {
+                    BusType::WaitForDisconnectedHandlers(*context);
                 }
             }
         }
@@ -1913,6 +2012,11 @@ AZ_POP_DISABLE_WARNING
                 {
                     AZStd::scoped_lock<decltype(context.m_contextMutex)> lock(context.m_contextMutex);
                     context.m_routing.m_routers.insert(&m_routerNode);
+                    if constexpr (EBus::Traits::EnableDispatchSnapshot)
+                    {
+                        // Events must go through the routers from now on
+                        context.m_buses.m_dispatchSnapshot.Discard();
+                    }
                 }
                 m_isConnected = true;
             }
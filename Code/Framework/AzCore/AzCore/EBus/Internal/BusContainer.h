@@ -12,6 +12,7 @@
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
 
 #include <AzCore/EBus/Internal/CallstackEntry.h>
+#include <AzCore/EBus/Internal/DispatchSnapshot.h>
 #include <AzCore/EBus/Internal/Handlers.h>
 #include <AzCore/EBus/Internal/StoragePolicies.h>
 #include <AzCore/EBus/Internal/Debug.h>
@@ -80,6 +81,17 @@ namespace AZ
         }                                                                                       \
     } while(false)
 
+// Dispatches through the handler snapshot on buses that set EnableDispatchSnapshot, and returns if the snapshot was usable
+#define EBUS_DO_SNAPSHOT_DISPATCH(contextParam, id, isReverse, ...)                                  \
+    do {                                                                                            \
+        if constexpr (Traits::EnableDispatchSnapshot) {                                             \
+            auto* local_context = (contextParam);                                                   \
+            if (local_context->m_buses.template TrySnapshotDispatch<Bus>(local_context, id, isReverse, __VA_ARGS__)) { \
+                return;                                                                             \
+            }                                                                                       \
+        }                                                                                           \
+    } while(false)
+
         // Default impl, used when there are multiple addresses and multiple handlers
         template <typename Interface, typename Traits, EBusAddressPolicy addressPolicy = Traits::AddressPolicy, EBusHandlerPolicy handlerPolicy = Traits::HandlerPolicy>
         struct EBusContainer
@@ -115,7 +127,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &id, false, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -158,7 +172,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &id, false, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, &id, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -201,7 +217,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &id, true, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -230,7 +248,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &id, true, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, &id, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -261,7 +281,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &busPtr->m_busId, false, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -297,7 +319,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &busPtr->m_busId, false, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
@@ -333,7 +357,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &busPtr->m_busId, true, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -355,7 +381,9 @@ namespace AZ
                     {
                         auto* context = Bus::GetContext();
                         EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &busPtr->m_busId, true, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, true);
 
@@ -377,7 +405,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, false, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -423,7 +453,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, false, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -469,7 +501,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, true, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -527,7 +561,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, true, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& addresses = context->m_buses.m_addresses;
@@ -587,7 +623,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, false, [&](Interface* handler)
+                            {
+                                bool result = false;
+                                Traits::EventProcessingPolicy::CallResult(result, callback, handler);
+                                return result;
+                            });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.begin();
@@ -606,7 +649,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, &id, false, [&](Interface* handler)
+                            {
+                                bool result = false;
+                                Traits::EventProcessingPolicy::CallResult(result, callback, handler);
+                                return result;
+                            });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         auto& addresses = context->m_buses.m_addresses;
                         auto addressIt = addresses.find(id);
@@ -621,7 +671,17 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        if (ptr)
+                        {
+                            EBUS_DO_SNAPSHOT_DISPATCH(context, &ptr->m_busId, false, [&](Interface* handler)
+                                {
+                                    bool result = false;
+                                    Traits::EventProcessingPolicy::CallResult(result, callback, handler);
+                                    return result;
+                                });
+                        }
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         if (ptr)
                         {
@@ -758,7 +818,41 @@ namespace AZ
                 handler.m_holder.reset();
             }
 
+            // Returns false if the dispatch snapshot can't be used, in which case nothing was called
+            template <typename Bus, typename Callback>
+            static bool TrySnapshotDispatch(typename Bus::Context* context, const IdType* id, bool reverse, Callback&& callback)
+            {
+                return context->m_buses.m_dispatchSnapshot.template Dispatch<Bus>(context, id, reverse, Bus::IsInDispatchThisThread(context), callback);
+            }
+
+            // Rebuilds the dispatch snapshot if a handler connected or disconnected since it was built. Requires the dispatch lock.
+            template <typename Context>
+            void UpdateDispatchSnapshot(Context& context)
+            {
+                if constexpr (Traits::EnableDispatchSnapshot)
+                {
+                    if (!m_dispatchSnapshot.IsUpToDate() && context.m_routing.m_routers.empty())
+                    {
+                        m_dispatchSnapshot.Rebuild([this](auto& image)
+                            {
+                                for (HandlerHolder& holder : m_addresses)
+                                {
+                                    if (holder.HasHandlers())
+                                    {
+                                        image.AddAddress(holder.m_busId);
+                                        for (HandlerNode& handler : holder.m_handlers)
+                                        {
+                                            image.AddHandler(handler.m_interface);
+                                        }
+                                    }
+                                }
+                            });
+                    }
+                }
+            }
+
             typename AddressStorage::StorageType m_addresses;
+            DispatchSnapshotType<Interface, Traits> m_dispatchSnapshot;
         };
 
         // Specialization for multi address, single handler
@@ -1336,7 +1430,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, false, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1371,7 +1467,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, false, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1406,7 +1504,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, true, [&](Interface* handler) { Traits::EventProcessingPolicy::Call(func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1427,7 +1527,9 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, true, [&](Interface* handler) { Traits::EventProcessingPolicy::CallResult(results, func, handler, args...); return true; });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
                         auto& handlers = context->m_buses.m_handlers;
@@ -1450,7 +1552,14 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SNAPSHOT_DISPATCH(context, nullptr, false, [&](Interface* handler)
+                            {
+                                bool result = false;
+                                Traits::EventProcessingPolicy::CallResult(result, callback, handler);
+                                return result;
+                            });
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                        context->m_buses.UpdateDispatchSnapshot(*context);
 
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
@@ -1496,7 +1605,34 @@ namespace AZ
                 m_handlers.erase(handler);
             }
 
+            // Returns false if the dispatch snapshot can't be used, in which case nothing was called
+            template <typename Bus, typename Callback>
+            static bool TrySnapshotDispatch(typename Bus::Context* context, const IdType* id, bool reverse, Callback&& callback)
+            {
+                return context->m_buses.m_dispatchSnapshot.template Dispatch<Bus>(context, id, reverse, Bus::IsInDispatchThisThread(context), callback);
+            }
+
+            // Rebuilds the dispatch snapshot if a handler connected or disconnected since it was built. Requires the dispatch lock.
+            template <typename Context>
+            void UpdateDispatchSnapshot(Context& context)
+            {
+                if constexpr (Traits::EnableDispatchSnapshot)
+                {
+                    if (!m_dispatchSnapshot.IsUpToDate() && context.m_routing.m_routers.empty())
+                    {
+                        m_dispatchSnapshot.Rebuild([this](auto& image)
+                            {
+                                for (HandlerNode& handler : m_handlers)
+                                {
+                                    image.AddHandler(handler.m_interface);
+                                }
+                            });
+                    }
+                }
+            }
+
             typename HandlerStorage::StorageType m_handlers;
+            DispatchSnapshotType<Interface, Traits> m_dispatchSnapshot;
         };
 
         // Specialization for single address, single handler
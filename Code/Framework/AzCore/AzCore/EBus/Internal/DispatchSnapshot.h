@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/Policies.h>
+#include <AzCore/EBus/Internal/CallstackEntry.h>
+#include <AzCore/EBus/Internal/Debug.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Flat, contiguous copy of the handlers connected to a bus, used by buses that set EBusTraits::EnableDispatchSnapshot.
+         *
+         * The snapshot is built from the handler storage the first time the bus is dispatched to after a connect or disconnect,
+         * while the dispatch lock is held. As long as it stays up to date, dispatches iterate over an array of handler pointers
+         * without taking the context mutex.
+         *
+         * Readers register in one of two counters selected by the read epoch. A handler disconnecting from another thread flips
+         * the epoch and waits for the readers that could still be calling it, the same way the context mutex would have made it wait.
+         * The wait happens once the context mutex is released, so the readers can still connect and disconnect handlers.
+         * A disconnecting handler is also cleared from every snapshot that may still be in use, so a dispatch in progress on the
+         * same thread skips it.
+         *
+         * Dispatches nested inside a dispatch on the same bus never lock: if the snapshot is out of date they use the latest one.
+         * Handlers connected during the outer dispatch receive events starting with the next top level dispatch.
+         */
+        template <typename Interface, typename Traits>
+        class DispatchSnapshot
+        {
+        public:
+            using IdType = typename Traits::BusIdType;
+            using AllocatorType = typename Traits::AllocatorType;
+            static constexpr bool HasId = Traits::AddressPolicy != EBusAddressPolicy::Single;
+
+            // Handler pointer that can be cleared while other threads read it
+            struct HandlerSlot
+            {
+                HandlerSlot(Interface* handler)
+                    : m_handler(handler)
+                {}
+                HandlerSlot(const HandlerSlot& rhs)
+                    : m_handler(rhs.m_handler.load(AZStd::memory_order_relaxed))
+                {}
+                HandlerSlot& operator=(const HandlerSlot& rhs)
+                {
+                    m_handler.store(rhs.m_handler.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+                    return *this;
+                }
+
+                AZStd::atomic<Interface*> m_handler;
+            };
+
+            // Range of handlers in the snapshot connected to a single address
+            struct AddressRange
+            {
+                IdType m_busId;
+                size_t m_begin;
+                size_t m_end;
+            };
+
+            struct NoAddressLookup {};
+            using AddressLookup = AZStd::conditional_t<HasId,
+                AZStd::unordered_map<IdType, size_t, AZStd::hash<IdType>, AZStd::equal_to<IdType>, AllocatorType>,
+                NoAddressLookup>;
+
+            // A snapshot is never modified after it's published, apart from clearing the slot of a disconnected handler
+            struct Image
+            {
+                AZStd::vector<HandlerSlot, AllocatorType> m_handlers;
+                AZStd::vector<AddressRange, AllocatorType> m_addresses;
+                AddressLookup m_addressLookup;
+                Image* m_nextRetired = nullptr;
+
+                //! Starts a new address. Handlers added after this call belong to it.
+                void AddAddress([[maybe_unused]] const IdType& busId)
+                {
+                    if constexpr (HasId)
+                    {
+                        m_addressLookup.emplace(busId, m_addresses.size());
+                        m_addresses.push_back(AddressRange{ busId, m_handlers.size(), m_handlers.size() });
+                    }
+                }
+
+                void AddHandler(Interface* handler)
+                {
+                    m_handlers.emplace_back(handler);
+                    if constexpr (HasId)
+                    {
+                        m_addresses.back().m_end = m_handlers.size();
+                    }
+                }
+            };
+
+            DispatchSnapshot() = default;
+            DispatchSnapshot(const DispatchSnapshot&) = delete;
+            DispatchSnapshot& operator=(const DispatchSnapshot&) = delete;
+
+            ~DispatchSnapshot()
+            {
+                DestroyImage(m_latest.exchange(nullptr));
+                FreeRetired();
+            }
+
+            /**
+             * Calls @callback for every handler at @busId, or for every handler on the bus if @busId is null, without locking.
+             * @callback receives the handler interface pointer and returns false to stop the dispatch.
+             * @param allowOutOfDate Use the latest snapshot even if handlers connected since it was built.
+             * @return false if no usable snapshot exists. Nothing was called and the caller must use the locked path.
+             */
+            template <typename Bus, typename Callback>
+            bool Dispatch(typename Bus::Context* context, const IdType* busId, bool reverse, bool allowOutOfDate, Callback&& callback) const
+            {
+                const uint32_t epoch = BeginRead();
+                const Image* image = (allowOutOfDate || m_isUpToDate.load()) ? m_latest.load() : nullptr;
+                if (image == nullptr)
+                {
+                    EndRead(epoch);
+                    return false;
+                }
+
+                if constexpr (HasId)
+                {
+                    if (busId)
+                    {
+                        if (auto lookupIt = image->m_addressLookup.find(*busId); lookupIt != image->m_addressLookup.end())
+                        {
+                            const AddressRange& address = image->m_addresses[lookupIt->second];
+                            DispatchRange<Bus>(context, image, address, reverse, callback);
+                        }
+                    }
+                    else
+                    {
+                        const size_t addressCount = image->m_addresses.size();
+                        for (size_t index = 0; index < addressCount; ++index)
+                        {
+                            const AddressRange& address = image->m_addresses[reverse ? addressCount - 1 - index : index];
+                            if (!DispatchRange<Bus>(context, image, address, reverse, callback))
+                            {
+                                break;
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    DispatchRange<Bus>(context, image, AddressRange{ IdType{}, 0, image->m_handlers.size() }, reverse, callback);
+                }
+
+                EndRead(epoch);
+                return true;
+            }
+
+            /**
+             * Returns true if top level dispatches can currently use the snapshot.
+             */
+            bool IsUpToDate() const
+            {
+                return m_isUpToDate.load();
+            }
+
+            /**
+             * Builds a new snapshot. @populate is invoked with the Image to fill in dispatch order.
+             * The caller must hold the dispatch lock, so that the handler storage can't change while it's being copied.
+             */
+            template <typename PopulateFunction>
+            void Rebuild(PopulateFunction&& populate)
+            {
+                AZStd::scoped_lock lock(m_rebuildMutex);
+                if (m_isUpToDate.load())
+                {
+                    // Another dispatching thread already rebuilt it
+                    return;
+                }
+
+                AllocatorType allocator;
+                Image* image = new (allocator.allocate(sizeof(Image), alignof(Image))) Image();
+                populate(*image);
+
+                if (Image* previous = m_latest.exchange(image); previous != nullptr)
+                {
+                    previous->m_nextRetired = m_retired;
+                    m_retired = previous;
+                }
+                m_isUpToDate.store(true);
+
+                // Free the replaced snapshots if nobody can be using them anymore. Readers register before loading m_latest,
+                // so any reader that isn't counted yet will see the new snapshot.
+                // This can't wait for readers, as the rebuild can happen within a dispatch on this bus.
+                if (m_activeReaders[0].load() == 0 && m_activeReaders[1].load() == 0)
+                {
+                    FreeRetired();
+                }
+            }
+
+            /**
+             * Marks the snapshot as out of date after a handler connected. Must be called with the connect lock held.
+             */
+            void Invalidate()
+            {
+                m_isUpToDate.store(false);
+            }
+
+            /**
+             * Stops all dispatches, including nested ones, from using the snapshot until it's rebuilt.
+             * Used when a router connects, as routed events can't go through the snapshot. Must be called with the connect lock held.
+             */
+            void Discard()
+            {
+                AZStd::scoped_lock lock(m_rebuildMutex);
+                m_isUpToDate.store(false);
+                if (Image* previous = m_latest.exchange(nullptr); previous != nullptr)
+                {
+                    previous->m_nextRetired = m_retired;
+                    m_retired = previous;
+                }
+            }
+
+            /**
+             * Removes a disconnecting handler from every snapshot that may still be in use and marks the snapshot as out of date.
+             * Must be called with the connect lock held.
+             * @param isInDispatchThisThread true if this thread is dispatching on the bus, in which case it can't wait for readers.
+             * @return true if WaitForReaders must be called once the connect lock is released, before the handler is destroyed.
+             */
+            bool RemoveHandler(Interface* handler, bool isInDispatchThisThread)
+            {
+                AZStd::scoped_lock lock(m_rebuildMutex);
+                m_isUpToDate.store(false);
+                ClearHandler(m_latest.load(), handler);
+                for (Image* image = m_retired; image != nullptr; image = image->m_nextRetired)
+                {
+                    ClearHandler(image, handler);
+                }
+                return !isInDispatchThisThread;
+            }
+
+            /**
+             * Waits for the dispatches that started before the last call to RemoveHandler, which could have loaded the removed handler
+             * before its slot was cleared. Must be called without the connect lock, as those dispatches may need it.
+             */
+            void WaitForReaders()
+            {
+                // Concurrent waits are serialized, so a flip by another thread never leaves readers of this thread's removal behind
+                AZStd::scoped_lock lock(m_waitMutex);
+                const uint32_t previousEpoch = m_readEpoch.fetch_add(1) & 1;
+                while (m_activeReaders[previousEpoch].load() != 0)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+
+        private:
+            template <typename Bus, typename Callback>
+            static bool DispatchRange(typename Bus::Context* context, const Image* image, const AddressRange& address, bool reverse, Callback& callback)
+            {
+                // The callstack entry keeps GetCurrentBusId and IsInDispatchThisThread working for the handlers
+                AZ::Internal::CallstackEntry<Interface, Traits> entry(context, HasId ? &address.m_busId : nullptr);
+
+                const HandlerSlot* handlers = image->m_handlers.data();
+                const size_t count = address.m_end - address.m_begin;
+                for (size_t index = 0; index < count; ++index)
+                {
+                    const size_t slot = reverse ? address.m_end - 1 - index : address.m_begin + index;
+                    if (Interface* handler = handlers[slot].m_handler.load(AZStd::memory_order_relaxed); handler != nullptr)
+                    {
+                        if (!callback(handler))
+                        {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+
+            uint32_t BeginRead() const
+            {
+                while (true)
+                {
+                    const uint32_t epoch = m_readEpoch.load() & 1;
+                    m_activeReaders[epoch].fetch_add(1);
+                    // A writer that flipped the epoch in between may already have seen this counter drain
+                    if ((m_readEpoch.load() & 1) == epoch)
+                    {
+                        return epoch;
+                    }
+                    m_activeReaders[epoch].fetch_sub(1);
+                }
+            }
+
+            void EndRead(uint32_t epoch) const
+            {
+                m_activeReaders[epoch].fetch_sub(1);
+            }
+
+            static void ClearHandler(Image* image, Interface* handler)
+            {
+                if (image != nullptr)
+                {
+                    for (HandlerSlot& slot : image->m_handlers)
+                    {
+                        if (slot.m_handler.load(AZStd::memory_order_relaxed) == handler)
+                        {
+                            slot.m_handler.store(nullptr, AZStd::memory_order_relaxed);
+                        }
+                    }
+                }
+            }
+
+            // Must be called with m_rebuildMutex held, or from the destructor
+            void FreeRetired()
+            {
+                while (m_retired != nullptr)
+                {
+                    Image* next = m_retired->m_nextRetired;
+                    DestroyImage(m_retired);
+                    m_retired = next;
+                }
+            }
+
+            static void DestroyImage(Image* image)
+            {
+                if (image != nullptr)
+                {
+                    image->~Image();
+                    AllocatorType allocator;
+                    allocator.deallocate(image, sizeof(Image), alignof(Image));
+                }
+            }
+
+            //! Most recently built snapshot. Once built, there is always one so nested dispatches never need to lock.
+            AZStd::atomic<Image*> m_latest{ nullptr };
+            AZStd::atomic_bool m_isUpToDate{ false };
+            //! Snapshots replaced while they might still be in use by a dispatch
+            Image* m_retired = nullptr;
+            AZStd::mutex m_rebuildMutex;
+
+            AZStd::mutex m_waitMutex;
+
+            mutable AZStd::atomic<uint32_t> m_readEpoch{ 0 };
+            mutable AZStd::atomic<uint32_t> m_activeReaders[2]{};
+        };
+
+        //! Placeholder stored by buses that don't enable the dispatch snapshot
+        struct NullDispatchSnapshot
+        {
+        };
+
+        template <typename Interface, typename Traits>
+        using DispatchSnapshotType = AZStd::conditional_t<Traits::EnableDispatchSnapshot, DispatchSnapshot<Interface, Traits>, NullDispatchSnapshot>;
+    } // namespace Internal
+} // namespace AZ
@@ -26,6 +26,8 @@ namespace AZ::IO
         m_conflictResolution = rhs.m_conflictResolution;
         m_isCompressed = rhs.m_isCompressed;
         m_isSharedPak = rhs.m_isSharedPak;
+        m_blockSize = rhs.m_blockSize;
+        m_blocks = AZStd::move(rhs.m_blocks);
 
         return *this;
     }
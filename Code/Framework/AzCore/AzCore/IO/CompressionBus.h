@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string_view.h>
@@ -31,6 +32,16 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Location of a block of a file that was compressed independently of the other blocks of that file.
+        struct CompressedBlock
+        {
+            //! Offset of the compressed block relative to the start of the file in the archive.
+            size_t m_offset = 0;
+            //! Exact size of the compressed block. Blocks can be padded in the archive, so this can be smaller than the distance
+            //! to the next block.
+            size_t m_compressedSize = 0;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -61,6 +72,12 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Uncompressed size of the blocks the file was split into before compressing, with only the last block allowed to be
+            //! smaller. If zero the file was compressed as a single unit.
+            size_t m_blockSize = 0;
+            //! The compressed blocks of the file in order if m_blockSize isn't zero. Every block can be decompressed on its own with
+            //! m_decompressor, which allows partial reads to only read and decompress the blocks that overlap with the read.
+            AZStd::vector<CompressedBlock> m_blocks;
         };
 
         class Compression
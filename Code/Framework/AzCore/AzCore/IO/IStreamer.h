@@ -340,12 +340,19 @@ namespace AZ::IO
 
         //! Get the result for operations that read data.
         //! @param request The request to query.
-        //! @param buffer The buffer the data was written to.
+        //! @param buffer The buffer the data was written to. If the request was completed with a mapped view, this points to read-only
+        //!         memory that stays valid until the request is released. Memory from mapped views can't be claimed.
         //! @param numBytesRead The total number of bytes that were read from the file.
         //! @return True if data could be retrieved, otherwise false.
         virtual bool GetReadRequestResult(FileRequestHandle request, void*& buffer, u64& numBytesRead,
             IStreamerTypes::ClaimMemory claimMemory = IStreamerTypes::ClaimMemory::No) const = 0;
 
+        //! Get the type of memory the result of a read request is stored in.
+        //! @param request The request to query.
+        //! @return The memory type of the buffer returned by GetReadRequestResult. If the memory type is MappedView the buffer
+        //!         can't be claimed and the request needs to be kept alive for as long as the buffer is used.
+        virtual IStreamerTypes::MemoryType GetReadRequestMemoryType(FileRequestHandle request) const = 0;
+
         //
         // General Streamer functions
         //
@@ -21,8 +21,9 @@ namespace AZ::IO::IStreamerTypes
         : m_allocator(AZ::AllocatorInstance<AZ::SystemAllocator>::Get())
     {}
 
-    DefaultRequestMemoryAllocator::DefaultRequestMemoryAllocator(AZ::IAllocator& allocator)
+    DefaultRequestMemoryAllocator::DefaultRequestMemoryAllocator(AZ::IAllocator& allocator, bool acceptsMappedViews)
         : m_allocator(allocator)
+        , m_acceptsMappedViews(acceptsMappedViews)
     {}
 
     DefaultRequestMemoryAllocator::~DefaultRequestMemoryAllocator()
@@ -72,6 +73,11 @@ namespace AZ::IO::IStreamerTypes
         }
     }
 
+    bool DefaultRequestMemoryAllocator::AcceptsMappedViews() const
+    {
+        return m_acceptsMappedViews;
+    }
+
     int DefaultRequestMemoryAllocator::GetNumLocks() const
     {
         return m_lockCounter;
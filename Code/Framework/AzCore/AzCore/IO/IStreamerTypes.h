@@ -81,7 +81,9 @@ namespace AZ::IO::IStreamerTypes
     enum class MemoryType : u8
     {
         ReadWrite, //!< General purpose memory.
-        WriteCombined //!< Reading back from memory with this flag will be avoided. This may require additional temporary buffers.
+        WriteCombined, //!< Reading back from memory with this flag will be avoided. This may require additional temporary buffers.
+        MappedView //!< Read-only view into memory owned by Streamer, such as a memory mapped archive. The view stays valid until the
+                   //!< request is released and can't be claimed.
     };
 
     enum class ClaimMemory : bool
@@ -129,6 +131,11 @@ namespace AZ::IO::IStreamerTypes
         //! Releases memory previously allocated by Allocate.
         //! @param address The address previously provided by Allocate.
         virtual void Release(void* address) = 0;
+
+        //! Whether or not the request can be completed with a read-only view into memory owned by Streamer instead of memory
+        //! from this allocator. If a view is provided the memory type of the request is set to MemoryType::MappedView and
+        //! Allocate will not be called for the request.
+        virtual bool AcceptsMappedViews() const { return false; }
     };
 
     //! Default memory allocator for file requests. This allocator is a wrapper around the standard memory allocator and can be used
@@ -139,7 +146,8 @@ namespace AZ::IO::IStreamerTypes
     public:
         //! DefaultRequestMemoryAllocator wraps around the AZ::SystemAllocator by default.
         DefaultRequestMemoryAllocator();
-        explicit DefaultRequestMemoryAllocator(AZ::IAllocator& allocator);
+        //! @param acceptsMappedViews If true, requests can be completed with read-only views instead of allocated memory.
+        explicit DefaultRequestMemoryAllocator(AZ::IAllocator& allocator, bool acceptsMappedViews = false);
         ~DefaultRequestMemoryAllocator() override;
 
         void LockAllocator() override;
@@ -147,6 +155,7 @@ namespace AZ::IO::IStreamerTypes
 
         RequestMemoryAllocatorResult Allocate(u64 minimalSize, u64 recommendeSize, size_t alignment) override;
         void Release(void* address) override;
+        bool AcceptsMappedViews() const override;
 
         int GetNumLocks() const;
 
@@ -154,13 +163,15 @@ namespace AZ::IO::IStreamerTypes
         AZStd::atomic_int m_lockCounter{ 0 };
         AZStd::atomic_int m_allocationCounter{ 0 };
         AZ::IAllocator& m_allocator;
+        bool m_acceptsMappedViews{ false };
     };
 
     //! The type of information that will be reported back from a call to Report.
     enum class ReportType : int8_t
     {
         Config,     //!< Report the configuration of stack.
-        FileLocks   //!< Report all file locks.
+        FileLocks,  //!< Report all file locks.
+        CacheHits   //!< Report the cache hits and misses per file. Each file is reported as "File" followed by its counters.
     };
 
     // The following alignment functions are put here until they're available in AzCore's math library.
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ::IO
+{
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs)
+        : m_data(AZStd::exchange(rhs.m_data, nullptr))
+        , m_size(AZStd::exchange(rhs.m_size, 0))
+        , m_platformHandle(AZStd::exchange(rhs.m_platformHandle, nullptr))
+    {
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Close();
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs)
+    {
+        if (this != &rhs)
+        {
+            Close();
+            m_data = AZStd::exchange(rhs.m_data, nullptr);
+            m_size = AZStd::exchange(rhs.m_size, 0);
+            m_platformHandle = AZStd::exchange(rhs.m_platformHandle, nullptr);
+        }
+        return *this;
+    }
+
+    bool MemoryMappedFile::Open(const char* filePath)
+    {
+        Close();
+        return PlatformOpen(filePath);
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if (m_data)
+        {
+            PlatformClose();
+            m_data = nullptr;
+            m_size = 0;
+            m_platformHandle = nullptr;
+        }
+    }
+
+    bool MemoryMappedFile::IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+
+    const u8* MemoryMappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    u64 MemoryMappedFile::GetSize() const
+    {
+        return m_size;
+    }
+
+    void MemoryMappedFile::Prefetch(u64 offset, u64 size) const
+    {
+        if (m_data && offset < m_size)
+        {
+            PlatformPrefetch(offset, AZStd::min(size, m_size - offset));
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ::IO
+{
+    //! Read-only mapping of an entire file into the address space of the process. Pages are loaded on first access and are
+    //! shared with the page cache of the OS, so reading from the mapping doesn't require an additional copy of the file data.
+    class MemoryMappedFile
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MemoryMappedFile, SystemAllocator);
+
+        MemoryMappedFile() = default;
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& rhs);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(MemoryMappedFile&& rhs);
+
+        //! Maps the file at the provided absolute path. Any previously mapped file is unmapped first.
+        //! @return True if the file was mapped. Files that don't exist or are empty can't be mapped.
+        bool Open(const char* filePath);
+        //! Unmaps the file. Any pointers previously retrieved from GetData are no longer valid after this call.
+        void Close();
+
+        bool IsOpen() const;
+        //! Returns the start of the mapped file or null if no file is mapped.
+        const u8* GetData() const;
+        //! Returns the size of the mapped file in bytes.
+        u64 GetSize() const;
+
+        //! Hints the OS that the provided range will be accessed soon so it can start reading it in the background.
+        void Prefetch(u64 offset, u64 size) const;
+
+    private:
+        bool PlatformOpen(const char* filePath);
+        void PlatformClose();
+        void PlatformPrefetch(u64 offset, u64 size) const;
+
+        const u8* m_data{ nullptr };
+        u64 m_size{ 0 };
+        //! Additional handle for platforms that need to keep an OS object alive while the file is mapped.
+        void* m_platformHandle{ nullptr };
+    };
+} // namespace AZ::IO
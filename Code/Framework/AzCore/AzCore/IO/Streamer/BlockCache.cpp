@@ -13,6 +13,7 @@
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ::IO
@@ -101,33 +102,87 @@ namespace AZ::IO
 
     BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
         : StreamStackEntry("Block cache")
+        , m_blockSize(blockSize)
         , m_alignment(alignment)
         , m_onlyEpilogWrites(onlyEpilogWrites)
     {
         AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
         AZ_Assert(IStreamerTypes::IsAlignedTo(blockSize, alignment), "Block size needs to be a multiple of the alignment.");
 
-        m_numBlocks = aznumeric_caster(cacheSize / blockSize);
-        m_cacheSize = cacheSize - (cacheSize % blockSize); // Only use the amount needed for the cache.
-        m_blockSize = blockSize;
+        AllocateCache(cacheSize);
         if (m_numBlocks == 1)
         {
             m_onlyEpilogWrites = true;
         }
+    }
+
+    BlockCache::~BlockCache()
+    {
+        ReleaseCache();
+    }
+
+    void BlockCache::AllocateCache(u64 cacheSize)
+    {
+        m_numBlocks = aznumeric_caster(cacheSize / m_blockSize);
+        m_cacheSize = cacheSize - (cacheSize % m_blockSize); // Only use the amount needed for the cache.
+        // Keep at least a quarter of the blocks on probation so newly read blocks have a chance to be read again before they're
+        // evicted, and remember the last evicted probation blocks for about half the number of blocks in the cache.
+        m_maxProtectedBlocks = m_numBlocks - AZStd::max(m_numBlocks / 4, 1u);
+        m_numEvictedBlockKeys = AZStd::max(m_numBlocks / 2, 1u);
 
         m_cache = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
-            m_cacheSize, alignment));
+            m_cacheSize, m_alignment));
         m_cachedPaths = AZStd::unique_ptr<RequestPath[]>(new RequestPath[m_numBlocks]);
         m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
         m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
         m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+        m_isBlockProtected = AZStd::unique_ptr<bool[]>(new bool[m_numBlocks]());
+        m_evictedBlockKeys = AZStd::unique_ptr<size_t[]>(new size_t[m_numEvictedBlockKeys]);
+        m_numProtectedBlocks = 0;
 
         ResetCache();
     }
 
-    BlockCache::~BlockCache()
+    void BlockCache::ReleaseCache()
     {
         AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_cache, m_cacheSize, m_alignment);
+        m_cache = nullptr;
+    }
+
+    void BlockCache::ResizeCache(u64 cacheSize)
+    {
+        if (cacheSize < m_blockSize * 2ull)
+        {
+            AZ_Warning("Streamer", false, "Size (%llu) for BlockCache isn't big enough to hold at least two cache blocks of size (%u). "
+                "The cache size will be increased to fit 2 cache blocks.", cacheSize, m_blockSize);
+            cacheSize = m_blockSize * 2ull;
+        }
+        m_pendingCacheSize = cacheSize;
+        ApplyPendingResize();
+    }
+
+    bool BlockCache::ApplyPendingResize()
+    {
+        // The cache memory can only be replaced once no more reads are writing into it.
+        if (m_pendingCacheSize == 0 || m_numInFlightRequests > 0)
+        {
+            return false;
+        }
+
+        ReleaseCache();
+        AllocateCache(m_pendingCacheSize);
+        m_pendingCacheSize = 0;
+        return true;
+    }
+
+    u64 BlockCache::GetCacheSize() const
+    {
+        return m_cacheSize;
+    }
+
+    u32 BlockCache::GetNumBlocks() const
+    {
+        return m_numBlocks;
     }
 
     void BlockCache::QueueRequest(FileRequest* request)
@@ -142,6 +197,17 @@ namespace AZ::IO
                 ReadFile(request, args);
                 return;
             }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CustomData>)
+            {
+                if (auto resize = AZStd::any_cast<BlockCacheResizeData>(&args.m_data); resize != nullptr)
+                {
+                    ResizeCache(resize->m_cacheSize);
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_context->MarkRequestAsCompleted(request);
+                    return;
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
             else
             {
                 if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
@@ -163,6 +229,9 @@ namespace AZ::IO
 
     bool BlockCache::ExecuteRequests()
     {
+        // Sections that were delayed while waiting for a resize will be picked up by the loop below.
+        ApplyPendingResize();
+
         size_t delayedCount = m_delayedSections.size();
 
         bool delayedRequestProcessed = false;
@@ -313,13 +382,11 @@ namespace AZ::IO
                     // so it's read in one read request. If main wasn't used, prefixing the prolog
                     // will cause it to be filled in and used.
                     main.Prefix(prolog);
-                    m_hitRateStat.PushSample(0.0);
-                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                    RecordCacheAccess(data.m_path, false);
                 }
                 else
                 {
-                    m_hitRateStat.PushSample(1.0);
-                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                    RecordCacheAccess(data.m_path, true);
                 }
             }
             else
@@ -331,8 +398,7 @@ namespace AZ::IO
                 bool readFromCache = (ServiceFromCache(request, prolog, data.m_path, data.m_sharedRead) == CacheResult::ReadFromCache);
                 fullyCached = readFromCache && fullyCached;
 
-                m_hitRateStat.PushSample(readFromCache ? 1.0 : 0.0);
-                Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                RecordCacheAccess(data.m_path, readFromCache);
             }
         }
 
@@ -351,8 +417,7 @@ namespace AZ::IO
             bool readFromCache = (ServiceFromCache(request, epilog, data.m_path, data.m_sharedRead) == CacheResult::ReadFromCache);
             fullyCached = readFromCache && fullyCached;
 
-            m_hitRateStat.PushSample(readFromCache ? 1.0 : 0.0);
-            Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+            RecordCacheAccess(data.m_path, readFromCache);
         }
 
         if (fullyCached)
@@ -394,6 +459,14 @@ namespace AZ::IO
             m_name, "Available slots", CalculateAvailableRequestSlots(),
             "The total number of slots available to processing cache-able requests with. If this value is low more memory may need to be "
             "allocated to the cache so more slots are available."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Protected blocks", m_numProtectedBlocks,
+            "The number of blocks that were read from the cache at least once after being loaded. If this value stays low while the "
+            "hit rate is high, the cache is mostly servicing requests that are in-flight at the same time."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Tracked files", aznumeric_caster(m_fileStatistics.size()),
+            "The number of files for which cache hits and misses are recorded. Request a report for cache hits to get the counters "
+            "per file."));
 
         StreamStackEntry::CollectStatistics(statistics);
     }
@@ -432,6 +505,9 @@ namespace AZ::IO
         if (!IsCacheBlockInFlight(cacheBlock))
         {
             TouchBlock(cacheBlock);
+            // Reads of blocks that are still in-flight are typically part of the same burst of requests, so only reading from a
+            // block that has already been loaded counts as reuse.
+            ProtectBlock(cacheBlock);
             memcpy(section.m_output, GetCacheBlockData(cacheBlock) + section.m_blockOffset, section.m_copySize);
             return CacheResult::ReadFromCache;
         }
@@ -456,9 +532,6 @@ namespace AZ::IO
         u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
         if (cacheLocation == s_fileNotCached)
         {
-            m_hitRateStat.PushSample(0.0);
-            Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
-
             section.m_parent = request;
             cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset);
             if (cacheLocation != s_fileNotCached)
@@ -509,9 +582,6 @@ namespace AZ::IO
                 section.m_wait = nullptr;
             }
 
-            m_hitRateStat.PushSample(1.0);
-            Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
-
             return ReadFromCache(request, section, cacheLocation);
         }
     }
@@ -691,34 +761,95 @@ namespace AZ::IO
         m_blockLastTouched[index] = AZStd::chrono::steady_clock::now();
     }
 
+    void BlockCache::ProtectBlock(u32 index)
+    {
+        AZ_Assert(index < m_numBlocks, "Index for protecting a cache entry in the BlockCache is out of bounds.");
+        if (m_isBlockProtected[index] || m_maxProtectedBlocks == 0)
+        {
+            return;
+        }
+
+        if (m_numProtectedBlocks >= m_maxProtectedBlocks)
+        {
+            u32 oldestIndex = s_fileNotCached;
+            for (u32 i = 0; i < m_numBlocks; ++i)
+            {
+                if (m_isBlockProtected[i] && (oldestIndex == s_fileNotCached || m_blockLastTouched[i] < m_blockLastTouched[oldestIndex]))
+                {
+                    oldestIndex = i;
+                }
+            }
+            AZ_Assert(oldestIndex != s_fileNotCached, "The protected segment of the BlockCache is full, but no protected block was found.");
+            // Touch the block so it gets the same chance to be reused as a newly read block.
+            m_isBlockProtected[oldestIndex] = false;
+            m_numProtectedBlocks--;
+            TouchBlock(oldestIndex);
+        }
+
+        m_isBlockProtected[index] = true;
+        m_numProtectedBlocks++;
+    }
+
     u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
     {
         AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
 
-        // Find the oldest cache block.
-        TimePoint oldest = m_blockLastTouched[0];
-        u32 oldestIndex = 0;
-        for (u32 i = 1; i < m_numBlocks; ++i)
+        if (m_pendingCacheSize != 0)
         {
-            if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+            // Don't start new reads into the cache so the in-flight reads can drain and the cache can be resized.
+            return s_fileNotCached;
+        }
+
+        // Find the oldest cache block that's not in-flight, preferring blocks on probation over protected blocks.
+        u32 oldestIndex = s_fileNotCached;
+        for (u32 i = 0; i < m_numBlocks; ++i)
+        {
+            if (IsCacheBlockInFlight(i))
+            {
+                continue;
+            }
+            if (oldestIndex == s_fileNotCached)
+            {
+                oldestIndex = i;
+            }
+            else if (m_isBlockProtected[i] == m_isBlockProtected[oldestIndex])
+            {
+                if (m_blockLastTouched[i] < m_blockLastTouched[oldestIndex])
+                {
+                    oldestIndex = i;
+                }
+            }
+            else if (!m_isBlockProtected[i])
             {
-                oldest = m_blockLastTouched[i];
                 oldestIndex = i;
             }
         }
 
-        if (!IsCacheBlockInFlight(oldestIndex))
+        if (oldestIndex == s_fileNotCached)
         {
-            // Recycle the block.
-            m_cachedPaths[oldestIndex] = filePath;
-            m_cachedOffsets[oldestIndex] = offset;
-            TouchBlock(oldestIndex);
-            return oldestIndex;
+            return s_fileNotCached;
         }
-        else
+
+        if (m_isBlockProtected[oldestIndex])
         {
-            return s_fileNotCached;
+            m_isBlockProtected[oldestIndex] = false;
+            m_numProtectedBlocks--;
+        }
+        else if (!m_cachedPaths[oldestIndex].GetRelativePath().empty())
+        {
+            RememberEvictedBlock(m_cachedPaths[oldestIndex], m_cachedOffsets[oldestIndex]);
+        }
+
+        // Recycle the block.
+        m_cachedPaths[oldestIndex] = filePath;
+        m_cachedOffsets[oldestIndex] = offset;
+        TouchBlock(oldestIndex);
+        if (ForgetEvictedBlock(filePath, offset))
+        {
+            // The block was evicted before it had a chance to be reused, so admit it directly to the protected segment.
+            ProtectBlock(oldestIndex);
         }
+        return oldestIndex;
     }
 
     u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
@@ -749,6 +880,11 @@ namespace AZ::IO
         m_cachedOffsets[index] = 0;
         m_blockLastTouched[index] = TimePoint::min();
         m_inFlightRequests[index] = nullptr;
+        if (m_isBlockProtected[index])
+        {
+            m_isBlockProtected[index] = false;
+            m_numProtectedBlocks--;
+        }
     }
 
     void BlockCache::ResetCache()
@@ -758,6 +894,78 @@ namespace AZ::IO
             ResetCacheEntry(i);
         }
         m_numInFlightRequests = 0;
+
+        for (u32 i = 0; i < m_numEvictedBlockKeys; ++i)
+        {
+            m_evictedBlockKeys[i] = 0;
+        }
+        m_nextEvictedBlockKey = 0;
+    }
+
+    size_t BlockCache::CalculateBlockKey(const RequestPath& filePath, u64 offset)
+    {
+        size_t key = filePath.GetHash();
+        AZStd::hash_combine(key, offset);
+        return key;
+    }
+
+    void BlockCache::RememberEvictedBlock(const RequestPath& filePath, u64 offset)
+    {
+        m_evictedBlockKeys[m_nextEvictedBlockKey] = CalculateBlockKey(filePath, offset);
+        m_nextEvictedBlockKey = (m_nextEvictedBlockKey + 1) % m_numEvictedBlockKeys;
+    }
+
+    bool BlockCache::ForgetEvictedBlock(const RequestPath& filePath, u64 offset)
+    {
+        const size_t key = CalculateBlockKey(filePath, offset);
+        for (u32 i = 0; i < m_numEvictedBlockKeys; ++i)
+        {
+            if (m_evictedBlockKeys[i] == key)
+            {
+                m_evictedBlockKeys[i] = 0;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void BlockCache::RecordCacheAccess(const RequestPath& filePath, bool isHit)
+    {
+        m_hitRateStat.PushSample(isHit ? 1.0 : 0.0);
+        Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+
+        auto it = m_fileStatistics.find(filePath);
+        if (it == m_fileStatistics.end())
+        {
+            if (m_fileStatistics.size() >= s_maxTrackedFiles)
+            {
+                auto leastUsed = m_fileStatistics.begin();
+                for (auto entry = m_fileStatistics.begin(); entry != m_fileStatistics.end(); ++entry)
+                {
+                    if ((entry->second.m_hits + entry->second.m_misses) < (leastUsed->second.m_hits + leastUsed->second.m_misses))
+                    {
+                        leastUsed = entry;
+                    }
+                }
+                m_fileStatistics.erase(leastUsed);
+            }
+            it = m_fileStatistics.emplace(filePath, FileCacheStatistics{}).first;
+        }
+
+        if (isHit)
+        {
+            it->second.m_hits++;
+        }
+        else
+        {
+            it->second.m_misses++;
+        }
+    }
+
+    BlockCache::FileCacheStatistics BlockCache::GetFileCacheStatistics(const RequestPath& filePath) const
+    {
+        auto it = m_fileStatistics.find(filePath);
+        return it != m_fileStatistics.end() ? it->second : FileCacheStatistics{};
     }
 
     void BlockCache::Report(const Requests::ReportData& data) const
@@ -783,10 +991,30 @@ namespace AZ::IO
             data.m_output.push_back(Statistic::CreateBoolean(
                 m_name, "Only epilog writes", m_onlyEpilogWrites,
                 "Whether or not only the epilog is considered or that both prolog and epilog are used for caching."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max protected blocks", m_maxProtectedBlocks,
+                "The maximum number of blocks that are protected from eviction because they were read from the cache again. The "
+                "remaining blocks are used for newly read data, so large sequential reads don't flush frequently used blocks."));
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Evicted block history", m_numEvictedBlockKeys,
+                "The number of evicted blocks that are remembered. Blocks that are read again while remembered are protected right away."));
             data.m_output.push_back(Statistic::CreateReferenceString(
                 m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
                 "The name of the node that follows this node or none."));
             break;
+        case IStreamerTypes::ReportType::CacheHits:
+            for (const auto& [path, fileStatistics] : m_fileStatistics)
+            {
+                const u64 total = fileStatistics.m_hits + fileStatistics.m_misses;
+                data.m_output.push_back(Statistic::CreatePersistentString(m_name, "File", path.GetRelativePath().Native()));
+                data.m_output.push_back(Statistic::CreateInteger(m_name, "Hits", aznumeric_caster(fileStatistics.m_hits)));
+                data.m_output.push_back(Statistic::CreateInteger(m_name, "Misses", aznumeric_caster(fileStatistics.m_misses)));
+                data.m_output.push_back(Statistic::CreatePercentage(
+                    m_name, "Hit rate", total > 0 ? aznumeric_cast<double>(fileStatistics.m_hits) / aznumeric_cast<double>(total) : 0.0));
+            }
+            break;
+        default:
+            break;
         };
     }
 } // namespace AZ::IO
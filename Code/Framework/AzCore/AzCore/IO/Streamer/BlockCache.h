@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
@@ -21,7 +22,6 @@
 
 namespace AZ::IO
 {
-    class RequestPath;
     namespace Requests
     {
         struct ReadData;
@@ -57,6 +57,24 @@ namespace AZ::IO
         BlockSize m_blockSize{ BlockSize::MemoryAlignment };
     };
 
+    //! Arguments for a custom request that changes the size of a BlockCache at runtime. Queue the request with
+    //! IStreamer::Custom. The first BlockCache in the stack handles the request. The cached data is discarded and
+    //! the new size is applied as soon as the reads that are currently in-flight in the cache have completed.
+    struct BlockCacheResizeData
+    {
+        AZ_TYPE_INFO(AZ::IO::BlockCacheResizeData, "{3A0F6C2E-8B5D-4E71-9C13-5F27D6B84E90}");
+
+        //! The new overall size of the cache in bytes. This will be rounded down to a multiple of the block size.
+        u64 m_cacheSize{ 0 };
+    };
+
+    //! Caches blocks of files to service small and unaligned reads.
+    //! Eviction uses a segmented policy similar to 2Q: newly read blocks are put on probation and are only moved to the
+    //! protected segment when they're read from the cache again. Blocks are evicted from the probation segment first, so
+    //! a large sequential read only cycles through the probation blocks and doesn't flush frequently used blocks. The
+    //! cache also remembers the most recently evicted probation blocks. If one of those blocks is read again it's
+    //! directly admitted to the protected segment, as it was evicted before it had the chance to be reused.
+
     class BlockCache
         : public StreamStackEntry
     {
@@ -87,6 +105,22 @@ namespace AZ::IO
         double CalculateCacheableRatePercentage() const;
         s32 CalculateAvailableRequestSlots() const;
 
+        //! The number of times cacheable sections of a file were found in the cache or had to be read.
+        struct FileCacheStatistics
+        {
+            u64 m_hits{ 0 };
+            u64 m_misses{ 0 };
+        };
+        //! Returns the cache hits and misses for a file. Counters are kept for a limited number of files, so files that
+        //! were rarely read may no longer be tracked, in which case both counters will be zero.
+        FileCacheStatistics GetFileCacheStatistics(const RequestPath& filePath) const;
+
+        //! Changes the size of the cache. The new size is applied once there are no more reads in-flight. Until then
+        //! no new blocks will be recycled. All cached data is discarded when the new size is applied.
+        void ResizeCache(u64 cacheSize);
+        u64 GetCacheSize() const;
+        u32 GetNumBlocks() const;
+
     protected:
         static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
 
@@ -125,14 +159,28 @@ namespace AZ::IO
         bool SplitRequest(Section& prolog, Section& main, Section& epilog, const RequestPath& filePath, u64 fileLength,
             u64 offset, u64 size, u8* buffer) const;
 
+        void AllocateCache(u64 cacheSize);
+        void ReleaseCache();
+        bool ApplyPendingResize();
+
         u8* GetCacheBlockData(u32 index);
         void TouchBlock(u32 index);
+        //! Moves a block to the protected segment. If the protected segment is full, the least recently used protected
+        //! block is moved back to the probation segment.
+        void ProtectBlock(u32 index);
+        //! Recycles the least recently used probation block or if there are none the least recently used protected block.
         AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
         u32 FindInCache(const RequestPath& filePath, u64 offset) const;
         bool IsCacheBlockInFlight(u32 index) const;
         void ResetCacheEntry(u32 index);
         void ResetCache();
 
+        static size_t CalculateBlockKey(const RequestPath& filePath, u64 offset);
+        void RememberEvictedBlock(const RequestPath& filePath, u64 offset);
+        bool ForgetEvictedBlock(const RequestPath& filePath, u64 offset);
+
+        void RecordCacheAccess(const RequestPath& filePath, bool isHit);
+
         void Report(const Requests::ReportData& data) const;
 
         //! Map of the file requests that are being processed and the sections of the parent requests they'll complete.
@@ -142,6 +190,9 @@ namespace AZ::IO
 
         AZ::Statistics::RunningStatistic m_hitRateStat;
         AZ::Statistics::RunningStatistic m_cacheableStat;
+        //! Cache hits and misses per file. This is capped at s_maxTrackedFiles, after which the least used file is dropped.
+        AZStd::unordered_map<RequestPath, FileCacheStatistics> m_fileStatistics;
+        static constexpr size_t s_maxTrackedFiles = 256;
 
         u8* m_cache;
         u64 m_cacheSize;
@@ -157,6 +208,16 @@ namespace AZ::IO
         AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
         //! The file request that's currently read data into the cache block. If null, the block has been read.
         AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
+        //! Whether the cache block is in the protected segment or on probation.
+        AZStd::unique_ptr<bool[]> m_isBlockProtected; // Array of m_numBlocks size.
+        //! Ring buffer with the keys of the blocks that were most recently evicted from the probation segment.
+        AZStd::unique_ptr<size_t[]> m_evictedBlockKeys; // Array of m_numEvictedBlockKeys size.
+        u32 m_numEvictedBlockKeys{ 0 };
+        u32 m_nextEvictedBlockKey{ 0 };
+        u32 m_numProtectedBlocks{ 0 };
+        u32 m_maxProtectedBlocks{ 0 };
+        //! If not zero, the size the cache will be resized to once there are no more reads in-flight.
+        u64 m_pendingCacheSize{ 0 };
 
         //! The number of requests waiting for meta data to be retrieved.
         s32 m_numMetaDataRetrievalInProgress{ 0 };
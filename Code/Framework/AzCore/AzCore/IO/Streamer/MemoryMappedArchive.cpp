@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/MemoryMappedArchive.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> MemoryMappedArchiveConfig::AddStreamStackEntry(
+        [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        u32 maxMappedArchives = m_maxMappedArchives;
+        if (maxMappedArchives == 0)
+        {
+            AZ_Warning("Streamer", false, "MemoryMappedArchive needs to be able to map at least one archive. The limit will be set to 1.");
+            maxMappedArchives = 1;
+        }
+
+        auto stackEntry = AZStd::make_shared<MemoryMappedArchive>(maxMappedArchives, m_minViewSizeKib * 1_kib, m_prefetch);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void MemoryMappedArchiveConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<MemoryMappedArchiveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxMappedArchives", &MemoryMappedArchiveConfig::m_maxMappedArchives)
+                ->Field("MinViewSizeKib", &MemoryMappedArchiveConfig::m_minViewSizeKib)
+                ->Field("Prefetch", &MemoryMappedArchiveConfig::m_prefetch);
+        }
+    }
+
+
+
+    //
+    // MappedArchive
+    //
+
+    class MemoryMappedArchive::MappedArchive final
+        : public IStreamerTypes::RequestMemoryAllocator
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MappedArchive, SystemAllocator);
+
+        explicit MappedArchive(MemoryMappedFile&& file)
+            : m_file(AZStd::move(file))
+        {
+        }
+
+        //! Pins the mapping. The stack entry holds a pin while the archive is cached and every view holds one until its
+        //! request is released.
+        void LockAllocator() override
+        {
+            m_pinCount++;
+        }
+
+        //! Releases a pin. The mapping is released together with the last pin, which can happen on any thread that releases a request.
+        void UnlockAllocator() override
+        {
+            if (--m_pinCount == 0)
+            {
+                delete this;
+            }
+        }
+
+        IStreamerTypes::RequestMemoryAllocatorResult Allocate(
+            [[maybe_unused]] u64 minimalSize, [[maybe_unused]] u64 recommendedSize, [[maybe_unused]] size_t alignment) override
+        {
+            AZ_Assert(false, "Mapped archives only provide views and can't allocate memory for requests.");
+            return { nullptr, 0, IStreamerTypes::MemoryType::MappedView };
+        }
+
+        void Release([[maybe_unused]] void* address) override
+        {
+            // Views point into the mapping, which is released together with the last pin.
+        }
+
+        const MemoryMappedFile& GetFile() const
+        {
+            return m_file;
+        }
+
+    private:
+        MemoryMappedFile m_file;
+        AZStd::atomic_uint32_t m_pinCount{ 0 };
+    };
+
+
+
+    //
+    // MemoryMappedArchive
+    //
+
+    static constexpr char ViewRateName[] = "Mapped view rate";
+
+    MemoryMappedArchive::MemoryMappedArchive(u32 maxMappedArchives, u64 minViewSize, bool prefetch)
+        : StreamStackEntry("Memory mapped archives")
+        , m_minViewSize(minViewSize)
+        , m_maxMappedArchives(maxMappedArchives)
+        , m_prefetch(prefetch)
+    {
+        m_archivePaths.reserve(maxMappedArchives);
+        m_archives.reserve(maxMappedArchives);
+        m_archiveLastUsed.reserve(maxMappedArchives);
+    }
+
+    MemoryMappedArchive::~MemoryMappedArchive()
+    {
+        FlushEntireCache();
+    }
+
+    void MemoryMappedArchive::PrepareRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (auto data = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand()); data != nullptr)
+        {
+            if (data->m_output == nullptr && data->m_allocator != nullptr && data->m_allocator->AcceptsMappedViews())
+            {
+                bool isViewCreated = CreateView(request, *data);
+                m_viewRateStat.PushSample(isViewCreated ? 1.0 : 0.0);
+                Statistic::PlotImmediate(m_name, ViewRateName, m_viewRateStat.GetMostRecentSample());
+                if (isViewCreated)
+                {
+                    return;
+                }
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void MemoryMappedArchive::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+        }, request->GetCommand());
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void MemoryMappedArchive::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(
+            m_name, ViewRateName, m_viewRateStat.GetAverage(),
+            "The percentage of requests that accept mapped views and were completed with one. Requests that are not completed with a "
+            "view are for loose files, compressed files, files that prefer loose files over archive or reads that are too small."));
+        statistics.push_back(Statistic::CreateByteSize(
+            m_name, "Average view size", aznumeric_cast<u64>(m_viewSizeAverage.CalculateAverage()),
+            "The average size of the created views."));
+        statistics.push_back(Statistic::CreateInteger(
+            m_name, "Mapped archives", aznumeric_caster(m_archives.size()),
+            "The number of archives currently mapped, excluding archives that are only kept alive by views."));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool MemoryMappedArchive::CreateView(FileRequest* request, Requests::ReadRequestData& data)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        if (data.m_size < m_minViewSize)
+        {
+            return false;
+        }
+
+        CompressionInfo info;
+        if (!CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()) || info.m_isCompressed ||
+            info.m_conflictResolution == ConflictResolution::PreferFile)
+        {
+            // Loose files are read through the regular drives and compressed files need to be decompressed into a buffer. Files that
+            // prefer a loose file over the archive need a file check first, which the decompressor takes care of.
+            return false;
+        }
+
+        if (data.m_offset + data.m_size > info.m_uncompressedSize)
+        {
+            return false;
+        }
+
+        MappedArchive* archive = FindOrMapArchive(info.m_archiveFilename);
+        if (!archive)
+        {
+            return false;
+        }
+
+        const MemoryMappedFile& file = archive->GetFile();
+        const u64 offset = info.m_offset + data.m_offset;
+        if (offset + data.m_size > file.GetSize())
+        {
+            AZ_Warning("Streamer", false, "The file '%s' is stored outside the bounds of archive '%s'.",
+                data.m_path.GetRelativePathCStr(), info.m_archiveFilename.GetRelativePathCStr());
+            return false;
+        }
+
+        if (m_prefetch)
+        {
+            file.Prefetch(offset, data.m_size);
+        }
+
+        // The scheduler locked the caller's allocator when the request was queued. The allocator is no longer needed as the
+        // request now pins the archive instead.
+        data.m_allocator->UnlockAllocator();
+        archive->LockAllocator();
+        data.m_allocator = archive;
+        // The view is read-only, which is communicated to the caller through the memory type.
+        data.m_output = const_cast<u8*>(file.GetData() + offset);
+        data.m_outputSize = data.m_size;
+        data.m_memoryType = IStreamerTypes::MemoryType::MappedView;
+        m_viewSizeAverage.PushEntry(data.m_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+        return true;
+    }
+
+    MemoryMappedArchive::MappedArchive* MemoryMappedArchive::FindOrMapArchive(const RequestPath& archivePath)
+    {
+        auto now = AZStd::chrono::steady_clock::now();
+        const size_t numArchives = m_archives.size();
+        for (size_t i = 0; i < numArchives; ++i)
+        {
+            if (m_archivePaths[i] == archivePath)
+            {
+                m_archiveLastUsed[i] = now;
+                return m_archives[i];
+            }
+        }
+
+        MemoryMappedFile file;
+        if (!file.Open(archivePath.GetAbsolutePathCStr()))
+        {
+            AZ_Warning("Streamer", false, "Unable to map archive '%s' into memory.", archivePath.GetAbsolutePathCStr());
+            return nullptr;
+        }
+
+        if (numArchives >= m_maxMappedArchives)
+        {
+            size_t oldest = 0;
+            for (size_t i = 1; i < numArchives; ++i)
+            {
+                if (m_archiveLastUsed[i] < m_archiveLastUsed[oldest])
+                {
+                    oldest = i;
+                }
+            }
+            ReleaseArchive(oldest);
+        }
+
+        MappedArchive* archive = aznew MappedArchive(AZStd::move(file));
+        archive->LockAllocator();
+        m_archivePaths.push_back(archivePath);
+        m_archives.push_back(archive);
+        m_archiveLastUsed.push_back(now);
+        return archive;
+    }
+
+    void MemoryMappedArchive::ReleaseArchive(size_t index)
+    {
+        m_archives[index]->UnlockAllocator();
+
+        size_t last = m_archives.size() - 1;
+        if (index != last)
+        {
+            m_archivePaths[index] = AZStd::move(m_archivePaths[last]);
+            m_archives[index] = m_archives[last];
+            m_archiveLastUsed[index] = m_archiveLastUsed[last];
+        }
+        m_archivePaths.pop_back();
+        m_archives.pop_back();
+        m_archiveLastUsed.pop_back();
+    }
+
+    void MemoryMappedArchive::FlushCache(const RequestPath& filePath)
+    {
+        for (size_t i = 0; i < m_archives.size(); ++i)
+        {
+            if (m_archivePaths[i] == filePath)
+            {
+                ReleaseArchive(i);
+                break;
+            }
+        }
+    }
+
+    void MemoryMappedArchive::FlushEntireCache()
+    {
+        for (MappedArchive* archive : m_archives)
+        {
+            archive->UnlockAllocator();
+        }
+        m_archivePaths.clear();
+        m_archives.clear();
+        m_archiveLastUsed.clear();
+    }
+
+    void MemoryMappedArchive::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            data.m_output.push_back(Statistic::CreateInteger(
+                m_name, "Max mapped archives", m_maxMappedArchives,
+                "The maximum number of archives that are kept mapped. Archives that are still used by views stay mapped until the "
+                "last request using them is released."));
+            data.m_output.push_back(Statistic::CreateByteSize(
+                m_name, "Min view size", m_minViewSize, "Reads smaller than this are passed on to the next node."));
+            data.m_output.push_back(Statistic::CreateBoolean(
+                m_name, "Prefetch", m_prefetch, "Whether or not the pages of a view are read in the background when the view is created."));
+            data.m_output.push_back(Statistic::CreateReferenceString(
+                m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                "The name of the node that follows this node or none."));
+            break;
+        };
+    }
+} // namespace AZ::IO
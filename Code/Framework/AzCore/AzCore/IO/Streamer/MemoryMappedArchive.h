@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::IO
+{
+    namespace Requests
+    {
+        struct ReadRequestData;
+        struct ReportData;
+    } // namespace Requests
+
+    struct MemoryMappedArchiveConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::MemoryMappedArchiveConfig, "{A4C7E2B1-5D38-4F6A-9B0E-7C1D3E8F2A65}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(MemoryMappedArchiveConfig, AZ::SystemAllocator);
+
+        ~MemoryMappedArchiveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The maximum number of archives that are kept mapped. Archives that are still referenced by a view stay mapped until the
+        //! last request referencing them is released.
+        u32 m_maxMappedArchives{ 8 };
+        //! Reads smaller than this are passed on to the next entry in the stack. Small reads are cheap to copy and would otherwise
+        //! keep an entire archive mapped for a few bytes.
+        u32 m_minViewSizeKib{ 64 };
+        //! If true, the OS is asked to start reading the pages of a view in the background as soon as the view is created.
+        bool m_prefetch{ true };
+    };
+
+    //! Completes reads from uncompressed files inside archives with a read-only view into a memory mapping of the archive instead
+    //! of copying the data into memory provided by the caller. This avoids a copy and keeps the file data only in the page cache.
+    //! Only requests that were issued with a RequestMemoryAllocator that accepts mapped views are handled, all other requests are
+    //! passed on. Because this entry works on untranslated requests it needs to be placed above the decompressor in the stack.
+    class MemoryMappedArchive
+        : public StreamStackEntry
+    {
+    public:
+        MemoryMappedArchive(u32 maxMappedArchives, u64 minViewSize, bool prefetch);
+        ~MemoryMappedArchive() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        //! A mapped archive. Views into the mapping pin the archive by using it as their request memory allocator, so the
+        //! mapping is released together with the last request that uses it.
+        class MappedArchive;
+
+        bool CreateView(FileRequest* request, Requests::ReadRequestData& data);
+        MappedArchive* FindOrMapArchive(const RequestPath& archivePath);
+        void ReleaseArchive(size_t index);
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        void Report(const Requests::ReportData& data) const;
+
+        AZStd::vector<RequestPath> m_archivePaths;
+        AZStd::vector<MappedArchive*> m_archives;
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_archiveLastUsed;
+
+        AZ::Statistics::RunningStatistic m_viewRateStat;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_viewSizeAverage;
+
+        u64 m_minViewSize;
+        u32 m_maxMappedArchives;
+        bool m_prefetch;
+    };
+} // namespace AZ::IO
@@ -10,6 +10,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/typetraits/is_arithmetic.h>
@@ -291,6 +292,52 @@ namespace AZ::IO
     template<size_t WindowSize>
     using TimedAverageWindow = AverageWindow<Statistic::TimeValue, Statistic::TimeValue, WindowSize>;
 
+    //! PercentileWindow keeps the values in a sliding window so percentiles, such as the median or the tail latency, can be calculated.
+    //! @StorageType The type of the value in the sliding window. Need to be a number of a AZStd::chrono::duration.
+    //! @WindowSize The maximum number of entries kept in the window.
+    template<typename StorageType, size_t WindowSize>
+    class PercentileWindow
+    {
+        static_assert(AZStd::is_arithmetic_v<StorageType> || Statistics::Internal::is_duration<StorageType>,
+            "PercentileWindow only support numbers and AZStd::chrono::durations.");
+        static_assert(IsPowerOfTwo(WindowSize), "The WindowSize of PercentileWindow needs to be a power of 2.");
+    public:
+        static const size_t s_windowSize = WindowSize;
+
+        //! Push a new entry into the window. If the window is full, the oldest value will be removed.
+        void PushEntry(StorageType value)
+        {
+            m_values[m_count & (WindowSize - 1)] = value;
+            ++m_count;
+        }
+
+        //! Calculates the value that @percentile percent of the values in the window are smaller than or equal to.
+        //! Returns a zero value if no entries have been recorded.
+        StorageType CalculatePercentile(double percentile) const
+        {
+            const size_t count = AZStd::min(m_count, WindowSize);
+            if (count == 0)
+            {
+                return StorageType{};
+            }
+
+            StorageType values[WindowSize];
+            AZStd::copy(m_values, m_values + count, values);
+            const size_t index = AZStd::min(count - 1, static_cast<size_t>(percentile * 0.01 * static_cast<double>(count)));
+            AZStd::nth_element(values, values + index, values + count);
+            return values[index];
+        }
+        //! Returns the total number of entries that have been passed in. This is not the total number of entries that are stored however.
+        size_t GetNumRecorded() const { return m_count; }
+
+    private:
+        StorageType m_values[WindowSize]{};
+        size_t m_count = 0;
+    };
+
+    template<size_t WindowSize>
+    using TimedPercentileWindow = PercentileWindow<Statistic::TimeValue, WindowSize>;
+
     template<size_t WindowSize>
     class TimedAverageWindowScope
     {
@@ -208,7 +208,12 @@ namespace AZ::IO
         {
             buffer = readRequest->m_output;
             numBytesRead = readRequest->m_size;
-            if (claimMemory == IStreamerTypes::ClaimMemory::Yes)
+            if (claimMemory == IStreamerTypes::ClaimMemory::Yes && readRequest->m_memoryType == IStreamerTypes::MemoryType::MappedView)
+            {
+                // Views are pinned until the request is released, so ownership can't be handed over.
+                AZ_Assert(false, "Memory from a read request that was completed with a mapped view can't be claimed.");
+            }
+            else if (claimMemory == IStreamerTypes::ClaimMemory::Yes)
             {
                 AZ_Assert(HasRequestCompleted(request), "Claiming memory from a read request that's still in progress. "
                     "This can lead to crashing if data is still being streamed to the request's buffer.");
@@ -227,6 +232,14 @@ namespace AZ::IO
         }
     }
 
+    IStreamerTypes::MemoryType Streamer::GetReadRequestMemoryType(FileRequestHandle request) const
+    {
+        AZ_Assert(request.m_request, "The request handle provided to Streamer::GetReadRequestMemoryType is invalid.");
+        auto readRequest = AZStd::get_if<Requests::ReadRequestData>(&request.m_request->GetCommand());
+        AZ_Assert(readRequest, "Provided file request did not contain read information");
+        return readRequest ? readRequest->m_memoryType : IStreamerTypes::MemoryType::ReadWrite;
+    }
+
     void Streamer::CollectStatistics(AZStd::vector<Statistic>& statistics)
     {
         m_streamStack->CollectStatistics(statistics);
@@ -168,6 +168,7 @@ namespace AZ::IO
         //! Gets the result for operations that read data.
         bool GetReadRequestResult(FileRequestHandle request, void*& buffer, u64& numBytesRead,
             IStreamerTypes::ClaimMemory claimMemory = IStreamerTypes::ClaimMemory::No) const override;
+        IStreamerTypes::MemoryType GetReadRequestMemoryType(FileRequestHandle request) const override;
 
         //
         // General Streamer functions
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/ConsoleTypeHelpers.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Math/Crc.h>
@@ -14,6 +15,7 @@
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
+#include <AzCore/IO/Streamer/MemoryMappedArchive.h>
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
@@ -199,6 +201,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        MemoryMappedArchiveConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
@@ -241,4 +244,18 @@ namespace AZ
             m_streamer->QueueRequest(m_streamer->FlushCaches());
         }
     }
+
+    void StreamerComponent::ResizeBlockCache(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (m_streamer)
+        {
+            u64 cacheSizeMib = 0;
+            if (someStrings.empty() || !AZ::ConsoleTypeHelpers::StringToValue(cacheSizeMib, someStrings.front()))
+            {
+                AZ_Warning("Streamer", false, "ResizeBlockCache requires the new size of the block cache in megabytes.");
+                return;
+            }
+            m_streamer->QueueRequest(m_streamer->Custom(AZStd::any(AZ::IO::BlockCacheResizeData{ cacheSizeMib * 1_mib })));
+        }
+    }
 } // namespace AZ
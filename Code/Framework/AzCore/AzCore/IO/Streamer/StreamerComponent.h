@@ -49,11 +49,14 @@ namespace AZ
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
+        void ResizeBlockCache(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, ResizeBlockCache, AZ::ConsoleFunctorFlags::Null,
+            "Changes the size of the block cache in AZ::IO::Streamer to the provided number of megabytes");
         
         AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
         int m_deviceThreadCpuId;
@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Plane.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/Math/SimdMathVec8.h>
+
+namespace AZ::BatchMath
+{
+    namespace Internal
+    {
+        using Simd::Vec4;
+
+        //! Number of elements processed at once, one per Vec4 lane
+        static constexpr size_t BatchSize = 4;
+
+        //! Runs @kernel(first) on every full batch of 4 elements from @first, then @tailKernel(first, count) on the remaining elements.
+        template<typename Kernel, typename TailKernel>
+        AZ_MATH_INLINE void ForEachBatch(size_t first, size_t size, const Kernel& kernel, const TailKernel& tailKernel)
+        {
+            for (; first + BatchSize <= size; first += BatchSize)
+            {
+                kernel(first);
+            }
+            if (first < size)
+            {
+                tailKernel(first, size - first);
+            }
+        }
+
+        //! Copies the @count elements at @source into a full batch, repeating the first one so the unused lanes compute valid values.
+        template<typename T>
+        AZ_MATH_INLINE void PadBatch(const T* source, size_t count, T* batch)
+        {
+            for (size_t index = 0; index < BatchSize; ++index)
+            {
+                batch[index] = source[index < count ? index : 0];
+            }
+        }
+
+        //! Loads the vectors of 4 elements, transposed so columns[c] holds component c of every vector.
+        template<typename GetVector>
+        AZ_MATH_INLINE void LoadTransposed(const GetVector& getVector, Vec4::FloatType* columns)
+        {
+            const Vec4::FloatType rows[BatchSize] = { getVector(0), getVector(1), getVector(2), getVector(3) };
+            Vec4::Mat4x4Transpose(rows, columns);
+        }
+
+        AZ_MATH_INLINE void LoadTransposed(const Vector3* vectors, Vec4::FloatType* columns)
+        {
+            LoadTransposed([vectors](size_t index) { return Vec4::FromVec3(vectors[index].GetSimdValue()); }, columns);
+        }
+
+        AZ_MATH_INLINE void StoreTransposed(const Vec4::FloatType* columns, Vector3* vectors)
+        {
+            Vec4::FloatType rows[BatchSize];
+            Vec4::Mat4x4Transpose(columns, rows);
+            vectors[0] = Vector3(Vec4::ToVec3(rows[0]));
+            vectors[1] = Vector3(Vec4::ToVec3(rows[1]));
+            vectors[2] = Vector3(Vec4::ToVec3(rows[2]));
+            vectors[3] = Vector3(Vec4::ToVec3(rows[3]));
+        }
+
+        //! Rotates the vectors (x, y, z) by the quaternions (qx, qy, qz, qw), like Vec4::QuaternionTransform does for one vector.
+        AZ_MATH_INLINE void QuaternionTransform(
+            Vec4::FloatArgType qx, Vec4::FloatArgType qy, Vec4::FloatArgType qz, Vec4::FloatArgType qw,
+            Vec4::FloatType& x, Vec4::FloatType& y, Vec4::FloatType& z)
+        {
+            const Vec4::FloatType two = Vec4::Splat(2.0f);
+
+            // quat.Dot(vec3) * quat * 2.0f
+            const Vec4::FloatType dotTwo = Vec4::Mul(Vec4::Madd(qx, x, Vec4::Madd(qy, y, Vec4::Mul(qz, z))), two);
+            // scalar * scalar - quat.Dot(quat)
+            const Vec4::FloatType squares = Vec4::Sub(Vec4::Mul(qw, qw), Vec4::Madd(qx, qx, Vec4::Madd(qy, qy, Vec4::Mul(qz, qz))));
+            // scalar * 2.0f * quat.Cross(vec3)
+            const Vec4::FloatType scalarTwo = Vec4::Mul(qw, two);
+            const Vec4::FloatType crossX = Vec4::Sub(Vec4::Mul(qy, z), Vec4::Mul(qz, y));
+            const Vec4::FloatType crossY = Vec4::Sub(Vec4::Mul(qz, x), Vec4::Mul(qx, z));
+            const Vec4::FloatType crossZ = Vec4::Sub(Vec4::Mul(qx, y), Vec4::Mul(qy, x));
+
+            x = Vec4::Madd(qx, dotTwo, Vec4::Madd(squares, x, Vec4::Mul(scalarTwo, crossX)));
+            y = Vec4::Madd(qy, dotTwo, Vec4::Madd(squares, y, Vec4::Mul(scalarTwo, crossY)));
+            z = Vec4::Madd(qz, dotTwo, Vec4::Madd(squares, z, Vec4::Mul(scalarTwo, crossZ)));
+        }
+
+        //! Returns @transform as a 3x4 matrix.
+        //! The transform is linear, so it is the matrix made of the transformed basis vectors and the translation.
+        void GetMatrixElements(const Transform& transform, float (&elements)[3][4])
+        {
+            const Vector3 basis[3] = { transform.TransformVector(Vector3::CreateAxisX()),
+                                       transform.TransformVector(Vector3::CreateAxisY()),
+                                       transform.TransformVector(Vector3::CreateAxisZ()) };
+            for (int row = 0; row < 3; ++row)
+            {
+                for (int column = 0; column < 3; ++column)
+                {
+                    elements[row][column] = basis[column].GetElement(row);
+                }
+                elements[row][3] = transform.GetTranslation().GetElement(row);
+            }
+        }
+
+        //! Transform as a 3x4 matrix, each element splatted
+        struct SplatMatrix3x4
+        {
+            explicit SplatMatrix3x4(const float (&elements)[3][4])
+            {
+                for (int row = 0; row < 3; ++row)
+                {
+                    for (int column = 0; column < 4; ++column)
+                    {
+                        m_elements[row][column] = Vec4::Splat(elements[row][column]);
+                    }
+                }
+            }
+
+            void TransformPoints(const Vector3* points, Vector3* results) const
+            {
+                Vec4::FloatType columns[BatchSize];
+                LoadTransposed(points, columns);
+                const Vec4::FloatType x = columns[0];
+                const Vec4::FloatType y = columns[1];
+                const Vec4::FloatType z = columns[2];
+                for (int row = 0; row < 3; ++row)
+                {
+                    columns[row] = Vec4::Madd(m_elements[row][0], x,
+                        Vec4::Madd(m_elements[row][1], y, Vec4::Madd(m_elements[row][2], z, m_elements[row][3])));
+                }
+                StoreTransposed(columns, results);
+            }
+
+            Vec4::FloatType m_elements[3][4];
+        };
+
+        AZ_MATH_INLINE void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* results)
+        {
+            Vec4::FloatType lhsRotation[BatchSize];
+            Vec4::FloatType rhsRotation[BatchSize];
+            Vec4::FloatType lhsTranslation[BatchSize];
+            Vec4::FloatType rhsTranslation[BatchSize];
+            LoadTransposed([lhs](size_t index) { return lhs[index].GetRotation().GetSimdValue(); }, lhsRotation);
+            LoadTransposed([rhs](size_t index) { return rhs[index].GetRotation().GetSimdValue(); }, rhsRotation);
+            LoadTransposed([lhs](size_t index) { return Vec4::FromVec3(lhs[index].GetTranslation().GetSimdValue()); }, lhsTranslation);
+            LoadTransposed([rhs](size_t index) { return Vec4::FromVec3(rhs[index].GetTranslation().GetSimdValue()); }, rhsTranslation);
+            const Vec4::FloatType lhsScale =
+                Vec4::LoadImmediate(lhs[0].GetUniformScale(), lhs[1].GetUniformScale(), lhs[2].GetUniformScale(), lhs[3].GetUniformScale());
+            const Vec4::FloatType rhsScale =
+                Vec4::LoadImmediate(rhs[0].GetUniformScale(), rhs[1].GetUniformScale(), rhs[2].GetUniformScale(), rhs[3].GetUniformScale());
+
+            const Vec4::FloatType& lx = lhsRotation[0];
+            const Vec4::FloatType& ly = lhsRotation[1];
+            const Vec4::FloatType& lz = lhsRotation[2];
+            const Vec4::FloatType& lw = lhsRotation[3];
+            const Vec4::FloatType& rx = rhsRotation[0];
+            const Vec4::FloatType& ry = rhsRotation[1];
+            const Vec4::FloatType& rz = rhsRotation[2];
+            const Vec4::FloatType& rw = rhsRotation[3];
+
+            // Same as Vec4::QuaternionMultiply
+            Vec4::FloatType rotation[BatchSize];
+            rotation[0] = Vec4::Add(Vec4::Sub(Vec4::Mul(ly, rz), Vec4::Mul(lz, ry)), Vec4::Madd(lw, rx, Vec4::Mul(lx, rw)));
+            rotation[1] = Vec4::Add(Vec4::Sub(Vec4::Mul(lz, rx), Vec4::Mul(lx, rz)), Vec4::Madd(lw, ry, Vec4::Mul(ly, rw)));
+            rotation[2] = Vec4::Add(Vec4::Sub(Vec4::Mul(lx, ry), Vec4::Mul(ly, rx)), Vec4::Madd(lw, rz, Vec4::Mul(lz, rw)));
+            rotation[3] = Vec4::Sub(Vec4::Mul(lw, rw), Vec4::Madd(lx, rx, Vec4::Madd(ly, ry, Vec4::Mul(lz, rz))));
+
+            alignas(16) float scales[BatchSize];
+            Vec4::StoreAligned(scales, Vec4::Mul(lhsScale, rhsScale));
+
+            // lhs.TransformPoint(rhs translation)
+            Vec4::FloatType translation[BatchSize];
+            translation[0] = Vec4::Mul(lhsScale, rhsTranslation[0]);
+            translation[1] = Vec4::Mul(lhsScale, rhsTranslation[1]);
+            translation[2] = Vec4::Mul(lhsScale, rhsTranslation[2]);
+            QuaternionTransform(lx, ly, lz, lw, translation[0], translation[1], translation[2]);
+            translation[0] = Vec4::Add(translation[0], lhsTranslation[0]);
+            translation[1] = Vec4::Add(translation[1], lhsTranslation[1]);
+            translation[2] = Vec4::Add(translation[2], lhsTranslation[2]);
+            translation[3] = Vec4::ZeroFloat();
+
+            Vec4::FloatType rotationRows[BatchSize];
+            Vec4::FloatType translationRows[BatchSize];
+            Vec4::Mat4x4Transpose(rotation, rotationRows);
+            Vec4::Mat4x4Transpose(translation, translationRows);
+            for (size_t index = 0; index < BatchSize; ++index)
+            {
+                results[index] = Transform(Vector3(Vec4::ToVec3(translationRows[index])), Quaternion(rotationRows[index]), scales[index]);
+            }
+        }
+
+        //! Frustum planes with each element splatted
+        struct SplatFrustum
+        {
+            explicit SplatFrustum(const Frustum& frustum)
+            {
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Plane plane = frustum.GetPlane(planeId);
+                    const Vector3 normal = plane.GetNormal();
+                    for (int axis = 0; axis < 3; ++axis)
+                    {
+                        m_normals[planeId][axis] = Vec4::Splat(normal.GetElement(axis));
+                        m_absNormals[planeId][axis] = Vec4::Splat(AZ::GetAbs(normal.GetElement(axis)));
+                    }
+                    m_distances[planeId] = Vec4::Splat(plane.GetDistance());
+                }
+            }
+
+            void Overlaps(const Aabb* aabbs, bool* results) const
+            {
+                Vec4::FloatType mins[BatchSize];
+                Vec4::FloatType maxs[BatchSize];
+                LoadTransposed([aabbs](size_t index) { return Vec4::FromVec3(aabbs[index].GetMin().GetSimdValue()); }, mins);
+                LoadTransposed([aabbs](size_t index) { return Vec4::FromVec3(aabbs[index].GetMax().GetSimdValue()); }, maxs);
+
+                // Halving before adding or subtracting, so Aabbs that reach FLT_MAX don't overflow, like ShapeIntersection::Overlaps
+                const Vec4::FloatType half = Vec4::Splat(0.5f);
+                Vec4::FloatType centers[3];
+                Vec4::FloatType extents[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const Vec4::FloatType halfMin = Vec4::Mul(mins[axis], half);
+                    const Vec4::FloatType halfMax = Vec4::Mul(maxs[axis], half);
+                    centers[axis] = Vec4::Add(halfMin, halfMax);
+                    extents[axis] = Vec4::Sub(halfMax, halfMin);
+                }
+
+                // An Aabb is outside if it is fully behind any plane
+                const Vec4::FloatType zero = Vec4::ZeroFloat();
+                Vec4::FloatType outside = Vec4::CastToFloat(Vec4::ZeroInt());
+                for (int plane = 0; plane < Frustum::PlaneId::MAX; ++plane)
+                {
+                    const Vec4::FloatType distance = Vec4::Madd(m_normals[plane][0], centers[0],
+                        Vec4::Madd(m_normals[plane][1], centers[1], Vec4::Madd(m_normals[plane][2], centers[2], m_distances[plane])));
+                    const Vec4::FloatType radius = Vec4::Madd(m_absNormals[plane][0], extents[0],
+                        Vec4::Madd(m_absNormals[plane][1], extents[1], Vec4::Mul(m_absNormals[plane][2], extents[2])));
+                    outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(distance, radius), zero));
+                }
+
+                alignas(16) int32_t outsideMask[BatchSize];
+                Vec4::StoreAligned(outsideMask, Vec4::CastToInt(outside));
+                for (size_t index = 0; index < BatchSize; ++index)
+                {
+                    results[index] = outsideMask[index] == 0;
+                }
+            }
+
+            Vec4::FloatType m_normals[Frustum::PlaneId::MAX][3];
+            Vec4::FloatType m_absNormals[Frustum::PlaneId::MAX][3];
+            Vec4::FloatType m_distances[Frustum::PlaneId::MAX];
+        };
+
+        //! Ray with each element splatted
+        struct SplatRay
+        {
+            SplatRay(const Vector3& rayStart, const Vector3& dirRCP)
+            {
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    m_starts[axis] = Vec4::Splat(rayStart.GetElement(axis));
+                    m_reciprocals[axis] = Vec4::Splat(dirRCP.GetElement(axis));
+                    // The near side of the Aabbs depends on the direction of the ray only, it is their max if the ray goes down the axis
+                    m_nearIsMax[axis] = dirRCP.GetElement(axis) < 0.0f;
+                }
+            }
+
+            void Intersect(const Aabb* aabbs, float* hitStarts) const
+            {
+                Vec4::FloatType mins[BatchSize];
+                Vec4::FloatType maxs[BatchSize];
+                LoadTransposed([aabbs](size_t index) { return Vec4::FromVec3(aabbs[index].GetMin().GetSimdValue()); }, mins);
+                LoadTransposed([aabbs](size_t index) { return Vec4::FromVec3(aabbs[index].GetMax().GetSimdValue()); }, maxs);
+
+                Vec4::FloatType nearDistances[3];
+                Vec4::FloatType farDistances[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const Vec4::FloatType& nearSide = m_nearIsMax[axis] ? maxs[axis] : mins[axis];
+                    const Vec4::FloatType& farSide = m_nearIsMax[axis] ? mins[axis] : maxs[axis];
+                    nearDistances[axis] = Vec4::Mul(Vec4::Sub(nearSide, m_starts[axis]), m_reciprocals[axis]);
+                    farDistances[axis] = Vec4::Mul(Vec4::Sub(farSide, m_starts[axis]), m_reciprocals[axis]);
+                }
+
+                const Vec4::FloatType start = Vec4::Max(Vec4::Max(nearDistances[0], nearDistances[1]), nearDistances[2]);
+                const Vec4::FloatType end = Vec4::Min(Vec4::Min(farDistances[0], farDistances[1]), farDistances[2]);
+                Vec4::StoreUnaligned(hitStarts, Vec4::Select(Vec4::Splat(Constants::FloatMax), start, Vec4::CmpGt(start, end)));
+            }
+
+            Vec4::FloatType m_starts[3];
+            Vec4::FloatType m_reciprocals[3];
+            bool m_nearIsMax[3];
+        };
+    } // namespace Internal
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+    //! Versions of the kernels processing 8 elements at once with Vec8, for CPUs supporting it.
+    //! They process the full batches of 8 elements and return their count, the Vec4 kernels process the rest.
+    namespace Avx2
+    {
+        using Simd::Vec8;
+
+        static constexpr size_t BatchSize = 8;
+
+        //! Loads the vectors of 8 elements, transposed so columns[c] holds component c of every vector.
+        template<typename GetVector>
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE void LoadTransposed(const GetVector& getVector, Vec8::FloatType* columns)
+        {
+            const Vec8::FloatType rows[4] = { Vec8::FromVec4(getVector(0), getVector(4)), Vec8::FromVec4(getVector(1), getVector(5)),
+                                              Vec8::FromVec4(getVector(2), getVector(6)), Vec8::FromVec4(getVector(3), getVector(7)) };
+            Vec8::Transpose4x4Halves(rows, columns);
+        }
+
+        AZ_SIMD_TARGET_AVX2 size_t TransformPoints(const float (&matrix)[3][4], const Vector3* points, Vector3* results, size_t size)
+        {
+            Vec8::FloatType elements[3][4];
+            for (int row = 0; row < 3; ++row)
+            {
+                for (int column = 0; column < 4; ++column)
+                {
+                    elements[row][column] = Vec8::Splat(matrix[row][column]);
+                }
+            }
+
+            size_t first = 0;
+            for (; first + BatchSize <= size; first += BatchSize)
+            {
+                const Vector3* batchPoints = points + first;
+                Vec8::FloatType columns[4];
+                LoadTransposed([batchPoints](size_t index) { return batchPoints[index].GetSimdValue(); }, columns);
+
+                Vec8::FloatType transformed[4];
+                for (int row = 0; row < 3; ++row)
+                {
+                    transformed[row] = Vec8::Madd(elements[row][0], columns[0],
+                        Vec8::Madd(elements[row][1], columns[1], Vec8::Madd(elements[row][2], columns[2], elements[row][3])));
+                }
+                transformed[3] = columns[3];
+
+                Vec8::FloatType rows[4];
+                Vec8::Transpose4x4Halves(transformed, rows);
+                Vector3* batchResults = results + first;
+                for (size_t index = 0; index < 4; ++index)
+                {
+                    batchResults[index] = Vector3(Vec8::GetLow(rows[index]));
+                    batchResults[index + 4] = Vector3(Vec8::GetHigh(rows[index]));
+                }
+            }
+            return first;
+        }
+
+        AZ_SIMD_TARGET_AVX2 size_t OverlapsFrustum(const Frustum& frustum, const Aabb* aabbs, bool* results, size_t size)
+        {
+            Vec8::FloatType normals[Frustum::PlaneId::MAX][3];
+            Vec8::FloatType absNormals[Frustum::PlaneId::MAX][3];
+            Vec8::FloatType distances[Frustum::PlaneId::MAX];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane plane = frustum.GetPlane(planeId);
+                const Vector3 normal = plane.GetNormal();
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    normals[planeId][axis] = Vec8::Splat(normal.GetElement(axis));
+                    absNormals[planeId][axis] = Vec8::Splat(AZ::GetAbs(normal.GetElement(axis)));
+                }
+                distances[planeId] = Vec8::Splat(plane.GetDistance());
+            }
+
+            const Vec8::FloatType half = Vec8::Splat(0.5f);
+            const Vec8::FloatType zero = Vec8::ZeroFloat();
+            size_t first = 0;
+            for (; first + BatchSize <= size; first += BatchSize)
+            {
+                const Aabb* batchAabbs = aabbs + first;
+                Vec8::FloatType mins[4];
+                Vec8::FloatType maxs[4];
+                LoadTransposed([batchAabbs](size_t index) { return batchAabbs[index].GetMin().GetSimdValue(); }, mins);
+                LoadTransposed([batchAabbs](size_t index) { return batchAabbs[index].GetMax().GetSimdValue(); }, maxs);
+
+                Vec8::FloatType centers[3];
+                Vec8::FloatType extents[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const Vec8::FloatType halfMin = Vec8::Mul(mins[axis], half);
+                    const Vec8::FloatType halfMax = Vec8::Mul(maxs[axis], half);
+                    centers[axis] = Vec8::Add(halfMin, halfMax);
+                    extents[axis] = Vec8::Sub(halfMax, halfMin);
+                }
+
+                Vec8::FloatType outside = Vec8::ZeroFloat();
+                for (int plane = 0; plane < Frustum::PlaneId::MAX; ++plane)
+                {
+                    const Vec8::FloatType distance = Vec8::Madd(normals[plane][0], centers[0],
+                        Vec8::Madd(normals[plane][1], centers[1], Vec8::Madd(normals[plane][2], centers[2], distances[plane])));
+                    const Vec8::FloatType radius = Vec8::Madd(absNormals[plane][0], extents[0],
+                        Vec8::Madd(absNormals[plane][1], extents[1], Vec8::Mul(absNormals[plane][2], extents[2])));
+                    outside = Vec8::Or(outside, Vec8::CmpLtEq(Vec8::Add(distance, radius), zero));
+                }
+
+                alignas(32) int32_t outsideMask[BatchSize];
+                Vec8::StoreAligned(outsideMask, Vec8::CastToInt(outside));
+                for (size_t index = 0; index < BatchSize; ++index)
+                {
+                    results[first + index] = outsideMask[index] == 0;
+                }
+            }
+            return first;
+        }
+
+        AZ_SIMD_TARGET_AVX2 size_t IntersectRayAabbs(
+            const Vector3& rayStart, const Vector3& dirRCP, const Aabb* aabbs, float* hitStarts, size_t size)
+        {
+            Vec8::FloatType starts[3];
+            Vec8::FloatType reciprocals[3];
+            bool nearIsMax[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                starts[axis] = Vec8::Splat(rayStart.GetElement(axis));
+                reciprocals[axis] = Vec8::Splat(dirRCP.GetElement(axis));
+                nearIsMax[axis] = dirRCP.GetElement(axis) < 0.0f;
+            }
+
+            const Vec8::FloatType miss = Vec8::Splat(Constants::FloatMax);
+            size_t first = 0;
+            for (; first + BatchSize <= size; first += BatchSize)
+            {
+                const Aabb* batchAabbs = aabbs + first;
+                Vec8::FloatType mins[4];
+                Vec8::FloatType maxs[4];
+                LoadTransposed([batchAabbs](size_t index) { return batchAabbs[index].GetMin().GetSimdValue(); }, mins);
+                LoadTransposed([batchAabbs](size_t index) { return batchAabbs[index].GetMax().GetSimdValue(); }, maxs);
+
+                Vec8::FloatType nearDistances[3];
+                Vec8::FloatType farDistances[3];
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    const Vec8::FloatType& nearSide = nearIsMax[axis] ? maxs[axis] : mins[axis];
+                    const Vec8::FloatType& farSide = nearIsMax[axis] ? mins[axis] : maxs[axis];
+                    nearDistances[axis] = Vec8::Mul(Vec8::Sub(nearSide, starts[axis]), reciprocals[axis]);
+                    farDistances[axis] = Vec8::Mul(Vec8::Sub(farSide, starts[axis]), reciprocals[axis]);
+                }
+
+                const Vec8::FloatType start = Vec8::Max(Vec8::Max(nearDistances[0], nearDistances[1]), nearDistances[2]);
+                const Vec8::FloatType end = Vec8::Min(Vec8::Min(farDistances[0], farDistances[1]), farDistances[2]);
+                Vec8::StoreUnaligned(hitStarts + first, Vec8::Select(miss, start, Vec8::CmpGt(start, end)));
+            }
+            return first;
+        }
+    } // namespace Avx2
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+
+    void TransformPoints(const Transform& transform, AZStd::span<const Vector3> points, AZStd::span<Vector3> results)
+    {
+        using namespace Internal;
+        AZ_Assert(results.size() >= points.size(), "The results span is smaller than the points span");
+
+        float matrixElements[3][4];
+        GetMatrixElements(transform, matrixElements);
+
+        size_t processedCount = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+        if (Simd::HasCpuFeatures(Simd::Vec8::RequiredCpuFeatures))
+        {
+            processedCount = Avx2::TransformPoints(matrixElements, points.data(), results.data(), points.size());
+        }
+#endif
+
+        const SplatMatrix3x4 matrix(matrixElements);
+        ForEachBatch(
+            processedCount,
+            points.size(),
+            [&](size_t first)
+            {
+                matrix.TransformPoints(points.data() + first, results.data() + first);
+            },
+            [&](size_t first, size_t count)
+            {
+                Vector3 paddedPoints[BatchSize];
+                Vector3 paddedResults[BatchSize];
+                PadBatch(points.data() + first, count, paddedPoints);
+                matrix.TransformPoints(paddedPoints, paddedResults);
+                AZStd::copy(paddedResults, paddedResults + count, results.data() + first);
+            });
+    }
+
+    void MultiplyTransforms(AZStd::span<const Transform> lhs, AZStd::span<const Transform> rhs, AZStd::span<Transform> results)
+    {
+        using namespace Internal;
+        AZ_Assert(lhs.size() == rhs.size(), "The lhs and rhs spans have different sizes");
+        AZ_Assert(results.size() >= lhs.size(), "The results span is smaller than the lhs span");
+
+        ForEachBatch(
+            0,
+            lhs.size(),
+            [&](size_t first)
+            {
+                Internal::MultiplyTransforms(lhs.data() + first, rhs.data() + first, results.data() + first);
+            },
+            [&](size_t first, size_t count)
+            {
+                Transform paddedLhs[BatchSize];
+                Transform paddedRhs[BatchSize];
+                Transform paddedResults[BatchSize];
+                PadBatch(lhs.data() + first, count, paddedLhs);
+                PadBatch(rhs.data() + first, count, paddedRhs);
+                Internal::MultiplyTransforms(paddedLhs, paddedRhs, paddedResults);
+                AZStd::copy(paddedResults, paddedResults + count, results.data() + first);
+            });
+    }
+
+    Aabb MergeAabbs(AZStd::span<const Aabb> aabbs)
+    {
+        if (aabbs.empty())
+        {
+            return Aabb::CreateNull();
+        }
+
+        // Several accumulators, so the min and max of consecutive Aabbs don't wait for each other
+        Vector3 mins[Internal::BatchSize];
+        Vector3 maxs[Internal::BatchSize];
+        for (size_t index = 0; index < Internal::BatchSize; ++index)
+        {
+            mins[index] = aabbs[0].GetMin();
+            maxs[index] = aabbs[0].GetMax();
+        }
+
+        size_t index = 1;
+        for (; index + Internal::BatchSize <= aabbs.size(); index += Internal::BatchSize)
+        {
+            for (size_t lane = 0; lane < Internal::BatchSize; ++lane)
+            {
+                mins[lane] = mins[lane].GetMin(aabbs[index + lane].GetMin());
+                maxs[lane] = maxs[lane].GetMax(aabbs[index + lane].GetMax());
+            }
+        }
+        for (; index < aabbs.size(); ++index)
+        {
+            mins[0] = mins[0].GetMin(aabbs[index].GetMin());
+            maxs[0] = maxs[0].GetMax(aabbs[index].GetMax());
+        }
+
+        return Aabb::CreateFromMinMax(
+            mins[0].GetMin(mins[1]).GetMin(mins[2].GetMin(mins[3])),
+            maxs[0].GetMax(maxs[1]).GetMax(maxs[2].GetMax(maxs[3])));
+    }
+
+    void OverlapsFrustum(const Frustum& frustum, AZStd::span<const Aabb> aabbs, AZStd::span<bool> results)
+    {
+        using namespace Internal;
+        AZ_Assert(results.size() >= aabbs.size(), "The results span is smaller than the aabbs span");
+
+        size_t processedCount = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+        if (Simd::HasCpuFeatures(Simd::Vec8::RequiredCpuFeatures))
+        {
+            processedCount = Avx2::OverlapsFrustum(frustum, aabbs.data(), results.data(), aabbs.size());
+        }
+#endif
+
+        const SplatFrustum splatFrustum(frustum);
+        ForEachBatch(
+            processedCount,
+            aabbs.size(),
+            [&](size_t first)
+            {
+                splatFrustum.Overlaps(aabbs.data() + first, results.data() + first);
+            },
+            [&](size_t first, size_t count)
+            {
+                Aabb paddedAabbs[BatchSize];
+                bool paddedResults[BatchSize];
+                PadBatch(aabbs.data() + first, count, paddedAabbs);
+                splatFrustum.Overlaps(paddedAabbs, paddedResults);
+                AZStd::copy(paddedResults, paddedResults + count, results.data() + first);
+            });
+    }
+
+    void IntersectRayAabbs(
+        const Vector3& rayStart, const Vector3& dirRCP, AZStd::span<const Aabb> aabbs, AZStd::span<float> hitStarts)
+    {
+        using namespace Internal;
+        AZ_Assert(hitStarts.size() >= aabbs.size(), "The hitStarts span is smaller than the aabbs span");
+
+        size_t processedCount = 0;
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+        if (Simd::HasCpuFeatures(Simd::Vec8::RequiredCpuFeatures))
+        {
+            processedCount = Avx2::IntersectRayAabbs(rayStart, dirRCP, aabbs.data(), hitStarts.data(), aabbs.size());
+        }
+#endif
+
+        const SplatRay ray(rayStart, dirRCP);
+        ForEachBatch(
+            processedCount,
+            aabbs.size(),
+            [&](size_t first)
+            {
+                ray.Intersect(aabbs.data() + first, hitStarts.data() + first);
+            },
+            [&](size_t first, size_t count)
+            {
+                Aabb paddedAabbs[BatchSize];
+                float paddedHitStarts[BatchSize];
+                PadBatch(aabbs.data() + first, count, paddedAabbs);
+                ray.Intersect(paddedAabbs, paddedHitStarts);
+                AZStd::copy(paddedHitStarts, paddedHitStarts + count, hitStarts.data() + first);
+            });
+    }
+} // namespace AZ::BatchMath
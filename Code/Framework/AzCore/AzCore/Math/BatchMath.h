@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+
+namespace AZ
+{
+    //! Batch versions of the Vector3, Transform and Aabb operations, for code that processes many elements at once such as
+    //! culling, skinning and shape queries.
+    //! Elements are processed 4 at a time: they are transposed into structure of arrays form with Simd::Vec4, so each
+    //! instruction works on the same component of 4 elements. This uses the SSE, NEON or scalar Simd backend of the platform.
+    //! The output spans must be at least as large as the input spans, and can be the same memory as the inputs.
+    namespace BatchMath
+    {
+        //! results[i] = transform.TransformPoint(points[i])
+        void TransformPoints(const Transform& transform, AZStd::span<const Vector3> points, AZStd::span<Vector3> results);
+
+        //! results[i] = lhs[i] * rhs[i]
+        void MultiplyTransforms(AZStd::span<const Transform> lhs, AZStd::span<const Transform> rhs, AZStd::span<Transform> results);
+
+        //! Returns the Aabb enclosing all of @aabbs, or a null Aabb if @aabbs is empty.
+        Aabb MergeAabbs(AZStd::span<const Aabb> aabbs);
+
+        //! results[i] = ShapeIntersection::Overlaps(frustum, aabbs[i])
+        void OverlapsFrustum(const Frustum& frustum, AZStd::span<const Aabb> aabbs, AZStd::span<bool> results);
+
+        //! Intersects a ray with each of @aabbs, like Intersect::IntersectRayAABB2.
+        //! @param rayStart Ray starting point.
+        //! @param dirRCP Ray reciprocal direction.
+        //! @param hitStarts Length on the ray of the first intersection with each Aabb, or Constants::FloatMax if the ray misses it.
+        void IntersectRayAabbs(
+            const Vector3& rayStart, const Vector3& dirRCP, AZStd::span<const Aabb> aabbs, AZStd::span<float> hitStarts);
+    } // namespace BatchMath
+} // namespace AZ
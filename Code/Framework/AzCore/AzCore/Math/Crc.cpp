@@ -7,13 +7,98 @@
  */
 
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 #include <string.h>
 
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <immintrin.h>
+#endif
+
 namespace AZ::Internal
 {
     template struct AggregateTypes<Crc32>;
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    //! Smallest size folded with carry-less multiplications, it needs 64 bytes and is slower than the table for a little more.
+    static constexpr size_t Crc32FoldMinSize = 64;
+
+    AZ_SIMD_TARGET_PCLMUL static AZ_FORCE_INLINE __m128i Crc32Load(const uint8_t* address)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(address));
+    }
+
+    //! Multiplies the 2 halves of @value by the 2 constants of @k and adds them to @next
+    AZ_SIMD_TARGET_PCLMUL static AZ_FORCE_INLINE __m128i Crc32Fold16(__m128i value, __m128i k, __m128i next)
+    {
+        return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11)), next);
+    }
+
+    //! Folds @size bytes into the running Crc32 @crc, 64 bytes at a time with carry-less multiplications, then reduces it to 32
+    //! bits. This is the algorithm of "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" from Intel, with the
+    //! constants for the bit reflected CRC-32 polynomial of crc_table. @size must be a multiple of 16, and at least 64.
+    AZ_SIMD_TARGET_PCLMUL static AZ::u32 Crc32Fold(const uint8_t* data, size_t size, AZ::u32 crc)
+    {
+        const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+        const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+        const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+        const __m128i polynomial = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+        const __m128i lowMask = _mm_setr_epi32(~0, 0, ~0, 0);
+
+        __m128i x0 = _mm_xor_si128(Crc32Load(data), _mm_cvtsi32_si128(static_cast<int>(crc)));
+        __m128i x1 = Crc32Load(data + 16);
+        __m128i x2 = Crc32Load(data + 32);
+        __m128i x3 = Crc32Load(data + 48);
+        data += 64;
+        size -= 64;
+
+        // 4 independent folds of 64 bytes
+        for (; size >= 64; data += 64, size -= 64)
+        {
+            x0 = Crc32Fold16(x0, k1k2, Crc32Load(data));
+            x1 = Crc32Fold16(x1, k1k2, Crc32Load(data + 16));
+            x2 = Crc32Fold16(x2, k1k2, Crc32Load(data + 32));
+            x3 = Crc32Fold16(x3, k1k2, Crc32Load(data + 48));
+        }
+
+        // Fold them into 128 bits, then the remaining blocks of 16 bytes
+        x0 = Crc32Fold16(x0, k3k4, x1);
+        x0 = Crc32Fold16(x0, k3k4, x2);
+        x0 = Crc32Fold16(x0, k3k4, x3);
+        for (; size >= 16; data += 16, size -= 16)
+        {
+            x0 = Crc32Fold16(x0, k3k4, Crc32Load(data));
+        }
+
+        // Fold 128 bits to 64 bits
+        x0 = _mm_xor_si128(_mm_srli_si128(x0, 8), _mm_clmulepi64_si128(x0, k3k4, 0x10));
+        x0 = _mm_xor_si128(_mm_srli_si128(x0, 4), _mm_clmulepi64_si128(_mm_and_si128(x0, lowMask), k5k0, 0x00));
+
+        // Barrett reduction to 32 bits
+        __m128i reduced = _mm_clmulepi64_si128(_mm_and_si128(x0, lowMask), polynomial, 0x10);
+        reduced = _mm_clmulepi64_si128(_mm_and_si128(reduced, lowMask), polynomial, 0x00);
+        return static_cast<AZ::u32>(_mm_extract_epi32(_mm_xor_si128(x0, reduced), 1));
+    }
+#endif
+
+    bool Crc32SetWithCpuFeatures([[maybe_unused]] const uint8_t* data, [[maybe_unused]] size_t size, [[maybe_unused]] AZ::u32& value)
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        if (size >= Crc32FoldMinSize && Simd::HasCpuFeatures(Simd::CpuFeatures::Sse41 | Simd::CpuFeatures::Pclmul))
+        {
+            const size_t foldedSize = size & ~size_t{ 15 };
+            AZ::u32 crc = Crc32Fold(data, foldedSize, 0xffffffff);
+            for (size_t index = foldedSize; index < size; ++index)
+            {
+                crc = ComputeCrc32Octet(crc, data[index]);
+            }
+            value = crc ^ 0xffffffff;
+            return true;
+        }
+#endif
+        return false;
+    }
 }
 
 namespace AZ
@@ -85,6 +85,10 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        //! Computes the Crc32 of @size bytes with the CPU's carry-less multiplication instructions, if it supports them.
+        //! Returns false if it doesn't, or if @size is too small for them to be faster.
+        bool Crc32SetWithCpuFeatures(const uint8_t* data, size_t size, AZ::u32& value);
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
@@ -93,6 +97,11 @@ namespace AZ
             {
                 value = 0;
             }
+            else if (!az_builtin_is_constant_evaluated() && !forceLowerCase &&
+                Crc32SetWithCpuFeatures(reinterpret_cast<const uint8_t*>(buf), size, value))
+            {
+                return;
+            }
             else
             {
                 unsigned int crc = 0xffffffffL;
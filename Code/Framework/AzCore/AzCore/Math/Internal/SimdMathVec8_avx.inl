@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AZ
+{
+    namespace Simd
+    {
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::FromVec4(Vec4::FloatArgType low, Vec4::FloatArgType high)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec4::FloatType Vec8::GetLow(FloatArgType value)
+        {
+            return _mm256_castps256_ps128(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec4::FloatType Vec8::GetHigh(FloatArgType value)
+        {
+            return _mm256_extractf128_ps(value, 1);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::LoadAligned(const float* __restrict addr)
+        {
+            return _mm256_load_ps(addr);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadAligned(const int32_t* __restrict addr)
+        {
+            return _mm256_load_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::LoadUnaligned(const float* __restrict addr)
+        {
+            return _mm256_loadu_ps(addr);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::LoadUnaligned(const int32_t* __restrict addr)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(addr));
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE void Vec8::StoreAligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_store_ps(addr, value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE void Vec8::StoreAligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE void Vec8::StoreUnaligned(float* __restrict addr, FloatArgType value)
+        {
+            _mm256_storeu_ps(addr, value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE void Vec8::StoreUnaligned(int32_t* __restrict addr, Int32ArgType value)
+        {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(addr), value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Splat(float value)
+        {
+            return _mm256_set1_ps(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Splat(int32_t value)
+        {
+            return _mm256_set1_epi32(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Add(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_add_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Sub(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_sub_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Mul(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_mul_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Div(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_div_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add)
+        {
+            return _mm256_fmadd_ps(mul1, mul2, add);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Abs(FloatArgType value)
+        {
+            return _mm256_and_ps(value, _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff)));
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Add(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_add_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Sub(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_sub_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Mul(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_mullo_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::And(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_and_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::AndNot(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_andnot_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Or(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_or_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Xor(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_xor_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::And(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_and_si256(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::AndNot(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_andnot_si256(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Or(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_or_si256(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Xor(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_xor_si256(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Floor(FloatArgType value)
+        {
+            return _mm256_floor_ps(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Ceil(FloatArgType value)
+        {
+            return _mm256_ceil_ps(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Min(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_min_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Max(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_max_ps(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Clamp(FloatArgType value, FloatArgType min, FloatArgType max)
+        {
+            return Max(min, Min(value, max));
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Min(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_min_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Max(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_max_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CmpEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_EQ_OQ);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CmpNeq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_NEQ_UQ);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GT_OQ);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CmpGtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_GE_OQ);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLt(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LT_OQ);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CmpLtEq(FloatArgType arg1, FloatArgType arg2)
+        {
+            return _mm256_cmp_ps(arg1, arg2, _CMP_LE_OQ);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpEq(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpeq_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpGt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg1, arg2);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::CmpLt(Int32ArgType arg1, Int32ArgType arg2)
+        {
+            return _mm256_cmpgt_epi32(arg2, arg1);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask)
+        {
+            return _mm256_blendv_ps(arg2, arg1, mask);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask)
+        {
+            return _mm256_blendv_epi8(arg2, arg1, mask);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Reciprocal(FloatArgType value)
+        {
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::Sqrt(FloatArgType value)
+        {
+            return _mm256_sqrt_ps(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE void Vec8::Transpose4x4Halves(const FloatType* __restrict rows, FloatType* __restrict out)
+        {
+            const __m256 xy01 = _mm256_unpacklo_ps(rows[0], rows[1]); // {r0.x, r1.x, r0.y, r1.y} in each half
+            const __m256 xy23 = _mm256_unpacklo_ps(rows[2], rows[3]);
+            const __m256 zw01 = _mm256_unpackhi_ps(rows[0], rows[1]); // {r0.z, r1.z, r0.w, r1.w} in each half
+            const __m256 zw23 = _mm256_unpackhi_ps(rows[2], rows[3]);
+            out[0] = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+            out[1] = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+            out[2] = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+            out[3] = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::ConvertToFloat(Int32ArgType value)
+        {
+            return _mm256_cvtepi32_ps(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::ConvertToInt(FloatArgType value)
+        {
+            return _mm256_cvttps_epi32(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::CastToFloat(Int32ArgType value)
+        {
+            return _mm256_castsi256_ps(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::CastToInt(FloatArgType value)
+        {
+            return _mm256_castps_si256(value);
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::FloatType Vec8::ZeroFloat()
+        {
+            return _mm256_setzero_ps();
+        }
+
+        AZ_SIMD_TARGET_AVX2 AZ_MATH_INLINE Vec8::Int32Type Vec8::ZeroInt()
+        {
+            return _mm256_setzero_si256();
+        }
+    }
+}
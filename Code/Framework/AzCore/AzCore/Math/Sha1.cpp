@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/std/utils.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <immintrin.h>
+#endif
+
+namespace AZ
+{
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+    namespace Sha1Internal
+    {
+        //! State of the Sha instructions while processing a block
+        struct ShaState
+        {
+            __m128i m_abcd; //!< a in the highest element
+            __m128i m_e; //!< Added to the first message words of the next 4 rounds
+            __m128i m_messages[4]; //!< Message words of the rounds, 4 per element, message group g is in m_messages[g % 4]
+        };
+
+        //! Computes the rounds 4 * Group to 4 * Group + 3 of a block, and the message words of the later groups which depend on
+        //! the words of this group: their w[i - 3], w[i - 8], w[i - 14] and w[i - 16] terms.
+        template<int Group>
+        AZ_SIMD_TARGET_SHA AZ_FORCE_INLINE void Rounds(ShaState& state, const AZStd::byte* block, __m128i byteSwapMask)
+        {
+            __m128i (&messages)[4] = state.m_messages;
+            if constexpr (Group < 4)
+            {
+                messages[Group] = _mm_shuffle_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + Group * 16)), byteSwapMask);
+            }
+
+            const __m128i e = Group == 0 ? _mm_add_epi32(state.m_e, messages[0]) : _mm_sha1nexte_epu32(state.m_e, messages[Group % 4]);
+            state.m_e = state.m_abcd;
+            state.m_abcd = _mm_sha1rnds4_epu32(state.m_abcd, e, Group / 5);
+
+            if constexpr (Group >= 3 && Group <= 18)
+            {
+                messages[(Group + 1) % 4] = _mm_sha1msg2_epu32(messages[(Group + 1) % 4], messages[Group % 4]);
+            }
+            if constexpr (Group >= 2 && Group <= 17)
+            {
+                messages[(Group + 2) % 4] = _mm_xor_si128(messages[(Group + 2) % 4], messages[Group % 4]);
+            }
+            if constexpr (Group >= 1 && Group <= 16)
+            {
+                messages[(Group + 3) % 4] = _mm_sha1msg1_epu32(messages[(Group + 3) % 4], messages[Group % 4]);
+            }
+        }
+
+        template<int... Groups>
+        AZ_SIMD_TARGET_SHA AZ_FORCE_INLINE void AllRounds(
+            ShaState& state, const AZStd::byte* block, __m128i byteSwapMask, AZStd::integer_sequence<int, Groups...>)
+        {
+            (Rounds<Groups>(state, block, byteSwapMask), ...);
+        }
+
+        //! ProcessBlocks with the Sha instructions, following the Intel sample code of "New Instructions Supporting the Secure
+        //! Hash Algorithm on Intel Architecture Processors".
+        AZ_SIMD_TARGET_SHA void ProcessBlocks(AZ::u32 (&h)[5], const AZStd::byte* blocks, size_t blockCount)
+        {
+            // Message words are big endian
+            const __m128i byteSwapMask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+
+            __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(h)), 0x1b);
+            __m128i e = _mm_set_epi32(static_cast<int>(h[4]), 0, 0, 0);
+            for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+            {
+                ShaState state{ abcd, e, {} };
+                AllRounds(state, blocks + blockIndex * 64, byteSwapMask, AZStd::make_integer_sequence<int, 20>{});
+
+                // state.m_e holds a of the state before the last 4 rounds, which gives e after them
+                e = _mm_sha1nexte_epu32(state.m_e, e);
+                abcd = _mm_add_epi32(state.m_abcd, abcd);
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(h), _mm_shuffle_epi32(abcd, 0x1b));
+            h[4] = static_cast<AZ::u32>(_mm_extract_epi32(e, 3));
+        }
+    } // namespace Sha1Internal
+#endif
+
+    void Sha1::ProcessBlocks(AZ::u32 (&h)[5], const AZStd::byte* blocks, size_t blockCount)
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        if (Simd::HasCpuFeatures(Simd::CpuFeatures::Sse41 | Simd::CpuFeatures::Sha))
+        {
+            Sha1Internal::ProcessBlocks(h, blocks, blockCount);
+            return;
+        }
+#endif
+        for (size_t blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+        {
+            ProcessBlock(h, blocks + blockIndex * BlockSize);
+        }
+    }
+} // namespace AZ
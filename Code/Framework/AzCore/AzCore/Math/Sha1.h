@@ -30,9 +30,14 @@ namespace AZ
         constexpr void GetDigest(DigestType digest);
 
     private:
+        static constexpr size_t BlockSize = 64;
+
         constexpr void ProcessBlock();
+        static constexpr void ProcessBlock(AZ::u32 (&h)[5], const AZStd::byte* block);
+        //! Runtime version of ProcessBlock for @blockCount consecutive blocks, using the Sha instructions if the CPU supports them
+        static void ProcessBlocks(AZ::u32 (&h)[5], const AZStd::byte* blocks, size_t blockCount);
 
-        AZ_FORCE_INLINE constexpr AZ::u32 LeftRotate(AZ::u32 x, size_t n)
+        AZ_FORCE_INLINE static constexpr AZ::u32 LeftRotate(AZ::u32 x, size_t n)
         {
             return (x << n) ^ (x >> (32 - n));
         }
@@ -68,7 +73,7 @@ namespace AZ
     {
         m_block[m_blockByteIndex++] = byte;
         ++m_byteCount;
-        if (m_blockByteIndex == 64)
+        if (m_blockByteIndex == BlockSize)
         {
             m_blockByteIndex = 0;
             ProcessBlock();
@@ -77,6 +82,25 @@ namespace AZ
 
     inline constexpr void Sha1::ProcessBytes(AZStd::span<AZStd::byte const> byteSpan)
     {
+        if (!az_builtin_is_constant_evaluated())
+        {
+            // Complete the pending block, then process the whole blocks in place
+            size_t index = 0;
+            for (; m_blockByteIndex != 0 && index < byteSpan.size(); ++index)
+            {
+                ProcessByte(byteSpan[index]);
+            }
+
+            const size_t blockCount = (byteSpan.size() - index) / BlockSize;
+            if (blockCount > 0)
+            {
+                ProcessBlocks(m_h, byteSpan.data() + index, blockCount);
+                index += blockCount * BlockSize;
+                m_byteCount += blockCount * BlockSize;
+            }
+            byteSpan = byteSpan.subspan(index);
+        }
+
         for (AZStd::byte byteElement : byteSpan)
         {
             ProcessByte(byteElement);
@@ -89,25 +113,37 @@ namespace AZ
     }
 
     inline constexpr void Sha1::ProcessBlock()
+    {
+        if (az_builtin_is_constant_evaluated())
+        {
+            ProcessBlock(m_h, m_block);
+        }
+        else
+        {
+            ProcessBlocks(m_h, m_block, 1);
+        }
+    }
+
+    inline constexpr void Sha1::ProcessBlock(AZ::u32 (&h)[5], const AZStd::byte* block)
     {
         AZ::u32 w[80]{ 0 };
         for (size_t i = 0; i < 16; ++i)
         {
-            w[i] = static_cast<AZ::u32>(m_block[i * 4 + 0]) << 24;
-            w[i] |= static_cast<AZ::u32>(m_block[i * 4 + 1]) << 16;
-            w[i] |= static_cast<AZ::u32>(m_block[i * 4 + 2]) << 8;
-            w[i] |= static_cast<AZ::u32>(m_block[i * 4 + 3]);
+            w[i] = static_cast<AZ::u32>(block[i * 4 + 0]) << 24;
+            w[i] |= static_cast<AZ::u32>(block[i * 4 + 1]) << 16;
+            w[i] |= static_cast<AZ::u32>(block[i * 4 + 2]) << 8;
+            w[i] |= static_cast<AZ::u32>(block[i * 4 + 3]);
         }
         for (size_t i = 16; i < 80; ++i)
         {
             w[i] = LeftRotate((w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16]), 1);
         }
 
-        AZ::u32 a = m_h[0];
-        AZ::u32 b = m_h[1];
-        AZ::u32 c = m_h[2];
-        AZ::u32 d = m_h[3];
-        AZ::u32 e = m_h[4];
+        AZ::u32 a = h[0];
+        AZ::u32 b = h[1];
+        AZ::u32 c = h[2];
+        AZ::u32 d = h[3];
+        AZ::u32 e = h[4];
 
         for (size_t i = 0; i < 80; ++i)
         {
@@ -143,11 +179,11 @@ namespace AZ
             a = temp;
         }
 
-        m_h[0] += a;
-        m_h[1] += b;
-        m_h[2] += c;
-        m_h[3] += d;
-        m_h[4] += e;
+        h[0] += a;
+        h[1] += b;
+        h[2] += c;
+        h[3] += d;
+        h[4] += e;
     }
 
     inline constexpr void Sha1::GetDigest(DigestType digest)
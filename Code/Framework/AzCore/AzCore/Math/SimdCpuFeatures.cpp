@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/std/parallel/atomic.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   if defined(AZ_COMPILER_MSVC)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#endif
+
+namespace AZ::Simd
+{
+    namespace
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        struct CpuIdRegisters
+        {
+            AZ::u32 m_eax = 0;
+            AZ::u32 m_ebx = 0;
+            AZ::u32 m_ecx = 0;
+            AZ::u32 m_edx = 0;
+        };
+
+        CpuIdRegisters CpuId(AZ::u32 leaf, AZ::u32 subleaf)
+        {
+            CpuIdRegisters registers;
+#if defined(AZ_COMPILER_MSVC)
+            int values[4];
+            __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+            registers = { static_cast<AZ::u32>(values[0]), static_cast<AZ::u32>(values[1]), static_cast<AZ::u32>(values[2]),
+                          static_cast<AZ::u32>(values[3]) };
+#else
+            __cpuid_count(leaf, subleaf, registers.m_eax, registers.m_ebx, registers.m_ecx, registers.m_edx);
+#endif
+            return registers;
+        }
+
+        //! Returns the register states the OS saves on context switches, the wider registers can't be used without it
+        AZ::u64 GetEnabledRegisterStates()
+        {
+#if defined(AZ_COMPILER_MSVC)
+            return _xgetbv(0);
+#else
+            AZ::u32 eax = 0;
+            AZ::u32 edx = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<AZ::u64>(edx) << 32) | eax;
+#endif
+        }
+
+        bool HasBit(AZ::u32 value, int bit)
+        {
+            return (value & (1u << bit)) != 0;
+        }
+
+        CpuFeatures DetectCpuFeatures()
+        {
+            const AZ::u32 maxLeaf = CpuId(0, 0).m_eax;
+            if (maxLeaf < 1)
+            {
+                return CpuFeatures::None;
+            }
+
+            CpuFeatures features = CpuFeatures::None;
+            const CpuIdRegisters leaf1 = CpuId(1, 0);
+            features |= HasBit(leaf1.m_ecx, 19) ? CpuFeatures::Sse41 : CpuFeatures::None;
+            features |= HasBit(leaf1.m_ecx, 20) ? CpuFeatures::Sse42 : CpuFeatures::None;
+            features |= HasBit(leaf1.m_ecx, 1) ? CpuFeatures::Pclmul : CpuFeatures::None;
+
+            const CpuIdRegisters leaf7 = maxLeaf >= 7 ? CpuId(7, 0) : CpuIdRegisters{};
+            features |= HasBit(leaf7.m_ebx, 29) ? CpuFeatures::Sha : CpuFeatures::None;
+
+            // The AVX registers are only usable if the OS saves them, which it reports through xgetbv
+            const bool osSavesRegisters = HasBit(leaf1.m_ecx, 27);
+            const AZ::u64 registerStates = osSavesRegisters ? GetEnabledRegisterStates() : 0;
+            constexpr AZ::u64 YmmStates = 0x6; // SSE and AVX
+            constexpr AZ::u64 ZmmStates = 0xe6; // SSE, AVX, opmask and both halves of the AVX-512 registers
+            if ((registerStates & YmmStates) == YmmStates && HasBit(leaf1.m_ecx, 28))
+            {
+                features |= CpuFeatures::Avx;
+                features |= HasBit(leaf1.m_ecx, 12) ? CpuFeatures::Fma : CpuFeatures::None;
+                features |= HasBit(leaf7.m_ebx, 5) ? CpuFeatures::Avx2 : CpuFeatures::None;
+
+                if ((registerStates & ZmmStates) == ZmmStates && HasBit(leaf7.m_ebx, 16))
+                {
+                    features |= CpuFeatures::Avx512F;
+                    features |= HasBit(leaf7.m_ebx, 31) ? CpuFeatures::Avx512Vl : CpuFeatures::None;
+                    features |= HasBit(leaf7.m_ebx, 30) ? CpuFeatures::Avx512Bw : CpuFeatures::None;
+                    features |= HasBit(leaf7.m_ebx, 17) ? CpuFeatures::Avx512Dq : CpuFeatures::None;
+                }
+            }
+            return features;
+        }
+#else
+        CpuFeatures DetectCpuFeatures()
+        {
+            return CpuFeatures::None;
+        }
+#endif
+
+        CpuFeatures GetDetectedCpuFeatures()
+        {
+            static const CpuFeatures s_detectedCpuFeatures = DetectCpuFeatures();
+            return s_detectedCpuFeatures;
+        }
+
+        AZStd::atomic<AZ::u32> s_disabledCpuFeatures{ 0 };
+    } // namespace
+
+    CpuFeatures GetCpuFeatures()
+    {
+        return GetDetectedCpuFeatures() & ~CpuFeatures(s_disabledCpuFeatures.load(AZStd::memory_order_relaxed));
+    }
+
+    bool HasCpuFeatures(CpuFeatures features)
+    {
+        return (GetCpuFeatures() & features) == features;
+    }
+
+    void SetDisabledCpuFeatures(CpuFeatures features)
+    {
+        s_disabledCpuFeatures.store(static_cast<AZ::u32>(features), AZStd::memory_order_relaxed);
+    }
+
+    CpuFeatures GetDisabledCpuFeatures()
+    {
+        return CpuFeatures(s_disabledCpuFeatures.load(AZStd::memory_order_relaxed));
+    }
+} // namespace AZ::Simd
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/typetraits/underlying_type.h>
+
+// Builds are compiled for the SSE4 baseline of the platform. Functions using later instruction sets are marked with these
+// macros so the compiler can generate those instructions for them only, and must only be called after checking HasCpuFeatures.
+// MSVC accepts any instruction set intrinsics without marking the functions.
+#if defined(__clang__) || defined(__GNUC__)
+#   define AZ_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#   define AZ_SIMD_TARGET_PCLMUL __attribute__((target("sse4.1,pclmul")))
+#   define AZ_SIMD_TARGET_SHA __attribute__((target("sse4.1,sha")))
+#else
+#   define AZ_SIMD_TARGET_AVX2
+#   define AZ_SIMD_TARGET_PCLMUL
+#   define AZ_SIMD_TARGET_SHA
+#endif
+
+namespace AZ::Simd
+{
+    //! Instruction set extensions which code can check for at runtime before using them.
+    enum class CpuFeatures : AZ::u32
+    {
+        None = 0,
+        Sse41 = 1 << 0,
+        Sse42 = 1 << 1,
+        Pclmul = 1 << 2, //!< Carry-less multiplication, used to compute Crc32 values
+        Sha = 1 << 3, //!< Sha1 and Sha256 rounds
+        Avx = 1 << 4,
+        Avx2 = 1 << 5,
+        Fma = 1 << 6,
+        Avx512F = 1 << 7,
+        Avx512Vl = 1 << 8,
+        Avx512Bw = 1 << 9,
+        Avx512Dq = 1 << 10
+    };
+    AZ_DEFINE_ENUM_BITWISE_OPERATORS(CpuFeatures);
+
+    //! Returns the instruction set extensions supported by both the CPU and the OS, minus the ones disabled with SetDisabledCpuFeatures.
+    //! Always returns CpuFeatures::None on platforms other than x86.
+    CpuFeatures GetCpuFeatures();
+
+    //! Returns true if all of @features are available.
+    bool HasCpuFeatures(CpuFeatures features);
+
+    //! Makes HasCpuFeatures return false for @features, so the code checking for them uses its baseline path instead.
+    //! Used to compare both paths in tests and benchmarks, or to work around issues with a CPU.
+    void SetDisabledCpuFeatures(CpuFeatures features);
+    CpuFeatures GetDisabledCpuFeatures();
+} // namespace AZ::Simd
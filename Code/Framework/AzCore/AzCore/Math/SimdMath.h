@@ -21,6 +21,11 @@
 #   endif
 #endif
 
+// The AVX instruction sets are never part of the compile time baseline, see SimdMathVec8.h and SimdCpuFeatures.h
+#if !defined(AZ_TRAIT_USE_PLATFORM_SIMD_AVX)
+#   define AZ_TRAIT_USE_PLATFORM_SIMD_AVX AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#endif
+
 namespace AZ
 {
     namespace Simd
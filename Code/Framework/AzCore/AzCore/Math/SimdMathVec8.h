@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/Math/SimdMath.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+
+#include <immintrin.h>
+
+namespace AZ
+{
+    namespace Simd
+    {
+        //! 8 wide float and int types using AVX2 and FMA.
+        //! These instructions are not part of the compile time baseline, so Vec8 functions can only be called from functions marked
+        //! with AZ_SIMD_TARGET_AVX2, after checking HasCpuFeatures(Vec8::RequiredCpuFeatures).
+        struct Vec8
+        {
+            static constexpr int32_t ElementCount = 8;
+            static constexpr CpuFeatures RequiredCpuFeatures = CpuFeatures::Avx | CpuFeatures::Avx2 | CpuFeatures::Fma;
+
+            using FloatType = __m256;
+            using Int32Type = __m256i;
+            using FloatArgType = FloatType;
+            using Int32ArgType = Int32Type;
+
+            AZ_SIMD_TARGET_AVX2 static FloatType FromVec4(Vec4::FloatArgType low, Vec4::FloatArgType high); // Generates Vec8 {low.xyzw, high.xyzw}
+            AZ_SIMD_TARGET_AVX2 static Vec4::FloatType GetLow(FloatArgType value);
+            AZ_SIMD_TARGET_AVX2 static Vec4::FloatType GetHigh(FloatArgType value);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType LoadAligned(const float* __restrict addr); // addr *must* be 32-byte aligned
+            AZ_SIMD_TARGET_AVX2 static Int32Type LoadAligned(const int32_t* __restrict addr); // addr *must* be 32-byte aligned
+            AZ_SIMD_TARGET_AVX2 static FloatType LoadUnaligned(const float* __restrict addr);
+            AZ_SIMD_TARGET_AVX2 static Int32Type LoadUnaligned(const int32_t* __restrict addr);
+
+            AZ_SIMD_TARGET_AVX2 static void StoreAligned(float* __restrict addr, FloatArgType value); // addr *must* be 32-byte aligned
+            AZ_SIMD_TARGET_AVX2 static void StoreAligned(int32_t* __restrict addr, Int32ArgType value); // addr *must* be 32-byte aligned
+            AZ_SIMD_TARGET_AVX2 static void StoreUnaligned(float* __restrict addr, FloatArgType value);
+            AZ_SIMD_TARGET_AVX2 static void StoreUnaligned(int32_t* __restrict addr, Int32ArgType value);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType Splat(float value);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Splat(int32_t value);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType Add(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Sub(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Mul(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Madd(FloatArgType mul1, FloatArgType mul2, FloatArgType add); // Fused, rounds once
+            AZ_SIMD_TARGET_AVX2 static FloatType Div(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Abs(FloatArgType value);
+
+            AZ_SIMD_TARGET_AVX2 static Int32Type Add(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Sub(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Mul(Int32ArgType arg1, Int32ArgType arg2);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType And(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType AndNot(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Or(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Xor(FloatArgType arg1, FloatArgType arg2);
+
+            AZ_SIMD_TARGET_AVX2 static Int32Type And(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type AndNot(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Or(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Xor(Int32ArgType arg1, Int32ArgType arg2);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType Floor(FloatArgType value);
+            AZ_SIMD_TARGET_AVX2 static FloatType Ceil(FloatArgType value);
+            AZ_SIMD_TARGET_AVX2 static FloatType Min(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Max(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType Clamp(FloatArgType value, FloatArgType min, FloatArgType max);
+
+            AZ_SIMD_TARGET_AVX2 static Int32Type Min(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Max(Int32ArgType arg1, Int32ArgType arg2);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType CmpEq(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType CmpNeq(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType CmpGt(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType CmpGtEq(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType CmpLt(FloatArgType arg1, FloatArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static FloatType CmpLtEq(FloatArgType arg1, FloatArgType arg2);
+
+            AZ_SIMD_TARGET_AVX2 static Int32Type CmpEq(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type CmpGt(Int32ArgType arg1, Int32ArgType arg2);
+            AZ_SIMD_TARGET_AVX2 static Int32Type CmpLt(Int32ArgType arg1, Int32ArgType arg2);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType Select(FloatArgType arg1, FloatArgType arg2, FloatArgType mask);
+            AZ_SIMD_TARGET_AVX2 static Int32Type Select(Int32ArgType arg1, Int32ArgType arg2, Int32ArgType mask);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType Reciprocal(FloatArgType value); // Slow, but full accuracy
+            AZ_SIMD_TARGET_AVX2 static FloatType Sqrt(FloatArgType value); // Slow, but full accuracy
+
+            // Transposes each 128 bit half of rows as a 4x4 matrix, like Vec4::Mat4x4Transpose.
+            // Loading rows[i] from FromVec4(vectors[i], vectors[i + 4]) gives out[c] holding component c of all 8 vectors.
+            AZ_SIMD_TARGET_AVX2 static void Transpose4x4Halves(const FloatType* __restrict rows, FloatType* __restrict out);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType ConvertToFloat(Int32ArgType value);
+            AZ_SIMD_TARGET_AVX2 static Int32Type ConvertToInt(FloatArgType value); // Truncates
+
+            AZ_SIMD_TARGET_AVX2 static FloatType CastToFloat(Int32ArgType value);
+            AZ_SIMD_TARGET_AVX2 static Int32Type CastToInt(FloatArgType value);
+
+            AZ_SIMD_TARGET_AVX2 static FloatType ZeroFloat();
+            AZ_SIMD_TARGET_AVX2 static Int32Type ZeroInt();
+        };
+    }
+}
+
+#include <AzCore/Math/Internal/SimdMathVec8_avx.inl>
+
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_AVX
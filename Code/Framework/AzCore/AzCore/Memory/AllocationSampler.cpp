@@ -0,0 +1,326 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Metrics/IEventLogger.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+
+#include <math.h>
+
+namespace AZ::Debug
+{
+    namespace AllocationSamplerInternal
+    {
+        // Bytes the calling thread can allocate before its next sample. Shared by all the samplers, which doesn't bias the
+        // sampling as the distance to the next sample is memoryless.
+        static AZ_THREAD_LOCAL int64_t s_bytesUntilSample = 0;
+        // Sampling interval s_bytesUntilSample was drawn with, it is drawn again when the interval changes
+        static AZ_THREAD_LOCAL size_t s_bytesUntilSampleInterval = 0;
+        // Set while the calling thread is sampling, the maps of the samplers can allocate from the sampled allocator
+        static AZ_THREAD_LOCAL bool s_isSampling = false;
+        static AZ_THREAD_LOCAL uint64_t s_randomState = 0;
+
+        //! xorshift64*, a cheap generator is enough to draw the sample distances
+        static uint64_t NextRandom()
+        {
+            if (s_randomState == 0)
+            {
+                // Seed every thread differently, so threads don't sample in lockstep
+                const uint64_t threadId = static_cast<uint64_t>(AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id()));
+                s_randomState = (threadId ^ reinterpret_cast<uintptr_t>(&s_randomState)) | 1;
+            }
+            s_randomState ^= s_randomState >> 12;
+            s_randomState ^= s_randomState << 25;
+            s_randomState ^= s_randomState >> 27;
+            return s_randomState * 0x2545F4914F6CDD1Dull;
+        }
+
+        static size_t HashFrames(const StackFrame* frames, unsigned int frameCount)
+        {
+            // FNV-1a over the program counters
+            size_t hash = 14695981039346656037ull;
+            for (unsigned int frame = 0; frame < frameCount; ++frame)
+            {
+                hash ^= static_cast<size_t>(frames[frame].m_programCounter);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        //! Clears s_isSampling when leaving the sampler
+        struct SamplingScope
+        {
+            SamplingScope()
+            {
+                s_isSampling = true;
+            }
+            ~SamplingScope()
+            {
+                s_isSampling = false;
+            }
+        };
+    } // namespace AllocationSamplerInternal
+
+    AllocationSampler::AllocationSampler() = default;
+
+    AllocationSampler::~AllocationSampler()
+    {
+        Stop();
+        if (m_filter)
+        {
+            AZStd::stateless_allocator().deallocate(m_filter, sizeof(AZStd::atomic<uint16_t>) * FilterSize, alignof(AZStd::atomic<uint16_t>));
+            m_filter = nullptr;
+        }
+    }
+
+    void AllocationSampler::Start(size_t samplingInterval)
+    {
+        using namespace AllocationSamplerInternal;
+        SamplingScope samplingScope;
+
+        AZStd::scoped_lock lock(m_mutex);
+        if (!m_filter)
+        {
+            void* filterMemory = AZStd::stateless_allocator().allocate(sizeof(AZStd::atomic<uint16_t>) * FilterSize, alignof(AZStd::atomic<uint16_t>));
+            m_filter = reinterpret_cast<AZStd::atomic<uint16_t>*>(filterMemory);
+            for (size_t index = 0; index < FilterSize; ++index)
+            {
+                new (&m_filter[index]) AZStd::atomic<uint16_t>(uint16_t{ 0 });
+            }
+        }
+        m_samplingInterval.store(AZStd::max<size_t>(samplingInterval, 1), AZStd::memory_order_relaxed);
+        m_active.store(true, AZStd::memory_order_release);
+    }
+
+    void AllocationSampler::Stop()
+    {
+        using namespace AllocationSamplerInternal;
+        SamplingScope samplingScope;
+
+        AZStd::scoped_lock lock(m_mutex);
+        m_active.store(false, AZStd::memory_order_relaxed);
+        m_liveSamples.clear();
+        m_callSites.clear();
+        if (m_filter)
+        {
+            for (size_t index = 0; index < FilterSize; ++index)
+            {
+                m_filter[index].store(0, AZStd::memory_order_relaxed);
+            }
+        }
+        m_liveSampleCount.store(0, AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetSamplingInterval() const
+    {
+        return m_samplingInterval.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::NextSampleDistance() const
+    {
+        // Exponentially distributed distance with a mean of the sampling interval, so the samples form a Poisson process over the
+        // allocated bytes. The top 53 bits of the random number give a uniform double in (0, 1].
+        const double uniform = (static_cast<double>(AllocationSamplerInternal::NextRandom() >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+        const double distance = -log(uniform) * static_cast<double>(GetSamplingInterval());
+        return AZStd::max<size_t>(static_cast<size_t>(distance), 1);
+    }
+
+    size_t AllocationSampler::GetFilterIndex(void* address)
+    {
+        // Fibonacci hashing, allocations are at least 16 bytes aligned so the low bits carry no information
+        return static_cast<size_t>(((reinterpret_cast<uint64_t>(address) >> 4) * 0x9E3779B97F4A7C15ull) >> 48) & (FilterSize - 1);
+    }
+
+    void AllocationSampler::SampleAllocation(void* address, size_t byteSize, unsigned int stackFramesToSkip)
+    {
+        using namespace AllocationSamplerInternal;
+        if (s_isSampling)
+        {
+            return;
+        }
+
+        const size_t samplingInterval = GetSamplingInterval();
+        if (s_bytesUntilSampleInterval != samplingInterval)
+        {
+            s_bytesUntilSample = static_cast<int64_t>(NextSampleDistance());
+            s_bytesUntilSampleInterval = samplingInterval;
+        }
+        s_bytesUntilSample -= static_cast<int64_t>(byteSize);
+        if (s_bytesUntilSample > 0)
+        {
+            return;
+        }
+
+        SamplingScope samplingScope;
+
+        // Allocations larger than the interval can cross several sample points, skip all of them
+        do
+        {
+            s_bytesUntilSample += static_cast<int64_t>(NextSampleDistance());
+        } while (s_bytesUntilSample <= 0);
+
+        // An allocation of byteSize bytes is sampled with a probability of 1 - e^(-byteSize / interval),
+        // its weight is the number of bytes it represents
+        const double sampleProbability = -expm1(-static_cast<double>(byteSize) / static_cast<double>(samplingInterval));
+        const size_t weight = sampleProbability > 0.0 ? static_cast<size_t>(static_cast<double>(byteSize) / sampleProbability) : byteSize;
+
+        StackFrame frames[MaxStackFrames];
+        const unsigned int frameCount = StackRecorder::Record(frames, MaxStackFrames, stackFramesToSkip + 1);
+        const size_t callSiteHash = HashFrames(frames, frameCount);
+
+        AZStd::scoped_lock lock(m_mutex);
+        if (!m_active.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        auto [liveSampleIt, inserted] = m_liveSamples.emplace(address, LiveSample{ callSiteHash, weight });
+        if (!inserted)
+        {
+            // The previous allocation at this address was freed without OnDeallocation, drop its sample
+            LiveSample& staleSample = liveSampleIt->second;
+            if (auto staleCallSite = m_callSites.find(staleSample.m_callSiteHash); staleCallSite != m_callSites.end())
+            {
+                staleCallSite->second.m_liveBytes -= staleSample.m_weight;
+                --staleCallSite->second.m_liveSamples;
+            }
+            staleSample = LiveSample{ callSiteHash, weight };
+        }
+        else
+        {
+            m_filter[GetFilterIndex(address)].fetch_add(1, AZStd::memory_order_relaxed);
+            m_liveSampleCount.fetch_add(1, AZStd::memory_order_relaxed);
+        }
+
+        auto callSiteIt = m_callSites.find(callSiteHash);
+        if (callSiteIt == m_callSites.end())
+        {
+            callSiteIt = m_callSites.emplace(callSiteHash, CallSite{}).first;
+            CallSite& callSite = callSiteIt->second;
+            AZStd::copy(frames, frames + frameCount, callSite.m_frames);
+            callSite.m_frameCount = frameCount;
+        }
+        CallSite& callSite = callSiteIt->second;
+        callSite.m_liveBytes += weight;
+        ++callSite.m_liveSamples;
+        ++callSite.m_totalSamples;
+    }
+
+    void AllocationSampler::RemoveSample(void* address)
+    {
+        using namespace AllocationSamplerInternal;
+
+        AZStd::atomic<uint16_t>& filter = m_filter[GetFilterIndex(address)];
+        if (filter.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        SamplingScope samplingScope;
+        AZStd::scoped_lock lock(m_mutex);
+        auto liveSampleIt = m_liveSamples.find(address);
+        if (liveSampleIt == m_liveSamples.end())
+        {
+            return;
+        }
+
+        if (auto callSiteIt = m_callSites.find(liveSampleIt->second.m_callSiteHash); callSiteIt != m_callSites.end())
+        {
+            callSiteIt->second.m_liveBytes -= liveSampleIt->second.m_weight;
+            --callSiteIt->second.m_liveSamples;
+        }
+        m_liveSamples.erase(liveSampleIt);
+        filter.fetch_sub(1, AZStd::memory_order_relaxed);
+        m_liveSampleCount.fetch_sub(1, AZStd::memory_order_relaxed);
+    }
+
+    auto AllocationSampler::GetCallSites() const -> CallSiteVector
+    {
+        AllocationSamplerInternal::SamplingScope samplingScope;
+
+        CallSiteVector callSites;
+        {
+            AZStd::scoped_lock lock(m_mutex);
+            callSites.reserve(m_callSites.size());
+            for (const auto& [callSiteHash, callSite] : m_callSites)
+            {
+                if (callSite.m_liveSamples > 0)
+                {
+                    callSites.push_back(callSite);
+                }
+            }
+        }
+
+        AZStd::sort(
+            callSites.begin(), callSites.end(),
+            [](const CallSite& lhs, const CallSite& rhs)
+            {
+                return lhs.m_liveBytes > rhs.m_liveBytes;
+            });
+        return callSites;
+    }
+
+    size_t AllocationSampler::GetLiveBytes() const
+    {
+        AZStd::scoped_lock lock(m_mutex);
+        size_t liveBytes = 0;
+        for (const auto& [callSiteHash, callSite] : m_callSites)
+        {
+            liveBytes += callSite.m_liveBytes;
+        }
+        return liveBytes;
+    }
+
+    void AllocationSampler::ReportCallSites(Metrics::IEventLogger& eventLogger, size_t maxCallSites) const
+    {
+        const CallSiteVector callSites = GetCallSites();
+
+        size_t liveBytes = 0;
+        for (const CallSite& callSite : callSites)
+        {
+            liveBytes += callSite.m_liveBytes;
+        }
+
+        SymbolStorage::StackLine stackLines[MaxStackFrames];
+        const size_t reportedCallSites = AZStd::min(maxCallSites, callSites.size());
+        for (size_t index = 0; index < reportedCallSites; ++index)
+        {
+            const CallSite& callSite = callSites[index];
+            SymbolStorage::DecodeFrames(callSite.m_frames, callSite.m_frameCount, stackLines);
+
+            Metrics::EventArrayStorage stack;
+            for (unsigned int frame = 0; frame < callSite.m_frameCount && frame < stack.capacity(); ++frame)
+            {
+                stack.emplace_back(AZStd::string_view(stackLines[frame]));
+            }
+
+            Metrics::EventObjectStorage args;
+            args.emplace_back("liveBytes", Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, callSite.m_liveBytes });
+            args.emplace_back("liveSamples", Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, callSite.m_liveSamples });
+            args.emplace_back("totalSamples", Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, callSite.m_totalSamples });
+            args.emplace_back("stack", Metrics::EventArray(stack));
+
+            Metrics::InstantArgs instantArgs;
+            instantArgs.m_name = "SampledCallSite";
+            instantArgs.m_cat = "Memory";
+            instantArgs.m_args = args;
+            instantArgs.m_scope = Metrics::InstantEventScope::Process;
+            eventLogger.RecordInstantEvent(instantArgs);
+        }
+
+        Metrics::EventObjectStorage counterArgsFields;
+        counterArgsFields.emplace_back("liveBytes", Metrics::EventValue{ AZStd::in_place_type<AZ::u64>, liveBytes });
+        Metrics::CounterArgs counterArgs;
+        counterArgs.m_name = "SampledLiveBytes";
+        counterArgs.m_cat = "Memory";
+        counterArgs.m_args = counterArgsFields;
+        eventLogger.RecordCounterEvent(counterArgs);
+    }
+} // namespace AZ::Debug
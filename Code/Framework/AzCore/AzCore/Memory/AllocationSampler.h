@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/std/allocator_stateless.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::Metrics
+{
+    class IEventLogger;
+}
+
+namespace AZ::Debug
+{
+    /**
+     * Allocation sampling profiler, cheap enough to stay enabled in production.
+     * Instead of recording every allocation like the AllocationRecords, it records the call stack of one allocation
+     * every SamplingInterval bytes on average. The sampled bytes are drawn from a Poisson process, so every byte allocated
+     * has the same chance of being sampled, and each sample is weighted to estimate the live bytes of its call site.
+     * Allocations that aren't sampled only decrement a thread local counter, and deallocations only test a small table
+     * of counters, so the profiler costs close to nothing outside of the sampled allocations.
+     *
+     * Allocators call OnAllocation and OnDeallocation, see SystemAllocator::GetAllocationSampler.
+     */
+    class AllocationSampler
+    {
+    public:
+        //! Average number of bytes allocated between two samples
+        static constexpr size_t DefaultSamplingInterval = 512 * 1024;
+        static constexpr unsigned int MaxStackFrames = 16;
+
+        //! Estimated live memory allocated from a call stack
+        struct CallSite
+        {
+            StackFrame m_frames[MaxStackFrames];
+            unsigned int m_frameCount = 0;
+            //! Estimated bytes allocated from this call site and not freed yet
+            size_t m_liveBytes = 0;
+            //! Sampled allocations from this call site that are not freed yet
+            size_t m_liveSamples = 0;
+            //! Sampled allocations from this call site since sampling started
+            size_t m_totalSamples = 0;
+        };
+        using CallSiteVector = AZStd::vector<CallSite, AZStd::stateless_allocator>;
+
+        AllocationSampler();
+        ~AllocationSampler();
+        AllocationSampler(const AllocationSampler&) = delete;
+        AllocationSampler& operator=(const AllocationSampler&) = delete;
+
+        //! Starts sampling one allocation every @samplingInterval bytes on average.
+        void Start(size_t samplingInterval = DefaultSamplingInterval);
+        //! Stops sampling and discards the samples.
+        void Stop();
+        bool IsActive() const
+        {
+            return m_active.load(AZStd::memory_order_relaxed);
+        }
+        size_t GetSamplingInterval() const;
+
+        //! Must be called by the allocator after each allocation.
+        //! @stackFramesToSkip the frames of the allocator itself, which are omitted from the call stacks.
+        void OnAllocation(void* address, size_t byteSize, unsigned int stackFramesToSkip = 0)
+        {
+            if (IsActive() && address)
+            {
+                SampleAllocation(address, byteSize, stackFramesToSkip + 1);
+            }
+        }
+
+        //! Must be called by the allocator before each deallocation.
+        void OnDeallocation(void* address)
+        {
+            if (m_liveSampleCount.load(AZStd::memory_order_relaxed) != 0 && address)
+            {
+                RemoveSample(address);
+            }
+        }
+
+        //! Returns the call sites with live samples, sorted from the most to the least live bytes.
+        CallSiteVector GetCallSites() const;
+        //! Returns the estimated bytes allocated from all the call sites and not freed yet.
+        size_t GetLiveBytes() const;
+
+        //! Records the @maxCallSites call sites with the most live bytes through @eventLogger.
+        //! Each call site is an instant event named "SampledCallSite" with the liveBytes, liveSamples and totalSamples args and its decoded
+        //! "stack", followed by a "SampledLiveBytes" counter event with the total.
+        void ReportCallSites(Metrics::IEventLogger& eventLogger, size_t maxCallSites = 32) const;
+
+    private:
+        struct LiveSample
+        {
+            size_t m_callSiteHash = 0;
+            size_t m_weight = 0;
+        };
+
+        void SampleAllocation(void* address, size_t byteSize, unsigned int stackFramesToSkip);
+        void RemoveSample(void* address);
+        //! Draws the number of bytes until the next sample, from an exponential distribution
+        size_t NextSampleDistance() const;
+        static size_t GetFilterIndex(void* address);
+
+        using LiveSampleMap = AZStd::unordered_map<void*, LiveSample, AZStd::hash<void*>, AZStd::equal_to<void*>, AZStd::stateless_allocator>;
+        using CallSiteMap = AZStd::unordered_map<size_t, CallSite, AZStd::hash<size_t>, AZStd::equal_to<size_t>, AZStd::stateless_allocator>;
+
+        static constexpr size_t FilterSize = 1 << 16;
+        //! Number of live samples per address hash. Deallocations only lock when their counter isn't 0.
+        //! Allocated by the first Start and kept until the sampler is destroyed, as deallocations can race with Stop.
+        AZStd::atomic<uint16_t>* m_filter = nullptr;
+        AZStd::atomic<size_t> m_liveSampleCount{ 0 };
+        AZStd::atomic<bool> m_active{ false };
+        AZStd::atomic<size_t> m_samplingInterval{ DefaultSamplingInterval };
+
+        mutable AZStd::mutex m_mutex;
+        LiveSampleMap m_liveSamples;
+        CallSiteMap m_callSites;
+    };
+} // namespace AZ::Debug
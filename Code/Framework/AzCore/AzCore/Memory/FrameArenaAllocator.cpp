@@ -0,0 +1,577 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Internal
+{
+    //! Block of memory an arena bump allocates from. The data follows the header, which is padded to keep it aligned.
+    struct alignas(alignof(max_align_t)) FrameArenaBlock
+    {
+        static constexpr size_t Alignment = alignof(max_align_t);
+
+        char* Begin() { return reinterpret_cast<char*>(this + 1); }
+        char* End() { return Begin() + m_size; }
+
+        FrameArenaBlock* m_next = nullptr;
+        size_t m_size = 0;
+    };
+
+    //! Blocks and bump pointer of a single thread. Only the owning thread allocates from it.
+    //! When the thread exits, the arena and its blocks are left to the next thread that needs one.
+    //! The blocks are double buffered: frames allocate from the chain of their parity, so the blocks used during a frame
+    //! are only reused two frames later, once the work started during the frame had the following frame to complete.
+    struct FrameArena
+    {
+        static constexpr uint32_t ChainCount = 2;
+        //! Every allocation is preceded by its size, so it can be reallocated after newer allocations were made
+        static constexpr size_t HeaderSize = sizeof(size_t);
+
+        //! Returns the address of an allocation aligned on @alignment starting at @cursor, after its header
+        static char* AllocationAddress(char* cursor, size_t alignment)
+        {
+            return cursor ? PointerAlignUp(cursor + HeaderSize, alignment) : nullptr;
+        }
+
+        static void SetAllocationSize(char* address, size_t byteSize)
+        {
+            memcpy(address - HeaderSize, &byteSize, HeaderSize);
+        }
+
+        static size_t GetAllocationSize(const char* address)
+        {
+            size_t byteSize;
+            memcpy(&byteSize, address - HeaderSize, HeaderSize);
+            return byteSize;
+        }
+
+        //! Blocks of the frame the arena last allocated during
+        FrameArenaBlock*& FirstBlock()
+        {
+            return m_firstBlocks[m_frameIndex.load(AZStd::memory_order_relaxed) % ChainCount];
+        }
+
+        //! Makes the blocks of the frame before the previous one available to the frame @frameIndex,
+        //! freeing the blocks of oversized allocations.
+        void Rewind(uint32_t frameIndex, IAllocator& blockAllocator, size_t blockSize)
+        {
+            FrameArenaBlock*& firstBlock = m_firstBlocks[frameIndex % ChainCount];
+            if (frameIndex - m_frameIndex.load(AZStd::memory_order_relaxed) > 1)
+            {
+                // Nothing was allocated during the previous frame, so the blocks of the other chain are no longer in use either
+                FrameArenaBlock** link = &firstBlock;
+                while (*link != nullptr)
+                {
+                    link = &(*link)->m_next;
+                }
+                FrameArenaBlock*& otherFirstBlock = m_firstBlocks[(frameIndex + 1) % ChainCount];
+                *link = otherFirstBlock;
+                otherFirstBlock = nullptr;
+            }
+
+            FrameArenaBlock** link = &firstBlock;
+            while (FrameArenaBlock* block = *link)
+            {
+                if (block->m_size > blockSize)
+                {
+                    *link = block->m_next;
+                    FreeBlock(block, blockAllocator);
+                }
+                else
+                {
+                    link = &block->m_next;
+                }
+            }
+
+            m_currentBlock = firstBlock;
+            m_cursor = firstBlock ? firstBlock->Begin() : nullptr;
+            m_end = firstBlock ? firstBlock->End() : nullptr;
+            m_lastAllocation = nullptr;
+            m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+            m_frameIndex.store(frameIndex, AZStd::memory_order_relaxed);
+        }
+
+        //! Moves on to the next block that can fit @byteSize bytes aligned on @alignment, allocating one if needed.
+        //! Returns the aligned address in the block, or nullptr if the block allocator ran out of memory.
+        char* NextBlock(size_t byteSize, size_t alignment, IAllocator& blockAllocator, size_t blockSize)
+        {
+            const size_t requiredSize = byteSize + HeaderSize + (alignment > HeaderSize ? alignment : 0);
+            FrameArenaBlock* block = m_currentBlock ? m_currentBlock->m_next : FirstBlock();
+            if (block == nullptr || block->m_size < requiredSize)
+            {
+                const size_t size = AZStd::max(blockSize, requiredSize);
+                void* memory = blockAllocator.allocate(sizeof(FrameArenaBlock) + size, FrameArenaBlock::Alignment);
+                if (memory == nullptr)
+                {
+                    return nullptr;
+                }
+
+                // Insert the new block after the current one, the following blocks are used once it's full
+                FrameArenaBlock* newBlock = new (memory) FrameArenaBlock{ block, size };
+                (m_currentBlock ? m_currentBlock->m_next : FirstBlock()) = newBlock;
+                m_reservedBytes.store(m_reservedBytes.load(AZStd::memory_order_relaxed) + size, AZStd::memory_order_relaxed);
+                block = newBlock;
+            }
+
+            m_currentBlock = block;
+            m_cursor = block->Begin();
+            m_end = block->End();
+            return AllocationAddress(m_cursor, alignment);
+        }
+
+        //! Frees the blocks that can no longer be in use during the frame @frameIndex: the blocks of the frames before the
+        //! previous one, and the blocks the arena didn't reach during its last frame.
+        void FreeUnusedBlocks(uint32_t frameIndex, IAllocator& blockAllocator)
+        {
+            const uint32_t arenaFrameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+            if (arenaFrameIndex != frameIndex)
+            {
+                // The other chain was last used before the previous frame
+                FreeBlocksAfter(nullptr, m_firstBlocks[(arenaFrameIndex + 1) % ChainCount], blockAllocator);
+            }
+
+            if (frameIndex - arenaFrameIndex > 1)
+            {
+                FreeBlocksAfter(nullptr, FirstBlock(), blockAllocator);
+                m_currentBlock = nullptr;
+                m_cursor = nullptr;
+                m_end = nullptr;
+                m_lastAllocation = nullptr;
+            }
+            else
+            {
+                FreeBlocksAfter(m_currentBlock, FirstBlock(), blockAllocator);
+            }
+        }
+
+        //! Frees the blocks of every frame.
+        void FreeBlocks(IAllocator& blockAllocator)
+        {
+            for (FrameArenaBlock*& firstBlock : m_firstBlocks)
+            {
+                FreeBlocksAfter(nullptr, firstBlock, blockAllocator);
+            }
+        }
+
+        //! Frees the blocks of the chain starting at @firstBlock after @lastKeptBlock, or all of them if it's nullptr.
+        void FreeBlocksAfter(FrameArenaBlock* lastKeptBlock, FrameArenaBlock*& firstBlock, IAllocator& blockAllocator)
+        {
+            FrameArenaBlock*& firstFreedBlock = lastKeptBlock ? lastKeptBlock->m_next : firstBlock;
+            for (FrameArenaBlock* block = firstFreedBlock; block != nullptr;)
+            {
+                FrameArenaBlock* next = block->m_next;
+                FreeBlock(block, blockAllocator);
+                block = next;
+            }
+            firstFreedBlock = nullptr;
+        }
+
+        void FreeBlock(FrameArenaBlock* block, IAllocator& blockAllocator)
+        {
+            m_reservedBytes.store(m_reservedBytes.load(AZStd::memory_order_relaxed) - block->m_size, AZStd::memory_order_relaxed);
+            blockAllocator.deallocate(block, sizeof(FrameArenaBlock) + block->m_size, FrameArenaBlock::Alignment);
+        }
+
+        //! Blocks of the even and odd frames
+        FrameArenaBlock* m_firstBlocks[ChainCount] = {};
+        FrameArenaBlock* m_currentBlock = nullptr;
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        //! Most recent allocation, which can be reallocated in place or rewound when deallocated
+        char* m_lastAllocation = nullptr;
+
+        // Read by other threads for statistics
+        AZStd::atomic<uint32_t> m_frameIndex{ 0 };
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+        AZStd::atomic<size_t> m_reservedBytes{ 0 };
+
+        // Ownership, guarded by the thread arena mutex
+        //! Thread allocating from the arena, the default id if the arena is free to be adopted
+        AZStd::thread::id m_owner;
+        //! Set when the arena was created after its thread released its arenas, so it's freed with the allocator instead
+        bool m_ownerExited = false;
+        //! Allocator the arena belongs to, nullptr once it was destroyed while the thread still held the arena
+        FrameArenaAllocator* m_allocator = nullptr;
+
+        FrameArena* m_next = nullptr;
+    };
+} // namespace AZ::Internal
+
+namespace AZ
+{
+    namespace
+    {
+        // Arenas recently used by the thread, so threads that allocate from a few arena allocators rarely need to look them up
+        struct ThreadArenaSlot
+        {
+            uint64_t m_instanceId = 0;
+            Internal::FrameArena* m_arena = nullptr;
+        };
+        constexpr size_t ThreadArenaSlotCount = 4;
+        AZ_THREAD_LOCAL ThreadArenaSlot s_threadArenas[ThreadArenaSlotCount];
+        AZ_THREAD_LOCAL size_t s_nextThreadArenaSlot = 0;
+
+        // Set when the thread exits, after which its arenas are no longer released to their allocators
+        AZ_THREAD_LOCAL bool s_threadArenasReleased = false;
+
+        AZStd::atomic<uint64_t> s_nextInstanceId{ 1 };
+
+        // Guards the ownership of the arenas of all the allocators.
+        // Never destroyed, as threads can exit after the static destructors ran.
+        AZStd::mutex& GetThreadArenaMutex()
+        {
+            static AZStd::aligned_storage_t<sizeof(AZStd::mutex), alignof(AZStd::mutex)> mutexStorage;
+            static AZStd::mutex* mutex = new (&mutexStorage) AZStd::mutex;
+            return *mutex;
+        }
+
+        void FreeArena(Internal::FrameArena* arena)
+        {
+            arena->~FrameArena();
+            AZ_OS_FREE(arena);
+        }
+
+        // Returns the arena to its allocator so another thread can adopt it, keeping its blocks.
+        // Requires the thread arena mutex.
+        void ReleaseThreadArena(Internal::FrameArena* arena)
+        {
+            if (arena->m_allocator == nullptr)
+            {
+                // The allocator was destroyed and already freed the blocks
+                FreeArena(arena);
+                return;
+            }
+            arena->m_owner = AZStd::thread::id();
+            arena->m_lastAllocation = nullptr;
+        }
+
+        // Releases the arenas of the thread when it exits
+        struct ThreadArenaReleaser
+        {
+            ~ThreadArenaReleaser()
+            {
+                AZStd::scoped_lock lock(GetThreadArenaMutex());
+                for (ThreadArenaSlot& slot : s_threadArenas)
+                {
+                    if (slot.m_arena != nullptr)
+                    {
+                        ReleaseThreadArena(slot.m_arena);
+                    }
+                    slot = ThreadArenaSlot{};
+                }
+                s_threadArenasReleased = true;
+            }
+        };
+        thread_local ThreadArenaReleaser t_threadArenaReleaser;
+
+        Internal::FrameArena* FindCachedThreadArena(uint64_t instanceId)
+        {
+            for (const ThreadArenaSlot& slot : s_threadArenas)
+            {
+                if (slot.m_instanceId == instanceId)
+                {
+                    return slot.m_arena;
+                }
+            }
+            return nullptr;
+        }
+    } // namespace
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL(FrameArenaAllocator, "FrameArenaAllocator", "{A5E3F0B6-2C4D-4E8A-9B71-6D0F3C8E2A54}");
+    AZ_RTTI_NO_TYPE_INFO_IMPL(FrameArenaAllocator, AllocatorBase);
+
+    FrameArenaAllocator::FrameArenaAllocator()
+    {
+        Create();
+        PostCreate();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+        PreDestroy();
+        Destroy();
+    }
+
+    bool FrameArenaAllocator::Create(size_type blockSize)
+    {
+        AZ_Assert(blockSize > 0, "FrameArenaAllocator block size must be greater than 0");
+        m_blockAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        m_blockSize = blockSize;
+        m_instanceId = s_nextInstanceId.fetch_add(1);
+        return true;
+    }
+
+    void FrameArenaAllocator::Destroy()
+    {
+        // All threads must be done allocating. Their thread local slots are invalidated by the instance id changing on Create.
+        AZStd::scoped_lock threadArenaLock(GetThreadArenaMutex());
+        AZStd::scoped_lock lock(m_arenasMutex);
+        while (m_arenas != nullptr)
+        {
+            Internal::FrameArena* next = m_arenas->m_next;
+            DestroyArena(m_arenas);
+            m_arenas = next;
+        }
+        m_instanceId = 0;
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Allocations are reclaimed in bulk at the end of the frame, so individual allocations aren't tracked
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    AllocateAddress FrameArenaAllocator::allocate(size_type byteSize, size_type alignment)
+    {
+        if (byteSize == 0)
+        {
+            return AllocateAddress{};
+        }
+        alignment = alignment > 1 ? alignment : alignof(max_align_t);
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment must be power of 2!");
+
+        Internal::FrameArena* arena = GetThreadArena();
+        if (arena == nullptr)
+        {
+            OnOutOfMemory(byteSize, alignment);
+            return AllocateAddress{};
+        }
+
+        const uint32_t frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) != frameIndex)
+        {
+            arena->Rewind(frameIndex, *m_blockAllocator, m_blockSize);
+        }
+
+        char* address = Internal::FrameArena::AllocationAddress(arena->m_cursor, alignment);
+        if (address == nullptr || address > arena->m_end || static_cast<size_type>(arena->m_end - address) < byteSize)
+        {
+            address = arena->NextBlock(byteSize, alignment, *m_blockAllocator, m_blockSize);
+            if (address == nullptr)
+            {
+                OnOutOfMemory(byteSize, alignment);
+                return AllocateAddress{};
+            }
+        }
+
+        Internal::FrameArena::SetAllocationSize(address, byteSize);
+        arena->m_cursor = address + byteSize;
+        arena->m_lastAllocation = address;
+        arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        return AllocateAddress{ address, byteSize };
+    }
+
+    auto FrameArenaAllocator::deallocate(pointer ptr, size_type byteSize, [[maybe_unused]] size_type alignment) -> size_type
+    {
+        if (ptr == nullptr)
+        {
+            return 0;
+        }
+
+        // Rewind the most recent allocation, which is common with containers growing one after another
+        Internal::FrameArena* arena = FindCachedThreadArena(m_instanceId);
+        if (arena && ptr == arena->m_lastAllocation)
+        {
+            char* address = static_cast<char*>(ptr);
+            const size_type allocatedBytes = Internal::FrameArena::GetAllocationSize(address);
+            arena->m_cursor = address - Internal::FrameArena::HeaderSize;
+            arena->m_lastAllocation = nullptr;
+            arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - allocatedBytes, AZStd::memory_order_relaxed);
+            return allocatedBytes;
+        }
+        return byteSize;
+    }
+
+    AllocateAddress FrameArenaAllocator::reallocate(pointer ptr, size_type newSize, align_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            deallocate(ptr);
+            return AllocateAddress{};
+        }
+
+        char* address = static_cast<char*>(ptr);
+        const size_type oldSize = Internal::FrameArena::GetAllocationSize(address);
+        newAlignment = newAlignment > 1 ? newAlignment : alignof(max_align_t);
+
+        Internal::FrameArena* arena = FindCachedThreadArena(m_instanceId);
+        if (arena && ptr == arena->m_lastAllocation && PointerAlignUp(address, newAlignment) == address &&
+            static_cast<size_type>(arena->m_end - address) >= newSize)
+        {
+            // Grow or shrink the most recent allocation in place
+            Internal::FrameArena::SetAllocationSize(address, newSize);
+            arena->m_cursor = address + newSize;
+            arena->m_allocatedBytes.store(
+                arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - oldSize + newSize, AZStd::memory_order_relaxed);
+            return AllocateAddress{ address, newSize };
+        }
+
+        // Older allocations are left behind until the end of the frame
+        AllocateAddress newAddress = allocate(newSize, newAlignment);
+        if (newAddress)
+        {
+            memcpy(newAddress.GetAddress(), address, AZStd::min(oldSize, newSize));
+        }
+        return newAddress;
+    }
+
+    auto FrameArenaAllocator::get_allocated_size(pointer ptr, [[maybe_unused]] align_type alignment) const -> size_type
+    {
+        return ptr ? Internal::FrameArena::GetAllocationSize(static_cast<const char*>(ptr)) : 0;
+    }
+
+    void FrameArenaAllocator::GarbageCollect()
+    {
+        const uint32_t frameIndex = m_frameIndex.load(AZStd::memory_order_acquire);
+        {
+            // Arenas released by exited threads are unused until another thread adopts them
+            AZStd::scoped_lock threadArenaLock(GetThreadArenaMutex());
+            AZStd::scoped_lock lock(m_arenasMutex);
+            for (Internal::FrameArena* arena = m_arenas; arena != nullptr; arena = arena->m_next)
+            {
+                if (arena->m_owner == AZStd::thread::id())
+                {
+                    arena->FreeUnusedBlocks(frameIndex, *m_blockAllocator);
+                }
+            }
+        }
+
+        // Other threads may be allocating from their arena, so only the blocks of the calling thread can be freed
+        if (Internal::FrameArena* arena = FindCachedThreadArena(m_instanceId); arena != nullptr)
+        {
+            arena->FreeUnusedBlocks(frameIndex, *m_blockAllocator);
+        }
+    }
+
+    auto FrameArenaAllocator::NumAllocatedBytes() const -> size_type
+    {
+        const uint32_t frameIndex = m_frameIndex.load(AZStd::memory_order_relaxed);
+        size_type allocatedBytes = 0;
+        AZStd::scoped_lock lock(m_arenasMutex);
+        for (const Internal::FrameArena* arena = m_arenas; arena != nullptr; arena = arena->m_next)
+        {
+            if (arena->m_frameIndex.load(AZStd::memory_order_relaxed) == frameIndex)
+            {
+                allocatedBytes += arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return allocatedBytes;
+    }
+
+    void FrameArenaAllocator::ResetFrame()
+    {
+        m_frameIndex.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    uint32_t FrameArenaAllocator::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_relaxed);
+    }
+
+    auto FrameArenaAllocator::GetReservedBytes() const -> size_type
+    {
+        size_type reservedBytes = 0;
+        AZStd::scoped_lock lock(m_arenasMutex);
+        for (const Internal::FrameArena* arena = m_arenas; arena != nullptr; arena = arena->m_next)
+        {
+            reservedBytes += arena->m_reservedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return reservedBytes;
+    }
+
+    Internal::FrameArena* FrameArenaAllocator::GetThreadArena()
+    {
+        if (Internal::FrameArena* arena = FindCachedThreadArena(m_instanceId); arena != nullptr)
+        {
+            return arena;
+        }
+
+        return CreateThreadArena();
+    }
+
+    Internal::FrameArena* FrameArenaAllocator::CreateThreadArena()
+    {
+        AZStd::scoped_lock threadArenaLock(GetThreadArenaMutex());
+
+        // The arena evicted from the slot is released, so the thread only holds the arenas in its slots
+        ThreadArenaSlot& slot = s_threadArenas[s_nextThreadArenaSlot];
+        if (!s_threadArenasReleased)
+        {
+            if (slot.m_arena != nullptr)
+            {
+                ReleaseThreadArena(slot.m_arena);
+            }
+            // Touching the releaser registers its destructor for the exit of the thread
+            [[maybe_unused]] ThreadArenaReleaser* releaser = &t_threadArenaReleaser;
+        }
+        slot = ThreadArenaSlot{};
+
+        Internal::FrameArena* arena = AdoptOrCreateArena();
+        if (arena != nullptr)
+        {
+            slot = ThreadArenaSlot{ m_instanceId, arena };
+            s_nextThreadArenaSlot = (s_nextThreadArenaSlot + 1) % ThreadArenaSlotCount;
+        }
+        return arena;
+    }
+
+    Internal::FrameArena* FrameArenaAllocator::AdoptOrCreateArena()
+    {
+        const AZStd::thread::id threadId = AZStd::this_thread::get_id();
+
+        AZStd::scoped_lock lock(m_arenasMutex);
+        // Adopt the arena of a thread that exited, along with its blocks
+        Internal::FrameArena** link = &m_arenas;
+        for (; *link != nullptr; link = &(*link)->m_next)
+        {
+            if ((*link)->m_owner == AZStd::thread::id())
+            {
+                (*link)->m_owner = threadId;
+                return *link;
+            }
+        }
+
+        void* memory = AZ_OS_MALLOC(sizeof(Internal::FrameArena), alignof(Internal::FrameArena));
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        Internal::FrameArena* arena = new (memory) Internal::FrameArena();
+        arena->m_owner = threadId;
+        arena->m_ownerExited = s_threadArenasReleased;
+        arena->m_allocator = this;
+        arena->m_frameIndex.store(m_frameIndex.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+        *link = arena;
+        return arena;
+    }
+
+    void FrameArenaAllocator::DestroyArena(Internal::FrameArena* arena)
+    {
+        // Requires the thread arena mutex
+        arena->FreeBlocks(*m_blockAllocator);
+        if (arena->m_owner == AZStd::thread::id() || arena->m_ownerExited)
+        {
+            FreeArena(arena);
+        }
+        else
+        {
+            // The thread still holds the arena in its slots and frees it when it releases it
+            arena->m_allocator = nullptr;
+            arena->m_next = nullptr;
+        }
+    }
+} // namespace AZ
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/AllocatorBase.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        struct FrameArena;
+    }
+
+    /**
+     * Frame arena allocator
+     * Linear allocator for temporary allocations that don't outlive the frame they are made in.
+     * Every thread bump allocates from its own blocks without locking, and deallocating is free: all the memory
+     * allocated during a frame is reclaimed at once, which the ComponentApplication triggers by calling ResetFrame at the end of every tick.
+     * The blocks are double buffered, so the memory of a frame is only reused once the following frame ended too. Jobs and tasks
+     * started during a frame can therefore keep using its allocations while they complete during the next frame.
+     * The blocks are kept for the following frames, so once warmed up, allocations never reach the system allocator.
+     * When a thread exits, its blocks are handed over to the next thread that allocates from the arena.
+     *
+     * Use it for transient containers (see FrameArenaStdAllocator) that are released, or simply forgotten,
+     * before the end of the next frame. Memory allocated before the previous frame must never be accessed.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+    {
+    public:
+        AZ_TYPE_INFO_WITH_NAME_DECL(FrameArenaAllocator);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Size of the blocks threads allocate from. Larger allocations get a block of their own for the frame.
+        static constexpr size_type DefaultBlockSize = 256 * 1024;
+
+        FrameArenaAllocator();
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+        ~FrameArenaAllocator() override;
+
+        bool Create(size_type blockSize = DefaultBlockSize);
+
+        void Destroy() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        AllocateAddress allocate(size_type byteSize, size_type alignment) override;
+        //! Only the most recent allocation of the calling thread is reclaimed before the end of the frame.
+        size_type       deallocate(pointer ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        //! The most recent allocation of the calling thread is resized in place when possible.
+        //! Other allocations are copied to a new allocation, leaving their memory behind until it's reclaimed.
+        AllocateAddress reallocate(pointer ptr, size_type newSize, align_type newAlignment) override;
+        size_type       get_allocated_size(pointer ptr, align_type alignment = 1) const override;
+        //! Frees the blocks of the calling thread and of exited threads that can no longer be in use: the blocks of the frames
+        //! before the previous one, and the blocks that weren't reached during their frame. Other threads keep their blocks.
+        void            GarbageCollect() override;
+        //! Returns the bytes allocated during the current frame, by all threads.
+        size_type       NumAllocatedBytes() const override;
+
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Ends the frame, making all memory allocated before the previous call available again.
+        //! The memory allocated since the previous call stays valid until the next call, for the work still using it.
+        //! Each thread reclaims its blocks the next time it allocates, so this doesn't synchronize with the allocating threads.
+        void ResetFrame();
+
+        //! Returns the number of frames ended by ResetFrame.
+        uint32_t GetFrameIndex() const;
+
+        //! Returns the bytes of the blocks reserved by all threads, whether they are used during the current frame or not.
+        size_type GetReservedBytes() const;
+
+    private:
+        Internal::FrameArena* GetThreadArena();
+        Internal::FrameArena* CreateThreadArena();
+        Internal::FrameArena* AdoptOrCreateArena();
+        void DestroyArena(Internal::FrameArena* arena);
+
+        //! Arenas of all threads that allocated, in creation order. Arenas of exited threads stay in the list until another
+        //! thread adopts them.
+        Internal::FrameArena* m_arenas = nullptr;
+        mutable AZStd::mutex m_arenasMutex;
+
+        IAllocator* m_blockAllocator = nullptr;
+        size_type m_blockSize = DefaultBlockSize;
+        //! Identifies this instance in the thread local storage of the threads, which outlives it
+        uint64_t m_instanceId = 0;
+        AZStd::atomic<uint32_t> m_frameIndex{ 0 };
+    };
+
+    using FrameArenaStdAllocator = AZStdAlloc<FrameArenaAllocator>;
+} // namespace AZ
@@ -12,8 +12,10 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/containers/intrusive_list.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
@@ -66,6 +68,133 @@ namespace AZ
 
     //////////////////////////////////////////////////////////////////////////
 
+    namespace HphaInternal
+    {
+        // Must match HpAllocator::NUM_BUCKETS
+        constexpr size_t ThreadCacheBucketCount = 64;
+        // Bytes of free elements a thread caches per bucket. Half of them move between the cache and the bucket at once.
+        constexpr size_t ThreadCacheBucketBytes = 2048;
+        constexpr unsigned ThreadCacheMinCount = 4;
+        constexpr unsigned ThreadCacheMaxCount = 64;
+
+        // Free elements of the small object buckets of one allocator, cached by a thread.
+        // Only the owning thread touches the cached elements, so it allocates and frees them without locking.
+        struct ThreadCache
+        {
+            struct Magazine
+            {
+                void* m_head = nullptr;
+                unsigned m_count = 0;
+            };
+            Magazine m_magazines[ThreadCacheBucketCount];
+
+            // Bytes allocated from this cache minus the bytes freed into it, which wraps around when elements are freed
+            // by another thread than the one that allocated them. Only written by the owning thread.
+            AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+
+            // Allocator the cached elements belong to, nullptr once its caches were released
+            void* m_allocator = nullptr;
+            // Returns the cached elements to m_allocator and detaches the cache from it
+            void (*m_release)(void* allocator, ThreadCache& cache) = nullptr;
+            uint64_t m_allocatorId = 0;
+            uint32_t m_epoch = 0;
+
+            // Caches of the same allocator, guarded by GetThreadCacheMutex
+            ThreadCache* m_prev = nullptr;
+            ThreadCache* m_next = nullptr;
+        };
+
+        // Guards the thread cache lists of all the allocators.
+        // Never destroyed, as threads can exit after the static destructors ran.
+        static AZStd::mutex& GetThreadCacheMutex()
+        {
+            static AZStd::aligned_storage_t<sizeof(AZStd::mutex), alignof(AZStd::mutex)> mutexStorage;
+            static AZStd::mutex* mutex = new (&mutexStorage) AZStd::mutex;
+            return *mutex;
+        }
+
+        // Identifies the allocators in the thread local storage, which outlives them
+        static AZStd::atomic<uint64_t> s_nextAllocatorId{ 1 };
+
+        constexpr size_t ThreadCacheSlotCount = 8;
+        static AZ_THREAD_LOCAL ThreadCache* s_threadCaches[ThreadCacheSlotCount];
+        static AZ_THREAD_LOCAL size_t s_nextThreadCacheSlot = 0;
+        // Set when the thread exits, after which it allocates from the buckets directly
+        static AZ_THREAD_LOCAL bool s_threadCachesReleased = false;
+
+        static ThreadCache* FindThreadCache(uint64_t allocatorId)
+        {
+            for (ThreadCache* cache : s_threadCaches)
+            {
+                if (cache && cache->m_allocatorId == allocatorId)
+                {
+                    return cache;
+                }
+            }
+            return nullptr;
+        }
+
+        static void FreeThreadCache(ThreadCache* cache)
+        {
+            cache->~ThreadCache();
+            AZ_OS_FREE(cache);
+        }
+
+        // Requires the thread cache mutex
+        static void ReleaseThreadCache(ThreadCache* cache)
+        {
+            if (cache->m_allocator)
+            {
+                cache->m_release(cache->m_allocator, *cache);
+            }
+            FreeThreadCache(cache);
+        }
+
+        // Returns a free slot for a new cache of the calling thread, releasing the cache of another allocator when they are all used.
+        // Requires the thread cache mutex.
+        static ThreadCache*& AcquireThreadCacheSlot()
+        {
+            for (ThreadCache*& cache : s_threadCaches)
+            {
+                if (cache && !cache->m_allocator)
+                {
+                    FreeThreadCache(cache);
+                    cache = nullptr;
+                }
+                if (!cache)
+                {
+                    return cache;
+                }
+            }
+            ThreadCache*& cache = s_threadCaches[s_nextThreadCacheSlot];
+            s_nextThreadCacheSlot = (s_nextThreadCacheSlot + 1) % ThreadCacheSlotCount;
+            ReleaseThreadCache(cache);
+            cache = nullptr;
+            return cache;
+        }
+
+        // Returns the cached elements of the thread when it exits
+        struct ThreadCacheReleaser
+        {
+            ~ThreadCacheReleaser()
+            {
+                AZStd::scoped_lock lock(GetThreadCacheMutex());
+                for (ThreadCache*& cache : s_threadCaches)
+                {
+                    if (cache)
+                    {
+                        ReleaseThreadCache(cache);
+                        cache = nullptr;
+                    }
+                }
+                s_threadCachesReleased = true;
+            }
+        };
+        static thread_local ThreadCacheReleaser t_threadCacheReleaser;
+    } // namespace HphaInternal
+
+    //////////////////////////////////////////////////////////////////////////
+
     template<bool DebugAllocatorEnable>
     class HphaSchemaBase<DebugAllocatorEnable>::HpAllocator
         : public IAllocator
@@ -89,6 +218,7 @@ namespace AZ
         static const size_t DEFAULT_ALIGNMENT = sizeof(double);
 
         static const size_t NUM_BUCKETS = (MAX_SMALL_ALLOCATION / MIN_ALLOCATION);
+        static_assert(NUM_BUCKETS == HphaInternal::ThreadCacheBucketCount, "Thread caches must have a magazine per bucket");
 
         static inline bool is_small_allocation(size_t s)
         {
@@ -343,6 +473,20 @@ namespace AZ
             return (page*)AZ::PointerAlignDown((char*)ptr, m_poolPageSize);
         }
 
+        // per-thread caches of free bucket elements, allocated and freed without locking
+        using thread_cache = HphaInternal::ThreadCache;
+        static unsigned thread_cache_capacity(unsigned bi);
+        thread_cache* thread_cache_get();
+        thread_cache* thread_cache_create();
+        void* thread_cache_alloc(thread_cache& cache, unsigned bi);
+        void thread_cache_free(thread_cache& cache, void* ptr, unsigned bi);
+        bool thread_cache_refill(thread_cache& cache, unsigned bi);
+        void thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_flush_all(thread_cache& cache);
+        static void thread_cache_release(void* allocator, thread_cache& cache);
+        void thread_cache_release_all();
+        size_t thread_cache_allocated() const;
+
         bool ptr_in_bucket(void* ptr) const
         {
             bool result = false;
@@ -590,6 +734,13 @@ namespace AZ
         // threads through that lock
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
+
+        // Caches of the threads that allocated from the buckets, guarded by the thread cache mutex
+        thread_cache* mThreadCaches = nullptr;
+        const uint64_t mThreadCacheId = HphaInternal::s_nextAllocatorId.fetch_add(1, AZStd::memory_order_relaxed);
+        // Threads flush their cache when this changes
+        AZStd::atomic<uint32_t> mThreadCacheEpoch{ 0 };
+        AZStd::atomic<bool> mThreadCacheEnabled{ true };
     public:
         HpAllocator();
         ~HpAllocator() override;
@@ -929,11 +1080,30 @@ namespace AZ
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Elements cached by threads keep their pages alive. The calling thread returns its elements now, the other
+            // threads do on their next allocation.
+            const uint32_t epoch = mThreadCacheEpoch.fetch_add(1, AZStd::memory_order_relaxed) + 1;
+            if (thread_cache* cache = HphaInternal::FindThreadCache(mThreadCacheId))
+            {
+                thread_cache_flush_all(*cache);
+                cache->m_epoch = epoch;
+            }
+
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
         }
 
+        void set_thread_cache_enabled(bool enabled)
+        {
+            mThreadCacheEnabled.store(enabled, AZStd::memory_order_relaxed);
+        }
+
+        bool thread_cache_enabled() const
+        {
+            return mThreadCacheEnabled.load(AZStd::memory_order_relaxed);
+        }
+
         // print HpAllocator statistics
         void report();
 
@@ -943,7 +1113,7 @@ namespace AZ
         // return the total number of allocated memory
         inline size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree + thread_cache_allocated();
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1047,6 +1217,8 @@ namespace AZ
     template<bool DebugAllocatorEnable>
     HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::~HpAllocator()
     {
+        thread_cache_release_all();
+
         if constexpr (DebugAllocatorEnable)
         {
             // Check if there are not-freed allocations
@@ -1204,6 +1376,13 @@ namespace AZ
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = thread_cache_get())
+        {
+            if (void* ptr = thread_cache_alloc(*cache, bi))
+            {
+                return AllocateAddress{ ptr, bucket_spacing_function_inverse(bi) };
+            }
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1233,6 +1412,13 @@ namespace AZ
     AllocateAddress HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = thread_cache_get())
+        {
+            if (void* ptr = thread_cache_alloc(*cache, bi))
+            {
+                return AllocateAddress{ ptr, bucket_spacing_function_inverse(bi) };
+            }
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1303,6 +1489,11 @@ namespace AZ
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (thread_cache* cache = thread_cache_get())
+        {
+            thread_cache_free(*cache, ptr, bi);
+            return p->elem_size();
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1325,6 +1516,11 @@ namespace AZ
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (thread_cache* cache = thread_cache_get())
+        {
+            thread_cache_free(*cache, ptr, bi);
+            return p->elem_size();
+        }
 #ifdef MULTITHREADED
 #if defined(USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1448,6 +1644,218 @@ namespace AZ
         }
     }
 
+    template<bool DebugAllocatorEnable>
+    unsigned HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_capacity(unsigned bi)
+    {
+        const unsigned count = static_cast<unsigned>(HphaInternal::ThreadCacheBucketBytes / bucket_spacing_function_inverse(bi));
+        return AZStd::GetMin(AZStd::GetMax(count, HphaInternal::ThreadCacheMinCount), HphaInternal::ThreadCacheMaxCount);
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_get() -> thread_cache*
+    {
+        if (!mThreadCacheEnabled.load(AZStd::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+        thread_cache* cache = HphaInternal::FindThreadCache(mThreadCacheId);
+        if (!cache)
+        {
+            cache = thread_cache_create();
+            if (!cache)
+            {
+                return nullptr;
+            }
+        }
+        // Memory was requested back since this thread last used its cache
+        const uint32_t epoch = mThreadCacheEpoch.load(AZStd::memory_order_relaxed);
+        if (cache->m_epoch != epoch)
+        {
+            thread_cache_flush_all(*cache);
+            cache->m_epoch = epoch;
+        }
+        return cache;
+    }
+
+    template<bool DebugAllocatorEnable>
+    auto HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_create() -> thread_cache*
+    {
+        AZStd::scoped_lock lock(HphaInternal::GetThreadCacheMutex());
+        if (HphaInternal::s_threadCachesReleased)
+        {
+            return nullptr;
+        }
+        void* mem = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+        if (!mem)
+        {
+            return nullptr;
+        }
+        // Touching the releaser registers its destructor for the exit of the thread
+        [[maybe_unused]] HphaInternal::ThreadCacheReleaser* releaser = &HphaInternal::t_threadCacheReleaser;
+
+        thread_cache*& slot = HphaInternal::AcquireThreadCacheSlot();
+        thread_cache* cache = new (mem) thread_cache;
+        cache->m_allocator = this;
+        cache->m_release = &thread_cache_release;
+        cache->m_allocatorId = mThreadCacheId;
+        cache->m_epoch = mThreadCacheEpoch.load(AZStd::memory_order_relaxed);
+        cache->m_next = mThreadCaches;
+        if (mThreadCaches)
+        {
+            mThreadCaches->m_prev = cache;
+        }
+        mThreadCaches = cache;
+        slot = cache;
+        return cache;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void* HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_alloc(thread_cache& cache, unsigned bi)
+    {
+        typename thread_cache::Magazine& magazine = cache.m_magazines[bi];
+        if (!magazine.m_head && !thread_cache_refill(cache, bi))
+        {
+            return nullptr;
+        }
+        free_link* link = static_cast<free_link*>(magazine.m_head);
+        magazine.m_head = link->mNext;
+        --magazine.m_count;
+        cache.m_allocatedBytes.store(
+            cache.m_allocatedBytes.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        return link;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_free(thread_cache& cache, void* ptr, unsigned bi)
+    {
+        typename thread_cache::Magazine& magazine = cache.m_magazines[bi];
+        if (magazine.m_count >= thread_cache_capacity(bi))
+        {
+            thread_cache_flush(cache, bi, magazine.m_count / 2);
+        }
+        free_link* link = static_cast<free_link*>(ptr);
+        link->mNext = static_cast<free_link*>(magazine.m_head);
+        magazine.m_head = link;
+        ++magazine.m_count;
+        cache.m_allocatedBytes.store(
+            cache.m_allocatedBytes.load(AZStd::memory_order_relaxed) - bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+    }
+
+    template<bool DebugAllocatorEnable>
+    bool HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi)
+    {
+        typename thread_cache::Magazine& magazine = cache.m_magazines[bi];
+        const unsigned count = thread_cache_capacity(bi) / 2;
+#ifdef MULTITHREADED
+#if defined(USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+#endif
+        for (unsigned i = 0; i < count; ++i)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                size_t bsize = bucket_spacing_function_inverse(bi);
+                p = bucket_grow(bsize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            free_link* link = static_cast<free_link*>(mBuckets[bi].alloc(p));
+            link->mNext = static_cast<free_link*>(magazine.m_head);
+            magazine.m_head = link;
+            ++magazine.m_count;
+        }
+        return magazine.m_head != nullptr;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        typename thread_cache::Magazine& magazine = cache.m_magazines[bi];
+        HPPA_ASSERT(count <= magazine.m_count);
+#ifdef MULTITHREADED
+#if defined(USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+#else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+#endif
+#endif
+        for (unsigned i = 0; i < count; ++i)
+        {
+            free_link* link = static_cast<free_link*>(magazine.m_head);
+            magazine.m_head = link->mNext;
+            mBuckets[bi].free(ptr_get_page(link), link);
+        }
+        magazine.m_count -= count;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_flush_all(thread_cache& cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache.m_magazines[bi].m_count)
+            {
+                thread_cache_flush(cache, bi, cache.m_magazines[bi].m_count);
+            }
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_release(void* allocator, thread_cache& cache)
+    {
+        // Called with the thread cache mutex locked, when the thread exits or the allocator is destroyed
+        HpAllocator* self = static_cast<HpAllocator*>(allocator);
+        self->thread_cache_flush_all(cache);
+        self->mTotalAllocatedSizeBuckets += cache.m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        cache.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+
+        if (cache.m_prev)
+        {
+            cache.m_prev->m_next = cache.m_next;
+        }
+        else
+        {
+            self->mThreadCaches = cache.m_next;
+        }
+        if (cache.m_next)
+        {
+            cache.m_next->m_prev = cache.m_prev;
+        }
+        cache.m_prev = nullptr;
+        cache.m_next = nullptr;
+        cache.m_allocator = nullptr;
+    }
+
+    template<bool DebugAllocatorEnable>
+    void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_release_all()
+    {
+        // The caches stay with their threads, which free them the next time they need a slot or when they exit
+        AZStd::scoped_lock lock(HphaInternal::GetThreadCacheMutex());
+        while (mThreadCaches)
+        {
+            thread_cache_release(this, *mThreadCaches);
+        }
+    }
+
+    template<bool DebugAllocatorEnable>
+    size_t HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::thread_cache_allocated() const
+    {
+        AZStd::scoped_lock lock(HphaInternal::GetThreadCacheMutex());
+        size_t allocatedBytes = 0;
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->m_next)
+        {
+            allocatedBytes += cache->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+
     template<bool DebugAllocatorEnable>
     void HphaSchemaBase<DebugAllocatorEnable>::HpAllocator::split_block(block_header* bl, size_t size)
     {
@@ -2604,6 +3012,18 @@ namespace AZ
         m_allocator->purge();
     }
 
+    template<bool DebugAllocator>
+    void HphaSchemaBase<DebugAllocator>::SetThreadCacheEnabled(bool enabled)
+    {
+        m_allocator->set_thread_cache_enabled(enabled);
+    }
+
+    template<bool DebugAllocator>
+    bool HphaSchemaBase<DebugAllocator>::IsThreadCacheEnabled() const
+    {
+        return m_allocator->thread_cache_enabled();
+    }
+
     template<bool DebugAllocator>
     size_t HphaSchemaBase<DebugAllocator>::GetMemoryGuardSize()
     {
@@ -15,6 +15,8 @@ namespace AZ
 {
     /**
     * Heap allocator schema, based on Dimitar Lazarov "High Performance Heap Allocator".
+    * Every thread keeps a small cache of free elements of the small allocation buckets, which it allocates from and frees to
+    * without locking. The caches are returned to the buckets when their thread exits, on GarbageCollect and when the allocator runs out of memory.
     */
     template<bool DebugAllocator = false>
     class HphaSchemaBase
@@ -40,6 +42,11 @@ namespace AZ
         /// Return unused memory to the OS. Don't call this unless you really need free memory, it is slow.
         void            GarbageCollect() override;
 
+        /// Enables the per-thread caches of small allocations, which are enabled by default.
+        /// Disabling them doesn't return the memory already cached by other threads until they exit or the allocator is destroyed.
+        void            SetThreadCacheEnabled(bool enabled);
+        bool            IsThreadCacheEnabled() const;
+
         static size_t GetMemoryGuardSize();
         static size_t GetFreeLinkSize();
 
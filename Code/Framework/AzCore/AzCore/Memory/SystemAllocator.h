@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/AllocatorBase.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -53,11 +54,15 @@ namespace AZ
 
         //////////////////////////////////////////////////////////////////////////
 
+        //! Returns the sampling profiler of the allocations, which is stopped until AllocationSampler::Start is called.
+        Debug::AllocationSampler& GetAllocationSampler() { return m_allocationSampler; }
+
     protected:
         SystemAllocator(const SystemAllocator&);
         SystemAllocator& operator=(const SystemAllocator&);
 
         AZStd::unique_ptr<IAllocator> m_subAllocator;
+        Debug::AllocationSampler m_allocationSampler;
     };
 }
 
@@ -12,6 +12,8 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
 #include <cstring>
@@ -25,6 +27,9 @@ namespace AZ
         // Pointer which indicated that the NameDictonary associated with the AZ::Interface
         // was created by the Create function below
         static AZ::EnvironmentVariable<AZStd::unique_ptr<AZ::NameDictionary>> s_staticNameDictionary;
+
+        // Marks a lookup table slot whose NameData has been removed. Probing continues past it.
+        static Internal::NameData* const LookupTombstone = reinterpret_cast<Internal::NameData*>(static_cast<uintptr_t>(1));
     }
 
     void NameDictionary::Create()
@@ -106,22 +111,28 @@ namespace AZ
 
         [[maybe_unused]] bool leaksDetected = false;
 
-        for (auto i = m_dictionary.begin(), last = m_dictionary.end(); i != last;)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = i->second.m_nameData;
-            const int useCount = nameData->m_useCount;
-
-            if (useCount == 0)
-            {
-                i = m_dictionary.erase(i);
-                delete nameData;
-            }
-            else
+            for (auto i = shard.m_dictionary.begin(), last = shard.m_dictionary.end(); i != last;)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
-                ++i;
+                Internal::NameData* nameData = i->second.m_nameData;
+                const int useCount = nameData->m_useCount;
+
+                if (useCount == 0)
+                {
+                    i = shard.m_dictionary.erase(i);
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, i->first, AZ_STRING_ARG(nameData->GetName()));
+                    ++i;
+                }
             }
+
+            // There can't be any readers left at this point, so the table can be freed directly
+            delete shard.m_lookupTable.exchange(nullptr);
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
@@ -129,21 +140,71 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        // The NameData m_useCount check is to avoid a multithread race condition
-        // where thread B is in NameData::release and reduces the m_useCount to 0
-        // and this thread(thread A) construct a Name using that NameData pointer
-        // causing the m_useCount to go back up to 1.
-        // If thread A continues along and releases the NameData again, before thread B can run
-        // the the m_useCount can be reduced to 0 and multiple threads can be in the
-        // NameData::release `if (m_useCount.fetch_sub(1) == 1)` block
-        if (auto iter = m_dictionary.find(hash);
-            iter != m_dictionary.end() && iter->second.m_nameData->m_useCount > 0)
+        return LockFreeFind(hash, {});
+    }
+
+    Name NameDictionary::LockFreeFind(Name::Hash hash, AZStd::string_view nameString) const
+    {
+        using namespace NameDictionaryInternal;
+
+        while (true)
         {
-            return Name(iter->second.m_nameData);
+            const Shard& shard = GetShard(hash);
+            const uint32_t epoch = BeginRead(shard);
+
+            Internal::NameData* found = nullptr;
+            if (const LookupTable* table = shard.m_lookupTable.load(AZStd::memory_order_acquire); table != nullptr)
+            {
+                // The table is kept at most half full, so the probe always reaches an empty slot
+                for (size_t slot = (hash / ShardCount) & table->m_mask;; slot = (slot + 1) & table->m_mask)
+                {
+                    Internal::NameData* nameData = table->m_slots[slot].load(AZStd::memory_order_acquire);
+                    if (nameData == nullptr)
+                    {
+                        break;
+                    }
+                    if (nameData != LookupTombstone && nameData->m_hash == hash)
+                    {
+                        found = nameData;
+                        break;
+                    }
+                }
+            }
+
+            // The read epoch guarantees the NameData isn't deleted until EndRead, but it can still be in the
+            // middle of being released. TryAcquire only takes a reference if the use count hasn't dropped to 0.
+            Internal::NameData* acquired = nullptr;
+            bool followCollision = false;
+            if (found != nullptr)
+            {
+                if (nameString.empty() || found->GetName() == nameString)
+                {
+                    acquired = TryAcquire(found) ? found : nullptr;
+                }
+                else
+                {
+                    // Entries that were involved in a collision are never removed, so the next hash in the chain
+                    // is where the name would have been placed
+                    followCollision = found->m_hashCollision;
+                }
+            }
+
+            EndRead(shard, epoch);
+
+            if (acquired != nullptr)
+            {
+                Name name(acquired);
+                // The Name holds its own reference, so the one taken by TryAcquire can be dropped directly
+                acquired->m_useCount.fetch_sub(1);
+                return name;
+            }
+
+            if (!followCollision)
+            {
+                return Name();
+            }
+            ++hash;
         }
-        return Name();
     }
 
     void NameDictionary::LoadLiteral(Name& nameLiteral)
@@ -226,29 +287,31 @@ namespace AZ
 
         Name::Hash hash = CalcHash(nameString);
 
-        // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // If we find the same name along its collision chain, just return it.
+        // This path is faster than the loop below because it doesn't take any lock, whereas the
+        // loop requires locking each shard it visits to modify the dictionary.
+        Name name = LockFreeFind(hash, nameString);
+        if (!name.IsEmpty())
         {
-            return AZStd::move(name);
+            return name;
         }
 
-        // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto iter = m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
+            // The name wasn't found without locking, so lock the shard owning the hash and check again
+            Shard& shard = GetShard(hash);
+            AZStd::scoped_lock lock(shard.m_mutex);
+
+            auto iter = shard.m_dictionary.find(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard.m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 // Piecewise construct to prevent creating a temporary ScopedNameDataWrapper that destructs
-                m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                shard.m_dictionary.emplace(AZStd::piecewise_construct, AZStd::forward_as_tuple(hash), AZStd::forward_as_tuple(*this, nameData));
+                InsertIntoLookupTable(shard, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -256,13 +319,14 @@ namespace AZ
             {
                 return Name(iter->second.m_nameData);
             }
-            // Hash collision, try a new hash
+            // Hash collision, try a new hash.
+            // The next hash may belong to a different shard. That is safe because an entry flagged as colliding
+            // is never removed, so every thread looking for this name walks the same chain.
             else
             {
                 collisionDetected = true;
                 iter->second.m_nameData->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
     }
@@ -280,39 +344,44 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
-
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
+        Shard& shard = GetShard(hash);
         {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
-            return;
-        }
+            AZStd::scoped_lock lock(shard.m_mutex);
 
-        Internal::NameData* nameData = dictIt->second.m_nameData;
+            auto dictIt = shard.m_dictionary.find(hash);
+            if (dictIt == shard.m_dictionary.end())
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
-        {
-            return;
-        }
+            Internal::NameData* nameData = dictIt->second.m_nameData;
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Check m_hashCollision inside the shard mutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name. Lock free readers check for this in TryAcquire.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                RemoveFromLookupTable(shard, nameData);
+                shard.m_dictionary.erase(dictIt);
+                // A lock free reader may have found the NameData before it was removed from the lookup table
+                Synchronize(shard);
+                delete nameData;
+            }
         }
 
         ReportStats();
@@ -333,35 +402,47 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            // Lock every shard so the NameData being reported can't be released while the stats are gathered.
+            // Other code paths only ever hold a single shard mutex at a time, so locking all of them in order is safe.
+            for (const Shard& shard : m_shards)
             {
-                Internal::NameData* nameData = iter.second.m_nameData;
-                const size_t nameLength = nameData->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
+                shard.m_mutex.lock();
+            }
 
-                if (!longestName || longestName->m_name.size() < nameLength)
+            size_t nameCount = 0;
+            for (const Shard& shard : m_shards)
+            {
+                nameCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = nameData;
-                }
+                    Internal::NameData* nameData = iter.second.m_nameData;
+                    const size_t nameLength = nameData->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = nameData;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = nameData;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = nameData;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = nameData;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -378,6 +459,11 @@ namespace AZ
                 AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", refCount);
             }
 
+            for (const Shard& shard : m_shards)
+            {
+                shard.m_mutex.unlock();
+            }
+
             reportUsage = false;
         }
 
@@ -392,6 +478,157 @@ namespace AZ
         return static_cast<Name::Hash>(hash % m_maxHashSlots);
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        return m_shards[hash % ShardCount];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[hash % ShardCount];
+    }
+
+    uint32_t NameDictionary::BeginRead(const Shard& shard)
+    {
+        while (true)
+        {
+            const uint32_t epoch = shard.m_readEpoch.load() & 1;
+            shard.m_activeReaders[epoch].fetch_add(1);
+            // If a writer flipped the epoch between the load and the increment, it may have already seen
+            // this counter drain, so register again under the new epoch.
+            if ((shard.m_readEpoch.load() & 1) == epoch)
+            {
+                return epoch;
+            }
+            shard.m_activeReaders[epoch].fetch_sub(1);
+        }
+    }
+
+    void NameDictionary::EndRead(const Shard& shard, uint32_t epoch)
+    {
+        shard.m_activeReaders[epoch].fetch_sub(1);
+    }
+
+    void NameDictionary::Synchronize(Shard& shard)
+    {
+        // New readers register against the other counter, so the previous one can only decrease
+        const uint32_t previousEpoch = shard.m_readEpoch.fetch_add(1) & 1;
+        while (shard.m_activeReaders[previousEpoch].load() != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void NameDictionary::InsertIntoLookupTable(Shard& shard, Internal::NameData* nameData)
+    {
+        LookupTable* table = shard.m_lookupTable.load(AZStd::memory_order_relaxed);
+        // Keep the table at most half full so lock free probes always terminate quickly
+        if (table == nullptr || (shard.m_usedSlots + 1) * 2 > table->m_mask + 1)
+        {
+            // The rebuilt table is filled from m_dictionary, which already contains nameData
+            RebuildLookupTable(shard, shard.m_dictionary.size() * 4);
+            return;
+        }
+
+        for (size_t slot = (nameData->m_hash / ShardCount) & table->m_mask;; slot = (slot + 1) & table->m_mask)
+        {
+            Internal::NameData* current = table->m_slots[slot].load(AZStd::memory_order_relaxed);
+            if (current == nullptr || current == NameDictionaryInternal::LookupTombstone)
+            {
+                if (current == nullptr)
+                {
+                    ++shard.m_usedSlots;
+                }
+                table->m_slots[slot].store(nameData, AZStd::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    void NameDictionary::RemoveFromLookupTable(Shard& shard, Internal::NameData* nameData)
+    {
+        LookupTable* table = shard.m_lookupTable.load(AZStd::memory_order_relaxed);
+        if (table == nullptr)
+        {
+            return;
+        }
+
+        for (size_t slot = (nameData->m_hash / ShardCount) & table->m_mask;; slot = (slot + 1) & table->m_mask)
+        {
+            Internal::NameData* current = table->m_slots[slot].load(AZStd::memory_order_relaxed);
+            if (current == nullptr)
+            {
+                return;
+            }
+            if (current == nameData)
+            {
+                // The slot stays occupied so probes for other entries in the same run keep going
+                table->m_slots[slot].store(NameDictionaryInternal::LookupTombstone, AZStd::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    void NameDictionary::RebuildLookupTable(Shard& shard, size_t minimumCapacity)
+    {
+        size_t capacity = MinLookupTableCapacity;
+        while (capacity < minimumCapacity)
+        {
+            capacity <<= 1;
+        }
+
+        // Populate the new table before publishing it, so readers never see it partially filled.
+        // Rebuilding also drops every tombstone of the old table.
+        LookupTable* newTable = aznew LookupTable(capacity);
+        for (const auto& [hash, nameDataWrapper] : shard.m_dictionary)
+        {
+            size_t slot = (hash / ShardCount) & newTable->m_mask;
+            while (newTable->m_slots[slot].load(AZStd::memory_order_relaxed) != nullptr)
+            {
+                slot = (slot + 1) & newTable->m_mask;
+            }
+            newTable->m_slots[slot].store(nameDataWrapper.m_nameData, AZStd::memory_order_relaxed);
+        }
+        shard.m_usedSlots = shard.m_dictionary.size();
+
+        LookupTable* oldTable = shard.m_lookupTable.exchange(newTable, AZStd::memory_order_acq_rel);
+        if (oldTable != nullptr)
+        {
+            Synchronize(shard);
+            delete oldTable;
+        }
+    }
+
+    bool NameDictionary::TryAcquire(Internal::NameData* nameData)
+    {
+        int32_t useCount = nameData->m_useCount.load(AZStd::memory_order_acquire);
+        while (useCount > 0)
+        {
+            if (nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // NameDictionary::LookupTable implementation
+    NameDictionary::LookupTable::LookupTable(size_t capacity)
+        : m_mask(capacity - 1)
+        , m_slots(new AZStd::atomic<Internal::NameData*>[capacity])
+    {
+        AZ_Assert((capacity & m_mask) == 0, "NameDictionary lookup table capacity must be a power of two");
+        for (size_t slot = 0; slot < capacity; ++slot)
+        {
+            m_slots[slot].store(nullptr, AZStd::memory_order_relaxed);
+        }
+    }
+
+    NameDictionary::LookupTable::~LookupTable()
+    {
+        delete[] m_slots;
+    }
+
 
     // NameDictionary::ScopedNameDataWrapper RAII implementation
     NameDictionary::ScopedNameDataWrapper::ScopedNameDataWrapper(NameDictionary& nameDictionary, Internal::NameData* nameData)
@@ -8,10 +8,12 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -43,6 +45,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! The dictionary is split into shards selected by the hash value. Looking up a name that already
+    //! exists (MakeName cache hits and FindName) never takes a lock; it probes a per-shard open addressed
+    //! index and relies on a per-shard read epoch to keep NameData alive while it is being inspected.
+    //! Adding or releasing a name only locks the shard the hash belongs to.
     class NameDictionary final
     {
     public:
@@ -71,7 +78,7 @@ namespace AZ
         //! @return A Name instance holding a dictionary entry associated with the provided raw string.
         Name MakeName(AZStd::string_view name);
 
-        //! Search for an existing name in the dictionary by hash.
+        //! Search for an existing name in the dictionary by hash. This never locks.
         //! @param hash The key by which to search for the name.
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
@@ -127,8 +134,71 @@ namespace AZ
             NameDictionary& m_nameDictionary;
         };
 
-        AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        using NameDataMap = AZStd::unordered_map<Name::Hash, ScopedNameDataWrapper>;
+
+        //! Open addressed table of NameData pointers that can be probed without a lock.
+        //! Slots are only written while the owning shard's mutex is held, and a table is never
+        //! resized in place: a larger copy is published and the old one is freed once all
+        //! readers that could have observed it have left.
+        struct LookupTable
+        {
+            AZ_CLASS_ALLOCATOR(LookupTable, AZ::OSAllocator);
+
+            explicit LookupTable(size_t capacity);
+            ~LookupTable();
+
+            size_t m_mask;
+            AZStd::atomic<Internal::NameData*>* m_slots;
+        };
+
+        //! A slice of the dictionary. Writers serialize on m_mutex, readers only touch
+        //! m_lookupTable and the read epoch counters.
+        //! Aligned to avoid cache line sharing between shards.
+        struct alignas(64) Shard
+        {
+            //! Authoritative storage of the shard. Only accessed while m_mutex is held.
+            NameDataMap m_dictionary;
+            mutable AZStd::mutex m_mutex;
+
+            AZStd::atomic<LookupTable*> m_lookupTable{ nullptr };
+            //! Number of occupied slots (live entries and tombstones) in m_lookupTable.
+            size_t m_usedSlots{};
+
+            //! Readers register in the counter selected by the low bit of m_readEpoch.
+            //! Writers flip the epoch and wait for the previous counter to drain before
+            //! freeing anything a reader could still be looking at.
+            AZStd::atomic<uint32_t> m_readEpoch{ 0 };
+            mutable AZStd::atomic<uint32_t> m_activeReaders[2]{};
+        };
+
+        static constexpr size_t ShardCount = 32;
+        static constexpr size_t MinLookupTableCapacity = 64;
+
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        //! Lock free lookup of the NameData stored at the hash.
+        //! Returns a Name if an entry with exactly that hash is alive. If @nameString is not empty,
+        //! follows the collision chain until an entry with a matching string is found.
+        //! A miss does not mean the name is absent; the caller should fall back to the locked path.
+        Name LockFreeFind(Name::Hash hash, AZStd::string_view nameString) const;
+
+        //! Enters and leaves the read side of a shard. Returns the epoch parity to pass to EndRead.
+        static uint32_t BeginRead(const Shard& shard);
+        static void EndRead(const Shard& shard, uint32_t epoch);
+        //! Waits until every reader that entered the shard before this call has left.
+        //! Must be called with the shard mutex held.
+        static void Synchronize(Shard& shard);
+
+        //! Adds or removes the NameData from the shard lookup table. Must be called with the shard mutex held.
+        static void InsertIntoLookupTable(Shard& shard, Internal::NameData* nameData);
+        static void RemoveFromLookupTable(Shard& shard, Internal::NameData* nameData);
+        static void RebuildLookupTable(Shard& shard, size_t minimumCapacity);
+
+        //! Increments the use count only if the name has not already been released.
+        static bool TryAcquire(Internal::NameData* nameData);
+
+        AZStd::array<Shard, ShardCount> m_shards;
 
         //! A fixed Name used as the head of a linked list of Name literals.
         //! These literals can be static and have lifecycles not coupled to the name dictionary,
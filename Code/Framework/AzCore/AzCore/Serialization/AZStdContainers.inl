@@ -469,6 +469,20 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            /// Returns the address of the first element.
+            void* GetContiguousElements(void* instance) override
+            {
+                return reinterpret_cast<T*>(instance)->data();
+            }
+
+            /// Resizes the container and returns the address of the first element.
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                T* arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->resize(numElements);
+                return arrayPtr->data();
+            }
         };
         template<class T, bool IsStableIterators, size_t N>
         class AZStdFixedCapacityRandomAccessContainer
@@ -500,6 +514,18 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            /// Resizes the container and returns the address of the first element if it has the capacity for numElements.
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                if (numElements > N)
+                {
+                    return nullptr;
+                }
+                T* arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->resize(numElements);
+                return arrayPtr->data();
+            }
         };
 
         class AZStdArrayEvents : public SerializeContext::IEventHandler
@@ -648,6 +674,18 @@ namespace AZ
                 return nullptr;
             }
 
+            /// Returns the address of the first element.
+            void* GetContiguousElements(void* instance) override
+            {
+                return reinterpret_cast<ContainerType*>(instance)->data();
+            }
+
+            /// Returns the address of the first element if numElements matches the size of the array.
+            void* ResizeContiguousElements(void* instance, size_t numElements) override
+            {
+                return numElements == N ? reinterpret_cast<ContainerType*>(instance)->data() : nullptr;
+            }
+
             /// Store element
             void    StoreElement(void* instance, void* element) override
             {
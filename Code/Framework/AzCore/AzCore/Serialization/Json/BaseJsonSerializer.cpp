@@ -225,6 +225,13 @@ namespace AZ
         return OperationFlags::None;
     }
 
+    JsonSerializationResult::Result BaseJsonSerializer::LoadArray(void*, const Uuid&, JsonArrayElementReader&,
+        JsonDeserializerContext& context)
+    {
+        return context.Report(JsonSerializationResult::Tasks::ReadField, JsonSerializationResult::Outcomes::Unsupported,
+            "Custom json serializer doesn't support loading arrays from a stream.");
+    }
+
     JsonSerializationResult::ResultCode BaseJsonSerializer::ContinueLoading(
         void* object, const Uuid& typeId, const rapidjson::Value& value, JsonDeserializerContext& context, ContinuationFlags flags)
     {
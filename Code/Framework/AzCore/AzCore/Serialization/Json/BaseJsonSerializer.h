@@ -150,6 +150,19 @@ namespace AZ
         JsonBaseContext& m_context;
     };
 
+    //! Provides the elements of a json array one at a time while the array is being read from a stream,
+    //! so the array doesn't have to be stored in a json document in its entirety.
+    class JsonArrayElementReader
+    {
+    public:
+        virtual ~JsonArrayElementReader() = default;
+
+        //! Reads the next element of the array.
+        //! @return The next element, which remains valid until the next call, or nullptr if there are no more elements
+        //!     or the element couldn't be read.
+        virtual const rapidjson::Value* ReadNextElement() = 0;
+    };
+
     //! The abstract class for primitive Json Serializers. 
     //! It is intentionally not templated, and uses void* for output value parameters.
     class BaseJsonSerializer
@@ -172,8 +185,10 @@ namespace AZ
         {
             None = 0,                       //! No flags that control how the custom json serializer is used.
             ManualDefault = 1 << 0,         //! Even if an (explicit) default is found the custom json serializer will still be called.
-            InitializeNewInstance = 1 << 1  //! If set, the custom json serializer will be called with an explicit default if a new
+            InitializeNewInstance = 1 << 1, //! If set, the custom json serializer will be called with an explicit default if a new
                                             //! instance of its target type is created.
+            StreamArrays = 1 << 2           //! If set, json arrays that are read from a stream are passed to LoadArray one element
+                                            //! at a time instead of being read into a json document first.
         };
 
         virtual ~BaseJsonSerializer() = default;
@@ -194,6 +209,12 @@ namespace AZ
         //! Returns the operation flags which tells the Json Serialization how this custom json serializer can be used.
         virtual OperationFlags GetOperationsFlags() const;
 
+        //! Transforms the elements of a json array that's read from a stream to outputValue. Only called for custom json serializers
+        //! that set OperationFlags::StreamArrays. Elements that are not read by the serializer are skipped.
+        //! \note The default implementation reports that streaming arrays is unsupported.
+        virtual JsonSerializationResult::Result LoadArray(void* outputValue, const Uuid& outputValueTypeId,
+            JsonArrayElementReader& elementReader, JsonDeserializerContext& context);
+
     protected:
         //! Continues loading of a (sub)value. Use this function to load member variables for instance. This is more optimal than 
         //! directly calling the json serialization.
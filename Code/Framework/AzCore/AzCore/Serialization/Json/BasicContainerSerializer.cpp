@@ -15,6 +15,30 @@
 
 namespace AZ
 {
+    namespace Internal
+    {
+        //! Provides the elements of an array in a json document.
+        class JsonDocumentArrayElementReader final
+            : public JsonArrayElementReader
+        {
+        public:
+            explicit JsonDocumentArrayElementReader(const rapidjson::Value& array)
+                : m_current(array.Begin())
+                , m_end(array.End())
+            {
+            }
+
+            const rapidjson::Value* ReadNextElement() override
+            {
+                return m_current != m_end ? m_current++ : nullptr;
+            }
+
+        private:
+            rapidjson::Value::ConstValueIterator m_current;
+            rapidjson::Value::ConstValueIterator m_end;
+        };
+    } // namespace Internal
+
     AZ_CLASS_ALLOCATOR_IMPL(JsonBasicContainerSerializer, SystemAllocator);
 
     JsonSerializationResult::Result JsonBasicContainerSerializer::Load(void* outputValue, const Uuid& outputValueTypeId,
@@ -28,7 +52,10 @@ namespace AZ
         switch (inputValue.GetType())
         {
         case rapidjson::kArrayType:
-            return LoadContainer(outputValue, outputValueTypeId, inputValue, context);
+        {
+            Internal::JsonDocumentArrayElementReader elementReader(inputValue);
+            return LoadContainer(outputValue, outputValueTypeId, elementReader, context);
+        }
 
         case rapidjson::kObjectType:
             [[fallthrough]];
@@ -50,6 +77,18 @@ namespace AZ
         }
     }
 
+    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadArray(void* outputValue, const Uuid& outputValueTypeId,
+        JsonArrayElementReader& elementReader, JsonDeserializerContext& context)
+    {
+        AZ_Assert(outputValue, "Expected a valid pointer to load from json array.");
+        return LoadContainer(outputValue, outputValueTypeId, elementReader, context);
+    }
+
+    BaseJsonSerializer::OperationFlags JsonBasicContainerSerializer::GetOperationsFlags() const
+    {
+        return OperationFlags::StreamArrays;
+    }
+
     bool JsonBasicContainerSerializer::ShouldClearContainer(const JsonDeserializerContext& context) const
     {
         return context.ShouldClearContainers();
@@ -144,7 +183,7 @@ namespace AZ
     }
 
     JsonSerializationResult::Result JsonBasicContainerSerializer::LoadContainer(void* outputValue, const Uuid& outputValueTypeId,
-        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+        JsonArrayElementReader& elementReader, JsonDeserializerContext& context)
     {
         namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
 
@@ -197,10 +236,12 @@ namespace AZ
             }
             retVal.Combine(result);
         }
-        rapidjson::SizeType arraySize = inputValue.Size();
-        for (rapidjson::SizeType i = 0; i < arraySize; ++i)
+        // The elements are counted as they're read as the size of the array isn't known up front when it's read from a stream.
+        size_t arraySize = 0;
+        while (const rapidjson::Value* element = elementReader.ReadNextElement())
         {
-            ScopedContextPath subPath(context, i);
+            ScopedContextPath subPath(context, arraySize);
+            ++arraySize;
 
             size_t expectedSize = container->Size(outputValue) + 1;
 
@@ -222,7 +263,7 @@ namespace AZ
                 *reinterpret_cast<void**>(elementAddress) = nullptr;
             }
             
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, *element, context, flags);
             if (result.GetProcessing() == JSR::Processing::Halted)
             {
                 container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
@@ -248,7 +289,7 @@ namespace AZ
             } 
         }
 
-        if (!retVal.HasDoneWork() && inputValue.Empty())
+        if (!retVal.HasDoneWork() && arraySize == 0)
         {
             return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Success, "No values provided for basic container.");
         }
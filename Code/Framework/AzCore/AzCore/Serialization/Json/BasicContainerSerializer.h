@@ -21,8 +21,11 @@ namespace AZ
         AZ_CLASS_ALLOCATOR_DECL;
         JsonSerializationResult::Result Load(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
             JsonDeserializerContext& context) override;
+        JsonSerializationResult::Result LoadArray(void* outputValue, const Uuid& outputValueTypeId,
+            JsonArrayElementReader& elementReader, JsonDeserializerContext& context) override;
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context) override;
+        OperationFlags GetOperationsFlags() const override;
 
     protected:
         //! When this function returns true then the container will be cleared before applying the data from the json document.
@@ -30,7 +33,7 @@ namespace AZ
         virtual bool ShouldClearContainer(const JsonDeserializerContext& context) const;
 
     private:
-        JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
-            JsonDeserializerContext& context);
+        JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId,
+            JsonArrayElementReader& elementReader, JsonDeserializerContext& context);
     };
 } // namespace AZ
@@ -21,6 +21,7 @@ namespace AZ
     {
         friend class JsonSerialization;
         friend class BaseJsonSerializer;
+        friend class JsonStreamingDeserializer;
 
     private:
         enum class ResolvePointerResult : bool
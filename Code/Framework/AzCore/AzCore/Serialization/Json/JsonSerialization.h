@@ -17,6 +17,11 @@
 
 namespace AZ
 {
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     class BaseJsonSerializer;
 
     struct JsonImportSettings;
@@ -177,6 +182,43 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the json from the provided stream into the supplied object. The object is expected to be created before calling load.
+        //! Unlike Load, the json isn't read into a json document first. Objects and arrays are loaded while they're being read from
+        //! the stream where possible, which reduces the memory needed to load large json files such as prefabs.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream the json will be read from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the json from the provided stream into the supplied object. The object is expected to be created before calling load.
+        //! Unlike Load, the json isn't read into a json document first. Objects and arrays are loaded while they're being read from
+        //! the stream where possible, which reduces the memory needed to load large json files such as prefabs.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream the json will be read from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode LoadFromStream(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the json from the provided stream into the supplied object. The object is expected to be created before calling load.
+        //! Unlike Load, the json isn't read into a json document first. Objects and arrays are loaded while they're being read from
+        //! the stream where possible, which reduces the memory needed to load large json files such as prefabs.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream the json will be read from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the json from the provided stream into the supplied object. The object is expected to be created before calling load.
+        //! Unlike Load, the json isn't read into a json document first. Objects and arrays are loaded while they're being read from
+        //! the stream where possible, which reduces the memory needed to load large json files such as prefabs.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream the json will be read from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode LoadFromStream(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -359,6 +401,20 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::LoadFromStream(
+        T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return LoadFromStream(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
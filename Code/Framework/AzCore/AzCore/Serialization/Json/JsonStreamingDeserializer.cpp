@@ -0,0 +1,556 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamingDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //
+    // InputStream
+    //
+
+    JsonStreamingDeserializer::InputStream::InputStream(IO::GenericStream& stream)
+        : m_stream(stream)
+    {
+        m_buffer.resize_no_construct(StreamBufferSize);
+        m_cursor = m_buffer.data();
+        m_end = m_buffer.data();
+        ReadBlock();
+    }
+
+    void JsonStreamingDeserializer::InputStream::ReadBlock()
+    {
+        m_blockOffset += static_cast<size_t>(m_end - m_buffer.data());
+        IO::SizeType bytesRead = m_stream.Read(m_buffer.size(), m_buffer.data());
+        m_cursor = m_buffer.data();
+        m_end = m_buffer.data() + bytesRead;
+    }
+
+    //
+    // TokenHandler
+    //
+
+    bool JsonStreamingDeserializer::TokenHandler::Null()
+    {
+        m_token.m_type = TokenType::Null;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Bool(bool value)
+    {
+        m_token.m_type = TokenType::Bool;
+        m_token.m_bool = value;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Int(int value)
+    {
+        m_token.m_type = TokenType::Int;
+        m_token.m_int64 = value;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Uint(unsigned value)
+    {
+        m_token.m_type = TokenType::Uint;
+        m_token.m_uint64 = value;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Int64(int64_t value)
+    {
+        m_token.m_type = TokenType::Int64;
+        m_token.m_int64 = value;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Uint64(uint64_t value)
+    {
+        m_token.m_type = TokenType::Uint64;
+        m_token.m_uint64 = value;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Double(double value)
+    {
+        m_token.m_type = TokenType::Double;
+        m_token.m_double = value;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::RawNumber(const char*, rapidjson::SizeType, bool)
+    {
+        AZ_Assert(false, "The json stream is parsed without requesting numbers as strings.");
+        return false;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::String(const char* value, rapidjson::SizeType length, bool)
+    {
+        m_token.m_type = TokenType::String;
+        m_token.m_string.assign(value, length);
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::StartObject()
+    {
+        m_token.m_type = TokenType::StartObject;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::Key(const char* value, rapidjson::SizeType length, bool)
+    {
+        m_token.m_type = TokenType::Key;
+        m_token.m_string.assign(value, length);
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::EndObject(rapidjson::SizeType)
+    {
+        m_token.m_type = TokenType::EndObject;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::StartArray()
+    {
+        m_token.m_type = TokenType::StartArray;
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::TokenHandler::EndArray(rapidjson::SizeType)
+    {
+        m_token.m_type = TokenType::EndArray;
+        return true;
+    }
+
+    //
+    // ArrayElementReader
+    //
+
+    //! Reads the elements of a json array from the stream one at a time. Every element is read into the document of the
+    //! deserializer, which is released when the next element is requested.
+    class JsonStreamingDeserializer::ArrayElementReader final
+        : public JsonArrayElementReader
+    {
+    public:
+        explicit ArrayElementReader(JsonStreamingDeserializer& deserializer)
+            : m_deserializer(deserializer)
+        {
+        }
+
+        ~ArrayElementReader() override
+        {
+            m_deserializer.ReleaseDocumentValue();
+        }
+
+        const rapidjson::Value* ReadNextElement() override
+        {
+            m_deserializer.ReleaseDocumentValue();
+            if (!ReadElementStart())
+            {
+                return nullptr;
+            }
+            if (!m_deserializer.ReadValue(m_deserializer.m_documentValue))
+            {
+                m_failed = true;
+                return nullptr;
+            }
+            return &m_deserializer.m_documentValue;
+        }
+
+        //! Skips over the elements that weren't read so the stream continues after the array.
+        //! Returns false if the array couldn't be parsed.
+        bool Finish()
+        {
+            m_deserializer.ReleaseDocumentValue();
+            while (ReadElementStart())
+            {
+                if (!m_deserializer.SkipValue())
+                {
+                    m_failed = true;
+                }
+            }
+            return !m_failed;
+        }
+
+    private:
+        bool ReadElementStart()
+        {
+            if (m_endReached || m_failed)
+            {
+                return false;
+            }
+            if (!m_deserializer.ReadToken())
+            {
+                m_failed = true;
+                return false;
+            }
+            if (m_deserializer.m_handler.m_token.m_type == TokenType::EndArray)
+            {
+                m_endReached = true;
+                return false;
+            }
+            return true;
+        }
+
+        JsonStreamingDeserializer& m_deserializer;
+        bool m_endReached{ false };
+        bool m_failed{ false };
+    };
+
+    //
+    // JsonStreamingDeserializer
+    //
+
+    JsonStreamingDeserializer::JsonStreamingDeserializer(IO::GenericStream& stream, JsonDeserializerContext& context)
+        : m_documentAllocator(m_documentBuffer, DocumentBufferSize)
+        , m_inputStream(stream)
+        , m_context(context)
+    {
+    }
+
+    JsonStreamingDeserializer::~JsonStreamingDeserializer()
+    {
+        ReleaseDocumentValue();
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::Load(void* object, const Uuid& typeId)
+    {
+        using namespace JsonSerializationResult;
+
+        m_reader.IterativeParseInit();
+        if (!ReadToken())
+        {
+            return ReportParseError();
+        }
+
+        ResultCode result = LoadValue(object, typeId, false);
+        if (result.GetProcessing() != Processing::Halted)
+        {
+            // The stream has to end after the root value. Reading past it reports any content that follows as a parse error.
+            if (ReadToken())
+            {
+                return m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                    AZStd::string::format("Unexpected content after the root value at offset %zu.", m_inputStream.Tell()));
+            }
+            if (m_reader.HasParseError())
+            {
+                return ReportParseError();
+            }
+        }
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadValue(void* object, const Uuid& typeId, bool isNewInstance)
+    {
+        const TokenType tokenType = m_handler.m_token.m_type;
+        if (object && (tokenType == TokenType::StartObject || tokenType == TokenType::StartArray))
+        {
+            const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(typeId);
+            if (BaseJsonSerializer* serializer = FindSerializer(typeId, classData))
+            {
+                if (tokenType == TokenType::StartArray &&
+                    (serializer->GetOperationsFlags() & BaseJsonSerializer::OperationFlags::StreamArrays) ==
+                        BaseJsonSerializer::OperationFlags::StreamArrays)
+                {
+                    return LoadArray(object, typeId, *serializer);
+                }
+            }
+            else if (tokenType == TokenType::StartObject && IsStreamableClass(typeId, classData))
+            {
+                return LoadClass(object, *classData);
+            }
+        }
+        return LoadFromDocument(object, typeId, isNewInstance, nullptr);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadWithClassElement(
+        void* object, const SerializeContext::ClassElement& classElement)
+    {
+        // Pointers can be created from the "$type" field, which can appear anywhere in the object, so they're always read in full.
+        return (classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            ? LoadFromDocument(object, classElement.m_typeId, false, &classElement)
+            : LoadValue(object, classElement.m_typeId, false);
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadClass(void* object, const SerializeContext::ClassData& classData)
+    {
+        using namespace JsonSerializationResult;
+
+        size_t numLoads = 0;
+        size_t numMembers = 0;
+        ResultCode retVal(Tasks::ReadField);
+        while (true)
+        {
+            if (!ReadToken())
+            {
+                return ReportParseError();
+            }
+            if (m_handler.m_token.m_type == TokenType::EndObject)
+            {
+                break;
+            }
+            numMembers++;
+
+            AZStd::string_view name = m_handler.m_token.m_string;
+            if (name == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                if (!ReadToken() || !SkipValue())
+                {
+                    return ReportParseError();
+                }
+                continue;
+            }
+            Crc32 nameCrc(name);
+            JsonDeserializer::ElementDataResult foundElementData =
+                JsonDeserializer::FindElementByNameCrc(*m_context.GetSerializeContext(), object, classData, nameCrc);
+
+            ScopedContextPath subPath(m_context, name);
+            // The name is no longer valid after reading the next token.
+            if (!ReadToken())
+            {
+                return ReportParseError();
+            }
+            if (foundElementData.m_found)
+            {
+                ResultCode result = LoadWithClassElement(foundElementData.m_data, *foundElementData.m_info);
+                retVal.Combine(result);
+
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    return m_context.Report(result, "Loading of element has failed.");
+                }
+                else if (result.GetProcessing() != Processing::Altered)
+                {
+                    numLoads++;
+                }
+            }
+            else
+            {
+                retVal.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                    "Skipping field as there's no matching variable in the target."));
+                if (!SkipValue())
+                {
+                    return ReportParseError();
+                }
+            }
+        }
+
+        if (numMembers == 0)
+        {
+            return m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+        }
+
+        size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), classData);
+        if (elementCount > numLoads)
+        {
+            retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+
+        return retVal;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadArray(
+        void* object, const Uuid& typeId, BaseJsonSerializer& serializer)
+    {
+        using namespace JsonSerializationResult;
+
+        ArrayElementReader elementReader(*this);
+        ResultCode result = serializer.LoadArray(object, typeId, elementReader, m_context);
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            return result;
+        }
+        return elementReader.Finish() ? result : ReportParseError();
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::LoadFromDocument(
+        void* object, const Uuid& typeId, bool isNewInstance, const SerializeContext::ClassElement* pointerElement)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!ReadValue(m_documentValue))
+        {
+            ReleaseDocumentValue();
+            return ReportParseError();
+        }
+
+        ResultCode result = pointerElement
+            ? JsonDeserializer::LoadWithClassElement(object, m_documentValue, *pointerElement, m_context)
+            : JsonDeserializer::Load(object, typeId, m_documentValue, isNewInstance, JsonDeserializer::UseTypeDeserializer::Yes, m_context);
+        ReleaseDocumentValue();
+        return result;
+    }
+
+    BaseJsonSerializer* JsonStreamingDeserializer::FindSerializer(
+        const Uuid& typeId, const SerializeContext::ClassData* classData) const
+    {
+        if (BaseJsonSerializer* serializer = m_context.GetRegistrationContext()->GetSerializerForType(typeId))
+        {
+            return serializer;
+        }
+
+        // Mirrors JsonDeserializer::Load, which uses the serializer for the generic type unless the type is an enum that
+        // was reflected as a field without being reflected itself.
+        if (classData && classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != typeId)
+        {
+            const bool isUnreflectedEnum =
+                (classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{ 0 } &&
+                m_context.GetSerializeContext()->GetUnderlyingTypeId(typeId) == classData->m_typeId;
+            return isUnreflectedEnum
+                ? nullptr
+                : m_context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId());
+        }
+        return nullptr;
+    }
+
+    bool JsonStreamingDeserializer::IsStreamableClass(const Uuid& typeId, const SerializeContext::ClassData* classData) const
+    {
+        if (!classData || classData->m_container)
+        {
+            return false;
+        }
+        if (classData->m_azRtti)
+        {
+            return classData->m_azRtti->GetGenericTypeId() == typeId &&
+                (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) != AZ::TypeTraits::is_enum;
+        }
+        return true;
+    }
+
+    bool JsonStreamingDeserializer::ReadToken()
+    {
+        m_handler.m_token.m_type = TokenType::None;
+        // The reader doesn't call the handler after the last token, in which case it reports success without a new token.
+        return m_reader.IterativeParseNext<ParseFlags>(m_inputStream, m_handler) && m_handler.m_token.m_type != TokenType::None;
+    }
+
+    bool JsonStreamingDeserializer::ReadValue(rapidjson::Value& value)
+    {
+        Token& token = m_handler.m_token;
+        switch (token.m_type)
+        {
+        case TokenType::Null:
+            value.SetNull();
+            return true;
+        case TokenType::Bool:
+            value.SetBool(token.m_bool);
+            return true;
+        case TokenType::Int:
+            value.SetInt(static_cast<int>(token.m_int64));
+            return true;
+        case TokenType::Uint:
+            value.SetUint(static_cast<unsigned>(token.m_uint64));
+            return true;
+        case TokenType::Int64:
+            value.SetInt64(token.m_int64);
+            return true;
+        case TokenType::Uint64:
+            value.SetUint64(token.m_uint64);
+            return true;
+        case TokenType::Double:
+            value.SetDouble(token.m_double);
+            return true;
+        case TokenType::String:
+            value.SetString(token.m_string.c_str(), static_cast<rapidjson::SizeType>(token.m_string.size()), m_documentAllocator);
+            return true;
+        case TokenType::StartObject:
+            value.SetObject();
+            while (ReadToken())
+            {
+                if (token.m_type == TokenType::EndObject)
+                {
+                    return true;
+                }
+                rapidjson::Value name(token.m_string.c_str(), static_cast<rapidjson::SizeType>(token.m_string.size()), m_documentAllocator);
+                rapidjson::Value member;
+                if (!ReadToken() || !ReadValue(member))
+                {
+                    return false;
+                }
+                value.AddMember(AZStd::move(name), AZStd::move(member), m_documentAllocator);
+            }
+            return false;
+        case TokenType::StartArray:
+            value.SetArray();
+            while (ReadToken())
+            {
+                if (token.m_type == TokenType::EndArray)
+                {
+                    return true;
+                }
+                rapidjson::Value element;
+                if (!ReadValue(element))
+                {
+                    return false;
+                }
+                value.PushBack(AZStd::move(element), m_documentAllocator);
+            }
+            return false;
+        default:
+            return false;
+        }
+    }
+
+    bool JsonStreamingDeserializer::SkipValue()
+    {
+        size_t depth = 0;
+        while (true)
+        {
+            switch (m_handler.m_token.m_type)
+            {
+            case TokenType::StartObject:
+                [[fallthrough]];
+            case TokenType::StartArray:
+                depth++;
+                break;
+            case TokenType::EndObject:
+                [[fallthrough]];
+            case TokenType::EndArray:
+                depth--;
+                break;
+            default:
+                break;
+            }
+
+            if (depth == 0)
+            {
+                return true;
+            }
+            if (!ReadToken())
+            {
+                return false;
+            }
+        }
+    }
+
+    void JsonStreamingDeserializer::ReleaseDocumentValue()
+    {
+        m_documentValue.SetNull();
+        // Frees the memory that didn't fit in the document buffer. The buffer itself is kept for the next value.
+        m_documentAllocator.Clear();
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamingDeserializer::ReportParseError()
+    {
+        using namespace JsonSerializationResult;
+
+        if (!m_reader.HasParseError())
+        {
+            return m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("Unexpected end of the json stream at offset %zu.", m_inputStream.Tell()));
+        }
+        return m_context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+            AZStd::string::format("JSON parse error at offset %zu: %s", m_reader.GetErrorOffset(),
+                rapidjson::GetParseError_En(m_reader.GetParseErrorCode())));
+    }
+} // namespace AZ
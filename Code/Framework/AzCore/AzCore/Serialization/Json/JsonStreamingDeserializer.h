@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    //! Loads json from a stream into an object without reading the entire json document into memory first.
+    //! Json objects that map to reflected classes are read one field at a time and json arrays are passed one element
+    //! at a time to custom json serializers that support OperationFlags::StreamArrays. Any other value is read into a
+    //! small json document and passed to the JsonDeserializer. The memory of that document is reused for the next value,
+    //! so the memory used while loading is bounded by the largest of those values instead of the size of the document.
+    class JsonStreamingDeserializer final
+    {
+        friend class JsonSerialization;
+
+    public:
+        JsonStreamingDeserializer(IO::GenericStream& stream, JsonDeserializerContext& context);
+        ~JsonStreamingDeserializer();
+
+        JsonStreamingDeserializer(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer(JsonStreamingDeserializer&& rhs) = delete;
+        JsonStreamingDeserializer& operator=(const JsonStreamingDeserializer& rhs) = delete;
+        JsonStreamingDeserializer& operator=(JsonStreamingDeserializer&& rhs) = delete;
+
+    private:
+        static constexpr size_t StreamBufferSize = 64 * 1024;
+        static constexpr size_t DocumentBufferSize = 16 * 1024;
+        static constexpr unsigned int ParseFlags = rapidjson::kParseCommentsFlag;
+
+        //! Implements the rapidjson input stream concept on top of a GenericStream, reading the stream in blocks.
+        class InputStream
+        {
+        public:
+            using Ch = char; //!< Character type. Only support char.
+
+            explicit InputStream(IO::GenericStream& stream);
+
+            char Peek() const
+            {
+                // rapidjson treats a null character as the end of the input.
+                return m_cursor != m_end ? *m_cursor : '\0';
+            }
+
+            char Take()
+            {
+                if (m_cursor == m_end)
+                {
+                    return '\0';
+                }
+                char result = *m_cursor++;
+                if (m_cursor == m_end)
+                {
+                    ReadBlock();
+                }
+                return result;
+            }
+
+            size_t Tell() const
+            {
+                return m_blockOffset + static_cast<size_t>(m_cursor - m_buffer.data());
+            }
+
+            // Not implemented as the input is only read.
+            char* PutBegin()
+            {
+                AZ_Assert(false, "JsonStreamingDeserializer input stream PutBegin not supported.");
+                return nullptr;
+            }
+            void Put(char)
+            {
+                AZ_Assert(false, "JsonStreamingDeserializer input stream Put not supported.");
+            }
+            void Flush()
+            {
+                AZ_Assert(false, "JsonStreamingDeserializer input stream Flush not supported.");
+            }
+            size_t PutEnd(char*)
+            {
+                AZ_Assert(false, "JsonStreamingDeserializer input stream PutEnd not supported.");
+                return 0;
+            }
+
+        private:
+            void ReadBlock();
+
+            AZStd::vector<char> m_buffer;
+            IO::GenericStream& m_stream;
+            const char* m_cursor{ nullptr };
+            const char* m_end{ nullptr };
+            size_t m_blockOffset{ 0 };
+        };
+
+        enum class TokenType : u8
+        {
+            None,
+            Null,
+            Bool,
+            Int,
+            Uint,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Key,
+            StartObject,
+            EndObject,
+            StartArray,
+            EndArray
+        };
+
+        //! The last token read from the stream. Strings are copied as they're only valid for the duration of the callback.
+        struct Token
+        {
+            AZStd::string m_string;
+            double m_double{ 0.0 };
+            int64_t m_int64{ 0 };
+            uint64_t m_uint64{ 0 };
+            TokenType m_type{ TokenType::None };
+            bool m_bool{ false };
+        };
+
+        //! Handler for the rapidjson reader that stores the last read token.
+        struct TokenHandler
+        {
+            bool Null();
+            bool Bool(bool value);
+            bool Int(int value);
+            bool Uint(unsigned value);
+            bool Int64(int64_t value);
+            bool Uint64(uint64_t value);
+            bool Double(double value);
+            bool RawNumber(const char* value, rapidjson::SizeType length, bool copy);
+            bool String(const char* value, rapidjson::SizeType length, bool copy);
+            bool StartObject();
+            bool Key(const char* value, rapidjson::SizeType length, bool copy);
+            bool EndObject(rapidjson::SizeType memberCount);
+            bool StartArray();
+            bool EndArray(rapidjson::SizeType elementCount);
+
+            Token m_token;
+        };
+
+        class ArrayElementReader;
+
+        JsonSerializationResult::ResultCode Load(void* object, const Uuid& typeId);
+        JsonSerializationResult::ResultCode LoadValue(void* object, const Uuid& typeId, bool isNewInstance);
+        JsonSerializationResult::ResultCode LoadWithClassElement(void* object, const SerializeContext::ClassElement& classElement);
+        JsonSerializationResult::ResultCode LoadClass(void* object, const SerializeContext::ClassData& classData);
+        JsonSerializationResult::ResultCode LoadArray(void* object, const Uuid& typeId, BaseJsonSerializer& serializer);
+        //! Reads the value starting at the current token into a json document and loads it with the JsonDeserializer.
+        JsonSerializationResult::ResultCode LoadFromDocument(
+            void* object, const Uuid& typeId, bool isNewInstance, const SerializeContext::ClassElement* pointerElement);
+
+        //! Returns the custom json serializer the JsonDeserializer would use for the type, or null if there's none.
+        BaseJsonSerializer* FindSerializer(const Uuid& typeId, const SerializeContext::ClassData* classData) const;
+        //! Returns true if the JsonDeserializer would load a json object for the type field by field.
+        bool IsStreamableClass(const Uuid& typeId, const SerializeContext::ClassData* classData) const;
+
+        //! Reads the next token from the stream. Returns false if the stream couldn't be parsed or no tokens are left.
+        bool ReadToken();
+        //! Reads the value that starts at the current token into the provided value using the document allocator.
+        bool ReadValue(rapidjson::Value& value);
+        //! Skips over the value that starts at the current token.
+        bool SkipValue();
+        //! Releases the value that was read into the document so its memory can be used for the next value.
+        void ReleaseDocumentValue();
+        JsonSerializationResult::ResultCode ReportParseError();
+
+        alignas(16) char m_documentBuffer[DocumentBufferSize];
+        rapidjson::Value::AllocatorType m_documentAllocator;
+        rapidjson::Value m_documentValue;
+        InputStream m_inputStream;
+        TokenHandler m_handler;
+        rapidjson::Reader m_reader;
+        JsonDeserializerContext& m_context;
+    };
+} // namespace AZ
@@ -71,6 +71,9 @@ namespace AZ
     namespace ObjectStreamInternal
     {
         static const u32 s_objectStreamVersion = 3;
+        // Version 4 of the binary format can store the elements of contiguous containers of trivially copyable types as a single
+        // value, see ObjectStreamImpl::WriteFastLayoutHeader. The xml and json formats are unchanged and stay at version 3.
+        static const u32 s_binaryObjectStreamVersion = 4;
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
@@ -105,6 +108,28 @@ namespace AZ
                 ST_BINARYFLAG_ELEMENT_END       = 0
             };
 
+            // Header of the value of a container element that stores all elements of the container as a single block. The header is
+            // followed by the elements in native endian, which can be copied straight into the container when the layout hash of the
+            // stream matches the current reflection. Otherwise each element is loaded through the serializer of the element type.
+            struct FastLayoutHeader
+            {
+                u32 m_layoutHash = 0;
+                u32 m_elementSize = 0;
+                u8 m_elementVersion = 0;
+                u16 m_byteOrderMark = 0;
+            };
+            static constexpr size_t FastLayoutHeaderSize = sizeof(u32) + sizeof(u32) + sizeof(u8) + sizeof(u16);
+            // Stored in native endian to detect if the elements have to be swapped on load.
+            static constexpr u16 FastLayoutByteOrderMark = 0xFEFF;
+
+            // Element type of a container that can be stored as a single block.
+            struct FastLayoutElement
+            {
+                const SerializeContext::ClassElement* m_classElement = nullptr;
+                const SerializeContext::ClassData* m_classData = nullptr;
+                u32 m_size = 0;
+            };
+
             AZ_CLASS_ALLOCATOR(ObjectStreamImpl, SystemAllocator);
 
             ObjectStreamImpl(IO::GenericStream* stream, SerializeContext* sc, const ClassReadyCB& readyCB, const CompletionCB& doneCB, const FilterDescriptor& filterDesc = FilterDescriptor(), int flags = 0, const InplaceLoadRootInfoCB& inplaceLoadInfoCB = InplaceLoadRootInfoCB())
@@ -141,6 +166,18 @@ namespace AZ
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
             bool CloseElement();
 
+            /// Returns true if the elements of the container can be stored as a single block in binary streams.
+            bool FindFastLayoutElement(const SerializeContext::ClassData& containerClassData, FastLayoutElement& fastLayoutElement) const;
+            static u32 GetFastLayoutHash(const FastLayoutElement& fastLayoutElement);
+            /// Writes the fast layout header for the container to m_inStream and returns the address of the elements that should follow it.
+            /// Returns null if the container can't be stored as a single block, in which case the elements are written one by one.
+            const void* WriteFastLayoutHeader(const void* containerPtr, const SerializeContext::ClassData& containerClassData, size_t& elementsSize);
+            static bool ReadFastLayoutHeader(const char* data, size_t dataSize, FastLayoutHeader& header);
+            /// Loads the elements of a container that was stored as a single block.
+            bool LoadFastLayoutElements(const SerializeContext::DataElement& element, const char* data, const SerializeContext::ClassData& containerClassData, void* containerPtr);
+            /// Adds the elements of a container that was stored as a single block as sub elements so they're available to version converters.
+            void ExpandFastLayoutElements(SerializeContext::DataElementNode& containerNode);
+
             const char* GetStreamFilename() const;
 
             enum class StorageAddressResult
@@ -280,6 +317,11 @@ namespace AZ
                 childNode.m_element = AZStd::move(childElement);
                 childNode.m_classData = childClass;
 
+                if (childClass && childClass->m_container && !childClass->m_serializer && childNode.m_element.m_dataSize > 0)
+                {
+                    ExpandFastLayoutElements(childNode);
+                }
+
                 if (childClass)
                 {
                     AZ_Error("Error", childNode.m_element.m_version <= childClass->m_version,
@@ -839,6 +881,13 @@ namespace AZ
                 if (classData->m_container && dataAddress)
                 {
                     classData->m_container->ClearElements(dataAddress, m_sc);
+
+                    // Containers that were stored as a single block have a value instead of child nodes.
+                    if (!classData->m_serializer && element.m_dataSize > 0 && GetType() == ST_BINARY)
+                    {
+                        const char* data = element.m_byteStream.GetLength() > 0 ? element.m_byteStream.GetData()->data() : m_inStream.GetData()->data();
+                        result = LoadFastLayoutElements(element, data, *classData, dataAddress) && result;
+                    }
                 }
 
                 // Read child nodes
@@ -1810,12 +1859,25 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
+                // Contiguous containers of trivially copyable types store their elements as the value of the container element.
+                const void* fastLayoutElements = nullptr;
+                size_t fastLayoutElementsSize = 0;
+                if (classData->m_container && !classData->m_serializer)
+                {
+                    fastLayoutElements = WriteFastLayoutHeader(objectPtr, *classData, fastLayoutElementsSize);
+                    if (fastLayoutElements)
+                    {
+                        element.m_dataSize = FastLayoutHeaderSize + fastLayoutElementsSize;
+                    }
+                }
+                const bool hasValue = classData->m_serializer || fastLayoutElements;
+
                 u8 flagsSize = ST_BINARYFLAG_ELEMENT_HEADER;
                 if (element.m_nameCrc)
                 {
                     flagsSize |= ST_BINARYFLAG_HAS_NAME;
                 }
-                if (classData->m_serializer)
+                if (hasValue)
                 {
                     flagsSize |= ST_BINARYFLAG_HAS_VALUE;
                     if (element.m_dataSize < 8)
@@ -1869,7 +1931,7 @@ namespace AZ
                 m_stream->Write(element.m_id.end() - element.m_id.begin(), element.m_id.begin());
 
                 // Write value
-                if (classData->m_serializer)
+                if (hasValue)
                 {
                     // Write extra size field if necessary
                     if (flagsSize & ST_BINARYFLAG_EXTRA_SIZE_FIELD)
@@ -1904,11 +1966,22 @@ namespace AZ
                     {
                         element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
                         // Directly copy data from element.m_stream into m_stream
-                        m_stream->WriteFromStream(element.m_dataSize, element.m_stream);
+                        m_stream->WriteFromStream(element.m_dataSize - fastLayoutElementsSize, element.m_stream);
+                        if (fastLayoutElements)
+                        {
+                            m_stream->Write(fastLayoutElementsSize, fastLayoutElements);
+                        }
                     }
 
                     element.m_stream = nullptr;
                 }
+
+                if (fastLayoutElements)
+                {
+                    // The elements have already been written, so close the container element here and skip the enumeration of its elements.
+                    CloseElement();
+                    return false;
+                }
             }
 
             return true;
@@ -1948,6 +2021,247 @@ namespace AZ
             return true;
         }
 
+        //=========================================================================
+        // FindFastLayoutElement
+        //=========================================================================
+        bool ObjectStreamImpl::FindFastLayoutElement(const SerializeContext::ClassData& containerClassData, FastLayoutElement& fastLayoutElement) const
+        {
+            SerializeContext::IDataContainer* container = containerClassData.m_container;
+            const SerializeContext::ClassElement* classElement = container->GetElement(container->GetElementNameCrC());
+            if (!classElement || (classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER))
+            {
+                return false;
+            }
+
+            const SerializeContext::ClassData* classData = classElement->m_genericClassInfo
+                ? classElement->m_genericClassInfo->GetClassData()
+                : m_sc->FindClassData(classElement->m_typeId);
+            // None of the per element callbacks are invoked for the elements in a block, so only types that are fully handled by
+            // their serializer qualify.
+            if (!classData || !classData->m_serializer || classData->m_eventHandler || classData->m_doSave || classData->IsDeprecated() ||
+                classData->m_version > 0xFF || classData->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride))
+            {
+                return false;
+            }
+
+            const size_t size = classData->m_serializer->GetTrivialBinarySize();
+            if (size == 0 || size != classElement->m_dataSize)
+            {
+                return false;
+            }
+
+            fastLayoutElement.m_classElement = classElement;
+            fastLayoutElement.m_classData = classData;
+            fastLayoutElement.m_size = static_cast<u32>(size);
+            return true;
+        }
+
+        //=========================================================================
+        // GetFastLayoutHash
+        //=========================================================================
+        u32 ObjectStreamImpl::GetFastLayoutHash(const FastLayoutElement& fastLayoutElement)
+        {
+            const Uuid& typeId = fastLayoutElement.m_classElement->m_typeId;
+            Crc32 hash(typeId.begin(), static_cast<size_t>(typeId.end() - typeId.begin()));
+            const u8 layout[] = {
+                static_cast<u8>(fastLayoutElement.m_size),
+                static_cast<u8>(fastLayoutElement.m_size >> 8),
+                static_cast<u8>(fastLayoutElement.m_size >> 16),
+                static_cast<u8>(fastLayoutElement.m_size >> 24),
+                static_cast<u8>(fastLayoutElement.m_classData->m_version)
+            };
+            hash.Add(layout, sizeof(layout));
+            return hash;
+        }
+
+        //=========================================================================
+        // WriteFastLayoutHeader
+        //=========================================================================
+        const void* ObjectStreamImpl::WriteFastLayoutHeader(const void* containerPtr, const SerializeContext::ClassData& containerClassData, size_t& elementsSize)
+        {
+            FastLayoutElement fastLayoutElement;
+            if (!FindFastLayoutElement(containerClassData, fastLayoutElement))
+            {
+                return nullptr;
+            }
+
+            void* instance = const_cast<void*>(containerPtr);
+            const size_t numElements = containerClassData.m_container->Size(instance);
+            const void* elements = containerClassData.m_container->GetContiguousElements(instance);
+            // Empty containers are smaller without a value and the size of the value has to fit in the extra size field.
+            if (!elements || numElements == 0 || FastLayoutHeaderSize + numElements * fastLayoutElement.m_size >= 0x100000000)
+            {
+                return nullptr;
+            }
+
+            u32 layoutHash = GetFastLayoutHash(fastLayoutElement);
+            u32 elementSize = fastLayoutElement.m_size;
+            u8 elementVersion = static_cast<u8>(fastLayoutElement.m_classData->m_version);
+            u16 byteOrderMark = FastLayoutByteOrderMark;
+            AZStd::endian_swap(layoutHash);
+            AZStd::endian_swap(elementSize);
+            m_inStream.Write(sizeof(layoutHash), &layoutHash);
+            m_inStream.Write(sizeof(elementSize), &elementSize);
+            m_inStream.Write(sizeof(elementVersion), &elementVersion);
+            m_inStream.Write(sizeof(byteOrderMark), &byteOrderMark);
+
+            elementsSize = numElements * fastLayoutElement.m_size;
+            return elements;
+        }
+
+        //=========================================================================
+        // ReadFastLayoutHeader
+        //=========================================================================
+        bool ObjectStreamImpl::ReadFastLayoutHeader(const char* data, size_t dataSize, FastLayoutHeader& header)
+        {
+            if (dataSize < FastLayoutHeaderSize)
+            {
+                return false;
+            }
+
+            memcpy(&header.m_layoutHash, data, sizeof(header.m_layoutHash));
+            data += sizeof(header.m_layoutHash);
+            memcpy(&header.m_elementSize, data, sizeof(header.m_elementSize));
+            data += sizeof(header.m_elementSize);
+            memcpy(&header.m_elementVersion, data, sizeof(header.m_elementVersion));
+            data += sizeof(header.m_elementVersion);
+            memcpy(&header.m_byteOrderMark, data, sizeof(header.m_byteOrderMark));
+            AZStd::endian_swap(header.m_layoutHash);
+            AZStd::endian_swap(header.m_elementSize);
+
+            u16 swappedByteOrderMark = FastLayoutByteOrderMark;
+            AZStd::endian_swap(swappedByteOrderMark);
+            return header.m_elementSize > 0 && (dataSize - FastLayoutHeaderSize) % header.m_elementSize == 0 &&
+                (header.m_byteOrderMark == FastLayoutByteOrderMark || header.m_byteOrderMark == swappedByteOrderMark);
+        }
+
+        //=========================================================================
+        // LoadFastLayoutElements
+        //=========================================================================
+        bool ObjectStreamImpl::LoadFastLayoutElements(const SerializeContext::DataElement& element, const char* data, const SerializeContext::ClassData& containerClassData, void* containerPtr)
+        {
+            SerializeContext::IDataContainer* container = containerClassData.m_container;
+            const SerializeContext::ClassElement* classElement = container->GetElement(container->GetElementNameCrC());
+            const SerializeContext::ClassData* elementClassData = nullptr;
+            if (classElement)
+            {
+                elementClassData = classElement->m_genericClassInfo
+                    ? classElement->m_genericClassInfo->GetClassData()
+                    : m_sc->FindClassData(classElement->m_typeId);
+            }
+
+            FastLayoutHeader header;
+            if (!elementClassData || !elementClassData->m_serializer || !ReadFastLayoutHeader(data, element.m_dataSize, header))
+            {
+                AZStd::string error = AZStd::string::format("Unable to load the elements of %s '%s'(0x%x) as they're not stored in a supported layout.  File %s",
+                    containerClassData.m_name, element.m_name ? element.m_name : "NULL", element.m_nameCrc, GetStreamFilename());
+                m_errorLogger.ReportError(error.c_str());
+                return (m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0;  // in strict mode, this is a complete failure.
+            }
+
+            const char* elementData = data + FastLayoutHeaderSize;
+            const size_t numElements = (element.m_dataSize - FastLayoutHeaderSize) / header.m_elementSize;
+
+            // Copy the elements straight into the container if their layout hasn't changed since they were stored.
+            FastLayoutElement fastLayoutElement;
+            if (header.m_byteOrderMark == FastLayoutByteOrderMark && FindFastLayoutElement(containerClassData, fastLayoutElement) &&
+                header.m_layoutHash == GetFastLayoutHash(fastLayoutElement))
+            {
+                if (void* elements = container->ResizeContiguousElements(containerPtr, numElements))
+                {
+                    memcpy(elements, elementData, numElements * header.m_elementSize);
+                    return true;
+                }
+            }
+
+            // Otherwise load the elements one by one with the serializer of the element type.
+            const bool isDataSwapped = header.m_byteOrderMark != FastLayoutByteOrderMark;
+            for (size_t elementIndex = 0; elementIndex < numElements; ++elementIndex, elementData += header.m_elementSize)
+            {
+                void* elementPtr = container->ReserveElement(containerPtr, classElement);
+                if (!elementPtr)
+                {
+                    AZStd::string error = AZStd::string::format("Unable to reserve element %zu of %zu in %s '%s'(0x%x).  File %s", elementIndex, numElements,
+                        containerClassData.m_name, element.m_name ? element.m_name : "NULL", element.m_nameCrc, GetStreamFilename());
+                    m_errorLogger.ReportError(error.c_str());
+                    return (m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0;  // in strict mode, this is a complete failure.
+                }
+
+                IO::MemoryStream elementStream(elementData, header.m_elementSize);
+                if (!elementClassData->m_serializer->Load(elementPtr, elementStream, header.m_elementVersion, isDataSwapped))
+                {
+                    container->FreeReservedElement(containerPtr, elementPtr, m_sc);
+
+                    AZStd::string error = AZStd::string::format("Serializer failed for element %zu of %s '%s'(0x%x).  File %s", elementIndex,
+                        containerClassData.m_name, element.m_name ? element.m_name : "NULL", element.m_nameCrc, GetStreamFilename());
+                    m_errorLogger.ReportError(error.c_str());
+                    if (m_filterDesc.m_flags & FILTERFLAG_STRICT)
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                container->StoreElement(containerPtr, elementPtr);
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // ExpandFastLayoutElements
+        //=========================================================================
+        void ObjectStreamImpl::ExpandFastLayoutElements(SerializeContext::DataElementNode& containerNode)
+        {
+            SerializeContext::DataElement& containerElement = containerNode.m_element;
+            SerializeContext::IDataContainer* container = containerNode.m_classData->m_container;
+            const SerializeContext::ClassElement* classElement = container->GetElement(container->GetElementNameCrC());
+            const SerializeContext::ClassData* elementClassData = nullptr;
+            if (classElement)
+            {
+                elementClassData = classElement->m_genericClassInfo
+                    ? classElement->m_genericClassInfo->GetClassData()
+                    : m_sc->FindClassData(classElement->m_typeId);
+            }
+
+            FastLayoutHeader header;
+            const char* data = containerElement.m_byteStream.GetData()->data();
+            if (elementClassData && ReadFastLayoutHeader(data, containerElement.m_dataSize, header))
+            {
+                const size_t numElements = (containerElement.m_dataSize - FastLayoutHeaderSize) / header.m_elementSize;
+                const char* elementData = data + FastLayoutHeaderSize;
+                containerNode.m_subElements.reserve(containerNode.m_subElements.size() + numElements);
+                for (size_t elementIndex = 0; elementIndex < numElements; ++elementIndex, elementData += header.m_elementSize)
+                {
+                    SerializeContext::DataElementNode& elementNode = containerNode.m_subElements.emplace_back();
+                    elementNode.m_classData = elementClassData;
+
+                    SerializeContext::DataElement& element = elementNode.m_element;
+                    element.m_name = classElement->m_name;
+                    element.m_nameCrc = classElement->m_nameCrc;
+                    element.m_id = classElement->m_typeId;
+                    element.m_version = header.m_elementVersion;
+                    element.m_dataType = header.m_byteOrderMark == FastLayoutByteOrderMark
+                        ? SerializeContext::DataElement::DT_BINARY
+                        : SerializeContext::DataElement::DT_BINARY_BE;
+                    element.m_dataSize = header.m_elementSize;
+                    element.m_stream = &element.m_byteStream;
+                    element.m_byteStream.Write(header.m_elementSize, elementData);
+                    element.m_byteStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                }
+            }
+            else
+            {
+                AZStd::string error = AZStd::string::format("Unable to convert the elements of %s '%s'(0x%x) as they're not stored in a supported layout.  File %s",
+                    containerNode.m_classData->m_name, containerElement.m_name ? containerElement.m_name : "NULL", containerElement.m_nameCrc,
+                    GetStreamFilename());
+                m_errorLogger.ReportError(error.c_str());
+            }
+
+            // The elements are sub elements now, so the container no longer has a value.
+            containerElement.m_dataSize = 0;
+            containerElement.m_buffer.clear();
+            containerElement.m_byteStream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+        }
+
         //=========================================================================
         // Start
         // [6/12/2012]
@@ -1981,6 +2295,7 @@ namespace AZ
                 }
                 else
                 {
+                    m_version = s_binaryObjectStreamVersion;
                     u8 binaryTag = s_binaryStreamTag;
                     u32 version = static_cast<u32>(m_version);
                     AZStd::endian_swap(binaryTag);
@@ -2009,14 +2324,14 @@ namespace AZ
                         AZStd::endian_swap(version);
                         m_version = version;
 
-                        if (m_version <= s_objectStreamVersion)
+                        if (m_version <= s_binaryObjectStreamVersion)
                         {
                             result = LoadClass(m_inStream, convertedClassElement, nullptr, nullptr, m_flags) && result;
                         }
                         else
                         {
                             AZStd::string newVersionError = AZStd::string::format("ObjectStream binary load error: Stream is a newer version than object stream supports. ObjectStream version: %u, load stream version: %u",
-                                s_objectStreamVersion, m_version);
+                                s_binaryObjectStreamVersion, m_version);
                             m_errorLogger.ReportError(newVersionError.c_str());
 
                             // this is considered a "fatal" error since the entire stream is unreadable.
@@ -84,6 +84,11 @@ namespace AZ
             AZ_SERIALIZE_SWAP_ENDIAN(value, isDataBigEndian);
             return static_cast<size_t>(stream.Write(sizeof(T), reinterpret_cast<const void*>(&value)));
         }
+
+        size_t GetTrivialBinarySize() const override
+        {
+            return sizeof(T);
+        }
     };
 
 
@@ -587,6 +592,7 @@ namespace AZ
     {
         if (IsRemovingReflection())
         {
+            InvalidateClonePlans();
             m_uuidMap.erase(typeUuid);
             return;
         }
@@ -1446,6 +1452,219 @@ namespace AZ
         ObjectParentStack   m_parentStack;
     };
 
+    struct SerializeContext::ClonePlan
+    {
+        enum class OpType : u8
+        {
+            CopyBytes,      ///< Copy m_size bytes at m_offset.
+            CopyContainer,  ///< Copy the elements of a contiguous container of m_size byte elements as a single block.
+            CloneClass,     ///< Clone the value class at m_offset by executing m_plan.
+            CloneElement,   ///< Clone the element by enumerating it.
+        };
+
+        struct Op
+        {
+            OpType m_type;
+            size_t m_offset;
+            size_t m_size;
+            const ClassElement* m_classElement;
+            const ClassData* m_classData;
+            const ClonePlan* m_plan;
+        };
+
+        AZStd::vector<Op> m_ops;
+    };
+
+    namespace
+    {
+        //! Returns true if the value is fully described by its bytes, so it can be cloned with a memcpy
+        //! instead of a round trip through its serializer.
+        bool IsTriviallyCloneable(const SerializeContext::ClassData& classData, size_t dataSize)
+        {
+            return classData.m_serializer && !classData.m_eventHandler && !classData.IsDeprecated() &&
+                dataSize != 0 && classData.m_serializer->GetTrivialBinarySize() == dataSize;
+        }
+
+        //! Returns the size of the elements if the container stores trivially cloneable elements contiguously, otherwise 0.
+        size_t GetTriviallyCloneableElementSize(const SerializeContext& serializeContext, const SerializeContext::ClassData& containerClassData)
+        {
+            SerializeContext::IDataContainer* container = containerClassData.m_container;
+            if (!container || containerClassData.m_serializer || containerClassData.m_eventHandler || containerClassData.IsDeprecated())
+            {
+                return 0;
+            }
+
+            const SerializeContext::ClassElement* classElement = container->GetElement(container->GetElementNameCrC());
+            if (!classElement || (classElement->m_flags & SerializeContext::ClassElement::FLG_POINTER))
+            {
+                return 0;
+            }
+
+            const SerializeContext::ClassData* classData = classElement->m_genericClassInfo
+                ? classElement->m_genericClassInfo->GetClassData()
+                : serializeContext.FindClassData(classElement->m_typeId);
+            return classData && IsTriviallyCloneable(*classData, classElement->m_dataSize) ? classElement->m_dataSize : 0;
+        }
+
+        //! Copies the elements of a contiguous container as a single block. Returns false if the container
+        //! doesn't expose its elements as a single block, in which case nothing has been copied.
+        bool CopyContiguousElements(const SerializeContext::ClassData& containerClassData, size_t elementSize, void* destPtr, const void* srcPtr)
+        {
+            SerializeContext::IDataContainer* container = containerClassData.m_container;
+            void* srcContainer = const_cast<void*>(srcPtr);
+            const size_t numElements = container->Size(srcContainer);
+            const void* srcElements = container->GetContiguousElements(srcContainer);
+            void* destElements = container->ResizeContiguousElements(destPtr, numElements);
+            if (numElements == 0)
+            {
+                // An empty container may not have an element address.
+                return container->Size(destPtr) == 0;
+            }
+            if (!srcElements || !destElements)
+            {
+                return false;
+            }
+            memcpy(destElements, srcElements, numElements * elementSize);
+            return true;
+        }
+    } // namespace
+
+    //=========================================================================
+    // GetClonePlan
+    //=========================================================================
+    const SerializeContext::ClonePlan* SerializeContext::GetClonePlan(const ClassData& classData)
+    {
+        // Plans are only built once per class, so concurrent clones only need a shared lock to find them.
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_clonePlanMutex);
+            if (auto planIt = m_clonePlans.find(&classData); planIt != m_clonePlans.end())
+            {
+                return planIt->second.get();
+            }
+        }
+
+        // BuildClonePlan checks for the plan again as another thread may have built it in between the locks.
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_clonePlanMutex);
+        return BuildClonePlan(classData);
+    }
+
+    //=========================================================================
+    // BuildClonePlan
+    //=========================================================================
+    const SerializeContext::ClonePlan* SerializeContext::BuildClonePlan(const ClassData& classData)
+    {
+        // The entry is added before the plan is built, which also stops malformed reflection from recursing forever.
+        auto [planIt, inserted] = m_clonePlans.try_emplace(&classData);
+        if (!inserted)
+        {
+            return planIt->second.get();
+        }
+
+        // Anything that needs callbacks during the clone keeps going through the enumeration path.
+        if (classData.m_serializer || classData.m_container || classData.m_eventHandler || classData.IsDeprecated() ||
+            classData.m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+        {
+            return nullptr;
+        }
+
+        auto clonePlan = AZStd::make_unique<ClonePlan>();
+        clonePlan->m_ops.reserve(classData.m_elements.size());
+        for (const ClassElement& classElement : classData.m_elements)
+        {
+            const ClassData* elementClassData = classElement.m_genericClassInfo
+                ? classElement.m_genericClassInfo->GetClassData()
+                : FindClassData(classElement.m_typeId, &classData, classElement.m_nameCrc);
+
+            ClonePlan::Op op{ ClonePlan::OpType::CloneElement, classElement.m_offset, classElement.m_dataSize, &classElement, elementClassData, nullptr };
+            if (elementClassData && (classElement.m_flags & ClassElement::FLG_POINTER) == 0)
+            {
+                if (IsTriviallyCloneable(*elementClassData, classElement.m_dataSize))
+                {
+                    op.m_type = ClonePlan::OpType::CopyBytes;
+                }
+                else if (elementClassData->m_container)
+                {
+                    if (size_t elementSize = GetTriviallyCloneableElementSize(*this, *elementClassData); elementSize != 0)
+                    {
+                        op.m_type = ClonePlan::OpType::CopyContainer;
+                        op.m_size = elementSize;
+                    }
+                }
+                else if (const ClonePlan* elementPlan = BuildClonePlan(*elementClassData))
+                {
+                    op.m_type = ClonePlan::OpType::CloneClass;
+                    op.m_plan = elementPlan;
+                }
+            }
+
+            // Merge adjacent fields into a single copy.
+            if (op.m_type == ClonePlan::OpType::CopyBytes && !clonePlan->m_ops.empty())
+            {
+                ClonePlan::Op& previousOp = clonePlan->m_ops.back();
+                if (previousOp.m_type == ClonePlan::OpType::CopyBytes && previousOp.m_offset + previousOp.m_size == op.m_offset)
+                {
+                    previousOp.m_size += op.m_size;
+                    continue;
+                }
+            }
+            clonePlan->m_ops.push_back(op);
+        }
+
+        // Building the element plans may have added entries, so look the entry up again.
+        AZStd::unique_ptr<ClonePlan>& planEntry = m_clonePlans[&classData];
+        planEntry = AZStd::move(clonePlan);
+        return planEntry.get();
+    }
+
+    //=========================================================================
+    // ExecuteClonePlan
+    //=========================================================================
+    void SerializeContext::ExecuteClonePlan(const ClonePlan& clonePlan, void* destPtr, const void* srcPtr, const ClassData& classData, void* stackData, EnumerateInstanceCallContext& callContext)
+    {
+        for (const ClonePlan::Op& op : clonePlan.m_ops)
+        {
+            void* destField = reinterpret_cast<char*>(destPtr) + op.m_offset;
+            const void* srcField = reinterpret_cast<const char*>(srcPtr) + op.m_offset;
+            switch (op.m_type)
+            {
+            case ClonePlan::OpType::CopyBytes:
+                memcpy(destField, srcField, op.m_size);
+                break;
+            case ClonePlan::OpType::CloneClass:
+                ExecuteClonePlan(*op.m_plan, destField, srcField, *op.m_classData, stackData, callContext);
+                break;
+            case ClonePlan::OpType::CopyContainer:
+                if (CopyContiguousElements(*op.m_classData, op.m_size, destField, srcField))
+                {
+                    break;
+                }
+                [[fallthrough]];
+            case ClonePlan::OpType::CloneElement:
+            {
+                // Enumerate the element with this class as its parent, so the clone callbacks resolve the destination as usual.
+                ObjectCloneData* cloneData = reinterpret_cast<ObjectCloneData*>(stackData);
+                ObjectCloneData::ParentInfo& parentInfo = cloneData->m_parentStack.emplace_back();
+                parentInfo.m_ptr = destPtr;
+                parentInfo.m_reservePtr = destPtr;
+                parentInfo.m_classData = &classData;
+                parentInfo.m_containerIndexCounter = 0;
+                EnumerateInstance(&callContext, const_cast<void*>(srcField), op.m_classElement->m_typeId, op.m_classData, op.m_classElement);
+                cloneData->m_parentStack.pop_back();
+                break;
+            }
+            }
+        }
+    }
+
+    //=========================================================================
+    // InvalidateClonePlans
+    //=========================================================================
+    void SerializeContext::InvalidateClonePlans()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_clonePlanMutex);
+        m_clonePlans.clear();
+    }
+
     //=========================================================================
     // CloneObject
     //=========================================================================
@@ -1474,6 +1693,16 @@ namespace AZ
             },
             this, SerializeContext::ENUM_ACCESS_FOR_READ, &m_errorLogger);
 
+        if (const ClassData* classData = FindClassData(classId); classData && classData->m_factory)
+        {
+            if (const ClonePlan* clonePlan = GetClonePlan(*classData))
+            {
+                cloneData.m_ptr = classData->m_factory->Create(classData->m_name);
+                ExecuteClonePlan(*clonePlan, cloneData.m_ptr, ptr, *classData, &cloneData, callContext);
+                return cloneData.m_ptr;
+            }
+        }
+
         EnumerateInstance(
             &callContext
             , const_cast<void*>(ptr)
@@ -1511,6 +1740,15 @@ namespace AZ
                 },
                 this, SerializeContext::ENUM_ACCESS_FOR_READ, &m_errorLogger);
 
+            if (const ClassData* classData = FindClassData(classId))
+            {
+                if (const ClonePlan* clonePlan = GetClonePlan(*classData))
+                {
+                    ExecuteClonePlan(*clonePlan, dest, ptr, *classData, &cloneData, callContext);
+                    return;
+                }
+            }
+
             EnumerateInstance(&callContext, const_cast<void*>(ptr), classId, nullptr, nullptr);
         }
     }
@@ -2032,6 +2270,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        InvalidateClonePlans();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
@@ -28,6 +28,8 @@
 #include <AzCore/std/typetraits/is_base_of.h>
 #include <AzCore/std/any.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/std/functional.h>
 
@@ -444,6 +446,15 @@ namespace AZ
         bool BeginCloneElementInplace(void* rootDestPtr, void* ptr, const ClassData* classData, const ClassElement* elementData, void* stackData, ErrorHandler* errorHandler, AZStd::vector<char>* scratchBuffer);
         bool EndCloneElement(void* stackData);
 
+        /// Flattened list of the operations needed to clone a class, built the first time the class is cloned.
+        struct ClonePlan;
+        /// Returns the clone plan for a class, or null if the class has to be cloned by enumerating it.
+        const ClonePlan* GetClonePlan(const ClassData& classData);
+        const ClonePlan* BuildClonePlan(const ClassData& classData);
+        void ExecuteClonePlan(const ClonePlan& clonePlan, void* destPtr, const void* srcPtr, const ClassData& classData, void* stackData, EnumerateInstanceCallContext& callContext);
+        /// Drops all cached clone plans, called when reflection is removed as the plans point to the class data.
+        void InvalidateClonePlans();
+
         /**
          * Internal structure to maintain class information while we are describing a class.
          * User should call variety of functions to describe class features and data.
@@ -677,6 +688,8 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        AZStd::unordered_map<const ClassData*, AZStd::unique_ptr<ClonePlan>> m_clonePlans; ///< Cached clone plans, a null plan marks a class that is cloned by enumerating it
+        AZStd::shared_mutex m_clonePlanMutex; ///< Guards m_clonePlans as objects can be cloned from multiple threads
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
@@ -1051,6 +1064,10 @@ namespace AZ::Serialize
 
         /// Optional post processing of the cloned data to deal with members that are not serialize-reflected.
         virtual void PostClone(void* /*classPtr*/) {}
+
+        /// Returns the size of the type if its binary data in native endian is an exact copy of the instance memory, otherwise 0.
+        /// Contiguous containers of these types can be written to and read from binary streams with a single copy.
+        virtual size_t GetTrivialBinarySize() const { return 0; }
     };
 
     /**
@@ -1160,6 +1177,11 @@ namespace AZ::Serialize
         virtual const IAssociativeDataContainer* GetAssociativeContainerInterface() const { return nullptr; }
         //! Returns true if the IDataContainer represents a reflected sequence type(AZStd array, (fixed)vector, list)
         virtual bool IsSequenceContainer() const { return false; }
+        /// Returns the address of the first element if the elements are stored contiguously in memory, otherwise null.
+        virtual void* GetContiguousElements([[maybe_unused]] void* instance) { return nullptr; }
+        /// Resizes the container to hold numElements value initialized elements and returns the address of the first one.
+        /// Returns null if the elements aren't stored contiguously or the container can't hold numElements elements.
+        virtual void* ResizeContiguousElements([[maybe_unused]] void* instance, [[maybe_unused]] size_t numElements) { return nullptr; }
         /// Reserve an element and get its address (called before the element is loaded).
         virtual void* ReserveElement(void* instance, const ClassElement* classElement) = 0;
         /// Free an element that was reserved using ReserveElement, but was not stored by calling StoreElement.
@@ -455,6 +455,14 @@ namespace AZ
         //! @return MergeSettingsResult value that is convertible to bool(true) if the registry folder was successfully merged.
         virtual MergeSettingsResult MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform = {}, AZStd::string_view anchorKey = "", AZStd::vector<char>* scratchBuffer = nullptr) = 0;
+        //! Merges a pre-merged binary snapshot of settings, as written by SettingsRegistrySnapshot::Write, into the registry.
+        //! No JSON parsing is required to load a snapshot, which makes it considerably faster than merging the source files.
+        //! @param path The path to the snapshot file.
+        //! @param anchorKey The registry path location where the settings will be anchored.
+        //! @return MergeSettingsResult value that is convertible to bool(true) if the snapshot was merged. If the snapshot
+        //!     is missing, damaged or any of the files or folders it was created from has changed since, the registry is left
+        //!     untouched and a failure is returned so the caller can fall back to merging the source files.
+        virtual MergeSettingsResult MergeSettingsSnapshot(AZStd::string_view path, AZStd::string_view anchorKey = "") = 0;
 
         //! Indicates whether the Merge functions should send notification events for individual operations
         //! using JSON Patch or JSON Merge Patch.
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Settings/SettingsRegistryCachedValue.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+
+namespace AZ
+{
+    SettingsRegistryCachedValueBase::SettingsRegistryCachedValueBase(SettingsRegistryInterface& registry, AZStd::string_view path)
+        : m_registry(registry)
+        , m_path(path)
+    {
+        m_notifyHandler = m_registry.RegisterNotifier(
+            [this](const SettingsRegistryInterface::NotifyEventArgs& notifyArgs)
+            {
+                // Merges are reported at their anchor key and removals at the removed key, so a change to an ancestor or
+                // a descendant can change the value as well.
+                if (SettingsRegistryMergeUtils::IsPathAncestorDescendantOrEqual(m_path, notifyArgs.m_jsonKeyPath))
+                {
+                    m_stale.store(true, AZStd::memory_order_release);
+                }
+            });
+    }
+
+    SettingsRegistryCachedValueBase::~SettingsRegistryCachedValueBase() = default;
+
+    AZStd::string_view SettingsRegistryCachedValueBase::GetPath() const
+    {
+        return m_path;
+    }
+} // namespace AZ
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/typetraits/is_same.h>
+
+namespace AZ
+{
+    //! Non-template part of SettingsRegistryCachedValue, which tracks if the cached value is still valid.
+    class SettingsRegistryCachedValueBase
+    {
+    public:
+        AZ_DISABLE_COPY_MOVE(SettingsRegistryCachedValueBase);
+
+        //! Returns the JSON pointer the cached value is bound to.
+        AZStd::string_view GetPath() const;
+
+    protected:
+        SettingsRegistryCachedValueBase(SettingsRegistryInterface& registry, AZStd::string_view path);
+        ~SettingsRegistryCachedValueBase();
+
+        SettingsRegistryInterface& m_registry;
+        SettingsRegistryInterface::FixedValueString m_path;
+        //! Set by the notifier whenever the value at the path, one of its ancestors or one of its descendants changes.
+        mutable AZStd::atomic_bool m_stale{ true };
+        //! Only taken while refreshing, so concurrent refreshes can't overwrite a newer value with an older one.
+        mutable AZStd::mutex m_refreshMutex;
+
+    private:
+        SettingsRegistryInterface::NotifyEventHandler m_notifyHandler;
+    };
+
+    //! Handle to a setting that keeps a typed copy of its value. Reading the value only costs an atomic load until the
+    //! Settings Registry reports a change that touches the path, after which the next read queries the registry again.
+    //! This avoids locking the registry and parsing the JSON pointer for settings that are read frequently, for instance
+    //! from worker threads.
+    //! The registry has to outlive the cached value. Changes become visible once the registry has signaled its notifiers.
+    template<typename T>
+    class SettingsRegistryCachedValue
+        : public SettingsRegistryCachedValueBase
+    {
+        static_assert(AZStd::is_same_v<T, bool> || AZStd::is_same_v<T, s64> || AZStd::is_same_v<T, u64> || AZStd::is_same_v<T, double>,
+            "SettingsRegistryCachedValue only supports the lock-free scalar types bool, s64, u64 and double.");
+
+    public:
+        //! @param registry The Settings Registry to read the value from.
+        //! @param path JSON pointer to the setting.
+        //! @param defaultValue Value returned while the setting doesn't exist or has a different type.
+        SettingsRegistryCachedValue(SettingsRegistryInterface& registry, AZStd::string_view path, T defaultValue = {})
+            : SettingsRegistryCachedValueBase(registry, path)
+            , m_defaultValue(defaultValue)
+            , m_value(defaultValue)
+        {
+        }
+
+        //! Returns the current value of the setting or the default value if it's not set.
+        T Get() const
+        {
+            if (m_stale.load(AZStd::memory_order_acquire))
+            {
+                Refresh();
+            }
+            return m_value.load(AZStd::memory_order_acquire);
+        }
+
+    private:
+        void Refresh() const
+        {
+            AZStd::scoped_lock lock(m_refreshMutex);
+            if (m_stale.load(AZStd::memory_order_acquire))
+            {
+                // Clear the flag before reading so a change that arrives during the read marks the value as stale again.
+                m_stale.store(false, AZStd::memory_order_release);
+                T value = m_defaultValue;
+                if (!m_registry.Get(value, m_path))
+                {
+                    value = m_defaultValue;
+                }
+                m_value.store(value, AZStd::memory_order_release);
+            }
+        }
+
+        T m_defaultValue;
+        mutable AZStd::atomic<T> m_value;
+    };
+} // namespace AZ
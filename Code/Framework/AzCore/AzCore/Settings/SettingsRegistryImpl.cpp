@@ -17,6 +17,7 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
@@ -898,6 +899,137 @@ namespace AZ
         return multiFileResult;
     }
 
+    auto SettingsRegistryImpl::MergeSettingsSnapshot(AZStd::string_view path, AZStd::string_view anchorKey)
+        -> MergeSettingsResult
+    {
+        MergeSettingsResult result;
+        if (path.empty() || path.size() > AZ::IO::MaxPathLength)
+        {
+            result.m_returnCode = MergeSettingsReturnCode::Failure;
+            result.m_operationMessages = AZStd::string::format(R"(Path "%.*s" provided for MergeSettingsSnapshot is invalid.)",
+                AZ_STRING_ARG(path));
+            return result;
+        }
+
+        AZ::IO::FixedMaxPath snapshotPath(path);
+        SettingsRegistrySnapshot snapshot;
+        if (!snapshot.Open(snapshotPath.c_str()))
+        {
+            result.m_returnCode = MergeSettingsReturnCode::Failure;
+            result.m_operationMessages = AZStd::string::format(R"(Unable to open settings snapshot "%s" or it's damaged.)",
+                snapshotPath.c_str());
+            return result;
+        }
+        if (!snapshot.IsUpToDate())
+        {
+            result.m_returnCode = MergeSettingsReturnCode::Failure;
+            result.m_operationMessages = AZStd::string::format(
+                R"(Settings snapshot "%s" is out of date as one or more of its source files or folders have changed.)", snapshotPath.c_str());
+            return result;
+        }
+
+        // Rebuild the settings from the flattened entries. The entries are stored in document order, so the containers
+        // that are still open are exactly the ancestors of the current entry. Only the last container on the stack is
+        // appended to, which keeps the pointers to its ancestors stable.
+        rapidjson::Document jsonPatch;
+        auto& allocator = jsonPatch.GetAllocator();
+        AZStd::vector<rapidjson::Value*> containers;
+        for (const SettingsRegistrySnapshot::Entry& entry : snapshot.GetEntries())
+        {
+            rapidjson::Value value;
+            switch (static_cast<Type>(entry.m_type))
+            {
+            case Type::Boolean:
+                value.SetBool(entry.m_value != 0);
+                break;
+            case Type::Integer:
+                if (static_cast<Signedness>(entry.m_signedness) == Signedness::Unsigned)
+                {
+                    value.SetUint64(entry.m_value);
+                }
+                else
+                {
+                    s64 signedValue;
+                    memcpy(&signedValue, &entry.m_value, sizeof(signedValue));
+                    value.SetInt64(signedValue);
+                }
+                break;
+            case Type::FloatingPoint:
+                {
+                    double doubleValue;
+                    memcpy(&doubleValue, &entry.m_value, sizeof(doubleValue));
+                    value.SetDouble(doubleValue);
+                }
+                break;
+            case Type::String:
+                {
+                    AZStd::string_view stringValue = snapshot.GetString(entry);
+                    value.SetString(stringValue.data(), aznumeric_cast<rapidjson::SizeType>(stringValue.size()), allocator);
+                }
+                break;
+            case Type::Array:
+                value.SetArray();
+                break;
+            case Type::Object:
+                value.SetObject();
+                break;
+            default:
+                // Snapshots are merged as a JSON merge patch, so a null would delete the setting instead of storing it.
+                // SettingsRegistrySnapshot::Write doesn't store them, so only a damaged snapshot can contain one.
+                result.m_returnCode = MergeSettingsReturnCode::Failure;
+                result.m_operationMessages = AZStd::string::format(
+                    R"(Settings snapshot "%s" contains a null or unknown value at "%.*s".)", snapshotPath.c_str(),
+                    AZ_STRING_ARG(snapshot.GetPath(entry)));
+                return result;
+            }
+
+            if (entry.m_depth == 0)
+            {
+                static_cast<rapidjson::Value&>(jsonPatch).Swap(value);
+                containers.assign(1, &jsonPatch);
+                continue;
+            }
+            if (entry.m_depth > containers.size())
+            {
+                result.m_returnCode = MergeSettingsReturnCode::Failure;
+                result.m_operationMessages = AZStd::string::format(R"(Settings snapshot "%s" has an invalid hierarchy.)",
+                    snapshotPath.c_str());
+                return result;
+            }
+
+            containers.resize(entry.m_depth);
+            rapidjson::Value& parent = *containers.back();
+            const bool isContainer = value.IsObject() || value.IsArray();
+            rapidjson::Value* child;
+            if (parent.IsObject())
+            {
+                AZStd::string_view name = snapshot.GetName(entry);
+                rapidjson::Value nameValue(name.data(), aznumeric_cast<rapidjson::SizeType>(name.size()), allocator);
+                parent.AddMember(AZStd::move(nameValue), AZStd::move(value), allocator);
+                child = &(parent.MemberEnd() - 1)->value;
+            }
+            else
+            {
+                parent.PushBack(AZStd::move(value), allocator);
+                child = &parent[parent.Size() - 1];
+            }
+            if (isContainer)
+            {
+                containers.push_back(child);
+            }
+        }
+
+        if (!jsonPatch.IsObject())
+        {
+            result.m_returnCode = MergeSettingsReturnCode::Failure;
+            result.m_operationMessages = AZStd::string::format(R"(Settings snapshot "%s" doesn't contain a JSON object.)",
+                snapshotPath.c_str());
+            return result;
+        }
+
+        return MergeSettingsJsonDocument(jsonPatch, Format::JsonMergePatch, anchorKey, snapshotPath);
+    }
+
     SettingsRegistryInterface::VisitResponse SettingsRegistryImpl::Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
         const rapidjson::Value& value) const
     {
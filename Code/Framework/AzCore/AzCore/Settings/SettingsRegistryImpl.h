@@ -82,6 +82,7 @@ namespace AZ
             AZStd::vector<char>* scratchBuffer = nullptr) override;
         MergeSettingsResult MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform, AZStd::string_view anchorKey = "", AZStd::vector<char>* scratchBuffer = nullptr) override;
+        MergeSettingsResult MergeSettingsSnapshot(AZStd::string_view path, AZStd::string_view anchorKey = "") override;
 
         void SetNotifyForMergeOperations(bool notify) override;
         bool GetNotifyForMergeOperations() const override;
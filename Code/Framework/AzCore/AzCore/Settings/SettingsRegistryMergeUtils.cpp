@@ -9,17 +9,21 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/JSON/prettywriter.h>
 #include <AzCore/JSON/writer.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/PlatformId/PlatformDefaults.h>
 #include <AzCore/Settings/CommandLine.h>
 #include <AzCore/Settings/ConfigParser.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/Dependency/Dependency.h>
@@ -1132,6 +1136,157 @@ namespace AZ::SettingsRegistryMergeUtils
 #endif // AZ_TRAIT_OS_IS_HOST_OS_PLATFORM
     }
 
+    //! Name of the folder within the project user path where the registry folder snapshots are stored.
+    //! This folder isn't scanned for settings files itself, so writing a snapshot doesn't invalidate it.
+    static constexpr AZStd::string_view SettingsSnapshotFolder = "SettingsRegistrySnapshots";
+
+    //! Returns the path of the snapshot for merging the registry folder with the specializations and platform,
+    //! or an empty path if snapshots are disabled or there's no project user path to store them in.
+    static AZ::IO::FixedMaxPath GetSettingsSnapshotPath(SettingsRegistryInterface& registry, AZStd::string_view folderPath,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform)
+    {
+        if (bool useSnapshots{}; registry.Get(useSnapshots, SettingsRegistrySnapshotsEnabledKey) && !useSnapshots)
+        {
+            return {};
+        }
+
+        AZ::IO::FixedMaxPath snapshotPath;
+        if (!registry.Get(snapshotPath.Native(), FilePathKey_ProjectUserPath) || snapshotPath.empty())
+        {
+            return {};
+        }
+
+        // The specializations are part of the name as they select and order the merged files
+        AZStd::string snapshotKey = AZStd::string::format("%.*s\n%.*s", AZ_STRING_ARG(folderPath), AZ_STRING_ARG(platform));
+        for (size_t index = 0; index < specializations.GetCount(); ++index)
+        {
+            snapshotKey += '\n';
+            snapshotKey += specializations.GetSpecialization(index);
+        }
+        const AZ::u32 snapshotHash = AZ::Crc32(snapshotKey.data(), snapshotKey.size());
+
+        snapshotPath /= SettingsSnapshotFolder;
+        snapshotPath /= AZ::IO::FixedMaxPathString::format("%08" PRIx32 ".%s", snapshotHash, SettingsRegistrySnapshot::Extension);
+        return snapshotPath;
+    }
+
+    //! Checks if the content of a settings file contains anything a snapshot can't reproduce. Null values remove settings
+    //! merged from other folders, which can't be stored in a snapshot, and $import directives pull in files the snapshot
+    //! doesn't track. This errs on the side of caution, so a "null" inside a string also prevents a snapshot.
+    static bool IsSettingsFileSnapshotCompatible(AZStd::string_view content)
+    {
+        if (content.find("$import") != AZStd::string_view::npos)
+        {
+            return false;
+        }
+
+        constexpr AZStd::string_view NullLiteral = "null";
+        for (size_t offset = content.find(NullLiteral); offset != AZStd::string_view::npos;
+            offset = content.find(NullLiteral, offset + NullLiteral.size()))
+        {
+            const size_t previous = offset > 0 ? content.find_last_not_of(" \t\r\n", offset - 1) : AZStd::string_view::npos;
+            if (previous != AZStd::string_view::npos && (content[previous] == ':' || content[previous] == '[' || content[previous] == ','))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //! Merges the registry folder into an empty registry and writes the result to a snapshot.
+    //! No snapshot is written if merging the snapshot on top of other settings would give a different result than merging
+    //! the files in the folder one by one, that is when the folder contains .setregpatch files, removes settings, imports
+    //! other files or replaces a value with an object. Values replaced by an object are merged into an object already in
+    //! the registry when coming from the snapshot, while the file by file merge discards that object.
+    static bool WriteSettingsSnapshot(const AZ::IO::FixedMaxPath& snapshotPath, AZStd::string_view folderPath,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform,
+        AZStd::vector<char>* scratchBuffer)
+    {
+        using Type = SettingsRegistryInterface::Type;
+
+        SettingsRegistryImpl folderRegistry;
+        folderRegistry.SetNotifyForMergeOperations(true);
+
+        bool isSnapshotCompatible = true;
+        AZStd::vector<AZ::IO::Path> sourceFiles;
+        auto CollectSourceFiles = [&isSnapshotCompatible, &sourceFiles](const SettingsRegistryInterface::MergeEventArgs& mergeEventArgs)
+        {
+            AZ::IO::PathView mergeFilePath(mergeEventArgs.m_mergeFilePath);
+            // JSON patches operate on the settings that were merged before them, which can't be replayed from a snapshot
+            if (AZStd::string_view extension = mergeFilePath.Extension().Native();
+                !extension.empty() && extension.substr(1) == SettingsRegistryInterface::PatchExtension)
+            {
+                isSnapshotCompatible = false;
+            }
+            sourceFiles.emplace_back(mergeFilePath);
+        };
+        auto postMergeHandler = folderRegistry.RegisterPostMergeEvent(AZStd::move(CollectSourceFiles));
+
+        AZStd::unordered_map<AZStd::string, Type> mergedTypes;
+        auto TrackMergedTypes = [&isSnapshotCompatible, &mergedTypes](const SettingsRegistryInterface::NotifyEventArgs& notifyEventArgs)
+        {
+            const Type mergedType = notifyEventArgs.m_type.m_type;
+            auto [mergedTypeIt, inserted] = mergedTypes.try_emplace(AZStd::string(notifyEventArgs.m_jsonKeyPath), mergedType);
+            if (!inserted)
+            {
+                if (mergedType == Type::Object && mergedTypeIt->second != Type::Object)
+                {
+                    isSnapshotCompatible = false;
+                }
+                mergedTypeIt->second = mergedType;
+            }
+        };
+        auto notifyHandler = folderRegistry.RegisterNotifier(AZStd::move(TrackMergedTypes));
+
+        if (!folderRegistry.MergeSettingsFolder(folderPath, specializations, platform, "", scratchBuffer) || !isSnapshotCompatible)
+        {
+            return false;
+        }
+
+        for (const AZ::IO::Path& sourceFile : sourceFiles)
+        {
+            auto readResult = AZ::Utils::ReadFile(sourceFile.Native());
+            if (!readResult.IsSuccess() || !IsSettingsFileSnapshotCompatible(readResult.GetValue()))
+            {
+                return false;
+            }
+        }
+
+        AZStd::fixed_vector<AZ::IO::Path, 2> sourceFolders{ AZ::IO::Path(folderPath) };
+        if (!platform.empty())
+        {
+            sourceFolders.emplace_back(AZ::IO::Path(folderPath) / SettingsRegistryInterface::PlatformFolder / platform);
+        }
+        return SettingsRegistrySnapshot::Write(snapshotPath.c_str(), folderRegistry, sourceFiles, sourceFolders);
+    }
+
+    //! Merges the settings files in the registry folder. If snapshots are enabled the folder is merged from its snapshot,
+    //! which doesn't require parsing any JSON. When the snapshot is missing or out of date it's rewritten first, and if
+    //! that isn't possible the files are merged one by one through MergeSettingsFolder.
+    static SettingsRegistryInterface::MergeSettingsResult MergeSettingsFolderWithSnapshot(SettingsRegistryInterface& registry,
+        AZStd::string_view folderPath, const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform,
+        AZStd::vector<char>* scratchBuffer)
+    {
+        if (AZ::IO::FixedMaxPath snapshotPath = GetSettingsSnapshotPath(registry, folderPath, specializations, platform);
+            !snapshotPath.empty() && AZ::IO::SystemFile::IsDirectory(AZ::IO::FixedMaxPath(folderPath).c_str()))
+        {
+            if (auto snapshotResult = registry.MergeSettingsSnapshot(snapshotPath.Native()); snapshotResult)
+            {
+                return snapshotResult;
+            }
+
+            if (WriteSettingsSnapshot(snapshotPath, folderPath, specializations, platform, scratchBuffer))
+            {
+                if (auto snapshotResult = registry.MergeSettingsSnapshot(snapshotPath.Native()); snapshotResult)
+                {
+                    return snapshotResult;
+                }
+            }
+        }
+
+        return registry.MergeSettingsFolder(folderPath, specializations, platform, "", scratchBuffer);
+    }
+
     auto MergeSettingsToRegistry_TargetBuildDependencyRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
         -> SettingsRegistryInterface::MergeSettingsResult
@@ -1177,7 +1332,7 @@ namespace AZ::SettingsRegistryMergeUtils
         {
             AZ::IO::FixedMaxPath mergePath{ AZStd::move(engineRootPath) };
             mergePath /= SettingsRegistryInterface::RegistryFolder;
-            mergeResult.Combine(registry.MergeSettingsFolder(mergePath.Native(), specializations, platform, "", scratchBuffer));
+            mergeResult.Combine(MergeSettingsFolderWithSnapshot(registry, mergePath.Native(), specializations, platform, scratchBuffer));
         }
 
         return mergeResult;
@@ -1200,8 +1355,8 @@ namespace AZ::SettingsRegistryMergeUtils
         SettingsRegistryInterface::MergeSettingsResult aggregateMergeResult;
         for (const auto& gemPath : gemPaths)
         {
-            aggregateMergeResult.Combine(registry.MergeSettingsFolder(
-                (gemPath / SettingsRegistryInterface::RegistryFolder).Native(), specializations, platform, "", scratchBuffer));
+            aggregateMergeResult.Combine(MergeSettingsFolderWithSnapshot(
+                registry, (gemPath / SettingsRegistryInterface::RegistryFolder).Native(), specializations, platform, scratchBuffer));
         }
 
         return aggregateMergeResult;
@@ -1217,7 +1372,7 @@ namespace AZ::SettingsRegistryMergeUtils
         {
             AZ::IO::FixedMaxPath mergePath{ projectPath };
             mergePath /= SettingsRegistryInterface::RegistryFolder;
-            registry.MergeSettingsFolder(mergePath.Native(), specializations, platform, "", scratchBuffer);
+            MergeSettingsFolderWithSnapshot(registry, mergePath.Native(), specializations, platform, scratchBuffer);
         }
 
         return mergeResult;
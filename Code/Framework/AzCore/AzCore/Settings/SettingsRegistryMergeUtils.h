@@ -100,6 +100,12 @@ namespace AZ::SettingsRegistryMergeUtils
     //! If a gem contains multiple targets module it will be stored underneath this key
     inline constexpr const char* ActiveGemsRootKey = "/O3DE/Gems";
 
+    //! Boolean setting that controls if the engine, gem and project registry folders are merged from pre-merged snapshots.
+    //! Snapshots are stored in the SettingsRegistrySnapshots folder of the project user path and are rewritten as soon as
+    //! any of the files in the registry folder changes. Defaults to true. When a folder is merged from its snapshot the merge
+    //! events report the snapshot file instead of the individual .setreg files.
+    inline constexpr AZStd::string_view SettingsRegistrySnapshotsEnabledKey = "/O3DE/Settings/SettingsRegistry/UseSnapshots";
+
     //! Examines the Settings Registry for a "${BootstrapSettingsRootKey}/engine_path" key
     //! to use as an override for the Engine Root.
     //! Otherwise a directory walk upwards from the executable directory is performed
@@ -225,6 +231,8 @@ namespace AZ::SettingsRegistryMergeUtils
         -> SettingsRegistryInterface::MergeSettingsResult;
 
     //! Adds the engine settings to the Settings Registry.
+    //! Like the gem and project registries, the folder is merged from its snapshot when it's up to date,
+    //! see SettingsRegistrySnapshotsEnabledKey.
     auto MergeSettingsToRegistry_EngineRegistry(SettingsRegistryInterface& registry, const AZStd::string_view platform,
         const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer = nullptr)
         -> SettingsRegistryInterface::MergeSettingsResult;
@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::SettingsRegistrySnapshotInternal
+{
+    static_assert(sizeof(SettingsRegistrySnapshot::Header) == 24, "Snapshot header layout has changed, bump the version.");
+    static_assert(sizeof(SettingsRegistrySnapshot::Source) == 24, "Snapshot source layout has changed, bump the version.");
+    static_assert(sizeof(SettingsRegistrySnapshot::Entry) == 32, "Snapshot entry layout has changed, bump the version.");
+
+    class SnapshotBuilder
+        : public SettingsRegistryInterface::Visitor
+    {
+    public:
+        using Entry = SettingsRegistrySnapshot::Entry;
+        using Type = SettingsRegistryInterface::Type;
+        using VisitArgs = SettingsRegistryInterface::VisitArgs;
+        using VisitAction = SettingsRegistryInterface::VisitAction;
+        using VisitResponse = SettingsRegistryInterface::VisitResponse;
+
+        explicit SnapshotBuilder(AZStd::string_view anchorKey)
+            : m_anchorKey(anchorKey)
+        {
+        }
+
+        VisitResponse Traverse(const VisitArgs& visitArgs, VisitAction action) override
+        {
+            if (action == VisitAction::End)
+            {
+                m_containerTypes.pop_back();
+                return VisitResponse::Continue;
+            }
+
+            AZStd::string_view path = visitArgs.m_jsonKeyPath;
+            path.remove_prefix(AZStd::min(m_anchorKey.size(), path.size()));
+
+            Entry& entry = m_entries.emplace_back();
+            AddString(entry.m_pathOffset, entry.m_pathSize, path);
+            // Array elements are identified by their position in the document order, so only object fields need a name.
+            if (!m_containerTypes.empty() && m_containerTypes.back() == Type::Object)
+            {
+                AddString(entry.m_nameOffset, entry.m_nameSize, visitArgs.m_fieldName);
+            }
+            entry.m_depth = aznumeric_cast<u32>(m_containerTypes.size());
+            m_hasNull = m_hasNull || visitArgs.m_type.m_type == Type::Null;
+            entry.m_type = static_cast<u8>(visitArgs.m_type.m_type);
+            entry.m_signedness = static_cast<u8>(visitArgs.m_type.m_signedness);
+
+            if (action == VisitAction::Begin)
+            {
+                m_containerTypes.push_back(visitArgs.m_type.m_type);
+            }
+            return VisitResponse::Continue;
+        }
+
+        void Visit(const VisitArgs&, bool value) override
+        {
+            m_entries.back().m_value = value ? 1 : 0;
+        }
+
+        void Visit(const VisitArgs&, s64 value) override
+        {
+            memcpy(&m_entries.back().m_value, &value, sizeof(value));
+        }
+
+        void Visit(const VisitArgs&, u64 value) override
+        {
+            m_entries.back().m_value = value;
+        }
+
+        void Visit(const VisitArgs&, double value) override
+        {
+            memcpy(&m_entries.back().m_value, &value, sizeof(value));
+        }
+
+        void Visit(const VisitArgs&, AZStd::string_view value) override
+        {
+            u32 offset{};
+            u32 size{};
+            AddString(offset, size, value);
+            m_entries.back().m_value = (static_cast<u64>(size) << 32) | offset;
+        }
+
+        AZStd::vector<Entry> m_entries;
+        AZStd::vector<char> m_strings;
+        //! Nulls delete fields when merged as a JSON merge patch, so they can't be stored.
+        bool m_hasNull{ false };
+
+    private:
+        void AddString(u32& offset, u32& size, AZStd::string_view value)
+        {
+            offset = aznumeric_cast<u32>(m_strings.size());
+            size = aznumeric_cast<u32>(value.size());
+            m_strings.insert(m_strings.end(), value.begin(), value.end());
+        }
+
+        AZStd::string_view m_anchorKey;
+        AZStd::vector<Type> m_containerTypes;
+    };
+
+    // Hashes the names of the files and folders in a folder, independent of the order they're listed in.
+    // A folder that doesn't exist has the same listing as an empty one.
+    static u32 GetFolderListingHash(const char* folderPath)
+    {
+        AZStd::vector<AZStd::string> names;
+        AZ::IO::SystemFile::FindFiles((AZ::IO::FixedMaxPath(folderPath) / "*").c_str(),
+            [&names](const char* name, bool)
+            {
+                if (AZStd::string_view(name) != "." && AZStd::string_view(name) != "..")
+                {
+                    names.emplace_back(name);
+                }
+                return true;
+            });
+        AZStd::sort(names.begin(), names.end());
+
+        AZ::Crc32 hash;
+        for (const AZStd::string& name : names)
+        {
+            // Include the terminator so names can't run into each other
+            hash.Add(name.c_str(), name.size() + 1);
+        }
+        return static_cast<u32>(hash);
+    }
+
+    template<typename T>
+    void AppendBytes(AZStd::vector<u8>& buffer, const T* data, size_t count)
+    {
+        const u8* bytes = reinterpret_cast<const u8*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + count * sizeof(T));
+    }
+} // namespace AZ::SettingsRegistrySnapshotInternal
+
+namespace AZ
+{
+    bool SettingsRegistrySnapshot::Write(const char* snapshotPath, const SettingsRegistryInterface& registry,
+        AZStd::span<const AZ::IO::Path> sourceFiles, AZStd::span<const AZ::IO::Path> sourceFolders, AZStd::string_view anchorKey)
+    {
+        using namespace SettingsRegistrySnapshotInternal;
+
+        if (registry.GetType(anchorKey) != Type::Object)
+        {
+            AZ_Error("SettingsRegistrySnapshot", false, R"(Unable to write snapshot, "%.*s" isn't a JSON object in the registry.)",
+                AZ_STRING_ARG(anchorKey));
+            return false;
+        }
+
+        SnapshotBuilder builder(anchorKey);
+        registry.Visit(builder, anchorKey);
+        if (builder.m_hasNull)
+        {
+            AZ_Error("SettingsRegistrySnapshot", false,
+                R"(Unable to write snapshot, "%.*s" contains null values, which would delete settings when merged.)",
+                AZ_STRING_ARG(anchorKey));
+            return false;
+        }
+
+        AZStd::vector<Source> sources;
+        sources.reserve(sourceFiles.size() + sourceFolders.size());
+        auto addSource = [&sources, &builder](const AZ::IO::Path& sourcePath) -> Source&
+        {
+            Source& source = sources.emplace_back();
+            source.m_pathOffset = aznumeric_cast<u32>(builder.m_strings.size());
+            source.m_pathSize = aznumeric_cast<u32>(sourcePath.Native().size());
+            builder.m_strings.insert(builder.m_strings.end(), sourcePath.Native().begin(), sourcePath.Native().end());
+            return source;
+        };
+        for (const AZ::IO::Path& sourceFile : sourceFiles)
+        {
+            addSource(sourceFile).m_modificationTime = AZ::IO::SystemFile::ModificationTime(sourceFile.c_str());
+        }
+        for (const AZ::IO::Path& sourceFolder : sourceFolders)
+        {
+            Source& source = addSource(sourceFolder);
+            source.m_listingHash = GetFolderListingHash(sourceFolder.c_str());
+            source.m_isFolder = 1;
+        }
+
+        const AZStd::vector<Entry>& entries = builder.m_entries;
+        const AZStd::vector<char>& strings = builder.m_strings;
+        AZStd::vector<u32> sortedIndices;
+        sortedIndices.reserve(entries.size());
+        for (u32 index = 0; index < entries.size(); ++index)
+        {
+            sortedIndices.push_back(index);
+        }
+        AZStd::sort(sortedIndices.begin(), sortedIndices.end(),
+            [&entries, &strings](u32 lhs, u32 rhs)
+            {
+                AZStd::string_view lhsPath(strings.data() + entries[lhs].m_pathOffset, entries[lhs].m_pathSize);
+                AZStd::string_view rhsPath(strings.data() + entries[rhs].m_pathOffset, entries[rhs].m_pathSize);
+                return lhsPath < rhsPath;
+            });
+
+        Header header;
+        header.m_sourceCount = aznumeric_cast<u32>(sources.size());
+        header.m_entryCount = aznumeric_cast<u32>(entries.size());
+        header.m_stringTableSize = aznumeric_cast<u32>(strings.size());
+
+        AZStd::vector<u8> buffer;
+        buffer.reserve(sizeof(Header) + sources.size() * sizeof(Source) + entries.size() * (sizeof(Entry) + sizeof(u32)) +
+            strings.size());
+        AppendBytes(buffer, &header, 1);
+        AppendBytes(buffer, sources.data(), sources.size());
+        AppendBytes(buffer, entries.data(), entries.size());
+        AppendBytes(buffer, sortedIndices.data(), sortedIndices.size());
+        AppendBytes(buffer, strings.data(), strings.size());
+
+        header.m_hash = static_cast<u32>(AZ::Crc32(buffer.data() + sizeof(Header), buffer.size() - sizeof(Header)));
+        memcpy(buffer.data(), &header, sizeof(Header));
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(snapshotPath,
+            AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Error("SettingsRegistrySnapshot", false, R"(Unable to open "%s" for writing.)", snapshotPath);
+            return false;
+        }
+        return file.Write(buffer.data(), buffer.size()) == buffer.size();
+    }
+
+    bool SettingsRegistrySnapshot::Open(const char* snapshotPath)
+    {
+        Close();
+        if (!m_file.Open(snapshotPath))
+        {
+            return false;
+        }
+
+        const u8* data = m_file.GetData();
+        const u64 size = m_file.GetSize();
+        if (size < sizeof(Header))
+        {
+            Close();
+            return false;
+        }
+
+        Header header;
+        memcpy(&header, data, sizeof(Header));
+        const u64 expectedSize = sizeof(Header) + u64{ header.m_sourceCount } * sizeof(Source) +
+            u64{ header.m_entryCount } * (sizeof(Entry) + sizeof(u32)) + header.m_stringTableSize;
+        if (header.m_magic != Header::Magic || header.m_version != Header::Version || size != expectedSize ||
+            static_cast<u32>(AZ::Crc32(data + sizeof(Header), size - sizeof(Header))) != header.m_hash)
+        {
+            Close();
+            return false;
+        }
+
+        const u8* cursor = data + sizeof(Header);
+        m_sources = AZStd::span(reinterpret_cast<const Source*>(cursor), header.m_sourceCount);
+        cursor += m_sources.size_bytes();
+        m_entries = AZStd::span(reinterpret_cast<const Entry*>(cursor), header.m_entryCount);
+        cursor += m_entries.size_bytes();
+        m_sortedIndices = AZStd::span(reinterpret_cast<const u32*>(cursor), header.m_entryCount);
+        cursor += m_sortedIndices.size_bytes();
+        m_stringTable = reinterpret_cast<const char*>(cursor);
+        m_stringTableSize = header.m_stringTableSize;
+        return true;
+    }
+
+    void SettingsRegistrySnapshot::Close()
+    {
+        m_file.Close();
+        m_sources = {};
+        m_entries = {};
+        m_sortedIndices = {};
+        m_stringTable = nullptr;
+        m_stringTableSize = 0;
+    }
+
+    bool SettingsRegistrySnapshot::IsOpen() const
+    {
+        return m_file.IsOpen();
+    }
+
+    bool SettingsRegistrySnapshot::IsUpToDate() const
+    {
+        if (!IsOpen())
+        {
+            return false;
+        }
+
+        for (const Source& source : m_sources)
+        {
+            AZStd::string_view sourcePath = GetPath(source);
+            if (sourcePath.size() > AZ::IO::MaxPathLength)
+            {
+                return false;
+            }
+            AZ::IO::FixedMaxPathString sourcePathString(sourcePath);
+            if (source.m_isFolder != 0)
+            {
+                if (SettingsRegistrySnapshotInternal::GetFolderListingHash(sourcePathString.c_str()) != source.m_listingHash)
+                {
+                    return false;
+                }
+            }
+            else if (!AZ::IO::SystemFile::Exists(sourcePathString.c_str()) ||
+                AZ::IO::SystemFile::ModificationTime(sourcePathString.c_str()) != source.m_modificationTime)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    auto SettingsRegistrySnapshot::GetType(AZStd::string_view path) const -> SettingsType
+    {
+        const Entry* entry = Find(path);
+        return entry ? SettingsType{ static_cast<Type>(entry->m_type), static_cast<Signedness>(entry->m_signedness) } : SettingsType{};
+    }
+
+    bool SettingsRegistrySnapshot::Get(bool& result, AZStd::string_view path) const
+    {
+        if (const Entry* entry = Find(path); entry && static_cast<Type>(entry->m_type) == Type::Boolean)
+        {
+            result = entry->m_value != 0;
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(s64& result, AZStd::string_view path) const
+    {
+        if (const Entry* entry = Find(path); entry && static_cast<Type>(entry->m_type) == Type::Integer &&
+            (static_cast<Signedness>(entry->m_signedness) == Signedness::Signed ||
+                entry->m_value <= static_cast<u64>(AZStd::numeric_limits<s64>::max())))
+        {
+            memcpy(&result, &entry->m_value, sizeof(result));
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(u64& result, AZStd::string_view path) const
+    {
+        if (const Entry* entry = Find(path); entry && static_cast<Type>(entry->m_type) == Type::Integer)
+        {
+            s64 signedValue;
+            memcpy(&signedValue, &entry->m_value, sizeof(signedValue));
+            if (static_cast<Signedness>(entry->m_signedness) == Signedness::Unsigned || signedValue >= 0)
+            {
+                result = entry->m_value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(double& result, AZStd::string_view path) const
+    {
+        if (const Entry* entry = Find(path); entry && static_cast<Type>(entry->m_type) == Type::FloatingPoint)
+        {
+            memcpy(&result, &entry->m_value, sizeof(result));
+            return true;
+        }
+        return false;
+    }
+
+    bool SettingsRegistrySnapshot::Get(AZStd::string_view& result, AZStd::string_view path) const
+    {
+        if (const Entry* entry = Find(path); entry && static_cast<Type>(entry->m_type) == Type::String)
+        {
+            result = GetString(*entry);
+            return true;
+        }
+        return false;
+    }
+
+    auto SettingsRegistrySnapshot::Find(AZStd::string_view path) const -> const Entry*
+    {
+        auto it = AZStd::lower_bound(m_sortedIndices.begin(), m_sortedIndices.end(), path,
+            [this](u32 index, AZStd::string_view searchPath)
+            {
+                return GetPath(m_entries[index]) < searchPath;
+            });
+        if (it != m_sortedIndices.end() && *it < m_entries.size() && GetPath(m_entries[*it]) == path)
+        {
+            return &m_entries[*it];
+        }
+        return nullptr;
+    }
+
+    auto SettingsRegistrySnapshot::GetEntries() const -> AZStd::span<const Entry>
+    {
+        return m_entries;
+    }
+
+    auto SettingsRegistrySnapshot::GetSources() const -> AZStd::span<const Source>
+    {
+        return m_sources;
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetPath(const Entry& entry) const
+    {
+        return GetStringFromTable(entry.m_pathOffset, entry.m_pathSize);
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetName(const Entry& entry) const
+    {
+        return GetStringFromTable(entry.m_nameOffset, entry.m_nameSize);
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetString(const Entry& entry) const
+    {
+        return GetStringFromTable(static_cast<u32>(entry.m_value), static_cast<u32>(entry.m_value >> 32));
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetPath(const Source& source) const
+    {
+        return GetStringFromTable(source.m_pathOffset, source.m_pathSize);
+    }
+
+    AZStd::string_view SettingsRegistrySnapshot::GetStringFromTable(u32 offset, u32 size) const
+    {
+        // The hash only protects against damaged files, so still guard against offsets outside of the table.
+        if (u64{ offset } + size > m_stringTableSize)
+        {
+            return {};
+        }
+        return AZStd::string_view(m_stringTable + offset, size);
+    }
+} // namespace AZ
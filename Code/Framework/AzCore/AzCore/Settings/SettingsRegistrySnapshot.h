@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ
+{
+    //! Read-only, pre-merged image of the Settings Registry that can be memory mapped and queried without parsing any JSON.
+    //! The image stores every value under an anchor key as a flattened entry in document order, a lookup index of those
+    //! entries sorted by JSON pointer, the modification times of the files that were merged to produce the settings, the
+    //! listings of the folders that were scanned for those files and a hash over its contents to detect truncated or
+    //! corrupted images.
+    //! A snapshot is considered out of date as soon as any of its source files has been modified or removed, or a file
+    //! has been added to, removed from or renamed in any of its source folders, in which case the caller is expected to
+    //! fall back to merging the source files.
+    class SettingsRegistrySnapshot
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SettingsRegistrySnapshot, SystemAllocator);
+
+        static constexpr char Extension[] = "setregbin";
+
+        using Type = SettingsRegistryInterface::Type;
+        using Signedness = SettingsRegistryInterface::Signedness;
+        using SettingsType = SettingsRegistryInterface::SettingsType;
+
+        struct Header
+        {
+            static constexpr u32 Magic = 0x4E535253; // "SRSN"
+            static constexpr u32 Version = 2;
+
+            u32 m_magic{ Magic };
+            u32 m_version{ Version };
+            //! Crc32 over all bytes following the header.
+            u32 m_hash{};
+            u32 m_sourceCount{};
+            u32 m_entryCount{};
+            u32 m_stringTableSize{};
+        };
+
+        struct Source
+        {
+            //! Modification time of a source file. Unused for source folders.
+            u64 m_modificationTime{};
+            u32 m_pathOffset{};
+            u32 m_pathSize{};
+            //! Crc32 over the sorted names of the entries in a source folder. Unused for source files.
+            u32 m_listingHash{};
+            u8 m_isFolder{};
+            u8 m_padding[3]{};
+        };
+
+        struct Entry
+        {
+            //! JSON pointer to the value, relative to the anchor key the snapshot was taken at.
+            u32 m_pathOffset{};
+            u32 m_pathSize{};
+            //! Unescaped member name for object fields. Empty for array elements and the root.
+            u32 m_nameOffset{};
+            u32 m_nameSize{};
+            //! Number of reference tokens in the path, used to rebuild the hierarchy from the document order.
+            u32 m_depth{};
+            u8 m_type{};
+            u8 m_signedness{};
+            u16 m_padding{};
+            //! Bit pattern of the stored bool, s64, u64 or double, or the string table offset (low) and size (high) of strings.
+            u64 m_value{};
+        };
+
+        SettingsRegistrySnapshot() = default;
+        SettingsRegistrySnapshot(const SettingsRegistrySnapshot&) = delete;
+        SettingsRegistrySnapshot(SettingsRegistrySnapshot&&) = default;
+        SettingsRegistrySnapshot& operator=(const SettingsRegistrySnapshot&) = delete;
+        SettingsRegistrySnapshot& operator=(SettingsRegistrySnapshot&&) = default;
+
+        //! Writes the settings stored at the anchor key of the registry to a snapshot file.
+        //! @param snapshotPath Path of the file the snapshot is written to. Any existing file is overwritten.
+        //! @param registry The registry to take the snapshot of.
+        //! @param sourceFiles Files that were merged to create the settings. Their modification times are stored so the
+        //!     snapshot can later be detected as out of date. The files can be gathered with a PostMergeEvent handler.
+        //! @param sourceFolders Folders that were scanned for settings files, for instance by MergeSettingsFolder, including
+        //!     the platform folders. Their listings are stored so files added to them are detected as well, which means the
+        //!     snapshot itself shouldn't be written to one of them.
+        //! @param anchorKey JSON pointer to the value in the registry that's stored in the snapshot. This has to be an object.
+        //! @return True if the snapshot was written, otherwise false.
+        static bool Write(const char* snapshotPath, const SettingsRegistryInterface& registry,
+            AZStd::span<const AZ::IO::Path> sourceFiles, AZStd::span<const AZ::IO::Path> sourceFolders = {},
+            AZStd::string_view anchorKey = "");
+
+        //! Maps the snapshot at the provided path and validates its header and hash.
+        //! @return True if the snapshot was mapped and is intact. It may still be out of date, see IsUpToDate.
+        bool Open(const char* snapshotPath);
+        void Close();
+        bool IsOpen() const;
+
+        //! Checks that none of the source files have been modified or removed, and that the listings of the source folders
+        //! haven't changed since the snapshot was written.
+        bool IsUpToDate() const;
+
+        [[nodiscard]] SettingsType GetType(AZStd::string_view path) const;
+        bool Get(bool& result, AZStd::string_view path) const;
+        bool Get(s64& result, AZStd::string_view path) const;
+        bool Get(u64& result, AZStd::string_view path) const;
+        bool Get(double& result, AZStd::string_view path) const;
+        //! The returned string points into the mapped file and remains valid until the snapshot is closed.
+        bool Get(AZStd::string_view& result, AZStd::string_view path) const;
+
+        //! Returns the entry for the value at the provided JSON pointer or null if there's no such value.
+        const Entry* Find(AZStd::string_view path) const;
+        //! Returns all entries in document order, which is a depth-first walk where each parent precedes its children.
+        AZStd::span<const Entry> GetEntries() const;
+        AZStd::span<const Source> GetSources() const;
+
+        AZStd::string_view GetPath(const Entry& entry) const;
+        AZStd::string_view GetName(const Entry& entry) const;
+        AZStd::string_view GetString(const Entry& entry) const;
+        AZStd::string_view GetPath(const Source& source) const;
+
+    private:
+        AZStd::string_view GetStringFromTable(u32 offset, u32 size) const;
+
+        AZ::IO::MemoryMappedFile m_file;
+        AZStd::span<const Source> m_sources;
+        AZStd::span<const Entry> m_entries;
+        //! Indices into m_entries sorted by the path of the entry.
+        AZStd::span<const u32> m_sortedIndices;
+        const char* m_stringTable{ nullptr };
+        u32 m_stringTableSize{};
+    };
+} // namespace AZ
@@ -12,12 +12,15 @@
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/typetraits/is_assignable.h>
 #include <AzCore/std/typetraits/is_destructible.h>
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/function_traits.h>
+#include <AzCore/std/typetraits/is_pointer.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 namespace AZ::Internal
 {
-    using TaskInvoke_t = void (*)(void* lambda);
+    using TaskInvoke_t = void (*)(void* lambda, void* userData);
     using TaskRelocate_t = void (*)(void* dst, void* src);
     using TaskDestroy_t = void (*)(void* obj);
 
@@ -33,6 +36,9 @@ namespace AZ::Internal
     //
     // Lambdas that are trivially destructible will result in a nullptr returned TaskDestroy_t pointer.
     //
+    // Lambdas either take no argument, or a single pointer argument receiving the user data bound to the task
+    // (see TaskGraph::Bind).
+    //
     // The class will check that the lambda is copy assignable or movable.
     template<typename Lambda>
     class TaskTypeEraser final
@@ -79,9 +85,20 @@ namespace AZ::Internal
         }
 
     private:
-        constexpr static void Invoker(Lambda* lambda)
+        constexpr static void Invoker(Lambda* lambda, [[maybe_unused]] void* userData)
         {
-            lambda->operator()();
+            if constexpr (AZStd::is_invocable_v<Lambda&>)
+            {
+                lambda->operator()();
+            }
+            else
+            {
+                using UserData = AZStd::function_traits_get_arg_t<Lambda, 0>;
+                static_assert(
+                    AZStd::function_traits<Lambda>::num_args == 1 && AZStd::is_pointer_v<UserData>,
+                    "Task lambdas must take either no argument, or a single pointer to the user data bound to the task.");
+                lambda->operator()(static_cast<UserData>(userData));
+            }
         }
 
         constexpr static void Mover(Lambda* dst, Lambda* src)
@@ -140,11 +157,13 @@ namespace AZ::Internal
         // Prepare for dispatch (reset the dependency counter to the number of inbound edges)
         void Init() noexcept;
 
-        // Invoke the embedded lambda function
-        void Invoke();
+        // Invoke the embedded lambda function, passing @userData to lambdas that take user data
+        void Invoke(void* userData = nullptr);
 
         uint8_t GetPriorityNumber() const noexcept;
 
+        uint16_t GetAffinity() const noexcept;
+
     private:
         friend class CompiledTaskGraph;
         friend class TaskWorker;
@@ -61,9 +61,9 @@ namespace AZ::Internal
         m_dependencyCount = m_inboundLinkCount;
     }
 
-    inline void Task::Invoke()
+    inline void Task::Invoke(void* userData)
     {
-        m_invoker(m_lambda);
+        m_invoker(m_lambda, userData);
     }
 
     inline uint8_t Task::GetPriorityNumber() const noexcept
@@ -71,6 +71,11 @@ namespace AZ::Internal
         return static_cast<uint8_t>(m_descriptor.priority);
     }
 
+    inline uint16_t Task::GetAffinity() const noexcept
+    {
+        return m_descriptor.affinity;
+    }
+
     inline void Task::Link(Task& other)
     {
         ++m_outboundLinkCount;
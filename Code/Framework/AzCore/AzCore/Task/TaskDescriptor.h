@@ -42,6 +42,12 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // Runs tasks sharing the same non-zero affinity on the same worker thread, so that tasks operating
+        // on the same data find it in that core's caches. These tasks are never stolen by other workers,
+        // so they wait for their worker even if others are idle.
+        // 0 lets the executor pick any worker, which favors the worker that submitted the task.
+        uint16_t affinity = 0;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
@@ -9,7 +9,9 @@
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
 
+#include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -27,6 +29,7 @@ namespace AZ
     {
         CompiledTaskGraph::CompiledTaskGraph(
             AZStd::vector<Task>&& tasks,
+            AZStd::vector<void*>&& userData,
             AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>>& links,
             size_t linkCount,
             TaskGraph* parent,
@@ -35,6 +38,12 @@ namespace AZ
             , m_parentLabel{ parentLabel }
         {
             m_tasks = AZStd::move(tasks);
+            m_userData = AZStd::move(userData);
+            if (!m_userData.empty())
+            {
+                // Tasks added after the last Bind have no user data
+                m_userData.resize(m_tasks.size(), nullptr);
+            }
             m_successors.resize(linkCount);
 
             Task** cursor = m_successors.data();
@@ -109,12 +118,14 @@ namespace AZ
         // - offset to the "head" of the ring, from where we acquire elements
         // - offset to the "tail" of the ring, which tracks where new elements should be enqueued
         // - offset to a tail reservation index, which is used to reserve a slot to enqueue elements
+        // Each worker owns one, used as a mailbox for the tasks submitted to it by other threads.
         class TaskQueue final
         {
         public:
             // Preallocating upfront allows us to reserve slots to insert tasks without locks.
             // Each thread allocated by the task manager consumes ~2 MB.
-            constexpr static uint16_t MaxQueueSize = 0xffff;
+            // The ring has one slot per uint16_t value, so that offsets wrap around with the ring.
+            constexpr static uint32_t MaxQueueSize = 0x10000;
             constexpr static uint8_t PriorityLevelCount = static_cast<uint8_t>(TaskPriority::PRIORITY_COUNT);
 
             TaskQueue() = default;
@@ -123,6 +134,7 @@ namespace AZ
 
             void Enqueue(Task* task);
             Task* TryDequeue();
+            bool IsEmpty() const;
 
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
@@ -142,17 +154,17 @@ namespace AZ
 
                 // Enqueuing is done in two phases because we cannot atomically write the task to the slot we reserve
                 // and simulataneously publish the fact that the slot is now available.
-                if (reserve != head - 1)
+                if (reserve != static_cast<uint16_t>(head - 1))
                 {
                     // Try to reserve a slot
-                    if (status.reserve.compare_exchange_weak(reserve, reserve + 1))
+                    if (status.reserve.compare_exchange_weak(reserve, static_cast<uint16_t>(reserve + 1)))
                     {
                         m_queues[priority][reserve] = task;
 
                         uint16_t expectedReserve = reserve;
 
                         // Increment the tail to advertise the new task
-                        while (!status.tail.compare_exchange_weak(expectedReserve, reserve + 1))
+                        while (!status.tail.compare_exchange_weak(expectedReserve, static_cast<uint16_t>(reserve + 1)))
                         {
                             expectedReserve = reserve;
                         }
@@ -185,8 +197,8 @@ namespace AZ
                     }
                     else
                     {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
+                        Task* task = m_queues[priority][head];
+                        if (status.head.compare_exchange_weak(head, static_cast<uint16_t>(head + 1)))
                         {
                             return task;
                         }
@@ -197,6 +209,170 @@ namespace AZ
             return nullptr;
         }
 
+        bool TaskQueue::IsEmpty() const
+        {
+            for (const QueueStatus& status : m_status)
+            {
+                if (status.head.load() != status.tail.load())
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Chase-Lev work stealing deque ("Dynamic Circular Work-Stealing Deque", Chase and Lev 2005), with the memory
+        // orderings of "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013).
+        // The owning worker pushes and pops tasks at the bottom, in LIFO order to keep recently touched data in its caches.
+        // Other workers steal the oldest tasks from the top.
+        class WorkStealingDeque final
+        {
+        public:
+            WorkStealingDeque()
+                : m_buffer{ Buffer::Create(InitialCapacity, nullptr) }
+            {
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            ~WorkStealingDeque()
+            {
+                // Buffers replaced by a larger one are only freed here, as thieves may still be reading them
+                Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+                while (buffer)
+                {
+                    Buffer* previous = buffer->m_previous;
+                    Buffer::Destroy(buffer);
+                    buffer = previous;
+                }
+            }
+
+            // Owner only
+            void Push(Task* task)
+            {
+                const int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed);
+                const int64_t top = m_top.load(AZStd::memory_order_acquire);
+                Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+                if (bottom - top > buffer->m_mask)
+                {
+                    buffer = Grow(buffer, top, bottom);
+                }
+                buffer->Store(bottom, task);
+                AZStd::atomic_thread_fence(AZStd::memory_order_release);
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+
+            // Owner only
+            Task* Pop()
+            {
+                const int64_t bottom = m_bottom.load(AZStd::memory_order_relaxed) - 1;
+                Buffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+                m_bottom.store(bottom, AZStd::memory_order_relaxed);
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                int64_t top = m_top.load(AZStd::memory_order_relaxed);
+
+                Task* task = nullptr;
+                if (top <= bottom)
+                {
+                    task = buffer->Load(bottom);
+                    if (top == bottom)
+                    {
+                        // Last task, race the thieves for it
+                        if (!m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                        {
+                            task = nullptr;
+                        }
+                        m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                    }
+                }
+                else
+                {
+                    m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+                }
+                return task;
+            }
+
+            // Any thread. Returns nullptr if the deque is empty or another thread won the race for the task.
+            Task* Steal()
+            {
+                int64_t top = m_top.load(AZStd::memory_order_acquire);
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                const int64_t bottom = m_bottom.load(AZStd::memory_order_acquire);
+                if (top < bottom)
+                {
+                    Buffer* buffer = m_buffer.load(AZStd::memory_order_acquire);
+                    Task* task = buffer->Load(top);
+                    if (m_top.compare_exchange_strong(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_relaxed))
+                    {
+                        return task;
+                    }
+                }
+                return nullptr;
+            }
+
+            bool IsEmpty() const
+            {
+                return m_top.load() >= m_bottom.load();
+            }
+
+        private:
+            static constexpr int64_t InitialCapacity = 1024;
+
+            struct Buffer
+            {
+                static Buffer* Create(int64_t capacity, Buffer* previous)
+                {
+                    void* memory = azmalloc(sizeof(Buffer) + sizeof(AZStd::atomic<Task*>) * capacity, alignof(Buffer));
+                    Buffer* buffer = new (memory) Buffer{ capacity - 1, previous };
+                    for (int64_t index = 0; index != capacity; ++index)
+                    {
+                        new (buffer->Slots() + index) AZStd::atomic<Task*>{ nullptr };
+                    }
+                    return buffer;
+                }
+
+                static void Destroy(Buffer* buffer)
+                {
+                    azfree(buffer);
+                }
+
+                AZStd::atomic<Task*>* Slots()
+                {
+                    return reinterpret_cast<AZStd::atomic<Task*>*>(this + 1);
+                }
+
+                Task* Load(int64_t index)
+                {
+                    return Slots()[index & m_mask].load(AZStd::memory_order_relaxed);
+                }
+
+                void Store(int64_t index, Task* task)
+                {
+                    Slots()[index & m_mask].store(task, AZStd::memory_order_relaxed);
+                }
+
+                int64_t m_mask;
+                Buffer* m_previous;
+            };
+
+            Buffer* Grow(Buffer* buffer, int64_t top, int64_t bottom)
+            {
+                Buffer* grown = Buffer::Create((buffer->m_mask + 1) * 2, buffer);
+                for (int64_t index = top; index != bottom; ++index)
+                {
+                    grown->Store(index, buffer->Load(index));
+                }
+                m_buffer.store(grown, AZStd::memory_order_release);
+                return grown;
+            }
+
+            // The top is contended by thieves, keep it on a different cache line than the owner's bottom
+            alignas(64) AZStd::atomic<int64_t> m_top{ 0 };
+            alignas(64) AZStd::atomic<int64_t> m_bottom{ 0 };
+            AZStd::atomic<Buffer*> m_buffer;
+        };
+
         class TaskWorker
         {
         public:
@@ -205,6 +381,8 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
+                m_randomState = id + 1;
 
                 m_threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -242,66 +420,302 @@ namespace AZ
 
             void Join()
             {
-                m_active.store(false, AZStd::memory_order_release);
-                m_semaphore.release();
+                m_active.store(false);
+                Wake();
                 m_thread.join();
             }
 
+            // Submits a task from another thread. Only this worker dequeues it, before making it available to thieves
+            // unless the task has an affinity. Other workers only dequeue it once this worker is delayed.
             void Enqueue(Task* task)
             {
-                m_queue.Enqueue(task);
+                m_mailbox.Enqueue(task);
+            }
+
+            // Submits a task with an affinity from this worker's own thread. Other workers only steal these once this worker
+            // is delayed.
+            void PushAffinityTask(Task* task)
+            {
+                m_affinityDeques[task->GetPriorityNumber()].Push(task);
+            }
+
+            // Submits a task from this worker's own thread
+            void Push(Task* task)
+            {
+                m_deques[task->GetPriorityNumber()].Push(task);
+            }
+
+            Task* Steal()
+            {
+                for (WorkStealingDeque& deque : m_deques)
+                {
+                    if (Task* task = deque.Steal(); task)
+                    {
+                        return task;
+                    }
+                }
+                return nullptr;
+            }
+
+            bool HasStealableTasks() const
+            {
+                for (const WorkStealingDeque& deque : m_deques)
+                {
+                    if (!deque.IsEmpty())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // A worker is delayed once it runs the same task for longer than DelayedStealTime. The tasks only it would run,
+            // those with an affinity and those in its mailbox, are then available to thieves as well.
+            bool IsDelayed(int64_t timeUs) const
+            {
+                const int64_t busySinceUs = m_busySinceUs.load(AZStd::memory_order_relaxed);
+                return busySinceUs != 0 && timeUs - busySinceUs >= DelayedStealTime.count();
+            }
+
+            bool IsBusy() const
+            {
+                return m_busySinceUs.load(AZStd::memory_order_relaxed) != 0;
+            }
+
+            // Returns true if the worker is busy with tasks waiting for it, which thieves take over once it's delayed
+            bool HasDelayedTasks() const
+            {
+                if (!IsBusy())
+                {
+                    return false;
+                }
+                for (const WorkStealingDeque& deque : m_affinityDeques)
+                {
+                    if (!deque.IsEmpty())
+                    {
+                        return true;
+                    }
+                }
+                return !m_mailbox.IsEmpty();
+            }
+
+            // Steals from the tasks only this worker would run. Only valid once the worker is delayed.
+            Task* StealDelayed()
+            {
+                for (WorkStealingDeque& deque : m_affinityDeques)
+                {
+                    if (Task* task = deque.Steal(); task)
+                    {
+                        return task;
+                    }
+                }
+                return m_mailbox.TryDequeue();
+            }
+
+            // Wakes the worker if it's parked. Returns false if it wasn't.
+            bool Wake()
+            {
+                if (m_parked.exchange(false))
+                {
+                    m_semaphore.release();
+                    return true;
+                }
+                return false;
+            }
 
-                m_semaphore.release();
+            bool IsParked() const
+            {
+                return m_parked.load();
             }
 
             const char* GetThreadName() {return m_threadName.c_str();}
 
+            void RunUntilSignaled(TaskGraphEvent& event)
+            {
+                // The event wakes this worker up when it's signaled. The worker keeps picking its own tasks up while it waits,
+                // so it isn't delayed by the task waiting.
+                event.m_waitingWorker.store(this);
+                m_busySinceUs.store(0, AZStd::memory_order_relaxed);
+
+                AZStd::exponential_backoff backoff;
+                uint32_t idleSpins = 0;
+                while (!event.IsSignaled())
+                {
+                    if (Task* task = FindTask(); task)
+                    {
+                        Execute(task);
+                        backoff.reset();
+                        idleSpins = 0;
+                    }
+                    else if (idleSpins != IdleSpinCount)
+                    {
+                        backoff.wait();
+                        ++idleSpins;
+                    }
+                    else
+                    {
+                        Park(&event);
+                        backoff.reset();
+                        idleSpins = 0;
+                    }
+                }
+
+                m_busySinceUs.store(GetTimeUs(), AZStd::memory_order_relaxed);
+            }
+
         private:
+            // Number of times an idle worker looks for tasks, backing off in between, before parking its thread
+            static constexpr uint32_t IdleSpinCount = 16;
+            // Time a worker runs the same task before idle workers steal the tasks only it would run
+            static constexpr AZStd::chrono::microseconds DelayedStealTime{ 1000 };
+
+            static int64_t GetTimeUs()
+            {
+                return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now().time_since_epoch())
+                    .count();
+            }
+            // Number of tasks moved from the mailbox to the deques at once, where other workers can steal them
+            static constexpr uint32_t MailboxBatchSize = 64;
+
             void Run()
             {
                 while (m_active)
                 {
-                    m_semaphore.acquire();
+                    Task* task = FindTask();
+                    if (!task)
+                    {
+                        // Spin with an increasing back off first, as new tasks are typically submitted shortly after
+                        AZStd::exponential_backoff backoff;
+                        for (uint32_t spin = 0; spin != IdleSpinCount && !task && m_active; ++spin)
+                        {
+                            backoff.wait();
+                            task = FindTask();
+                        }
+                    }
 
-                    if (!m_active)
+                    if (task)
                     {
-                        return;
+                        Execute(task);
+                    }
+                    else if (m_active)
+                    {
+                        Park();
                     }
+                }
+            }
 
-                    Task* task = m_queue.TryDequeue();
-                    while (task)
+            Task* FindTask()
+            {
+                uint32_t mailboxCount = 0;
+                for (; mailboxCount != MailboxBatchSize; ++mailboxCount)
+                {
+                    Task* task = m_mailbox.TryDequeue();
+                    if (!task)
                     {
-                        task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
-                        {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
-                        }
+                        break;
+                    }
+                    if (task->GetAffinity() != 0)
+                    {
+                        PushAffinityTask(task);
+                    }
+                    else
+                    {
+                        Push(task);
+                    }
+                }
+                if (mailboxCount > 1)
+                {
+                    // Let parked workers steal the tasks this worker won't run right away
+                    m_executor->WakeParkedWorker(m_id);
+                }
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
-                        {
-                            m_executor->ReleaseGraph();
-                        }
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_affinityDeques[priority].Pop(); task)
+                    {
+                        return task;
+                    }
+                    if (Task* task = m_deques[priority].Pop(); task)
+                    {
+                        return task;
+                    }
+                }
+
+                return m_executor->Steal(*this);
+            }
 
-                        task = m_queue.TryDequeue();
+            void Execute(Task* task)
+            {
+                m_busySinceUs.store(GetTimeUs(), AZStd::memory_order_relaxed);
+                task->Invoke(task->m_graph->GetUserData(*task));
+                m_busySinceUs.store(0, AZStd::memory_order_relaxed);
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        m_executor->Submit(*successor);
+                    }
+                }
+
+                bool isRetained = task->m_graph->m_parent != nullptr;
+                if (task->m_graph->Release(m_executor->GetEventTracker()) == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+                }
+            }
+
+            // Parks the thread until a task is submitted to it, or @event is signaled if this worker waits for one
+            void Park(TaskGraphEvent* event = nullptr)
+            {
+                // Advertise that this worker is parking before checking for tasks one last time. A thread submitting
+                // a task checks for parked workers after publishing it, so either it sees this worker or this worker sees the task.
+                // Signaling the event pairs the same way with the worker waiting for it.
+                m_parked.store(true);
+                ++m_executor->m_parkedWorkerCount;
+                AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+
+                if (m_active && m_mailbox.IsEmpty() && !m_executor->HasStealableTasks() && !(event && event->m_waitCount.load() < 0))
+                {
+                    if (!m_executor->HasDelayedTasks())
+                    {
+                        m_semaphore.acquire();
+                    }
+                    else if (!m_semaphore.try_acquire_for(DelayedStealTime) && !m_parked.exchange(false))
+                    {
+                        // Look for the tasks of delayed workers again, unless a submitting thread woke this worker in the meantime
+                        m_semaphore.acquire();
                     }
                 }
+                else if (!m_parked.exchange(false))
+                {
+                    // A submitting thread woke this worker in the meantime, consume its wake up
+                    m_semaphore.acquire();
+                }
+                --m_executor->m_parkedWorkerCount;
             }
 
+            friend class ::AZ::TaskExecutor;
+
+            WorkStealingDeque m_deques[TaskQueue::PriorityLevelCount];
+            // Tasks with an affinity to this worker, which other workers only steal once it's delayed
+            WorkStealingDeque m_affinityDeques[TaskQueue::PriorityLevelCount];
+            TaskQueue m_mailbox;
+
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_parked = false;
             AZStd::binary_semaphore m_semaphore;
+            // Time at which the worker started the task it's running, 0 while it looks for tasks
+            AZStd::atomic<int64_t> m_busySinceUs = 0;
 
             ::AZ::TaskExecutor* m_executor;
-            TaskQueue m_queue;
+            uint32_t m_id = 0;
+            // State of the xorshift generator used to pick victims to steal from
+            uint32_t m_randomState = 1;
             AZStd::string m_threadName;
-            friend class ::AZ::TaskExecutor;
         };
 
         thread_local TaskWorker* TaskWorker::t_worker = nullptr;
@@ -376,13 +790,18 @@ namespace AZ
         // TODO: Configure thread count + affinity based on configuration
         m_threadCount = threadCount == 0 ? AZStd::thread::hardware_concurrency() : threadCount;
 
-        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker)));
+        m_workers = reinterpret_cast<Internal::TaskWorker*>(azmalloc(m_threadCount * sizeof(Internal::TaskWorker), alignof(Internal::TaskWorker)));
 
         AZStd::semaphore initSemaphore;
 
+        // Workers steal from each other, so all of them must exist before the first thread starts
         for (uint32_t i = 0; i != m_threadCount; ++i)
         {
             new (m_workers + i) Internal::TaskWorker{};
+        }
+
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
             m_workers[i].Spawn(*this, i, initSemaphore, false);
         }
 
@@ -451,9 +870,34 @@ namespace AZ
 
     void TaskExecutor::Submit(Internal::Task& task)
     {
-        // TODO: Something more sophisticated is likely needed here.
-        // First, we are completely ignoring affinity.
-        // Second, some heuristics on core availability will help distribute work more effectively
+        Internal::TaskWorker* currentWorker = GetTaskWorker();
+        if (const uint16_t affinity = task.GetAffinity(); affinity != 0)
+        {
+            Internal::TaskWorker& worker = m_workers[affinity % m_threadCount];
+            if (&worker == currentWorker)
+            {
+                worker.PushAffinityTask(&task);
+                // Parked workers take over once the worker stays busy for too long
+                WakeParkedWorker(worker.m_id);
+                return;
+            }
+            if (worker.Enabled())
+            {
+                worker.Enqueue(&task);
+                WakeWorker(worker);
+                return;
+            }
+        }
+
+        if (currentWorker && currentWorker->Enabled())
+        {
+            // Successors run on the worker that completed their last dependency, which likely touched the same data.
+            // Parked workers are woken up to steal from it if there is more than one task available.
+            currentWorker->Push(&task);
+            WakeParkedWorker(currentWorker->m_id);
+            return;
+        }
+
         uint32_t nextWorker = ++m_lastSubmission % m_threadCount;
         while (!m_workers[nextWorker].Enabled())
         {
@@ -463,6 +907,109 @@ namespace AZ
         }
 
         m_workers[nextWorker].Enqueue(&task);
+        WakeWorker(m_workers[nextWorker]);
+    }
+
+    void TaskExecutor::WakeWorker(Internal::TaskWorker& worker)
+    {
+        // Pairs with the fence in TaskWorker::Park, so that a parking worker either sees the task or is seen as parked
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (!worker.Wake() && worker.IsBusy())
+        {
+            // Wake another worker to take the task over, should the worker stay busy for too long
+            WakeParkedWorker(worker.m_id);
+        }
+    }
+
+    void TaskExecutor::RunTasksUntilSignaled(Internal::TaskWorker& worker, TaskGraphEvent& event)
+    {
+        worker.RunUntilSignaled(event);
+    }
+
+    Internal::Task* TaskExecutor::Steal(Internal::TaskWorker& thief)
+    {
+        if (m_threadCount < 2)
+        {
+            return nullptr;
+        }
+
+        // Start with a random victim so that thieves don't all contend on the same deque
+        uint32_t& state = thief.m_randomState;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        const uint32_t firstVictim = state % m_threadCount;
+        for (uint32_t offset = 0; offset != m_threadCount; ++offset)
+        {
+            Internal::TaskWorker& victim = m_workers[(firstVictim + offset) % m_threadCount];
+            if (&victim != &thief)
+            {
+                if (Internal::Task* task = victim.Steal(); task)
+                {
+                    return task;
+                }
+            }
+        }
+
+        // Take over the tasks waiting for workers that have been busy with the same task for a while
+        if (!HasDelayedTasks())
+        {
+            return nullptr;
+        }
+        const int64_t timeUs = Internal::TaskWorker::GetTimeUs();
+        for (uint32_t offset = 0; offset != m_threadCount; ++offset)
+        {
+            Internal::TaskWorker& victim = m_workers[(firstVictim + offset) % m_threadCount];
+            if (&victim != &thief && victim.IsDelayed(timeUs))
+            {
+                if (Internal::Task* task = victim.StealDelayed(); task)
+                {
+                    return task;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    bool TaskExecutor::HasStealableTasks() const
+    {
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[i].HasStealableTasks())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TaskExecutor::HasDelayedTasks() const
+    {
+        for (uint32_t i = 0; i != m_threadCount; ++i)
+        {
+            if (m_workers[i].HasDelayedTasks())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+
+    void TaskExecutor::WakeParkedWorker(uint32_t firstWorker)
+    {
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+        if (m_parkedWorkerCount.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+        for (uint32_t offset = 1; offset <= m_threadCount; ++offset)
+        {
+            if (m_workers[(firstWorker + offset) % m_threadCount].Wake())
+            {
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
@@ -81,6 +81,7 @@ namespace AZ
 
             CompiledTaskGraph(
                 AZStd::vector<Task>&& tasks,
+                AZStd::vector<void*>&& userData,
                 AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>>& links,
                 size_t linkCount,
                 TaskGraph* parent,
@@ -91,6 +92,12 @@ namespace AZ
                 return m_tasks;
             }
 
+            // Returns the user data bound to @task, which must belong to this graph
+            void* GetUserData(const Task& task) const noexcept
+            {
+                return m_userData.empty() ? nullptr : m_userData[&task - m_tasks.data()];
+            }
+
             // Indicate that a constituent task has finished and decrement a counter to determine if the
             // graph should be freed (returns the value after atomic decrement)
             uint32_t Release(CompiledTaskGraphTracker& allocationTracker);
@@ -106,6 +113,8 @@ namespace AZ
 
             AZStd::vector<Task> m_tasks;
             AZStd::vector<Task*> m_successors;
+            // Either empty or holding the user data bound to each task, rebound in place by TaskGraph::Bind
+            AZStd::vector<void*> m_userData;
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
             TaskGraph* m_parent = nullptr;
@@ -147,10 +156,24 @@ namespace AZ
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
+        // Runs tasks on the calling worker until the event is signaled
+        void RunTasksUntilSignaled(Internal::TaskWorker& worker, TaskGraphEvent& event);
+
+        // Steals a task from another worker, starting from a random one
+        Internal::Task* Steal(Internal::TaskWorker& thief);
+        bool HasStealableTasks() const;
+        // Returns true if a busy worker has tasks waiting for it, which idle workers take over once it stays busy for too long
+        bool HasDelayedTasks() const;
+        // Wakes the worker if it's parked, after a task was submitted to it. If it's busy, wakes a parked worker to take over.
+        void WakeWorker(Internal::TaskWorker& worker);
+        // Wakes a parked worker, if any, to steal the tasks submitted to firstWorker. Searches from the worker after it.
+        void WakeParkedWorker(uint32_t firstWorker);
+
         Internal::TaskWorker* m_workers;
         uint32_t m_threadCount = 0;
         AZStd::atomic<uint32_t> m_lastSubmission;
         AZStd::atomic<uint64_t> m_graphsRemaining;
+        AZStd::atomic<uint32_t> m_parkedWorkerCount = 0;
 
         // Implement basic CompiledTaskGraph event breadcrumbs to help debug
         // https://github.com/o3de/o3de/issues/12015
@@ -16,7 +16,14 @@ namespace AZ
 
     void TaskGraphEvent::Wait()
     {
-        AZ_Assert(m_executor->GetTaskWorker() == nullptr, "Event %s waiting in a task is unsupported", m_label);
+        Internal::TaskWorker* worker = m_executor->GetTaskWorker();
+        if (worker)
+        {
+            // Waiting from within a task is supported. Blocking the worker could leave the tasks this event waits for
+            // in its queues, so keep running tasks instead.
+            m_executor->RunTasksUntilSignaled(*worker, *this);
+            return;
+        }
         m_semaphore.acquire();
     }
 
@@ -55,7 +62,14 @@ namespace AZ
             // validate no one incremented the wait count and mark signalling state
             if (m_waitCount.compare_exchange_strong(expectedValue, -1))
             {
+                // The waiting thread may destroy the event as soon as the semaphore is released
+                Internal::TaskWorker* waitingWorker = m_waitingWorker.load();
+                TaskExecutor* executor = m_executor;
                 m_semaphore.release();
+                if (waitingWorker)
+                {
+                    executor->WakeWorker(*waitingWorker);
+                }
             }
         }
     }
@@ -102,6 +116,7 @@ namespace AZ
             m_compiledTaskGraph = nullptr;
         }
         m_tasks.clear();
+        m_userData.clear();
         m_links.clear();
         m_linkCount = 0;
     }
@@ -125,12 +140,37 @@ namespace AZ
         SubmitOnExecutor(TaskExecutor::Instance(), waitEvent);
     }
 
+    void TaskGraph::Bind(const TaskToken& token, void* userData)
+    {
+        AZ_Assert(&token.m_parent == this, "Cannot bind user data to a task of another TaskGraph than %s.", m_label);
+        AZ_Assert(!m_submitted, "Cannot bind user data to a task of TaskGraph %s while it is in flight.", m_label);
+
+        // Once compiled, the tasks and their user data belong to the compiled graph
+        if (m_compiledTaskGraph)
+        {
+            AZStd::vector<void*>& compiledUserData = m_compiledTaskGraph->m_userData;
+            if (compiledUserData.empty())
+            {
+                compiledUserData.resize(m_compiledTaskGraph->m_tasks.size(), nullptr);
+            }
+            compiledUserData[token.m_index] = userData;
+        }
+        else
+        {
+            if (m_userData.size() <= token.m_index)
+            {
+                m_userData.resize(m_tasks.size(), nullptr);
+            }
+            m_userData[token.m_index] = userData;
+        }
+    }
+
     void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
     {
         Internal::CompiledTaskGraphTracker& eventTracker = executor.GetEventTracker();
         if (!m_compiledTaskGraph)
         {
-            m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), m_links, m_linkCount, m_retained ? this : nullptr, m_label);
+            m_compiledTaskGraph = aznew CompiledTaskGraph(AZStd::move(m_tasks), AZStd::move(m_userData), m_links, m_linkCount, m_retained ? this : nullptr, m_label);
             eventTracker.WriteEventInfo(m_compiledTaskGraph, Internal::CTGEvent::Allocated, "SubmitOnExecutor");
         }
 
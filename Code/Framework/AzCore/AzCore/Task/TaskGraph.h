@@ -38,7 +38,8 @@ namespace AZ
 
     // A TaskToken is returned each time a Task is added to the TaskGraph. TaskTokens are used to
     // express dependencies between tasks within the graph, and have no purpose after the graph
-    // is submitted (simply let them go out of scope)
+    // is submitted (simply let them go out of scope), unless they are kept to bind new user data
+    // to their task before the retained graph is resubmitted (see TaskGraph::Bind)
     class TaskToken final
     {
     public:
@@ -81,6 +82,7 @@ namespace AZ
 
     private:
         friend class ::AZ::Internal::CompiledTaskGraph;
+        friend class ::AZ::Internal::TaskWorker;
         friend class TaskGraph;
         friend class TaskExecutor;
 
@@ -90,6 +92,8 @@ namespace AZ
         AZStd::binary_semaphore m_semaphore;
         AZStd::atomic_int       m_waitCount = 0;
         TaskExecutor*           m_executor = nullptr;
+        // Worker running tasks while it waits for the event, woken up when the event is signaled
+        AZStd::atomic<Internal::TaskWorker*> m_waitingWorker = nullptr;
         [[maybe_unused]] const char* m_label = nullptr;
     };
 
@@ -134,9 +138,9 @@ namespace AZ
         // go out of scope or deallocate after submission.
         //
         // NOTE: The TaskGraph has no concept of resources used by design. Resubmission
-        // of the task graph is expected to rely on either indirection, or safe overwriting
-        // of previously used memory to supply new data (this can even be done as the first
-        // task in the graph).
+        // of the task graph is expected to rely on either indirection, user data rebound with
+        // TaskGraph::Bind, or safe overwriting of previously used memory to supply new data
+        // (this can even be done as the first task in the graph).
         // NOTE: This operation is invalid if the graph is in-flight
         void Detach();
 
@@ -155,6 +159,14 @@ namespace AZ
         // Same as submit but run on a different executor than the default system executor
         void SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent = nullptr);
 
+        // Bind @userData to the task associated with @token. A task lambda taking a single pointer argument,
+        // for example [](const FrameData* frameData) { ... }, receives the user data bound to its task when it runs
+        // (nullptr if nothing was bound). Bindings persist across submissions of a retained graph and may be changed
+        // between submissions, which lets a graph be built once and fed new data every frame. Once every task had
+        // user data bound, rebinding and resubmitting a retained graph never allocates.
+        // NOTE: This operation is invalid if the graph is in-flight
+        void Bind(const TaskToken& token, void* userData);
+
     private:
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
@@ -163,6 +175,9 @@ namespace AZ
 
         AZStd::vector<Internal::Task> m_tasks;
 
+        // User data bound to each task, empty if none was bound. Moved to the compiled graph on submission.
+        AZStd::vector<void*> m_userData;
+
         // Task index |-> Dependent task indices
         AZStd::unordered_map<uint32_t, AZStd::vector<uint32_t>> m_links;
 
@@ -54,6 +54,7 @@ namespace AZ
         MOCK_METHOD5(
             MergeSettingsFolder,
             MergeSettingsResult(AZStd::string_view, const Specializations&, AZStd::string_view, AZStd::string_view, AZStd::vector<char>*));
+        MOCK_METHOD2(MergeSettingsSnapshot, MergeSettingsResult(AZStd::string_view, AZStd::string_view));
 
         MOCK_METHOD1(SetNotifyForMergeOperations, void(bool));
         MOCK_CONST_METHOD0(GetNotifyForMergeOperations, bool());
@@ -56,6 +56,9 @@ set(FILES
     Component/NamedEntityId.h
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
+    Component/ParallelTickBus.h
+    Component/ParallelTickScheduler.cpp
+    Component/ParallelTickScheduler.h
     Component/TickBus.h
     Component/TransformBus.h
     Compression/compression.cpp
@@ -144,6 +147,7 @@ set(FILES
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
+    EBus/Internal/DispatchSnapshot.h
     EBus/Internal/Handlers.h
     EBus/Internal/StoragePolicies.h
     Instance/InstancePool.h
@@ -172,6 +176,8 @@ set(FILES
     IO/IStreamerTypes.h
     IO/IStreamerTypes.inl
     IO/IStreamerTypes.cpp
+    IO/MemoryMappedFile.cpp
+    IO/MemoryMappedFile.h
     IO/GenericStreams.cpp
     IO/GenericStreams.h
     IO/OpenMode.h
@@ -198,6 +204,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/MemoryMappedArchive.h
+    IO/Streamer/MemoryMappedArchive.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -271,6 +279,8 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BatchMath.cpp
+    Math/BatchMath.h
     Math/Capsule.h
     Math/Capsule.inl
     Math/Color.cpp
@@ -305,6 +315,7 @@ set(FILES
     Math/Internal/SimdMathVec4_neon.inl
     Math/Internal/SimdMathVec4_scalar.inl
     Math/Internal/SimdMathVec4_sse.inl
+    Math/Internal/SimdMathVec8_avx.inl
     Math/Internal/SimdMathCommon_neon.inl
     Math/Internal/SimdMathCommon_neonDouble.inl
     Math/Internal/SimdMathCommon_neonQuad.inl
@@ -365,11 +376,15 @@ set(FILES
     Math/ShapeIntersection.cpp
     Math/ShapeIntersection.h
     Math/ShapeIntersection.inl
+    Math/SimdCpuFeatures.cpp
+    Math/SimdCpuFeatures.h
     Math/SimdMath.h
     Math/SimdMathVec1.h
     Math/SimdMathVec2.h
     Math/SimdMathVec3.h
     Math/SimdMathVec4.h
+    Math/SimdMathVec8.h
+    Math/Sha1.cpp
     Math/Sha1.h
     Math/Spline.cpp
     Math/Spline.h
@@ -410,6 +425,8 @@ set(FILES
     Math/ColorSerializer.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorInstance.h
@@ -421,6 +438,8 @@ set(FILES
     Memory/ChildAllocatorSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HphaAllocator.cpp
     Memory/HphaAllocator.h
     Memory/IAllocator.h
@@ -608,6 +627,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamingDeserializer.h
+    Serialization/Json/JsonStreamingDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -645,6 +666,8 @@ set(FILES
     Settings/ConfigurableStack.h
     Settings/SettingsRegistry.cpp
     Settings/SettingsRegistry.h
+    Settings/SettingsRegistryCachedValue.cpp
+    Settings/SettingsRegistryCachedValue.h
     Settings/SettingsRegistryConsoleUtils.cpp
     Settings/SettingsRegistryConsoleUtils.h
     Settings/SettingsRegistryImpl.cpp
@@ -655,6 +678,8 @@ set(FILES
     Settings/SettingsRegistryOriginTracker.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     Settings/SettingsRegistryVisitorUtils.cpp
     Settings/SettingsRegistryVisitorUtils.h
     Settings/TextParser.cpp
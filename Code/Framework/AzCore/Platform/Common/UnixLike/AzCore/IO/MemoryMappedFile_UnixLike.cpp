@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    bool MemoryMappedFile::PlatformOpen(const char* filePath)
+    {
+        int fileDescriptor = ::open(filePath, O_RDONLY | O_CLOEXEC);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStatus;
+        if (::fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode) || fileStatus.st_size <= 0)
+        {
+            ::close(fileDescriptor);
+            return false;
+        }
+
+        size_t size = aznumeric_cast<size_t>(fileStatus.st_size);
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+        // The mapping keeps its own reference to the file, so the descriptor is no longer needed.
+        ::close(fileDescriptor);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MemoryMappedFile::PlatformClose()
+    {
+        ::munmap(const_cast<u8*>(m_data), aznumeric_cast<size_t>(m_size));
+    }
+
+    void MemoryMappedFile::PlatformPrefetch(u64 offset, u64 size) const
+    {
+        // The advised range needs to start at a page boundary.
+        const uintptr_t pageSize = aznumeric_cast<uintptr_t>(::sysconf(_SC_PAGESIZE));
+        const uintptr_t start = reinterpret_cast<uintptr_t>(m_data + offset);
+        const uintptr_t alignedStart = start & ~(pageSize - 1);
+        ::posix_madvise(reinterpret_cast<void*>(alignedStart), aznumeric_cast<size_t>(size + (start - alignedStart)), POSIX_MADV_WILLNEED);
+    }
+} // namespace AZ::IO
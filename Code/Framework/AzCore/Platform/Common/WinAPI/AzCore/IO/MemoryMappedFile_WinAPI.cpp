@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MemoryMappedFile.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    bool MemoryMappedFile::PlatformOpen(const char* filePath)
+    {
+        AZStd::fixed_wstring<MaxPathLength> filePathW;
+        AZStd::to_wstring(filePathW, filePath);
+        HANDLE file = ::CreateFileW(filePathW.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // The mapping object keeps its own reference to the file, so the file handle is no longer needed.
+        ::CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (data == nullptr)
+        {
+            ::CloseHandle(mapping);
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = aznumeric_cast<u64>(fileSize.QuadPart);
+        m_platformHandle = mapping;
+        return true;
+    }
+
+    void MemoryMappedFile::PlatformClose()
+    {
+        ::UnmapViewOfFile(m_data);
+        ::CloseHandle(reinterpret_cast<HANDLE>(m_platformHandle));
+    }
+
+    void MemoryMappedFile::PlatformPrefetch(u64 offset, u64 size) const
+    {
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = const_cast<u8*>(m_data + offset);
+        range.NumberOfBytes = aznumeric_cast<SIZE_T>(size);
+        ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+    }
+} // namespace AZ::IO
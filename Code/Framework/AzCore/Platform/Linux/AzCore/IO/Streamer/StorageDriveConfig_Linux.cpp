@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!StorageDriveLinux::IsSupported())
+        {
+            // The previous entry in the stack, typically the generic storage drive, will handle all requests.
+            AZ_Warning("Streamer", false, "io_uring is not supported by the kernel or is disabled, no io_uring drives will be created.\n");
+            return parent;
+        }
+
+        const DriveList* drives = AZStd::any_cast<DriveList>(&hardware.m_platformData);
+
+        if (drives && !drives->empty())
+        {
+            for (const DriveInformation& drive : *drives)
+            {
+                StorageDriveLinux::ConstructionOptions options;
+                options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+                options.m_enableRegisteredBuffers = m_enableRegisteredBuffers;
+                options.m_hasSeekPenalty = drive.m_hasSeekPenalty;
+                options.m_minimalReporting = m_minimalReporting;
+
+                AZStd::vector<AZStd::string_view> drivePaths(drive.m_paths.begin(), drive.m_paths.end());
+                AZStd::vector<AZStd::string_view> excludedPaths(drive.m_excludedPaths.begin(), drive.m_excludedPaths.end());
+                AZ_Assert(!drive.m_paths.empty(), "Expected at least one drive path.");
+                const u32 queueDepth = m_queueDepth != 0 ? m_queueDepth : AZStd::min(drive.m_queueDepth, MaxDeviceQueueDepth);
+                auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+                    drivePaths, excludedPaths, m_maxFileHandles, m_maxMetaDataCache, drive.m_physicalSectorSize,
+                    drive.m_logicalSectorSize, queueDepth, m_overcommit, m_alignmentBufferSizeKib * 1_kib, options);
+
+                stackEntry->SetNext(AZStd::move(parent));
+                parent = stackEntry;
+            }
+        }
+        else
+        {
+            AZ_Warning("Streamer", false, "No drives found that can make use of the available optimizations.\n");
+        }
+        return parent;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("AlignmentBufferSizeKib", &LinuxStorageDriveConfig::m_alignmentBufferSizeKib)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("EnableRegisteredBuffers", &LinuxStorageDriveConfig::m_enableRegisteredBuffers)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{3F1C2A6E-8B47-4D1E-A5C9-6E0B7D2F4A18}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator);
+
+        ~LinuxStorageDriveConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        //! Cap on the queue depth taken from the device. NVMe drives report request queues of around a thousand entries,
+        //! which would allocate an alignment buffer per entry without improving the read speed.
+        static constexpr AZ::u32 MaxDeviceQueueDepth = 128;
+
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_overcommit{ 8 };
+        //! The number of reads in flight per drive. If 0 the size of the device's request queue is used, up to MaxDeviceQueueDepth.
+        AZ::u32 m_queueDepth{ 0 };
+        AZ::u32 m_alignmentBufferSizeKib{ 64 };
+        bool m_enableUnbufferedReads{ true };
+        bool m_enableRegisteredBuffers{ true };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,1509 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/StringFunc/StringFunc.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    // The io_uring system calls are used directly as glibc doesn't provide wrappers for them. This also avoids a dependency
+    // on liburing.
+    static int IoUringSetup(u32 entries, io_uring_params* params)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    static int IoUringEnter(int ringFileDescriptor, u32 toSubmit, u32 minComplete, u32 flags)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ringFileDescriptor, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    static int IoUringRegister(int ringFileDescriptor, u32 opcode, const void* arguments, u32 argumentCount)
+    {
+        return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ringFileDescriptor, opcode, arguments, argumentCount));
+    }
+
+    // The head and tail of the queues are shared with the kernel, so the entries need to be published and consumed in order.
+    static u32 LoadAcquire(const u32* value)
+    {
+        return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+    }
+
+    static void StoreRelease(u32* target, u32 value)
+    {
+        __atomic_store_n(target, value, __ATOMIC_RELEASE);
+    }
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_enableRegisteredBuffers(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    bool StorageDriveLinux::IsSupported()
+    {
+        static const bool isSupported = []()
+        {
+            io_uring_params params{};
+            int ring = IoUringSetup(1, &params);
+            if (ring < 0)
+            {
+                return false;
+            }
+            ::close(ring);
+            return true;
+        }();
+        return isSupported;
+    }
+
+    bool StorageDriveLinux::IsOnMountPoint(AZStd::string_view path, AZStd::string_view mountPoint)
+    {
+        if (mountPoint == "/")
+        {
+            return path.starts_with('/');
+        }
+        return path.starts_with(mountPoint) && (path.size() == mountPoint.size() || path[mountPoint.size()] == '/');
+    }
+
+    StorageDriveLinux::StorageDriveLinux(const AZStd::vector<AZStd::string_view>& mountPoints,
+        const AZStd::vector<AZStd::string_view>& excludedPaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+        size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth, s32 overCommit, size_t alignmentBufferSize,
+        ConstructionOptions options)
+        : m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        AZ_Assert(!mountPoints.empty(), "StorageDriveLinux requires at least one mount point to work.");
+
+        // Erase trailing slashes as it makes comparing paths to the mount points simpler.
+        auto AddPaths = [](AZStd::vector<AZStd::string>& target, const AZStd::vector<AZStd::string_view>& paths)
+        {
+            target.reserve(paths.size());
+            for (AZStd::string_view path : paths)
+            {
+                while (path.size() > 1 && path.ends_with('/'))
+                {
+                    path.remove_suffix(1);
+                }
+                target.emplace_back(path);
+            }
+        };
+        AddPaths(m_mountPoints, mountPoints);
+        AddPaths(m_excludedPaths, excludedPaths);
+
+        // Create name for statistics. The name will include all mount points on this physical device
+        // for instance "Storage drive (/,/home)".
+        m_name = "Storage drive (";
+        AZ::StringFunc::Join(m_name, m_mountPoints, ',');
+        m_name += ')';
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+        m_alignmentBufferSize = AZ_SIZE_ALIGN_UP(alignmentBufferSize, m_physicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a queue depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        else
+        {
+            m_queueDepth = AZ::GetMin(m_queueDepth, s_maxQueueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %zu", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        DestroyRing();
+        for (int file : m_fileCache_handles)
+        {
+            if (file != -1)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::InitializeRing()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // Reads and cancellations can both be in flight, so there are 2 submission entries per read slot. The completion queue
+        // is twice the size of the submission queue by default, so it can't overflow.
+        io_uring_params params{};
+        m_ring.m_fileDescriptor = IoUringSetup(m_queueDepth * 2, &params);
+        if (m_ring.m_fileDescriptor < 0)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Unable to create an io_uring for %s (errno: %i). Reads will be forwarded.\n",
+                m_name.c_str(), errno);
+            m_ring.m_fileDescriptor = -1;
+            return false;
+        }
+
+        m_ring.m_submissionQueueMemorySize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_ring.m_completionQueueMemorySize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool isSingleMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (isSingleMapping)
+        {
+            m_ring.m_submissionQueueMemorySize = AZStd::max(m_ring.m_submissionQueueMemorySize, m_ring.m_completionQueueMemorySize);
+            m_ring.m_completionQueueMemorySize = m_ring.m_submissionQueueMemorySize;
+        }
+        m_ring.m_submissionEntriesMemorySize = params.sq_entries * sizeof(io_uring_sqe);
+
+        auto MapRing = [this](size_t size, off_t offset) -> void*
+        {
+            void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ring.m_fileDescriptor, offset);
+            return memory != MAP_FAILED ? memory : nullptr;
+        };
+        m_ring.m_submissionQueueMemory = MapRing(m_ring.m_submissionQueueMemorySize, IORING_OFF_SQ_RING);
+        m_ring.m_completionQueueMemory =
+            isSingleMapping ? m_ring.m_submissionQueueMemory : MapRing(m_ring.m_completionQueueMemorySize, IORING_OFF_CQ_RING);
+        m_ring.m_submissionEntries = reinterpret_cast<io_uring_sqe*>(MapRing(m_ring.m_submissionEntriesMemorySize, IORING_OFF_SQES));
+        if (!m_ring.m_submissionQueueMemory || !m_ring.m_completionQueueMemory || !m_ring.m_submissionEntries)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Unable to map the io_uring for %s (errno: %i). Reads will be forwarded.\n",
+                m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+
+        auto submissionQueue = reinterpret_cast<u8*>(m_ring.m_submissionQueueMemory);
+        m_ring.m_submissionHead = reinterpret_cast<u32*>(submissionQueue + params.sq_off.head);
+        m_ring.m_submissionTail = reinterpret_cast<u32*>(submissionQueue + params.sq_off.tail);
+        m_ring.m_submissionArray = reinterpret_cast<u32*>(submissionQueue + params.sq_off.array);
+        m_ring.m_submissionMask = *reinterpret_cast<u32*>(submissionQueue + params.sq_off.ring_mask);
+
+        auto completionQueue = reinterpret_cast<u8*>(m_ring.m_completionQueueMemory);
+        m_ring.m_completionHead = reinterpret_cast<u32*>(completionQueue + params.cq_off.head);
+        m_ring.m_completionTail = reinterpret_cast<u32*>(completionQueue + params.cq_off.tail);
+        m_ring.m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionQueue + params.cq_off.cqes);
+        m_ring.m_completionMask = *reinterpret_cast<u32*>(completionQueue + params.cq_off.ring_mask);
+
+        // Let completed reads wake up the scheduler thread in case it went to sleep while reads are in flight.
+        const int wakeUpEvent = m_context->GetStreamerThreadSynchronizer().GetWakeUpEventDescriptor();
+        if (IoUringRegister(m_ring.m_fileDescriptor, IORING_REGISTER_EVENTFD, &wakeUpEvent, 1) != 0)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Unable to register the Streamer's wake up event with the io_uring for %s (errno: %i). "
+                "Reads will be forwarded.\n", m_name.c_str(), errno);
+            DestroyRing();
+            return false;
+        }
+
+        if (m_alignmentBufferSize > 0)
+        {
+            m_alignmentBuffers = azmalloc(m_alignmentBufferSize * m_queueDepth, m_physicalSectorSize, AZ::SystemAllocator);
+            if (m_constructionOptions.m_enableRegisteredBuffers)
+            {
+                AZStd::vector<iovec> buffers(m_queueDepth);
+                for (u32 i = 0; i < m_queueDepth; ++i)
+                {
+                    buffers[i].iov_base = reinterpret_cast<u8*>(m_alignmentBuffers) + i * m_alignmentBufferSize;
+                    buffers[i].iov_len = m_alignmentBufferSize;
+                }
+                // Registering pins the memory, which fails with ENOMEM or EPERM if it exceeds the locked memory limit. Skip registering
+                // the buffers if that's known up front. The buffers can still be used for regular reads in either case.
+                const size_t bufferPoolSize = m_alignmentBufferSize * m_queueDepth;
+                const size_t registeredSize = s_registeredBufferSize.fetch_add(bufferPoolSize) + bufferPoolSize;
+                rlimit lockedMemoryLimit{};
+                if (::getrlimit(RLIMIT_MEMLOCK, &lockedMemoryLimit) == 0 && lockedMemoryLimit.rlim_cur != RLIM_INFINITY &&
+                    registeredSize > lockedMemoryLimit.rlim_cur)
+                {
+                    AZ_Warning("StorageDriveLinux", false,
+                        "Not registering the %zu KiB of alignment buffers for %s as it exceeds the locked memory limit of %zu KiB. "
+                        "Reduce the QueueDepth or AlignmentBufferSizeKib, or raise the limit (ulimit -l) to use registered buffers.\n",
+                        bufferPoolSize / 1024, m_name.c_str(), aznumeric_cast<size_t>(lockedMemoryLimit.rlim_cur / 1024));
+                }
+                else if (IoUringRegister(m_ring.m_fileDescriptor, IORING_REGISTER_BUFFERS, buffers.data(), m_queueDepth) == 0)
+                {
+                    m_alignmentBuffersRegistered = true;
+                }
+                else
+                {
+                    AZ_Warning("StorageDriveLinux", false,
+                        "Unable to register the %zu KiB of alignment buffers with the io_uring for %s (errno: %i)%s. Using unregistered "
+                        "buffers instead.\n", bufferPoolSize / 1024, m_name.c_str(), errno,
+                        errno == ENOMEM || errno == EPERM ? ", they likely exceed the locked memory limit" : "");
+                }
+                if (!m_alignmentBuffersRegistered)
+                {
+                    s_registeredBufferSize -= bufferPoolSize;
+                }
+            }
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::DestroyRing()
+    {
+        if (m_ring.m_fileDescriptor != -1 && m_activeReads_Count > 0)
+        {
+            // Reads that are still in flight write to buffers that are about to be released, so wait for them to complete.
+            AZ_Warning("StorageDriveLinux", false, "%s is destroyed while there are still %u reads in flight.\n",
+                m_name.c_str(), m_activeReads_Count);
+            while (m_activeReads_Count > 0)
+            {
+                if (IoUringEnter(m_ring.m_fileDescriptor, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR)
+                {
+                    break;
+                }
+                u32 head = *m_ring.m_completionHead;
+                const u32 tail = LoadAcquire(m_ring.m_completionTail);
+                for (; head != tail; ++head)
+                {
+                    if (m_ring.m_completionEntries[head & m_ring.m_completionMask].user_data != CancelUserData)
+                    {
+                        --m_activeReads_Count;
+                    }
+                }
+                StoreRelease(m_ring.m_completionHead, head);
+            }
+        }
+
+        if (m_ring.m_submissionEntries)
+        {
+            ::munmap(m_ring.m_submissionEntries, m_ring.m_submissionEntriesMemorySize);
+        }
+        if (m_ring.m_completionQueueMemory && m_ring.m_completionQueueMemory != m_ring.m_submissionQueueMemory)
+        {
+            ::munmap(m_ring.m_completionQueueMemory, m_ring.m_completionQueueMemorySize);
+        }
+        if (m_ring.m_submissionQueueMemory)
+        {
+            ::munmap(m_ring.m_submissionQueueMemory, m_ring.m_submissionQueueMemorySize);
+        }
+        if (m_ring.m_fileDescriptor != -1)
+        {
+            ::close(m_ring.m_fileDescriptor);
+        }
+        m_ring = Ring{};
+
+        if (m_alignmentBuffers)
+        {
+            azfree(m_alignmentBuffers, AZ::SystemAllocator);
+            m_alignmentBuffers = nullptr;
+        }
+        if (m_alignmentBuffersRegistered)
+        {
+            // Closing the ring unregisters the buffers
+            s_registeredBufferSize -= m_alignmentBufferSize * m_queueDepth;
+            m_alignmentBuffersRegistered = false;
+        }
+    }
+
+    io_uring_sqe* StorageDriveLinux::GetSubmissionEntry()
+    {
+        // The submission queue has room for a read and a cancellation per read slot and is flushed after every batch, so it
+        // can't run out of entries.
+        const u32 tail = *m_ring.m_submissionTail + m_ring.m_unsubmittedCount;
+        AZ_Assert(tail - LoadAcquire(m_ring.m_submissionHead) <= m_ring.m_submissionMask,
+            "The submission queue of %s is full.", m_name.c_str());
+        const u32 index = tail & m_ring.m_submissionMask;
+        m_ring.m_submissionArray[index] = index;
+        ++m_ring.m_unsubmittedCount;
+
+        io_uring_sqe* entry = &m_ring.m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        return entry;
+    }
+
+    bool StorageDriveLinux::Submit()
+    {
+        if (m_ring.m_unsubmittedCount > 0)
+        {
+            StoreRelease(m_ring.m_submissionTail, *m_ring.m_submissionTail + m_ring.m_unsubmittedCount);
+            m_ring.m_unsubmittedCount = 0;
+        }
+
+        u32 pendingCount = *m_ring.m_submissionTail - LoadAcquire(m_ring.m_submissionHead);
+        if (pendingCount == 0)
+        {
+            return false;
+        }
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::Submit %s", m_name.c_str());
+        while (pendingCount > 0)
+        {
+            int submitted = IoUringEnter(m_ring.m_fileDescriptor, pendingCount, 0, 0);
+            if (submitted > 0)
+            {
+                pendingCount -= AZStd::min(pendingCount, aznumeric_cast<u32>(submitted));
+            }
+            else if (submitted < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            else if (submitted < 0 && (errno == EAGAIN || errno == EBUSY))
+            {
+                // The kernel is temporarily out of resources. The entries stay in the queue and are submitted on the next call.
+                break;
+            }
+            else
+            {
+                AZ_Error("StorageDriveLinux", false, "Failed to submit reads to the io_uring of %s (errno: %i).\n", m_name.c_str(), errno);
+
+                // The kernel hasn't picked up the remaining entries, so take them back and fail their requests.
+                u32 head = LoadAcquire(m_ring.m_submissionHead);
+                const u32 tail = *m_ring.m_submissionTail;
+                StoreRelease(m_ring.m_submissionTail, head);
+                for (; head != tail; ++head)
+                {
+                    const u64 userData = m_ring.m_submissionEntries[m_ring.m_submissionArray[head & m_ring.m_submissionMask]].user_data;
+                    if (userData != CancelUserData)
+                    {
+                        FinalizeSingleRequest(aznumeric_cast<size_t>(userData), -EIO);
+                    }
+                }
+                break;
+            }
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<Requests::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<Requests::ReadRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(readRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingReadRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        if (!m_pendingReadRequests.empty())
+        {
+            // Prepare reads for all available slots so they can be submitted to the kernel with a single call.
+            while (!m_pendingReadRequests.empty())
+            {
+                FileRequest* request = m_pendingReadRequests.front();
+                if (!ReadRequest(request))
+                {
+                    break;
+                }
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            }
+        }
+        else if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit(
+                [this, request](auto&& args)
+                {
+                    using Command = AZStd::decay_t<decltype(args)>;
+                    if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+                    {
+                        FileExistsRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+                    {
+                        FileMetaDataRetrievalRequest(request);
+                        m_pendingRequests.pop_front();
+                        return true;
+                    }
+                    else
+                    {
+                        AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                        return false;
+                    }
+                },
+                request->GetCommand());
+        }
+
+        if (m_ringInitialized && Submit())
+        {
+            m_queueDepthAverage.PushEntry(m_activeReads_Count);
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::steady_clock::time_point earliestSlot = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<Requests::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                AZStd::chrono::steady_clock::time_point endTime =
+                    read.m_startTime + Statistic::TimeValue(aznumeric_cast<u64>((readCommand->m_size * totalReadTime) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::steady_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTime = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += Statistic::TimeValue(aznumeric_cast<u64>((readSize * totalReadTime) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, Requests::ReadData> ||
+                          AZStd::is_same_v<Command, Requests::FileExistsCheckData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, Requests::CompressedReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_compressionInfo.m_archiveFilename.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = -1;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file != -1, "Found the file '%s' in cache, but file handle is invalid.\n", data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                // Depending on configuration, reads are unbuffered, which means they bypass the page cache.
+                const int openFlags = O_RDONLY | O_CLOEXEC;
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), openFlags | O_DIRECT);
+                }
+                // Not all file systems support unbuffered reads, in which case the file is read through the page cache.
+                if (file == -1 && (!m_constructionOptions.m_enableUnbufferedReads || errno == EINVAL))
+                {
+                    file = ::open(data.m_path.GetAbsolutePathCStr(), openFlags);
+                }
+
+                if (file == -1)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                if (m_fileCache_handles[cacheIndex] != -1)
+                {
+                    ::close(m_fileCache_handles[cacheIndex]);
+                }
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::now();
+        fileDescriptor = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::steady_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, -1);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+
+            m_readSlots_readInfo.resize(m_queueDepth);
+            m_readSlots_active.resize(m_queueDepth);
+
+            m_ringInitialized = InitializeRing();
+            m_cachesInitialized = true;
+        }
+
+        if (!m_ringInitialized)
+        {
+            // io_uring isn't available, so let the next entry in the stack handle the read.
+            StreamStackEntry::QueueRequest(request);
+            return true;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        auto data = AZStd::get_if<Requests::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = -1;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+
+        if (m_constructionOptions.m_enableUnbufferedReads)
+        {
+            // Check alignment of the file read information: size, offset, and address.
+            // If any are unaligned to the sector sizes, align the offset down and the size up and read into an aligned buffer. Only
+            // the requested part is copied back to the output once the read completes. See StorageDriveWin for a detailed overview.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (readSize <= m_alignmentBufferSize)
+                {
+                    readInfo.m_usesAlignmentBuffer = true;
+                    output = reinterpret_cast<u8*>(m_alignmentBuffers) + readSlot * m_alignmentBufferSize;
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = readInfo.m_sectorAlignedOutput;
+                }
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        readInfo.m_target.iov_base = output;
+        readInfo.m_target.iov_len = aznumeric_caster(readSize);
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        // The read is submitted together with the other reads prepared in this tick.
+        io_uring_sqe* entry = GetSubmissionEntry();
+        entry->fd = file;
+        entry->off = readOffs;
+        entry->user_data = readSlot;
+        if (readInfo.m_usesAlignmentBuffer && m_alignmentBuffersRegistered)
+        {
+            entry->opcode = IORING_OP_READ_FIXED;
+            entry->addr = reinterpret_cast<u64>(output);
+            entry->len = aznumeric_caster(readSize);
+            entry->buf_index = aznumeric_caster(readSlot);
+        }
+        else
+        {
+            entry->opcode = IORING_OP_READV;
+            entry->addr = reinterpret_cast<u64>(&readInfo.m_target);
+            entry->len = 1;
+        }
+
+        auto now = AZStd::chrono::steady_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now ask the kernel to cancel any active reads. Reads that can't be canceled
+        // anymore will complete as usual.
+        bool hasCanceledReads = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                io_uring_sqe* entry = GetSubmissionEntry();
+                entry->opcode = IORING_OP_ASYNC_CANCEL;
+                entry->fd = -1;
+                entry->addr = readSlot;
+                entry->user_data = CancelUserData;
+                hasCanceledReads = true;
+                ownsRequestChain = true;
+            }
+        }
+        if (hasCanceledReads)
+        {
+            Submit();
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<Requests::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        AZ_Assert(IsServicedByThisDrive(fileExists.m_path.GetAbsolutePath()),
+            "FileExistsRequest was queued on a StorageDriveLinux that doesn't service files on the given path '%s'.",
+            fileExists.m_path.GetRelativePath());
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStatus;
+        if (::stat(fileExists.m_path.GetAbsolutePathCStr(), &fileStatus) == 0)
+        {
+            if (S_ISREG(fileStatus.st_mode))
+            {
+                cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStatus.st_size);
+                fileExists.m_found = true;
+            }
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<Requests::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat fileStatus;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != -1,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &fileStatus) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePathCStr(), &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(fileStatus.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(fileStatus.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] != -1)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                if (m_fileCache_handles[cacheIndex] != -1)
+                {
+                    AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                        m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                    ::close(m_fileCache_handles[cacheIndex]);
+                    m_fileCache_handles[cacheIndex] = -1;
+                }
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::steady_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        if (!m_ringInitialized)
+        {
+            return false;
+        }
+
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        bool hasWorked = false;
+        u32 head = *m_ring.m_completionHead;
+        u32 tail = LoadAcquire(m_ring.m_completionTail);
+        while (head != tail)
+        {
+            const io_uring_cqe& completion = m_ring.m_completionEntries[head & m_ring.m_completionMask];
+            const u64 userData = completion.user_data;
+            const s32 result = completion.res;
+            // Release the entry before finalizing as that can queue the next read.
+            StoreRelease(m_ring.m_completionHead, ++head);
+
+            // The results of cancellations don't need to be handled as the canceled read will complete with -ECANCELED or
+            // its regular result if it was too late to cancel.
+            if (userData != CancelUserData)
+            {
+                FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+                hasWorked = true;
+            }
+
+            if (head == tail)
+            {
+                tail = LoadAcquire(m_ring.m_completionTail);
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        const bool isCanceled = result == -ECANCELED;
+        const bool encounteredError = result < 0 && !isCanceled;
+        const size_t numBytesTransferred = result > 0 ? aznumeric_cast<size_t>(result) : 0;
+        AZ_Error("StorageDriveLinux", !encounteredError, "Async file read operation completed with error %i (%s).\n",
+            -result, strerror(-result));
+
+        auto now = AZStd::chrono::steady_clock::now();
+        m_activeReads_ByteCount += numBytesTransferred;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        m_readLatencyPercentiles.PushEntry(AZStd::chrono::duration_cast<Statistic::TimeValue>(now - fileReadInfo.m_startTime));
+
+        auto readCommand = AZStd::get_if<Requests::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less than the amount of
+        // requested data, unless the request reads past the end of the file.
+        bool isSuccess = !encounteredError && !isCanceled && (readCommand->m_size + fileReadInfo.m_copyBackOffset <= numBytesTransferred);
+        if (isSuccess && (fileReadInfo.m_sectorAlignedOutput || fileReadInfo.m_usesAlignmentBuffer))
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_target.iov_base) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+
+        // There's now a slot available to queue the next request, if there is one.
+        if (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readSlot))
+            {
+                m_pendingReadRequests.pop_front();
+            }
+        }
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::steady_clock::time_point oldest = AZStd::chrono::steady_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    bool StorageDriveLinux::IsServicedByThisDrive(AZ::IO::PathView filePath) const
+    {
+        // The path is compared against the mount points rather than looking up the device of the file, as that requires a
+        // system call per request. Bind mounts and symbolic links to other devices are therefore attributed to this drive.
+        const AZStd::string_view path = filePath.Native();
+        size_t mountPointLength = 0;
+        bool isOnMountPoint = false;
+        for (const AZStd::string& mountPoint : m_mountPoints)
+        {
+            if (IsOnMountPoint(path, mountPoint))
+            {
+                mountPointLength = AZStd::max(mountPointLength, mountPoint.size());
+                isOnMountPoint = true;
+            }
+        }
+        if (!isOnMountPoint)
+        {
+            return false;
+        }
+
+        // Other file systems can be mounted inside of a mount point, in which case the most specific mount point is used.
+        for (const AZStd::string& excludedPath : m_excludedPaths)
+        {
+            if (excludedPath.size() > mountPointLength && IsOnMountPoint(path, excludedPath))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateBytesPerSecond(m_name, "Read Speed", totalBytesRead / totalReadTimeSec,
+                "The average read speed in megabytes per second this drive achieved. This is the maximum achievable speed for reading from "
+                "disk. If this is lower than expected it may indicate that the queue depth is too small to saturate the device, other "
+                "applications are using the same drive or reads are served from the page cache because unbuffered reads are disabled."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "File Open & Close", m_fileOpenCloseTimeAverage.CalculateAverage(), m_fileOpenCloseTimeAverage.GetMinimum(),
+                m_fileOpenCloseTimeAverage.GetMaximum(),
+                "The average amount of time needed to open and close file handles. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file exists", m_getFileExistsTimeAverage.CalculateAverage(),
+                m_getFileExistsTimeAverage.GetMinimum(), m_getFileExistsTimeAverage.GetMaximum(),
+                "The average amount of time needed to check if a file exists. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+            statistics.push_back(Statistic::CreateTimeRange(
+                m_name, "Get file meta data", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage(),
+                m_getFileMetaDataRetrievalTimeAverage.GetMinimum(), m_getFileMetaDataRetrievalTimeAverage.GetMaximum(),
+                "The average amount of time in microseconds needed to retrieve file information. This is a fixed cost from the operating "
+                "system. This can be mitigated running from archives."));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots(),
+                "The total number of available slots to queue requests on. The lower this number, the more active this node is. A small "
+                "number is ideal as it means there are a few requests available for immediate processing next once a request "
+                "completes. If this is value is often negative then increasing the over-commit value, but keep in mind that too many "
+                "over-committed reduces the ability of scheduler to order requests."));
+            statistics.push_back(Statistic::CreateFloatRange(
+                m_name, "Queue depth", m_queueDepthAverage.CalculateAverage(),
+                aznumeric_caster(m_queueDepthAverage.GetNumRecorded() > 0 ? m_queueDepthAverage.GetMinimum() : 0),
+                aznumeric_caster(m_queueDepthAverage.GetNumRecorded() > 0 ? m_queueDepthAverage.GetMaximum() : 0),
+                "The number of reads in flight after submitting reads to the kernel. Fast drives such as NVMe drives need a deep queue to "
+                "reach their full bandwidth. If this value stays well below the configured queue depth while reads are pending, the "
+                "scheduler isn't providing requests fast enough, which can be improved by increasing the over-commit value."));
+            statistics.push_back(Statistic::CreateTime(
+                m_name, "Read latency (p50)", m_readLatencyPercentiles.CalculatePercentile(50.0),
+                "The median time between submitting a read to the kernel and its completion."));
+            statistics.push_back(Statistic::CreateTime(
+                m_name, "Read latency (p90)", m_readLatencyPercentiles.CalculatePercentile(90.0),
+                "The time 90 percent of the reads complete in, measured from submission to completion."));
+            statistics.push_back(Statistic::CreateTime(
+                m_name, "Read latency (p99)", m_readLatencyPercentiles.CalculatePercentile(99.0),
+                "The time 99 percent of the reads complete in, measured from submission to completion. A tail latency that's much "
+                "larger than the median can indicate that the device's queue is oversubscribed, for instance by other applications."));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage(), m_fileSwitchPercentageStat.GetMinimum(),
+                m_fileSwitchPercentageStat.GetMaximum(),
+                "The percentage of file requests that required switching to a different file. When running from loose file this should be "
+                "close to 100% as that would indicate mostly full file reads. When running from archives this should be as close to 0 as "
+                "possible as that would indicate efficiently running from archives."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, SeeksName, m_seekPercentageStat.GetAverage(), m_seekPercentageStat.GetMinimum(), m_seekPercentageStat.GetMaximum(),
+                "The percentage of file reads that required seeking within a file. For loose files this should be lose to zero to indicate "
+                "no partial file reads. For archives this value is typically high, which is not a problem, but lower values indicate more "
+                "efficient scheduling and archive layout which will result in better hardware cache utilization."));
+            statistics.push_back(Statistic::CreatePercentageRange(
+                m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage(), m_directReadsPercentageStat.GetMinimum(),
+                m_directReadsPercentageStat.GetMaximum(),
+                "The percentage of reads that did not require any additional aligning. If this number isn't close to 100 percent "
+                "performance will suffer as data needs to be copied from the alignment buffers. The best way to avoid this is by adding a "
+                "block cache and/or read splitter in front of this node."));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const Requests::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case IStreamerTypes::ReportType::Config:
+            {
+                AZStd::string mountPoints;
+                AZ::StringFunc::Join(mountPoints, m_mountPoints, ' ');
+                data.m_output.push_back(Statistic::CreatePersistentString(
+                    m_name, "Mount points", AZStd::move(mountPoints), "The mount points of the file systems this node monitors."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Max file handles", m_maxFileHandles,
+                    "The maximum number of file handles this drive node will cache. Increasing this will allow files that are read "
+                    "multiple times to be processed faster. It's recommended to have this set to at least the largest number of archives "
+                    "that can be in use at the same time."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Max meta data cache", m_metaDataCache_paths.size(),
+                    "The maximum number of meta data like file sizes this drive node will cache."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Physical sector size", m_physicalSectorSize,
+                    "The sector size used by the hardware. For optimal performance memory alignment and read sizes need to be multiples of "
+                    "this value."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Logical sector size", m_logicalSectorSize,
+                    "The sector size used by the operating system. This is typically the same or smaller than the physical sector size. If "
+                    "the physical sector size alignment can't be met, this is the next best size to align to."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Queue depth", m_queueDepth, "The maximum number of reads this node keeps in flight."));
+                data.m_output.push_back(Statistic::CreateInteger(
+                    m_name, "Overcommit", m_overCommit,
+                    "The number of additional requests this node will accept. Higher numbers means that drives don't have to wait for the "
+                    "scheduler to provide new request to process and the next request can immediately start reading. If this value is too "
+                    "high though it will negatively impact the scheduler's ability to order and prioritize requests, which can lead to "
+                    "poorer hardware and software cache performance and slower cancellations, among others."));
+                data.m_output.push_back(Statistic::CreateByteSize(
+                    m_name, "Alignment buffer size", m_alignmentBufferSize,
+                    "The size of the buffer per queue slot that reads are done into when their output doesn't meet the alignment "
+                    "requirements. Larger unaligned reads allocate a temporary buffer."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Registered buffers", m_alignmentBuffersRegistered,
+                    "Whether or not the alignment buffers are registered with the kernel. Registered buffers don't need to be mapped "
+                    "for every read."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Has seek penalty", m_constructionOptions.m_hasSeekPenalty,
+                    "Whether or not the hardware has a penalty for seeking. This refers to drives that need to physically position a read "
+                    "head to retrieve data, which can cause additional seek times for non-consecutive reads. This does not refer to seeks "
+                    "impacting hardware cache performance."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Unbuffered reads enabled", m_constructionOptions.m_enableUnbufferedReads,
+                    "Whether or not this drive will use the page cache (buffered) or not (unbuffered). Buffered reads are beneficial when "
+                    "reading the same file frequently, which happens during development. Unbuffered typically is faster when reading the "
+                    "initial file as there's much less the operating system has to do, but subsequential reads are slower."));
+                data.m_output.push_back(Statistic::CreateBoolean(
+                    m_name, "Minimal reporting", m_constructionOptions.m_minimalReporting,
+                    "Whether or not this node only reports issues or reports all information."));
+                data.m_output.push_back(Statistic::CreateReferenceString(
+                    m_name, "Next node", m_next ? AZStd::string_view(m_next->GetName()) : AZStd::string_view("<None>"),
+                    "The name of the node that follows this node or none."));
+            }
+            break;
+        case IStreamerTypes::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != -1)
+                    {
+                        data.m_output.push_back(
+                            Statistic::CreatePersistentString(m_name, "File lock", m_fileCache_paths[i].GetRelativePath().Native()));
+                    }
+                }
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO::Requests
+{
+    struct ReadData;
+    struct ReportData;
+}
+
+namespace AZ::IO
+{
+    //! Storage drive that reads through io_uring, which allows a single thread to keep many reads in flight and
+    //! submit and complete them in batches.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use unbuffered reads (O_DIRECT) for the fastest possible read speeds by bypassing the page cache. This results in
+            //! a faster read the first time a file is read, but subsequent reads will possibly be slower as those could have been
+            //! serviced from the page cache. Unbuffered reads have alignment restrictions. Many of the other stream stack entry are
+            //! (optionally) aware and make adjustments. For the most optimal performance align read buffers to the physicalSectorSize.
+            //! Files on file systems that don't support O_DIRECT are read buffered.
+            u8 m_enableUnbufferedReads : 1;
+            //! Register the buffers used to align reads with the kernel, so they don't need to be mapped for every read.
+            u8 m_enableRegisteredBuffers : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Returns true if the kernel supports io_uring. It's not available on kernels older than 5.1 and can be disabled,
+        //! for instance by the seccomp policies of containers.
+        static bool IsSupported();
+        //! Returns true if @path is @mountPoint or a path inside of it. The mount point can't have a trailing slash unless
+        //! it's the root.
+        static bool IsOnMountPoint(AZStd::string_view path, AZStd::string_view mountPoint);
+
+        //! Creates an instance of a storage device that reads through io_uring.
+        //! @param mountPoints The mount points of the file systems on the device. A single device can have multiple
+        //!     partitions and mount points.
+        //! @param excludedPaths Mount points of other devices that are nested under the mount points of this device.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Only
+        //!     a small number are needed when running from archives, but it's recommended that a larger number are kept open
+        //!     when reading from loose files.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param queueDepth The maximum number of reads that are in flight at the same time. This is typically set to the number of
+        //!     requests the device's queue can hold.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. An over-commit that is too large can negatively impact the
+        //!     scheduler's ability to re-order requests for optimal read order. A negative value will under-commit and will
+        //!     avoid saturating the IO controller which can be needed if the drive is used by other applications.
+        //! @param alignmentBufferSize The size of the buffer per queue slot that reads are done into if their output doesn't meet the
+        //!     alignment requirements. Larger unaligned reads use a temporary allocation.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& mountPoints, const AZStd::vector<AZStd::string_view>& excludedPaths,
+            u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth,
+            s32 overCommit, size_t alignmentBufferSize, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::steady_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+        //! The queue depth is capped so the completion queue, which is sized for twice the number of submissions, can
+        //! hold both the completed reads and cancellations.
+        static constexpr u32 s_maxQueueDepth = 1024;
+        //! Total size of the alignment buffers registered by all drives. Registered buffers are pinned, and count towards
+        //! the locked memory limit (RLIMIT_MEMLOCK) of the process.
+        inline static AZStd::atomic<size_t> s_registeredBufferSize{ 0 };
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        //! User data for submissions that cancel reads. Reads use their read slot index.
+        inline static constexpr u64 CancelUserData = std::numeric_limits<u64>::max();
+
+        //! The submission and completion queues that are shared with the kernel.
+        struct Ring
+        {
+            void* m_submissionQueueMemory{ nullptr };
+            void* m_completionQueueMemory{ nullptr };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            io_uring_cqe* m_completionEntries{ nullptr };
+            u32* m_submissionHead{ nullptr };
+            u32* m_submissionTail{ nullptr };
+            u32* m_submissionArray{ nullptr };
+            u32* m_completionHead{ nullptr };
+            u32* m_completionTail{ nullptr };
+            size_t m_submissionQueueMemorySize{ 0 };
+            size_t m_completionQueueMemorySize{ 0 };
+            size_t m_submissionEntriesMemorySize{ 0 };
+            u32 m_submissionMask{ 0 };
+            u32 m_completionMask{ 0 };
+            u32 m_unsubmittedCount{ 0 };
+            int m_fileDescriptor{ -1 };
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::steady_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr }; // Internally allocated buffer that is sector aligned.
+            iovec m_target{};
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            bool m_usesAlignmentBuffer{ false }; // Set if the read is done in the registered alignment buffer of the slot.
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        bool InitializeRing();
+        void DestroyRing();
+        io_uring_sqe* GetSubmissionEntry();
+        bool Submit();
+
+        OpenFileResult OpenFile(int& fileDescriptor, size_t& cacheSlot, FileRequest* request, const Requests::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(AZ::IO::PathView filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::steady_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::steady_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+
+        void Report(const Requests::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AverageWindow<u64, double, s_statisticsWindowSize> m_queueDepthAverage;
+        TimedPercentileWindow<s_statisticsWindowSize> m_readLatencyPercentiles;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::steady_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::steady_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_mountPoints;
+        AZStd::vector<AZStd::string> m_excludedPaths;
+
+        Ring m_ring;
+        //! One buffer of m_alignmentBufferSize bytes per read slot.
+        void* m_alignmentBuffers{ nullptr };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_alignmentBufferSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+        bool m_ringInitialized{ false };
+        bool m_alignmentBuffersRegistered{ false };
+    };
+} // namespace AZ::IO
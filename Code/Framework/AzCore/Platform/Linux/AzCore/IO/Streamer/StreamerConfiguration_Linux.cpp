@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryMergeUtils.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+#include <limits.h>
+#include <mntent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    struct MountInformation
+    {
+        AZStd::string m_path;
+        //! The sysfs folder of the disk the file system is on, or empty if the file system isn't on a block device.
+        AZStd::string m_diskPath;
+    };
+
+    static bool ReadSysfsValue(u64& value, const AZStd::string& folder, const char* name)
+    {
+        AZStd::string path = AZStd::string::format("%s/%s", folder.c_str(), name);
+        FILE* file = ::fopen(path.c_str(), "r");
+        if (!file)
+        {
+            return false;
+        }
+        unsigned long long result = 0;
+        bool isRead = ::fscanf(file, "%llu", &result) == 1;
+        ::fclose(file);
+        value = result;
+        return isRead;
+    }
+
+    static AZStd::string FindDiskPath(const char* deviceName)
+    {
+        struct stat deviceStatus;
+        if (::stat(deviceName, &deviceStatus) != 0 || !S_ISBLK(deviceStatus.st_mode))
+        {
+            return {};
+        }
+
+        // Partitions are sub folders of the disk they're on and the request queue information is only available on the disk.
+        AZStd::string devicePath =
+            AZStd::string::format("/sys/dev/block/%u:%u", ::major(deviceStatus.st_rdev), ::minor(deviceStatus.st_rdev));
+        char resolvedPath[PATH_MAX];
+        if (!::realpath(devicePath.c_str(), resolvedPath))
+        {
+            return {};
+        }
+        AZStd::string diskPath = resolvedPath;
+        u64 partition = 0;
+        if (ReadSysfsValue(partition, diskPath, "partition"))
+        {
+            diskPath.erase(diskPath.find_last_of('/'));
+        }
+
+        struct stat queueStatus;
+        AZStd::string queuePath = diskPath + "/queue";
+        if (::stat(queuePath.c_str(), &queueStatus) != 0 || !S_ISDIR(queueStatus.st_mode))
+        {
+            // Devices such as loop devices without a request queue aren't supported.
+            return {};
+        }
+        return diskPath;
+    }
+
+    static void CollectDriveInfo(const AZStd::string& diskPath, DriveInformation& information, bool reportHardware)
+    {
+        AZStd::string queuePath = diskPath + "/queue";
+        u64 value = 0;
+        if (ReadSysfsValue(value, queuePath, "physical_block_size"))
+        {
+            information.m_physicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysfsValue(value, queuePath, "logical_block_size"))
+        {
+            information.m_logicalSectorSize = aznumeric_caster(value);
+        }
+        if (ReadSysfsValue(value, queuePath, "nr_requests"))
+        {
+            information.m_queueDepth = aznumeric_caster(value);
+        }
+        if (ReadSysfsValue(value, queuePath, "max_sectors_kb"))
+        {
+            information.m_maxTransfer = aznumeric_caster(value * 1_kib);
+        }
+        if (ReadSysfsValue(value, queuePath, "rotational"))
+        {
+            information.m_hasSeekPenalty = value != 0;
+        }
+
+        AZStd::string_view diskName = AZStd::string_view(diskPath).substr(diskPath.find_last_of('/') + 1);
+        information.m_profile = diskName.starts_with("nvme") ? "Nvme" : "Generic";
+        information.m_profile += information.m_hasSeekPenalty ? "_HDD" : "_SSD";
+
+        if (reportHardware)
+        {
+            AZ_Trace(
+                "Streamer",
+                "Drive info for '%.*s':\n"
+                "    Profile: %s\n"
+                "    Physical sector size: %zu bytes\n"
+                "    Logical sector size: %zu bytes\n"
+                "    Request queue size: %u\n"
+                "    Max transfer: %zu kb\n"
+                "    Has seek penalty: %s\n",
+                AZ_STRING_ARG(diskName), information.m_profile.c_str(), information.m_physicalSectorSize,
+                information.m_logicalSectorSize, information.m_queueDepth, information.m_maxTransfer / 1_kib,
+                information.m_hasSeekPenalty ? "Yes" : "No");
+        }
+    }
+
+    //! Returns the index of the mount with the most specific mount point that @path is on.
+    static size_t FindMount(AZStd::string_view path, const AZStd::vector<MountInformation>& mounts)
+    {
+        size_t result = mounts.size();
+        for (size_t i = 0; i < mounts.size(); ++i)
+        {
+            if (StorageDriveLinux::IsOnMountPoint(path, mounts[i].m_path) &&
+                (result == mounts.size() || mounts[i].m_path.size() >= mounts[result].m_path.size()))
+            {
+                result = i;
+            }
+        }
+        return result;
+    }
+
+    static bool IsDiskUsed(const AZStd::string& diskPath, const AZStd::vector<MountInformation>& mounts)
+    {
+        bool diskFound{};
+        auto IsDiskInUse = [&diskPath, &diskFound, &mounts](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            AZ::IO::FixedMaxPath runtimePath;
+            if (visitArgs.m_registry.Get(runtimePath.Native(), visitArgs.m_jsonKeyPath))
+            {
+                size_t mountIndex = FindMount(runtimePath.Native(), mounts);
+                if (mountIndex < mounts.size() && mounts[mountIndex].m_diskPath == diskPath)
+                {
+                    // Halt iteration if there exist O3DE is using a path from the disk
+                    diskFound = true;
+                    return AZ::SettingsRegistryInterface::VisitResponse::Done;
+                }
+            }
+
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+
+        auto settingsRegistry = SettingsRegistry::Get();
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, IsDiskInUse, SettingsRegistryMergeUtils::FilePathsRootKey);
+
+        return diskFound;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool addAllDrives, bool reportHardware)
+    {
+        FILE* mountTable = ::setmntent("/proc/self/mounts", "r");
+        if (!mountTable)
+        {
+            return false;
+        }
+
+        AZStd::vector<MountInformation> mounts;
+        mntent entry;
+        char buffer[4096];
+        while (::getmntent_r(mountTable, &entry, buffer, sizeof(buffer)))
+        {
+            // Virtual file systems such as proc and tmpfs are recorded as well, so they can be excluded from the drive they're
+            // mounted on.
+            MountInformation& mount = mounts.emplace_back();
+            mount.m_path = entry.mnt_dir;
+            mount.m_diskPath = FindDiskPath(entry.mnt_fsname);
+        }
+        ::endmntent(mountTable);
+
+        AZStd::unordered_map<AZStd::string, DriveInformation> driveMappings;
+        for (size_t i = 0; i < mounts.size(); ++i)
+        {
+            const MountInformation& mount = mounts[i];
+            if (mount.m_diskPath.empty())
+            {
+                continue;
+            }
+            // File systems that are mounted on top of an earlier mount hide the original.
+            if (FindMount(mount.m_path, mounts) != i)
+            {
+                continue;
+            }
+
+            auto driveInformationEntry = driveMappings.find(mount.m_diskPath);
+            if (driveInformationEntry == driveMappings.end())
+            {
+                if (!addAllDrives && !IsDiskUsed(mount.m_diskPath, mounts))
+                {
+                    if (reportHardware)
+                    {
+                        AZ_Trace("Streamer", "Skipping drive '%s' because no paths make use of it.\n", mount.m_diskPath.c_str());
+                    }
+                    continue;
+                }
+
+                DriveInformation driveInformation;
+                driveInformation.m_paths.push_back(mount.m_path);
+                CollectDriveInfo(mount.m_diskPath, driveInformation, reportHardware);
+
+                hardwareInfo.m_maxPhysicalSectorSize =
+                    AZStd::max(hardwareInfo.m_maxPhysicalSectorSize, driveInformation.m_physicalSectorSize);
+                hardwareInfo.m_maxLogicalSectorSize =
+                    AZStd::max(hardwareInfo.m_maxLogicalSectorSize, driveInformation.m_logicalSectorSize);
+                hardwareInfo.m_maxPageSize = AZStd::max(hardwareInfo.m_maxPageSize, aznumeric_cast<size_t>(::sysconf(_SC_PAGESIZE)));
+                hardwareInfo.m_maxTransfer = AZStd::max(hardwareInfo.m_maxTransfer, driveInformation.m_maxTransfer);
+
+                driveMappings.emplace(mount.m_diskPath, AZStd::move(driveInformation));
+            }
+            else
+            {
+                if (reportHardware)
+                {
+                    AZ_Trace(
+                        "Streamer", "Mount point '%s' is on the same storage drive as '%s'.\n",
+                        mount.m_path.c_str(), driveInformationEntry->second.m_paths[0].c_str());
+                }
+                driveInformationEntry->second.m_paths.push_back(mount.m_path);
+            }
+        }
+
+        DriveList driveList;
+        driveList.reserve(driveMappings.size());
+        for (auto& drive : driveMappings)
+        {
+            // Exclude everything that's mounted inside the drive's mount points from another device.
+            DriveInformation& driveInformation = drive.second;
+            for (const MountInformation& mount : mounts)
+            {
+                if (mount.m_diskPath == drive.first)
+                {
+                    continue;
+                }
+                for (const AZStd::string& drivePath : driveInformation.m_paths)
+                {
+                    if (mount.m_path.size() > drivePath.size() && StorageDriveLinux::IsOnMountPoint(mount.m_path, drivePath))
+                    {
+                        driveInformation.m_excludedPaths.push_back(mount.m_path);
+                        break;
+                    }
+                }
+            }
+            driveList.push_back(AZStd::move(driveInformation));
+        }
+
+        // Only the Generic profile is defined for Linux, so the per-drive profiles are only used for reporting.
+        hardwareInfo.m_profile = "Generic";
+        const bool hasDrives = !driveList.empty();
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return hasDrives;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, includeAllHardware, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
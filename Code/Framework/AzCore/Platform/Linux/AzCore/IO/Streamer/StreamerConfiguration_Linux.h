@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    struct DriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::DriveInformation, "{6D0A8E7C-3B0B-4C8D-9E55-2F4A1C7B8D93}");
+
+        //! Mount points of the file systems on the device.
+        AZStd::vector<AZStd::string> m_paths;
+        //! Mount points of other devices or virtual file systems that are nested inside the mount points of this device.
+        AZStd::vector<AZStd::string> m_excludedPaths;
+        AZStd::string m_profile;
+        size_t m_physicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_logicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_maxTransfer{ 0 };
+        u32 m_queueDepth{ 0 };
+        bool m_hasSeekPenalty{ true };
+    };
+
+    using DriveList = AZStd::vector<DriveInformation>;
+} // namespace AZ::IO
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Trace.h>
+
+#include <errno.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_wakeUpEvent = ::eventfd(0, EFD_CLOEXEC);
+        AZ_Assert(m_wakeUpEvent != -1, "Failed to create the wake up event for the Streamer (errno: %i).", errno);
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        if (m_wakeUpEvent != -1)
+        {
+            ::close(m_wakeUpEvent);
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        // Reading blocks until the counter is non-zero and then resets it, so wake up calls that were queued before the
+        // thread got here return immediately.
+        eventfd_t value = 0;
+        while (::eventfd_read(m_wakeUpEvent, &value) != 0 && errno == EINTR)
+        {
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        ::eventfd_write(m_wakeUpEvent, 1);
+    }
+
+    int StreamerContextThreadSync::GetWakeUpEventDescriptor() const
+    {
+        return m_wakeUpEvent;
+    }
+} // namespace AZ::Platform
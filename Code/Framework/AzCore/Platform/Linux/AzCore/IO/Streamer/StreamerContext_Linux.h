@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Puts the scheduler thread to sleep on an eventfd. Besides wake up calls from other threads, the eventfd can be
+    //! registered with the kernel so completed asynchronous reads also wake up the scheduler thread.
+    class StreamerContextThreadSync
+    {
+    public:
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns the eventfd that wakes up the scheduler thread when it's signaled.
+        int GetWakeUpEventDescriptor() const;
+
+    private:
+        int m_wakeUpEvent{ -1 };
+    };
+} // namespace AZ::Platform
@@ -236,6 +236,48 @@ TEST_F(AssetDataStreamTest, Open_OpenAndReadFile_FileReadSuccessfully)
     assetDataStream.Close();
 }
 
+TEST_F(AssetDataStreamTest, Open_ReadCompletedWithMappedView_ViewUsedWithoutClaimingOrReleasing)
+{
+    using ::testing::_;
+    using ::testing::Return;
+
+    const size_t assetSize = 500;
+
+    // The view is owned by the streamer, so it must not be claimed by the stream or released to the allocator.
+    AZStd::vector<AZ::u8> view(assetSize, m_expectedBufferChar);
+    bool claimedMemory = false;
+
+    ON_CALL(m_mockStreamer, GetReadRequestMemoryType(_)).WillByDefault(Return(IStreamerTypes::MemoryType::MappedView));
+    ON_CALL(m_mockStreamer, GetReadRequestResult(_, _, _, _))
+        .WillByDefault([&view, &claimedMemory](
+            [[maybe_unused]] FileRequestHandle request,
+            void*& buffer,
+            AZ::u64& numBytesRead,
+            IStreamerTypes::ClaimMemory claimMemory)
+            {
+                claimedMemory = claimMemory == IStreamerTypes::ClaimMemory::Yes;
+                numBytesRead = view.size();
+                buffer = view.data();
+                return true;
+            });
+
+    AZ::Data::AssetDataStream assetDataStream;
+    assetDataStream.Open("path/test", 0, assetSize);
+    assetDataStream.BlockUntilLoadComplete();
+
+    // The default allocator lets the streamer complete the read with a view.
+    ASSERT_NE(nullptr, m_allocator);
+    EXPECT_TRUE(m_allocator->AcceptsMappedViews());
+    EXPECT_FALSE(claimedMemory);
+
+    AZStd::vector<AZ::u8> outBuffer(assetSize, m_badBufferChar);
+    AZ::IO::SizeType bytesRead = assetDataStream.Read(outBuffer.size(), outBuffer.data());
+    EXPECT_EQ(assetSize, bytesRead);
+    EXPECT_EQ(view, outBuffer);
+
+    assetDataStream.Close();
+}
+
 TEST_F(AssetDataStreamTest, IsOpen_OpenAndCloseStream_OnlyTrueWhileOpen)
 {
     // Pick an arbitrary buffer size
@@ -58,6 +58,14 @@ namespace AZ::Dom::Tests
             EXPECT_TRUE(result.IsSuccess());
             EXPECT_TRUE(Utils::DeepCompareIsEqual(result.GetValue(), m_dataset));
 
+            // Verify the batched application produces the same result and an inverse that restores the original
+            Value batchedResult = m_dataset;
+            Patch batchedInverse;
+            EXPECT_TRUE(info.m_forwardPatches.ApplyInPlaceBatched(batchedResult, &batchedInverse).IsSuccess());
+            EXPECT_TRUE(Utils::DeepCompareIsEqual(batchedResult, m_deltaDataset));
+            EXPECT_TRUE(batchedInverse.ApplyInPlaceBatched(batchedResult).IsSuccess());
+            EXPECT_TRUE(Utils::DeepCompareIsEqual(batchedResult, m_dataset));
+
             // Verify serialization of the patches
             auto VerifySerialization = [](const Patch& patch)
             {
@@ -580,4 +588,84 @@ namespace AZ::Dom::Tests
 
         EXPECT_FALSE(info.m_forwardPatches.ContainsNormalizedEntries());
     }
+
+    TEST_F(DomPatchTests, TestPatch_ApplyBatched_MatchesSequentialApplication)
+    {
+        Patch patch({
+            PatchOperation::ReplaceOperation(Path("/obj/foo"), Value(false)),
+            PatchOperation::AddOperation(Path("/obj/baz"), Value(42)),
+            PatchOperation::RemoveOperation(Path("/arr/1")),
+            PatchOperation::ReplaceOperation(Path("/arr/1"), Value(7)),
+            PatchOperation::AddOperation(Path("/arr/-"), Value(8)),
+            PatchOperation::CopyOperation(Path("/obj/arrCopy"), Path("/arr")),
+            PatchOperation::ReplaceOperation(Path("/arr/0"), Value(9)),
+            PatchOperation::MoveOperation(Path("/node/moved"), Path("/obj/bar")),
+            PatchOperation::ReplaceOperation(Path("/node/0"), Value(11)),
+            PatchOperation::TestOperation(Path("/obj/arrCopy/0"), Value(0)),
+        });
+
+        auto sequentialResult = patch.Apply(m_dataset);
+        ASSERT_TRUE(sequentialResult.IsSuccess());
+
+        Value batchedResult = m_dataset;
+        Patch inversePatch;
+        ASSERT_TRUE(patch.ApplyInPlaceBatched(batchedResult, &inversePatch).IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(batchedResult, sequentialResult.GetValue()));
+
+        // The copy must not be affected by changes made to its source later in the patch
+        EXPECT_EQ(0, batchedResult["obj"]["arrCopy"][0].GetInt64());
+        EXPECT_EQ(9, batchedResult["arr"][0].GetInt64());
+
+        // The original is shared with the patched value and must not be modified
+        EXPECT_TRUE(m_dataset["obj"]["foo"].GetBool());
+        EXPECT_EQ(5, m_dataset["arr"].ArraySize());
+
+        auto revertedResult = inversePatch.Apply(batchedResult);
+        ASSERT_TRUE(revertedResult.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(revertedResult.GetValue(), m_dataset));
+    }
+
+    TEST_F(DomPatchTests, TestPatch_ApplyBatched_HaltsOnFailure)
+    {
+        Patch patch({
+            PatchOperation::ReplaceOperation(Path("/obj/foo"), Value(false)),
+            PatchOperation::RemoveOperation(Path("/obj/missing")),
+            PatchOperation::ReplaceOperation(Path("/obj/bar"), Value(true)),
+        });
+
+        Value batchedResult = m_dataset;
+        Patch inversePatch;
+        EXPECT_FALSE(patch.ApplyInPlaceBatched(batchedResult, &inversePatch).IsSuccess());
+        EXPECT_FALSE(batchedResult["obj"]["foo"].GetBool());
+        EXPECT_FALSE(batchedResult["obj"]["bar"].GetBool());
+
+        // Only the operation that was applied is reverted
+        EXPECT_EQ(1, inversePatch.Size());
+        EXPECT_TRUE(inversePatch.ApplyInPlace(batchedResult).IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(batchedResult, m_dataset));
+    }
+
+    TEST_F(DomPatchTests, TestPatch_ApplyBatched_InvertsAppends)
+    {
+        Patch patch({
+            PatchOperation::AddOperation(Path("/node/-"), Value(42)),
+            PatchOperation::CopyOperation(Path("/arr/-"), Path("/obj/foo")),
+            PatchOperation::MoveOperation(Path("/arr/-"), Path("/arr/1")),
+            PatchOperation::MoveOperation(Path("/arr/-"), Path("/obj/bar")),
+        });
+
+        Value batchedResult = m_dataset;
+        Patch inversePatch;
+        ASSERT_TRUE(patch.ApplyInPlaceBatched(batchedResult, &inversePatch).IsSuccess());
+        EXPECT_EQ(42, batchedResult["node"][5].GetInt64());
+        EXPECT_EQ(7, batchedResult["arr"].ArraySize());
+
+        // Appends are resolved to the index the value ended up at, as "-" can't be removed or moved from
+        ASSERT_EQ(4, inversePatch.Size());
+        EXPECT_FALSE(inversePatch.ContainsNormalizedEntries());
+
+        auto revertedResult = inversePatch.Apply(batchedResult);
+        ASSERT_TRUE(revertedResult.IsSuccess());
+        EXPECT_TRUE(Utils::DeepCompareIsEqual(revertedResult.GetValue(), m_dataset));
+    }
 } // namespace AZ::Dom::Tests
@@ -174,6 +174,86 @@ namespace AZ::Dom::Benchmark
     }
     DOM_REGISTER_SERIALIZATION_BENCHMARK_MS(DomValueBenchmark, AzDomValueCopyAndMutate)
 
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueCopyAndPushBackLargeArray)(benchmark::State& state)
+    {
+        Value original(Type::Array);
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            original.ArrayPushBack(Value(i));
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Value copy = original;
+            copy.ArrayPushBack(Value(42));
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(copy), state);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(DomValueBenchmark, AzDomValueCopyAndPushBackLargeArray)
+        ->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueCopyAndPopBackLargeArray)(benchmark::State& state)
+    {
+        Value original(Type::Array);
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            original.ArrayPushBack(Value(i));
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Value copy = original;
+            copy.ArrayPopBack();
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(copy), state);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(DomValueBenchmark, AzDomValueCopyAndPopBackLargeArray)
+        ->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueRepeatedArrayInsert)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Value value(Type::Array);
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                value.ArrayInsert(value.ArrayEnd(), Value(i));
+            }
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(value), state);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(DomValueBenchmark, AzDomValueRepeatedArrayInsert)
+        ->Arg(1000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueRepeatedMemberInsert)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::Name> keys;
+        for (int64_t i = 0; i < state.range(0); ++i)
+        {
+            keys.emplace_back(AZStd::string::format("key%" PRId64, i));
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Value value(Type::Object);
+            for (const AZ::Name& key : keys)
+            {
+                value[key] = Value(true);
+            }
+            TakeAndDiscardWithoutTimingDtor(AZStd::move(value), state);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_REGISTER_F(DomValueBenchmark, AzDomValueRepeatedMemberInsert)
+        ->Arg(100)->Arg(1000)->Unit(benchmark::kMicrosecond);
+
     BENCHMARK_DEFINE_F(DomValueBenchmark, AzDomValueDeepCopy)(benchmark::State& state)
     {
         Value original = GenerateDomBenchmarkPayload(state.range(0), state.range(1));
@@ -381,4 +381,125 @@ namespace AZ::Dom::Tests
         EXPECT_EQ(&v1.GetNode(), &v2.GetNode());
         EXPECT_EQ(&v1["obj"].GetNode(), &v2["obj"].GetNode());
     }
+
+    TEST_F(DomValueTests, CopyOnWrite_ArrayResize)
+    {
+        Value v1(Type::Array);
+        for (int i = 0; i < 10; ++i)
+        {
+            v1.ArrayPushBack(Value(i));
+        }
+
+        Value v2 = v1;
+        v2.ArrayPushBack(Value(10));
+        EXPECT_EQ(10, v1.ArraySize());
+        ASSERT_EQ(11, v2.ArraySize());
+        EXPECT_EQ(10, v2[10].GetInt64());
+
+        v2 = v1;
+        v2.ArrayPopBack();
+        EXPECT_EQ(10, v1.ArraySize());
+        EXPECT_EQ(9, v2.ArraySize());
+
+        v2 = v1;
+        v2.ArrayErase(v2.MutableArrayBegin() + 2, v2.MutableArrayBegin() + 5);
+        ASSERT_EQ(7, v2.ArraySize());
+        EXPECT_EQ(1, v2[1].GetInt64());
+        EXPECT_EQ(5, v2[2].GetInt64());
+
+        v2 = v1;
+        v2.ArrayInsert(v2.ArrayBegin() + 1, Value(42));
+        ASSERT_EQ(11, v2.ArraySize());
+        EXPECT_EQ(0, v2[0].GetInt64());
+        EXPECT_EQ(42, v2[1].GetInt64());
+        EXPECT_EQ(1, v2[2].GetInt64());
+
+        v2 = v1;
+        v2.ClearArray();
+        EXPECT_TRUE(v2.IsArrayEmpty());
+
+        ASSERT_EQ(10, v1.ArraySize());
+        for (int i = 0; i < 10; ++i)
+        {
+            EXPECT_EQ(i, v1[i].GetInt64());
+        }
+    }
+
+    TEST_F(DomValueTests, ArrayInsert_RangeOfSameArray_InsertsCopies)
+    {
+        // Fill the array to its capacity, so inserting into it has to reallocate the storage the range points to
+        Value value(Type::Array);
+        for (int i = 0; i < 8; ++i)
+        {
+            value.ArrayPushBack(Value(AZStd::string::format("LongerThanShortStringOptimization%d", i), true));
+        }
+        ASSERT_EQ(value.ArraySize(), value.ArrayCapacity());
+
+        value.ArrayInsert(value.ArrayBegin() + 1, value.ArrayBegin() + 2, value.ArrayBegin() + 6);
+        const int expectedAfterInsert[] = { 0, 2, 3, 4, 5, 1, 2, 3, 4, 5, 6, 7 };
+        ASSERT_EQ(AZ_ARRAY_SIZE(expectedAfterInsert), value.ArraySize());
+        for (size_t i = 0; i < value.ArraySize(); ++i)
+        {
+            EXPECT_EQ(AZStd::string::format("LongerThanShortStringOptimization%d", expectedAfterInsert[i]), value[i].GetString());
+        }
+
+        value.ArrayInsertRange(value.ArrayEnd(), AZStd::span<Value>(&*value.MutableArrayBegin(), value.ArraySize()));
+        ASSERT_EQ(2 * AZ_ARRAY_SIZE(expectedAfterInsert), value.ArraySize());
+        for (size_t i = 0; i < value.ArraySize(); ++i)
+        {
+            EXPECT_EQ(
+                AZStd::string::format("LongerThanShortStringOptimization%d", expectedAfterInsert[i % AZ_ARRAY_SIZE(expectedAfterInsert)]),
+                value[i].GetString());
+        }
+    }
+
+    TEST_F(DomValueTests, CopyOnWrite_ObjectResize)
+    {
+        Value v1(Type::Object);
+        v1["foo"] = 1;
+        v1["bar"] = 2;
+        v1["baz"] = 3;
+
+        Value v2 = v1;
+        v2.AddMember("qux", Value(4));
+        EXPECT_EQ(3, v1.MemberCount());
+        ASSERT_EQ(4, v2.MemberCount());
+        EXPECT_EQ(4, v2["qux"].GetInt64());
+
+        v2 = v1;
+        v2.EraseMember("bar");
+        EXPECT_EQ(3, v1.MemberCount());
+        ASSERT_EQ(2, v2.MemberCount());
+        EXPECT_FALSE(v2.HasMember("bar"));
+        EXPECT_EQ(3, v2["baz"].GetInt64());
+
+        v2 = v1;
+        v2.RemoveAllMembers();
+        EXPECT_TRUE(v2.ObjectEmpty());
+
+        ASSERT_EQ(3, v1.MemberCount());
+        EXPECT_EQ(2, v1["bar"].GetInt64());
+    }
+
+    TEST_F(DomValueTests, CopyOnWrite_NodeResize)
+    {
+        Value v1;
+        v1.SetNode("TopLevel");
+        v1["attr"] = 5;
+        v1.ArrayPushBack(Value(1));
+        v1.ArrayPushBack(Value(2));
+
+        Value v2 = v1;
+        v2.ArrayPopBack();
+        EXPECT_EQ(2, v1.ArraySize());
+        EXPECT_EQ(1, v2.ArraySize());
+        EXPECT_EQ(AZ::Name("TopLevel"), v2.GetNodeName());
+        EXPECT_EQ(5, v2["attr"].GetInt64());
+
+        v2 = v1;
+        v2.RemoveAllMembers();
+        EXPECT_EQ(1, v1.MemberCount());
+        EXPECT_TRUE(v2.ObjectEmpty());
+        EXPECT_EQ(2, v2.ArraySize());
+    }
 } // namespace AZ::Dom::Tests
@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool dispatchSnapshot = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -53,6 +53,7 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static const bool EnableDispatchSnapshot = dispatchSnapshot;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
@@ -193,13 +194,17 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool dispatchSnapshot = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, dispatchSnapshot>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
     namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
 
+#define EBUS_TEST_SNAPSHOT_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                                 \
+    using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy, false, true>;   \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
 // Predefined benchmark bus instantiations
 // Single
 EBUS_TEST_ALIAS(OneToOne, Single, Single)
@@ -213,6 +218,10 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// Dispatch snapshot
+EBUS_TEST_SNAPSHOT_ALIAS(OneToManySnapshot, Single, Multiple)
+EBUS_TEST_SNAPSHOT_ALIAS(ManyToManySnapshot, ById, Multiple)
+EBUS_TEST_SNAPSHOT_ALIAS(ManyOrderedToManyOrderedSnapshot, ByIdAndOrdered, MultipleAndOrdered)
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -362,11 +371,13 @@ namespace UnitTest
 {
     using BusTypesId = ::testing::Types<
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
     using BusTypesAll = ::testing::Types<
         OneToOne,         OneToMany,         OneToManyOrdered,
         ManyToOne,        ManyToMany,        ManyToManyOrdered,
-        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToOne, ManyOrderedToMany, ManyOrderedToManyOrdered,
+        OneToManySnapshot, ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
 
     template <typename Bus>
     class EBusTestAll
@@ -564,7 +575,8 @@ namespace UnitTest
 
     using BusTypesIdMultiHandlers = ::testing::Types<
         ManyToMany, ManyToManyOrdered,
-        ManyOrderedToMany, ManyOrderedToManyOrdered>;
+        ManyOrderedToMany, ManyOrderedToManyOrdered,
+        ManyToManySnapshot, ManyOrderedToManyOrderedSnapshot>;
     template <typename Bus>
     class EBusTestIdMultiHandlers
         : public EBusTestAll<Bus>
@@ -2871,6 +2883,221 @@ namespace UnitTest
         }
     }
 
+    namespace DispatchSnapshotTest
+    {
+        class SnapshotEvents
+            : public AZ::EBusTraits
+        {
+        public:
+            using MutexType = AZStd::recursive_mutex;
+            static const bool EnableDispatchSnapshot = true;
+
+            virtual ~SnapshotEvents() = default;
+            virtual void OnEvent() = 0;
+        };
+
+        using SnapshotBus = AZ::EBus<SnapshotEvents>;
+
+        class SnapshotHandler
+            : public SnapshotBus::Handler
+        {
+        public:
+            static constexpr uint32_t AliveMarker = 0xA11BE;
+
+            SnapshotHandler(bool connect = true)
+            {
+                if (connect)
+                {
+                    BusConnect();
+                }
+            }
+
+            ~SnapshotHandler() override
+            {
+                BusDisconnect();
+                m_aliveMarker = 0;
+            }
+
+            void OnEvent() override
+            {
+                EXPECT_EQ(AliveMarker, m_aliveMarker) << "Handler called after it disconnected";
+                ++m_numOnEvent;
+                if (m_onEvent)
+                {
+                    m_onEvent();
+                }
+            }
+
+            AZStd::atomic_int m_numOnEvent{ 0 };
+            AZStd::function<void()> m_onEvent;
+            volatile uint32_t m_aliveMarker = AliveMarker;
+        };
+
+        class SnapshotRouter
+            : public SnapshotBus::Router
+        {
+        public:
+            void OnEvent() override
+            {
+                ++m_numOnEvent;
+            }
+
+            int m_numOnEvent = 0;
+        };
+    }
+
+    TEST_F(EBus, DispatchSnapshot_HandlerDisconnectsOtherHandlerDuringDispatch_OtherHandlerIsSkipped)
+    {
+        using namespace DispatchSnapshotTest;
+        SnapshotHandler first;
+        SnapshotHandler second;
+
+        // The first broadcast builds the snapshot, the second one goes through it
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, first.m_numOnEvent);
+        EXPECT_EQ(2, second.m_numOnEvent);
+
+        // Whichever handler is called first disconnects the other one
+        first.m_onEvent = [&second]() { second.BusDisconnect(); };
+        second.m_onEvent = [&first]() { first.BusDisconnect(); };
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(5, first.m_numOnEvent + second.m_numOnEvent);
+        EXPECT_NE(first.BusIsConnected(), second.BusIsConnected());
+    }
+
+    TEST_F(EBus, DispatchSnapshot_HandlerConnectedDuringDispatch_IsCalledByNextDispatch)
+    {
+        using namespace DispatchSnapshotTest;
+        SnapshotHandler connector;
+        SnapshotHandler late(false);
+
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        connector.m_onEvent = [&late]() { late.BusConnect(); };
+
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, connector.m_numOnEvent);
+        EXPECT_EQ(0, late.m_numOnEvent);
+
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(3, connector.m_numOnEvent);
+        EXPECT_EQ(1, late.m_numOnEvent);
+    }
+
+    TEST_F(EBus, DispatchSnapshot_RouterConnected_EventsAreRouted)
+    {
+        using namespace DispatchSnapshotTest;
+        SnapshotHandler handler;
+        SnapshotRouter router;
+
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+
+        router.BusRouterConnect();
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, router.m_numOnEvent);
+        EXPECT_EQ(4, handler.m_numOnEvent);
+
+        router.BusRouterDisconnect();
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        EXPECT_EQ(2, router.m_numOnEvent);
+        EXPECT_EQ(6, handler.m_numOnEvent);
+    }
+
+    TEST_F(EBus, DispatchSnapshot_BroadcastWhileOtherThreadsConnectAndDestroyHandlers_NeverCallsDestroyedHandlers)
+    {
+        using namespace DispatchSnapshotTest;
+        constexpr size_t dispatchThreadCount = 4;
+        constexpr size_t connectThreadCount = 2;
+        constexpr int cycleCount = 500;
+
+        SnapshotHandler permanentHandler;
+        AZStd::atomic_bool done{ false };
+
+        auto dispatch = [&done]()
+        {
+            while (!done)
+            {
+                SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+            }
+        };
+
+        auto connect = []()
+        {
+            for (int i = 0; i < cycleCount; ++i)
+            {
+                AZStd::unique_ptr<SnapshotHandler> handler = AZStd::make_unique<SnapshotHandler>();
+                if (i % 2)
+                {
+                    AZStd::this_thread::yield();
+                }
+            }
+        };
+
+        AZStd::thread dispatchThreads[dispatchThreadCount];
+        for (AZStd::thread& thread : dispatchThreads)
+        {
+            thread = AZStd::thread(dispatch);
+        }
+
+        AZStd::thread connectThreads[connectThreadCount];
+        for (AZStd::thread& thread : connectThreads)
+        {
+            thread = AZStd::thread(connect);
+        }
+
+        for (AZStd::thread& thread : connectThreads)
+        {
+            thread.join();
+        }
+
+        done = true;
+        for (AZStd::thread& thread : dispatchThreads)
+        {
+            thread.join();
+        }
+
+        EXPECT_LT(0, permanentHandler.m_numOnEvent);
+        EXPECT_EQ(1u, SnapshotBus::GetTotalNumOfEventHandlers());
+    }
+
+    TEST_F(EBus, DispatchSnapshot_HandlerConnectsWhileOtherThreadDisconnects_DoesNotDeadlock)
+    {
+        using namespace DispatchSnapshotTest;
+        SnapshotHandler dispatched;
+        SnapshotHandler late(false);
+        AZStd::unique_ptr<SnapshotHandler> disconnecting = AZStd::make_unique<SnapshotHandler>();
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+
+        // The disconnecting thread waits for the dispatch to finish, which needs the context mutex to connect a handler
+        AZStd::atomic_bool inDispatch{ false };
+        dispatched.m_onEvent = [&inDispatch, &late]()
+        {
+            if (!inDispatch.exchange(true))
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(50));
+                late.BusConnect();
+            }
+        };
+
+        AZStd::thread disconnectThread(
+            [&inDispatch, &disconnecting]()
+            {
+                while (!inDispatch)
+                {
+                    AZStd::this_thread::yield();
+                }
+                disconnecting.reset();
+            });
+        SnapshotBus::Broadcast(&SnapshotBus::Events::OnEvent);
+        disconnectThread.join();
+
+        EXPECT_TRUE(late.BusIsConnected());
+        EXPECT_EQ(2u, SnapshotBus::GetTotalNumOfEventHandlers());
+    }
+
     namespace MultithreadConnect
     {
         class MyEventGroup
@@ -4805,6 +5032,104 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Dispatch snapshot
+    //////////////////////////////////////////////////////////////////////////
+
+    namespace BenchmarkSettings
+    {
+        void ManyHandlers(::benchmark::internal::Benchmark* benchmark)
+        {
+            Common(benchmark);
+            benchmark
+                ->ArgNames({ { "Handlers" } })
+                ->Arg(10000)
+                ;
+        }
+    }
+
+    // Connects handlers to the single address of a bus for the lifetime of the object
+    template<typename Bus>
+    class BM_EBusConnectedHandlers
+    {
+    public:
+        using HandlerT = Handler<Bus>;
+
+        explicit BM_EBusConnectedHandlers(int64_t numHandlers)
+        {
+            constexpr bool connectOnConstruct{ false };
+            AZ::BetterPseudoRandom random;
+
+            m_handlers.reserve(static_cast<size_t>(numHandlers));
+            for (int64_t handler = 0; handler < numHandlers; ++handler)
+            {
+                int handlerOrder{};
+                random.GetRandom(handlerOrder);
+                m_handlers.emplace_back(HandlerT(0, handlerOrder, connectOnConstruct));
+            }
+
+            for (HandlerT& handler : m_handlers)
+            {
+                handler.Connect();
+            }
+        }
+
+        ~BM_EBusConnectedHandlers()
+        {
+            for (HandlerT& handler : m_handlers)
+            {
+                handler.Disconnect();
+            }
+        }
+
+    private:
+        std::vector<HandlerT> m_handlers;
+    };
+
+    template <typename Bus>
+    static void BM_EBus_BroadcastManyHandlers(::benchmark::State& state)
+    {
+        BM_EBusConnectedHandlers<Bus> handlers(state.range(0));
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnEvent);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_BroadcastManyHandlers, OneToMany)->Apply(&BenchmarkSettings::ManyHandlers);
+    BENCHMARK_TEMPLATE(BM_EBus_BroadcastManyHandlers, OneToManySnapshot)->Apply(&BenchmarkSettings::ManyHandlers);
+
+    template <typename Bus>
+    static void BM_EBus_Multithreaded_BroadcastManyHandlers(::benchmark::State& state)
+    {
+        AZStd::unique_ptr<BM_EBusConnectedHandlers<Bus>> handlers;
+        if (state.thread_index() == 0)
+        {
+            handlers = AZStd::make_unique<BM_EBusConnectedHandlers<Bus>>(state.range(0));
+        }
+
+        // Only measure the dispatch itself, the handlers are shared by all threads
+        auto visitHandler = [](typename Bus::InterfaceType* handler)
+        {
+            benchmark::DoNotOptimize(handler);
+        };
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(visitHandler);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+
+        if (state.thread_index() == 0)
+        {
+            handlers.reset();
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_BroadcastManyHandlers, OneToMany)
+        ->Apply(&BenchmarkSettings::ManyHandlers)->Apply(&BenchmarkSettings::Multithreaded)->UseRealTime();
+    BENCHMARK_TEMPLATE(BM_EBus_Multithreaded_BroadcastManyHandlers, OneToManySnapshot)
+        ->Apply(&BenchmarkSettings::ManyHandlers)->Apply(&BenchmarkSettings::Multithreaded)->UseRealTime();
 }
 
 #endif // HAVE_BENCHMARK
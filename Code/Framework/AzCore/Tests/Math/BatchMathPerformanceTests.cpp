@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Each benchmark pairs the per element functions with their batch version, over the same data
+    class BM_MathBatch
+        : public benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> unif(-100.0f, 100.0f);
+            std::uniform_real_distribution<float> unifUnit(-1.0f, 1.0f);
+            std::uniform_real_distribution<float> unifExtent(0.1f, 10.0f);
+
+            auto randomTransform = [&]()
+            {
+                const AZ::Quaternion rotation = AZ::Quaternion(unifUnit(rng), unifUnit(rng), unifUnit(rng), unifUnit(rng)).GetNormalized();
+                return AZ::Transform(AZ::Vector3(unif(rng), unif(rng), unif(rng)), rotation, 1.0f + unifUnit(rng) * 0.5f);
+            };
+
+            m_transform = randomTransform();
+            m_points.resize(ElementCount);
+            m_pointResults.resize(ElementCount);
+            m_transforms.resize(ElementCount);
+            m_otherTransforms.resize(ElementCount);
+            m_transformResults.resize(ElementCount);
+            m_aabbs.resize(ElementCount);
+            m_hitStarts.resize(ElementCount);
+            m_overlaps = AZStd::make_unique<bool[]>(ElementCount);
+            for (size_t index = 0; index < ElementCount; ++index)
+            {
+                m_points[index] = AZ::Vector3(unif(rng), unif(rng), unif(rng));
+                m_transforms[index] = randomTransform();
+                m_otherTransforms[index] = randomTransform();
+                m_aabbs[index] = AZ::Aabb::CreateCenterHalfExtents(
+                    AZ::Vector3(unif(rng), unif(rng), unif(rng)), AZ::Vector3(unifExtent(rng), unifExtent(rng), unifExtent(rng)));
+            }
+
+            m_frustum = AZ::Frustum(
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 1.f, 0.f), AZ::Vector3(0.f, -50.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, -1.f, 0.f), AZ::Vector3(0.f, 50.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.f, 0.f, 0.f), AZ::Vector3(-50.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.f, 0.f, 0.f), AZ::Vector3(50.f, 0.f, 0.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, -1.f), AZ::Vector3(0.f, 0.f, 50.f)),
+                AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.f, 0.f, 1.f), AZ::Vector3(0.f, 0.f, -50.f)));
+            m_rayStart = AZ::Vector3(-150.0f, 0.0f, 0.0f);
+            m_rayDirRCP = AZ::Vector3(1.0f, 0.1f, -0.05f).GetNormalized().GetReciprocal();
+        }
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        static constexpr size_t ElementCount = 1000;
+
+        AZ::Transform m_transform;
+        AZStd::vector<AZ::Vector3> m_points;
+        AZStd::vector<AZ::Vector3> m_pointResults;
+        AZStd::vector<AZ::Transform> m_transforms;
+        AZStd::vector<AZ::Transform> m_otherTransforms;
+        AZStd::vector<AZ::Transform> m_transformResults;
+        AZStd::vector<AZ::Aabb> m_aabbs;
+        AZStd::vector<float> m_hitStarts;
+        AZStd::unique_ptr<bool[]> m_overlaps;
+        AZ::Frustum m_frustum;
+        AZ::Vector3 m_rayStart;
+        AZ::Vector3 m_rayDirRCP;
+    };
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < ElementCount; ++index)
+            {
+                m_pointResults[index] = m_transform.TransformPoint(m_points[index]);
+            }
+            benchmark::DoNotOptimize(m_pointResults.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, TransformPoints_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform, m_points, m_pointResults);
+            benchmark::DoNotOptimize(m_pointResults.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransforms_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < ElementCount; ++index)
+            {
+                m_transformResults[index] = m_transforms[index] * m_otherTransforms[index];
+            }
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, MultiplyTransforms_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::BatchMath::MultiplyTransforms(m_transforms, m_otherTransforms, m_transformResults);
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, MergeAabbs_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Aabb merged = AZ::Aabb::CreateNull();
+            for (const AZ::Aabb& aabb : m_aabbs)
+            {
+                merged.AddAabb(aabb);
+            }
+            benchmark::DoNotOptimize(merged);
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, MergeAabbs_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::Aabb merged = AZ::BatchMath::MergeAabbs(m_aabbs);
+            benchmark::DoNotOptimize(merged);
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustum_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < ElementCount; ++index)
+            {
+                m_overlaps[index] = AZ::ShapeIntersection::Overlaps(m_frustum, m_aabbs[index]);
+            }
+            benchmark::DoNotOptimize(m_overlaps.get());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, OverlapsFrustum_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::BatchMath::OverlapsFrustum(m_frustum, m_aabbs, AZStd::span<bool>(m_overlaps.get(), ElementCount));
+            benchmark::DoNotOptimize(m_overlaps.get());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectRayAabbs_PerElement)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (size_t index = 0; index < ElementCount; ++index)
+            {
+                float start = 0.0f;
+                float end = 0.0f;
+                const bool hit = AZ::Intersect::IntersectRayAABB2(m_rayStart, m_rayDirRCP, m_aabbs[index], start, end) ==
+                    AZ::Intersect::ISECT_RAY_AABB_ISECT;
+                m_hitStarts[index] = hit ? start : AZ::Constants::FloatMax;
+            }
+            benchmark::DoNotOptimize(m_hitStarts.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+
+    BENCHMARK_F(BM_MathBatch, IntersectRayAabbs_Batch)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::BatchMath::IntersectRayAabbs(m_rayStart, m_rayDirRCP, m_aabbs, m_hitStarts);
+            benchmark::DoNotOptimize(m_hitStarts.data());
+        }
+        state.SetItemsProcessed(state.iterations() * ElementCount);
+    }
+} // namespace Benchmark
+
+#endif
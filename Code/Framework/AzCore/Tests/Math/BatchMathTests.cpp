@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <random>
+
+namespace UnitTest
+{
+    class MATH_BatchMath
+        : public LeakDetectionFixture
+    {
+    protected:
+        // Sizes covering empty spans, partial batches and several full batches
+        static constexpr size_t Sizes[] = { 0, 1, 3, 4, 5, 8, 17, 100 };
+
+        AZ::Vector3 RandomVector3(float min, float max)
+        {
+            std::uniform_real_distribution<float> unif(min, max);
+            return AZ::Vector3(unif(m_rng), unif(m_rng), unif(m_rng));
+        }
+
+        AZ::Transform RandomTransform()
+        {
+            std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+            std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+            const AZ::Quaternion rotation = AZ::Quaternion(unif(m_rng), unif(m_rng), unif(m_rng), unif(m_rng)).GetNormalized();
+            return AZ::Transform(RandomVector3(-100.0f, 100.0f), rotation, scale(m_rng));
+        }
+
+        AZ::Aabb RandomAabb()
+        {
+            return AZ::Aabb::CreateCenterHalfExtents(RandomVector3(-20.0f, 20.0f), RandomVector3(0.1f, 5.0f));
+        }
+
+        std::mt19937_64 m_rng{ 1 };
+    };
+
+    TEST_F(MATH_BatchMath, TransformPoints_MatchesTransformPoint)
+    {
+        const AZ::Transform transform = RandomTransform();
+        for (size_t size : Sizes)
+        {
+            AZStd::vector<AZ::Vector3> points(size);
+            for (AZ::Vector3& point : points)
+            {
+                point = RandomVector3(-100.0f, 100.0f);
+            }
+
+            AZStd::vector<AZ::Vector3> results(size);
+            AZ::BatchMath::TransformPoints(transform, points, results);
+            for (size_t index = 0; index < size; ++index)
+            {
+                EXPECT_THAT(results[index], IsCloseTolerance(transform.TransformPoint(points[index]), 1e-3f));
+            }
+
+            // In place
+            AZ::BatchMath::TransformPoints(transform, points, points);
+            for (size_t index = 0; index < size; ++index)
+            {
+                EXPECT_THAT(points[index], IsClose(results[index]));
+            }
+        }
+    }
+
+    TEST_F(MATH_BatchMath, MultiplyTransforms_MatchesTransformMultiply)
+    {
+        for (size_t size : Sizes)
+        {
+            AZStd::vector<AZ::Transform> lhs(size);
+            AZStd::vector<AZ::Transform> rhs(size);
+            for (size_t index = 0; index < size; ++index)
+            {
+                lhs[index] = RandomTransform();
+                rhs[index] = RandomTransform();
+            }
+
+            AZStd::vector<AZ::Transform> results(size);
+            AZ::BatchMath::MultiplyTransforms(lhs, rhs, results);
+            for (size_t index = 0; index < size; ++index)
+            {
+                const AZ::Transform expected = lhs[index] * rhs[index];
+                EXPECT_THAT(results[index].GetRotation(), IsClose(expected.GetRotation()));
+                EXPECT_NEAR(results[index].GetUniformScale(), expected.GetUniformScale(), 1e-5f);
+                EXPECT_THAT(results[index].GetTranslation(), IsCloseTolerance(expected.GetTranslation(), 1e-3f));
+            }
+
+            // In place
+            AZ::BatchMath::MultiplyTransforms(lhs, rhs, lhs);
+            for (size_t index = 0; index < size; ++index)
+            {
+                EXPECT_THAT(lhs[index], IsClose(results[index]));
+            }
+        }
+    }
+
+    TEST_F(MATH_BatchMath, MergeAabbs_MatchesAddAabb)
+    {
+        EXPECT_FALSE(AZ::BatchMath::MergeAabbs({}).IsValid());
+
+        for (size_t size : Sizes)
+        {
+            AZStd::vector<AZ::Aabb> aabbs(size);
+            AZ::Aabb expected = AZ::Aabb::CreateNull();
+            for (AZ::Aabb& aabb : aabbs)
+            {
+                aabb = RandomAabb();
+                expected.AddAabb(aabb);
+            }
+
+            const AZ::Aabb merged = AZ::BatchMath::MergeAabbs(aabbs);
+            EXPECT_EQ(expected.IsValid(), merged.IsValid());
+            if (expected.IsValid())
+            {
+                EXPECT_THAT(merged.GetMin(), IsClose(expected.GetMin()));
+                EXPECT_THAT(merged.GetMax(), IsClose(expected.GetMax()));
+            }
+        }
+    }
+
+    TEST_F(MATH_BatchMath, OverlapsFrustum_MatchesShapeIntersectionOverlaps)
+    {
+        // Tilted planes around a 20 units box, so Aabbs are on both sides of every plane
+        const AZ::Frustum frustum(
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.1f, 1.0f, 0.0f).GetNormalized(), AZ::Vector3(0.0f, -10.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, -1.0f, 0.2f).GetNormalized(), AZ::Vector3(0.0f, 10.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.0f, 0.3f, 0.0f).GetNormalized(), AZ::Vector3(-10.0f, 0.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.0f, 0.0f, 0.1f).GetNormalized(), AZ::Vector3(10.0f, 0.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 0.2f, -1.0f).GetNormalized(), AZ::Vector3(0.0f, 0.0f, 10.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.1f, 0.0f, 1.0f).GetNormalized(), AZ::Vector3(0.0f, 0.0f, -10.0f)));
+
+        size_t overlapCount = 0;
+        size_t totalCount = 0;
+        for (size_t size : Sizes)
+        {
+            AZStd::vector<AZ::Aabb> aabbs(size);
+            for (AZ::Aabb& aabb : aabbs)
+            {
+                aabb = RandomAabb();
+            }
+
+            AZStd::unique_ptr<bool[]> resultValues = AZStd::make_unique<bool[]>(size);
+            AZ::BatchMath::OverlapsFrustum(frustum, aabbs, AZStd::span<bool>(resultValues.get(), size));
+            for (size_t index = 0; index < size; ++index)
+            {
+                const bool expected = AZ::ShapeIntersection::Overlaps(frustum, aabbs[index]);
+                EXPECT_EQ(expected, resultValues[index]);
+                overlapCount += expected ? 1 : 0;
+                ++totalCount;
+            }
+        }
+
+        // Some Aabbs are inside and some outside
+        EXPECT_GT(overlapCount, 0);
+        EXPECT_LT(overlapCount, totalCount);
+    }
+
+    TEST_F(MATH_BatchMath, IntersectRayAabbs_MatchesIntersectRayAABB2)
+    {
+        const AZ::Vector3 rayStart(-30.0f, 1.0f, -2.0f);
+        const AZ::Vector3 rayDirection = AZ::Vector3(1.0f, -0.05f, 0.1f).GetNormalized();
+        const AZ::Vector3 dirRCP = rayDirection.GetReciprocal();
+
+        size_t hitCount = 0;
+        size_t totalCount = 0;
+        for (size_t size : Sizes)
+        {
+            AZStd::vector<AZ::Aabb> aabbs(size);
+            for (AZ::Aabb& aabb : aabbs)
+            {
+                aabb = RandomAabb();
+            }
+
+            AZStd::vector<float> hitStarts(size);
+            AZ::BatchMath::IntersectRayAabbs(rayStart, dirRCP, aabbs, hitStarts);
+            for (size_t index = 0; index < size; ++index)
+            {
+                float start = 0.0f;
+                float end = 0.0f;
+                if (AZ::Intersect::IntersectRayAABB2(rayStart, dirRCP, aabbs[index], start, end) == AZ::Intersect::ISECT_RAY_AABB_ISECT)
+                {
+                    EXPECT_NEAR(start, hitStarts[index], 1e-3f);
+                    ++hitCount;
+                }
+                else
+                {
+                    EXPECT_EQ(AZ::Constants::FloatMax, hitStarts[index]);
+                }
+                ++totalCount;
+            }
+        }
+
+        EXPECT_GT(hitCount, 0);
+        EXPECT_LT(hitCount, totalCount);
+    }
+
+    TEST_F(MATH_BatchMath, CpuFeatureKernels_MatchBaselineKernels)
+    {
+        // The other tests use the kernels selected for the CPU, this compares them against the compile time baseline ones
+        const AZ::Transform transform = RandomTransform();
+        const AZ::Frustum frustum(
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 1.0f, 0.0f), AZ::Vector3(0.0f, -10.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, -1.0f, 0.0f), AZ::Vector3(0.0f, 10.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(-10.0f, 0.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(-1.0f, 0.0f, 0.0f), AZ::Vector3(10.0f, 0.0f, 0.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 0.0f, -1.0f), AZ::Vector3(0.0f, 0.0f, 10.0f)),
+            AZ::Plane::CreateFromNormalAndPoint(AZ::Vector3(0.0f, 0.0f, 1.0f), AZ::Vector3(0.0f, 0.0f, -10.0f)));
+        const AZ::Vector3 rayStart(-30.0f, 1.0f, -2.0f);
+        const AZ::Vector3 dirRCP = AZ::Vector3(1.0f, -0.05f, 0.1f).GetNormalized().GetReciprocal();
+
+        for (size_t size : Sizes)
+        {
+            AZStd::vector<AZ::Vector3> points(size);
+            AZStd::vector<AZ::Aabb> aabbs(size);
+            for (size_t index = 0; index < size; ++index)
+            {
+                points[index] = RandomVector3(-100.0f, 100.0f);
+                aabbs[index] = RandomAabb();
+            }
+
+            AZStd::vector<AZ::Vector3> transformedPoints[2] = { AZStd::vector<AZ::Vector3>(size), AZStd::vector<AZ::Vector3>(size) };
+            AZStd::unique_ptr<bool[]> overlaps[2] = { AZStd::make_unique<bool[]>(size), AZStd::make_unique<bool[]>(size) };
+            AZStd::vector<float> hitStarts[2] = { AZStd::vector<float>(size), AZStd::vector<float>(size) };
+            for (int pass = 0; pass < 2; ++pass)
+            {
+                AZ::Simd::SetDisabledCpuFeatures(pass == 0 ? AZ::Simd::CpuFeatures::None : ~AZ::Simd::CpuFeatures::None);
+                AZ::BatchMath::TransformPoints(transform, points, transformedPoints[pass]);
+                AZ::BatchMath::OverlapsFrustum(frustum, aabbs, AZStd::span<bool>(overlaps[pass].get(), size));
+                AZ::BatchMath::IntersectRayAabbs(rayStart, dirRCP, aabbs, hitStarts[pass]);
+            }
+            AZ::Simd::SetDisabledCpuFeatures(AZ::Simd::CpuFeatures::None);
+
+            for (size_t index = 0; index < size; ++index)
+            {
+                EXPECT_THAT(transformedPoints[0][index], IsCloseTolerance(transformedPoints[1][index], 1e-3f));
+                EXPECT_EQ(overlaps[1][index], overlaps[0][index]);
+                EXPECT_NEAR(hitStarts[1][index], hitStarts[0][index], 1e-3f);
+            }
+        }
+    }
+} // namespace UnitTest
@@ -7,7 +7,9 @@
  */
 
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 
@@ -118,4 +120,45 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x4727dc92), constEvalIntValue);
     }
 
+    TEST_F(Crc32Fixture, LargeData_MatchesCompileTimeValue)
+    {
+        // Large enough for the carry-less multiplication path, which is only used at runtime
+        constexpr auto CreateData = []() constexpr
+        {
+            AZStd::array<uint8_t, 203> data{};
+            for (size_t index = 0; index < data.size(); ++index)
+            {
+                data[index] = static_cast<uint8_t>(index * 131 + 7);
+            }
+            return data;
+        };
+        constexpr AZStd::array<uint8_t, 203> Data = CreateData();
+        constexpr AZ::Crc32 CompileTimeCrc(Data.data(), Data.size());
+
+        const AZStd::vector<uint8_t> runtimeData(Data.begin(), Data.end());
+        EXPECT_EQ(CompileTimeCrc, AZ::Crc32(runtimeData.data(), runtimeData.size()));
+        EXPECT_EQ(CompileTimeCrc, AZ::Crc32(static_cast<const void*>(runtimeData.data()), runtimeData.size()));
+    }
+
+    TEST_F(Crc32Fixture, LargeData_MatchesWithoutCpuFeatures)
+    {
+        AZStd::vector<uint8_t> data(4096 + 3);
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            data[index] = static_cast<uint8_t>(index * 31 + 11);
+        }
+
+        for (size_t offset : { 0, 1, 3 })
+        {
+            for (size_t size : { 0, 15, 63, 64, 65, 79, 80, 127, 128, 129, 1000, 4096 })
+            {
+                const AZ::Crc32 crc(data.data() + offset, size);
+                AZ::Simd::SetDisabledCpuFeatures(AZ::Simd::CpuFeatures::Pclmul);
+                const AZ::Crc32 tableCrc(data.data() + offset, size);
+                AZ::Simd::SetDisabledCpuFeatures(AZ::Simd::CpuFeatures::None);
+                EXPECT_EQ(tableCrc, crc) << "offset " << offset << " size " << size;
+            }
+        }
+    }
+
 }
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/SimdCpuFeatures.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class MATH_Sha1
+        : public LeakDetectionFixture
+    {
+    protected:
+        using Digest = AZStd::array<AZ::u32, 5>;
+
+        //! Digest of @data, given to the Sha1 in chunks of @chunkSize bytes
+        static Digest GetDigest(AZStd::span<const AZStd::byte> data, size_t chunkSize)
+        {
+            AZ::Sha1 sha;
+            for (size_t index = 0; index < data.size(); index += chunkSize)
+            {
+                sha.ProcessBytes(data.subspan(index, AZStd::min(chunkSize, data.size() - index)));
+            }
+            AZ::u32 digest[5];
+            sha.GetDigest(digest);
+            return { digest[0], digest[1], digest[2], digest[3], digest[4] };
+        }
+
+        static Digest GetDigest(AZStd::string_view text)
+        {
+            return GetDigest(AZStd::as_bytes(AZStd::span(text.data(), text.size())), text.size() + 1);
+        }
+    };
+
+    TEST_F(MATH_Sha1, GetDigest_MatchesReferenceValues)
+    {
+        EXPECT_EQ((Digest{ 0xda39a3ee, 0x5e6b4b0d, 0x3255bfef, 0x95601890, 0xafd80709 }), GetDigest(""));
+        EXPECT_EQ((Digest{ 0xa9993e36, 0x4706816a, 0xba3e2571, 0x7850c26c, 0x9cd0d89d }), GetDigest("abc"));
+        EXPECT_EQ(
+            (Digest{ 0x84983e44, 0x1c3bd26e, 0xbaae4aa1, 0xf95129e5, 0xe54670f1 }),
+            GetDigest("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq"));
+
+        const AZStd::vector<AZStd::byte> millionA(1000000, AZStd::byte{ 'a' });
+        EXPECT_EQ((Digest{ 0x34aa973c, 0xd4c4daa4, 0xf61eeb2b, 0xdbad2731, 0x6534016f }), GetDigest(millionA, millionA.size()));
+    }
+
+    TEST_F(MATH_Sha1, GetDigest_IsConstexpr)
+    {
+        constexpr auto GetFirstDigestWord = []() constexpr
+        {
+            AZ::Sha1 sha;
+            const AZStd::string_view text = "abc";
+            for (char element : text)
+            {
+                sha.ProcessByte(AZStd::byte(element));
+            }
+            AZ::u32 digest[5]{};
+            sha.GetDigest(digest);
+            return digest[0];
+        };
+        static_assert(GetFirstDigestWord() == 0xa9993e36);
+    }
+
+    TEST_F(MATH_Sha1, ProcessBytes_MatchesWithoutCpuFeatures)
+    {
+        AZStd::vector<AZStd::byte> data(10000);
+        for (size_t index = 0; index < data.size(); ++index)
+        {
+            data[index] = AZStd::byte(index * 7 + 3);
+        }
+
+        for (size_t size : { 0, 1, 55, 56, 63, 64, 65, 128, 1000, 10000 })
+        {
+            // Chunks which are smaller than, not aligned with and larger than the 64 bytes blocks
+            for (size_t chunkSize : { 1, 7, 64, 100, 10000 })
+            {
+                const AZStd::span<const AZStd::byte> span(data.data(), size);
+                const Digest digest = GetDigest(span, chunkSize);
+                AZ::Simd::SetDisabledCpuFeatures(AZ::Simd::CpuFeatures::Sha);
+                const Digest scalarDigest = GetDigest(span, chunkSize);
+                AZ::Simd::SetDisabledCpuFeatures(AZ::Simd::CpuFeatures::None);
+                EXPECT_EQ(scalarDigest, digest) << "size " << size << " chunk size " << chunkSize;
+            }
+        }
+    }
+} // namespace UnitTest
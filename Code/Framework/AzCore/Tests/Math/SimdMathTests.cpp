@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Internal/MathTypes.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/SimdMathVec8.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 using namespace AZ;
@@ -3153,4 +3154,129 @@ namespace UnitTest
     {
         TestZeroVectorInt<Simd::Vec4>();
     }
+
+    TEST(MATH_SimdMath, SetDisabledCpuFeatures_RemovesFeatures)
+    {
+        const Simd::CpuFeatures features = Simd::GetCpuFeatures();
+        Simd::SetDisabledCpuFeatures(Simd::CpuFeatures::Avx2);
+        EXPECT_EQ(features & ~Simd::CpuFeatures::Avx2, Simd::GetCpuFeatures());
+        EXPECT_FALSE(Simd::HasCpuFeatures(Simd::CpuFeatures::Avx2));
+        EXPECT_TRUE(Simd::HasCpuFeatures(Simd::CpuFeatures::None));
+        Simd::SetDisabledCpuFeatures(Simd::CpuFeatures::None);
+        EXPECT_EQ(features, Simd::GetCpuFeatures());
+    }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_AVX
+    // The Vec8 functions can only be called from functions compiled for AVX2, so the results are computed by these helpers
+    // and checked by the tests after they return.
+    AZ_SIMD_TARGET_AVX2 static void ComputeVec8FloatOperations(const float* arg1, const float* arg2, float (&results)[8][8])
+    {
+        const Simd::Vec8::FloatType a = Simd::Vec8::LoadUnaligned(arg1);
+        const Simd::Vec8::FloatType b = Simd::Vec8::LoadUnaligned(arg2);
+        Simd::Vec8::StoreUnaligned(results[0], Simd::Vec8::Add(a, b));
+        Simd::Vec8::StoreUnaligned(results[1], Simd::Vec8::Sub(a, b));
+        Simd::Vec8::StoreUnaligned(results[2], Simd::Vec8::Mul(a, b));
+        Simd::Vec8::StoreUnaligned(results[3], Simd::Vec8::Madd(a, b, Simd::Vec8::Splat(1.0f)));
+        Simd::Vec8::StoreUnaligned(results[4], Simd::Vec8::Min(a, b));
+        Simd::Vec8::StoreUnaligned(results[5], Simd::Vec8::Select(a, b, Simd::Vec8::CmpGt(a, b)));
+        Simd::Vec8::StoreUnaligned(results[6], Simd::Vec8::Floor(a));
+        Simd::Vec8::StoreUnaligned(results[7], Simd::Vec8::Abs(b));
+    }
+
+    AZ_SIMD_TARGET_AVX2 static void ComputeVec8IntOperations(const int32_t* arg1, const int32_t* arg2, int32_t (&results)[4][8])
+    {
+        const Simd::Vec8::Int32Type a = Simd::Vec8::LoadUnaligned(arg1);
+        const Simd::Vec8::Int32Type b = Simd::Vec8::LoadUnaligned(arg2);
+        Simd::Vec8::StoreUnaligned(results[0], Simd::Vec8::Add(a, b));
+        Simd::Vec8::StoreUnaligned(results[1], Simd::Vec8::Mul(a, b));
+        Simd::Vec8::StoreUnaligned(results[2], Simd::Vec8::Max(a, b));
+        Simd::Vec8::StoreUnaligned(results[3], Simd::Vec8::ConvertToInt(Simd::Vec8::ConvertToFloat(a)));
+    }
+
+    AZ_SIMD_TARGET_AVX2 static void ComputeVec8Transpose(const float (&vectors)[8][4], float (&results)[4][8])
+    {
+        Simd::Vec8::FloatType rows[4];
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            rows[i] = Simd::Vec8::FromVec4(Simd::Vec4::LoadUnaligned(vectors[i]), Simd::Vec4::LoadUnaligned(vectors[i + 4]));
+        }
+        Simd::Vec8::FloatType columns[4];
+        Simd::Vec8::Transpose4x4Halves(rows, columns);
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            Simd::Vec8::StoreUnaligned(results[i], columns[i]);
+        }
+    }
+
+    class MATH_SimdMathVec8
+        : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!Simd::HasCpuFeatures(Simd::Vec8::RequiredCpuFeatures))
+            {
+                GTEST_SKIP() << "The CPU does not support the Vec8 instructions";
+            }
+        }
+    };
+
+    TEST_F(MATH_SimdMathVec8, FloatOperations_MatchScalarResults)
+    {
+        const float arg1[8] = { 1.5f, -2.25f, 3.0f, -4.75f, 5.5f, 0.0f, -7.5f, 8.25f };
+        const float arg2[8] = { 2.0f, -3.0f, 1.0f, 4.5f, -5.0f, 6.0f, -7.5f, 0.5f };
+        float results[8][8];
+        ComputeVec8FloatOperations(arg1, arg2, results);
+
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_FLOAT_EQ(arg1[i] + arg2[i], results[0][i]);
+            EXPECT_FLOAT_EQ(arg1[i] - arg2[i], results[1][i]);
+            EXPECT_FLOAT_EQ(arg1[i] * arg2[i], results[2][i]);
+            EXPECT_FLOAT_EQ(arg1[i] * arg2[i] + 1.0f, results[3][i]);
+            EXPECT_FLOAT_EQ(AZStd::min(arg1[i], arg2[i]), results[4][i]);
+            EXPECT_FLOAT_EQ(AZStd::max(arg1[i], arg2[i]), results[5][i]);
+            EXPECT_FLOAT_EQ(floorf(arg1[i]), results[6][i]);
+            EXPECT_FLOAT_EQ(fabsf(arg2[i]), results[7][i]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, IntOperations_MatchScalarResults)
+    {
+        const int32_t arg1[8] = { 1, -2, 3, -4, 5, 0, -7, 8 };
+        const int32_t arg2[8] = { 2, -3, 1, 4, -5, 6, -7, 100 };
+        int32_t results[4][8];
+        ComputeVec8IntOperations(arg1, arg2, results);
+
+        for (int32_t i = 0; i < Simd::Vec8::ElementCount; ++i)
+        {
+            EXPECT_EQ(arg1[i] + arg2[i], results[0][i]);
+            EXPECT_EQ(arg1[i] * arg2[i], results[1][i]);
+            EXPECT_EQ(AZStd::max(arg1[i], arg2[i]), results[2][i]);
+            EXPECT_EQ(arg1[i], results[3][i]);
+        }
+    }
+
+    TEST_F(MATH_SimdMathVec8, Transpose4x4Halves_GivesComponentsOfAllVectors)
+    {
+        float vectors[8][4];
+        for (int32_t i = 0; i < 8; ++i)
+        {
+            for (int32_t j = 0; j < 4; ++j)
+            {
+                vectors[i][j] = static_cast<float>(i * 10 + j);
+            }
+        }
+        float results[4][8];
+        ComputeVec8Transpose(vectors, results);
+
+        for (int32_t component = 0; component < 4; ++component)
+        {
+            for (int32_t i = 0; i < 8; ++i)
+            {
+                EXPECT_EQ(vectors[i][component], results[component][i]);
+            }
+        }
+    }
+#endif // AZ_TRAIT_USE_PLATFORM_SIMD_AVX
 }
@@ -9,6 +9,7 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Memory/HphaAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Debug/StackTracer.h>
@@ -726,6 +727,236 @@ namespace UnitTest
         run();
     }
 
+    /**
+     * Tests FrameArenaAllocator
+     */
+    class FrameArenaAllocatorTest
+        : public MemoryTrackingFixture
+    {
+    public:
+        void SetUp() override
+        {
+            MemoryTrackingFixture::SetUp();
+            // Start from a frame without allocations or blocks
+            GetArena().ResetFrame();
+            GetArena().ResetFrame();
+            GetArena().GarbageCollect();
+        }
+
+        FrameArenaAllocator& GetArena()
+        {
+            return static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::Get());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_AlignedAndDistinct_MemoryReusedAfterNextFrame)
+    {
+        FrameArenaAllocator& arena = GetArena();
+
+        constexpr size_t allocationCount = 64;
+        AZStd::array<char*, allocationCount> addresses;
+        size_t allocatedBytes = 0;
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            const size_t size = 8 + i * 24;
+            const size_t alignment = size_t{ 1 } << (i % 8);
+            addresses[i] = static_cast<char*>(arena.allocate(size, alignment));
+            ASSERT_NE(nullptr, addresses[i]);
+            EXPECT_EQ(0, reinterpret_cast<uintptr_t>(addresses[i]) % alignment);
+            memset(addresses[i], static_cast<int>(i), size);
+            allocatedBytes += size;
+        }
+        EXPECT_EQ(allocatedBytes, arena.NumAllocatedBytes());
+
+        // No allocation overwrote another one
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            const size_t size = 8 + i * 24;
+            for (size_t j = 0; j < size; ++j)
+            {
+                ASSERT_EQ(static_cast<char>(i), addresses[i][j]);
+            }
+        }
+
+        // Deallocating doesn't free memory until the end of the frame
+        arena.deallocate(addresses[0], 8);
+        EXPECT_EQ(allocatedBytes, arena.NumAllocatedBytes());
+
+        const size_t reservedBytes = arena.GetReservedBytes();
+        EXPECT_GE(reservedBytes, allocatedBytes);
+
+        // The memory stays valid during the next frame
+        arena.ResetFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+        void* nextFrameAddress = arena.allocate(8, 1);
+        EXPECT_NE(addresses[0], nextFrameAddress);
+        const size_t nextFrameReservedBytes = arena.GetReservedBytes();
+        EXPECT_GT(nextFrameReservedBytes, reservedBytes);
+        for (size_t i = 0; i < allocationCount; ++i)
+        {
+            ASSERT_EQ(static_cast<char>(i), addresses[i][0]);
+        }
+
+        arena.ResetFrame();
+        void* reused = arena.allocate(8, 1);
+        EXPECT_EQ(addresses[0], reused);
+        EXPECT_EQ(nextFrameReservedBytes, arena.GetReservedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_LargerThanBlock_BlockFreedAfterNextFrame)
+    {
+        FrameArenaAllocator& arena = GetArena();
+
+        arena.allocate(16, 16);
+        EXPECT_EQ(FrameArenaAllocator::DefaultBlockSize, arena.GetReservedBytes());
+
+        void* large = arena.allocate(FrameArenaAllocator::DefaultBlockSize * 2, 16);
+        ASSERT_NE(nullptr, large);
+        memset(large, 0xcd, FrameArenaAllocator::DefaultBlockSize * 2);
+        const size_t largeBlockSize = arena.GetReservedBytes() - FrameArenaAllocator::DefaultBlockSize;
+        EXPECT_GE(largeBlockSize, FrameArenaAllocator::DefaultBlockSize * 2);
+
+        arena.ResetFrame();
+        arena.allocate(16, 16);
+        EXPECT_EQ(FrameArenaAllocator::DefaultBlockSize * 2 + largeBlockSize, arena.GetReservedBytes());
+
+        arena.ResetFrame();
+        arena.allocate(16, 16);
+        EXPECT_EQ(FrameArenaAllocator::DefaultBlockSize * 2, arena.GetReservedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reallocate_MostRecentAllocation_GrowsInPlace)
+    {
+        FrameArenaAllocator& arena = GetArena();
+
+        char* address = static_cast<char*>(arena.allocate(64, 16));
+        memset(address, 7, 64);
+        EXPECT_EQ(address, arena.reallocate(address, 256, 16));
+        EXPECT_EQ(256, arena.NumAllocatedBytes());
+
+        // Deallocating the most recent allocation rewinds it
+        arena.deallocate(address, 256);
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+        EXPECT_EQ(address, arena.allocate(32, 16));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Reallocate_OlderAllocation_CopiedToNewAllocation)
+    {
+        FrameArenaAllocator& arena = GetArena();
+
+        char* address = static_cast<char*>(arena.allocate(64, 16));
+        memset(address, 7, 64);
+        char* newerAddress = static_cast<char*>(arena.allocate(32, 16));
+        memset(newerAddress, 9, 32);
+
+        char* reallocated = static_cast<char*>(arena.reallocate(address, 128, 16));
+        ASSERT_NE(nullptr, reallocated);
+        EXPECT_NE(address, reallocated);
+        EXPECT_EQ(128, arena.get_allocated_size(reallocated));
+        for (size_t i = 0; i < 64; ++i)
+        {
+            ASSERT_EQ(7, reallocated[i]);
+        }
+        for (size_t i = 0; i < 32; ++i)
+        {
+            ASSERT_EQ(9, newerAddress[i]);
+        }
+        EXPECT_EQ(64 + 32 + 128, arena.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdContainer_AllocatesFromArena)
+    {
+        AZStd::vector<int, FrameArenaStdAllocator> values;
+        for (int i = 0; i < 10000; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_GE(GetArena().NumAllocatedBytes(), values.size() * sizeof(int));
+        for (int i = 0; i < 10000; ++i)
+        {
+            EXPECT_EQ(i, values[i]);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_MultipleThreads_UseSeparateMemory)
+    {
+        constexpr int threadCount = 4;
+        constexpr int allocationCount = 1000;
+        constexpr size_t allocationSize = 200;
+        AZStd::vector<char*> addresses[threadCount];
+
+        AZStd::thread threads[threadCount];
+        for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread(
+                [this, threadIndex, &addresses]()
+                {
+                    for (int i = 0; i < allocationCount; ++i)
+                    {
+                        char* address = static_cast<char*>(GetArena().allocate(allocationSize, 8));
+                        memset(address, threadIndex, allocationSize);
+                        addresses[threadIndex].push_back(address);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(threadCount * allocationCount * allocationSize, GetArena().NumAllocatedBytes());
+        for (int threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            for (char* address : addresses[threadIndex])
+            {
+                for (size_t i = 0; i < allocationSize; ++i)
+                {
+                    ASSERT_EQ(threadIndex, address[i]);
+                }
+            }
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_ThreadExited_NextThreadAdoptsItsBlocks)
+    {
+        constexpr size_t allocationSize = 1024;
+        char* exitedThreadAddress = nullptr;
+        AZStd::thread(
+            [this, &exitedThreadAddress]()
+            {
+                exitedThreadAddress = static_cast<char*>(GetArena().allocate(allocationSize, 8));
+                memset(exitedThreadAddress, 0xab, allocationSize);
+            }).join();
+        ASSERT_NE(nullptr, exitedThreadAddress);
+        const size_t reservedBytes = GetArena().GetReservedBytes();
+
+        // Threads allocating one after another reuse the blocks of the threads that exited
+        for (int i = 0; i < 8; ++i)
+        {
+            AZStd::thread(
+                [this]()
+                {
+                    EXPECT_NE(nullptr, GetArena().allocate(allocationSize, 8));
+                }).join();
+        }
+        EXPECT_EQ(reservedBytes, GetArena().GetReservedBytes());
+        EXPECT_EQ(9 * allocationSize, GetArena().NumAllocatedBytes());
+
+        // Memory allocated by a thread that exited stays valid until the end of the frame
+        for (size_t i = 0; i < allocationSize; ++i)
+        {
+            ASSERT_EQ(static_cast<char>(0xab), exitedThreadAddress[i]);
+        }
+
+        // Once the next frame ended too, the blocks of the threads that exited are freed by garbage collection
+        GetArena().ResetFrame();
+        GetArena().GarbageCollect();
+        EXPECT_EQ(reservedBytes, GetArena().GetReservedBytes());
+        GetArena().ResetFrame();
+        GetArena().GarbageCollect();
+        EXPECT_EQ(0, GetArena().GetReservedBytes());
+    }
+
     /**
      * Tests azmalloc,azmallocex/azfree.
      */
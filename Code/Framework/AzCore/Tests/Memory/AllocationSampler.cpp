@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Metrics/IEventLogger.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace UnitTest
+{
+    //! Event logger which keeps the names and liveBytes args of the recorded events
+    class AllocationSamplerTestEventLogger
+        : public AZ::Metrics::IEventLogger
+    {
+    public:
+        struct RecordedEvent
+        {
+            AZStd::string m_name;
+            AZ::u64 m_liveBytes = 0;
+            size_t m_stackFrameCount = 0;
+        };
+
+        void Flush() override {}
+        ResultOutcome RecordDurationEventBegin(const AZ::Metrics::DurationArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordDurationEventEnd(const AZ::Metrics::DurationArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordCompleteEvent(const AZ::Metrics::CompleteArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordInstantEvent(const AZ::Metrics::InstantArgs& args) override
+        {
+            Record(args);
+            return AZ::Success();
+        }
+        ResultOutcome RecordCounterEvent(const AZ::Metrics::CounterArgs& args) override
+        {
+            Record(args);
+            return AZ::Success();
+        }
+        ResultOutcome RecordAsyncEventStart(const AZ::Metrics::AsyncArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordAsyncEventInstant(const AZ::Metrics::AsyncArgs&) override { return AZ::Success(); }
+        ResultOutcome RecordAsyncEventEnd(const AZ::Metrics::AsyncArgs&) override { return AZ::Success(); }
+
+        AZStd::vector<RecordedEvent> m_events;
+
+    private:
+        void Record(const AZ::Metrics::EventArgs& args)
+        {
+            RecordedEvent& recordedEvent = m_events.emplace_back();
+            recordedEvent.m_name = args.m_name;
+            for (const AZ::Metrics::EventField& field : args.m_args)
+            {
+                if (field.m_name == "liveBytes")
+                {
+                    recordedEvent.m_liveBytes = AZStd::get<AZ::u64>(field.m_value.m_value);
+                }
+                else if (field.m_name == "stack")
+                {
+                    recordedEvent.m_stackFrameCount = AZStd::get<AZ::Metrics::EventArray>(field.m_value.m_value).GetArrayValues().size();
+                }
+            }
+        }
+    };
+
+    class AllocationSamplerTest
+        : public LeakDetectionFixture
+    {
+    protected:
+        // Addresses are never dereferenced, they only need to be distinct and aligned like real allocations
+        static void* FakeAddress(size_t index)
+        {
+            return reinterpret_cast<void*>(0x10000 + index * 16);
+        }
+
+        AZ::Debug::AllocationSampler m_sampler;
+    };
+
+    TEST_F(AllocationSamplerTest, Stopped_AllocationsAreNotSampled)
+    {
+        EXPECT_FALSE(m_sampler.IsActive());
+        for (size_t index = 0; index < 1000; ++index)
+        {
+            m_sampler.OnAllocation(FakeAddress(index), 1024);
+        }
+        EXPECT_EQ(0, m_sampler.GetLiveBytes());
+        EXPECT_TRUE(m_sampler.GetCallSites().empty());
+    }
+
+    TEST_F(AllocationSamplerTest, SamplingIntervalOfOneByte_EveryAllocationIsSampledWithItsSize)
+    {
+        m_sampler.Start(1);
+        constexpr size_t AllocationCount = 100;
+        for (size_t index = 0; index < AllocationCount; ++index)
+        {
+            m_sampler.OnAllocation(FakeAddress(index), 64);
+        }
+        EXPECT_EQ(AllocationCount * 64, m_sampler.GetLiveBytes());
+
+        const AZ::Debug::AllocationSampler::CallSiteVector callSites = m_sampler.GetCallSites();
+        ASSERT_FALSE(callSites.empty());
+        size_t liveSamples = 0;
+        for (const AZ::Debug::AllocationSampler::CallSite& callSite : callSites)
+        {
+            liveSamples += callSite.m_liveSamples;
+            EXPECT_EQ(callSite.m_liveSamples, callSite.m_totalSamples);
+        }
+        EXPECT_EQ(AllocationCount, liveSamples);
+        m_sampler.Stop();
+    }
+
+    TEST_F(AllocationSamplerTest, Deallocate_RemovesLiveBytes)
+    {
+        m_sampler.Start(1);
+        constexpr size_t AllocationCount = 100;
+        for (size_t index = 0; index < AllocationCount; ++index)
+        {
+            m_sampler.OnAllocation(FakeAddress(index), 32);
+        }
+        for (size_t index = 0; index < AllocationCount; index += 2)
+        {
+            m_sampler.OnDeallocation(FakeAddress(index));
+        }
+        EXPECT_EQ(AllocationCount / 2 * 32, m_sampler.GetLiveBytes());
+
+        for (size_t index = 1; index < AllocationCount; index += 2)
+        {
+            m_sampler.OnDeallocation(FakeAddress(index));
+        }
+        EXPECT_EQ(0, m_sampler.GetLiveBytes());
+        EXPECT_TRUE(m_sampler.GetCallSites().empty());
+
+        // Deallocating addresses that were never sampled is ignored
+        m_sampler.OnDeallocation(FakeAddress(AllocationCount + 1));
+        EXPECT_EQ(0, m_sampler.GetLiveBytes());
+        m_sampler.Stop();
+    }
+
+    TEST_F(AllocationSamplerTest, LargeSamplingInterval_EstimatesLiveBytes)
+    {
+        constexpr size_t SamplingInterval = 4 * 1024;
+        m_sampler.Start(SamplingInterval);
+
+        // About 12800 samples, the estimate stays within a few percent of the live bytes
+        constexpr size_t AllocationCount = 200000;
+        constexpr size_t AllocationSize = 256;
+        for (size_t index = 0; index < AllocationCount; ++index)
+        {
+            m_sampler.OnAllocation(FakeAddress(index), AllocationSize);
+        }
+        const double expectedLiveBytes = static_cast<double>(AllocationCount * AllocationSize);
+        EXPECT_NEAR(expectedLiveBytes, static_cast<double>(m_sampler.GetLiveBytes()), expectedLiveBytes * 0.1);
+
+        for (size_t index = 0; index < AllocationCount; ++index)
+        {
+            m_sampler.OnDeallocation(FakeAddress(index));
+        }
+        EXPECT_EQ(0, m_sampler.GetLiveBytes());
+        m_sampler.Stop();
+    }
+
+    TEST_F(AllocationSamplerTest, Stop_DiscardsSamples)
+    {
+        m_sampler.Start(1);
+        m_sampler.OnAllocation(FakeAddress(0), 128);
+        EXPECT_EQ(128, m_sampler.GetLiveBytes());
+
+        m_sampler.Stop();
+        EXPECT_FALSE(m_sampler.IsActive());
+        EXPECT_EQ(0, m_sampler.GetLiveBytes());
+        m_sampler.OnDeallocation(FakeAddress(0));
+        EXPECT_EQ(0, m_sampler.GetLiveBytes());
+    }
+
+    TEST_F(AllocationSamplerTest, ReportCallSites_RecordsCallSitesAndTotal)
+    {
+        m_sampler.Start(1);
+        for (size_t index = 0; index < 10; ++index)
+        {
+            m_sampler.OnAllocation(FakeAddress(index), 100);
+        }
+
+        AllocationSamplerTestEventLogger eventLogger;
+        m_sampler.ReportCallSites(eventLogger);
+        m_sampler.Stop();
+
+        ASSERT_GE(eventLogger.m_events.size(), 2);
+        AZ::u64 callSiteLiveBytes = 0;
+        for (size_t index = 0; index + 1 < eventLogger.m_events.size(); ++index)
+        {
+            EXPECT_EQ("SampledCallSite", eventLogger.m_events[index].m_name);
+            callSiteLiveBytes += eventLogger.m_events[index].m_liveBytes;
+        }
+        EXPECT_EQ(1000, callSiteLiveBytes);
+        EXPECT_EQ("SampledLiveBytes", eventLogger.m_events.back().m_name);
+        EXPECT_EQ(1000, eventLogger.m_events.back().m_liveBytes);
+    }
+
+    TEST_F(AllocationSamplerTest, SystemAllocator_SamplesItsAllocations)
+    {
+        auto& systemAllocator = static_cast<AZ::SystemAllocator&>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get());
+        AZ::Debug::AllocationSampler& sampler = systemAllocator.GetAllocationSampler();
+        sampler.Start(1);
+
+        void* address = systemAllocator.allocate(4096, 16);
+        EXPECT_GE(sampler.GetLiveBytes(), 4096);
+
+        systemAllocator.deallocate(address, 4096, 16);
+        sampler.Stop();
+        EXPECT_EQ(0, sampler.GetLiveBytes());
+    }
+} // namespace UnitTest
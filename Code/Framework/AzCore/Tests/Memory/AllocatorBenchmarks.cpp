@@ -11,6 +11,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -45,6 +46,16 @@ namespace Benchmark
         AZ_TYPE_INFO(HphaSchemaAllocator, "{6563AB4B-A68E-4499-8C98-D61D640D1F7F}");
     };
 
+    // Same as HphaSchemaAllocator, with every thread locking the buckets for all its small allocations
+    class HphaSchemaAllocatorNoThreadCache : public HphaSchemaAllocator
+    {
+    public:
+        HphaSchemaAllocatorNoThreadCache()
+        {
+            static_cast<AZ::HphaSchema*>(GetSchema())->SetThreadCacheEnabled(false);
+        }
+    };
+
     // For the SystemAllocator we inherit so we have a different stack. The SystemAllocator is used globally so we dont want
     // to get that data affecting the benchmark
     class TestSystemAllocator : public AZ::SystemAllocator
@@ -58,6 +69,27 @@ namespace Benchmark
         }
     };
 
+    // SystemAllocator with the allocation sampler running at its default interval, to measure the sampling overhead
+    class TestSystemAllocatorSampled : public TestSystemAllocator
+    {
+    public:
+        TestSystemAllocatorSampled()
+        {
+            GetAllocationSampler().Start();
+        }
+    };
+
+    // The fixtures garbage collect after every iteration, which for the frame arena is the end of the frame.
+    // Its blocks are kept, like they are between the frames of the application.
+    class TestFrameArenaAllocator : public AZ::FrameArenaAllocator
+    {
+    public:
+        void GarbageCollect() override
+        {
+            ResetFrame();
+        }
+    };
+
     // Allocated bytes reported by the allocator
     static const char* s_counterAllocatorMemory = "Allocator_Memory";
 
@@ -237,6 +269,71 @@ namespace Benchmark
         }
     };
 
+    // All the threads allocate and free small blocks from the same allocator, measuring the contention between them
+    template<typename TAllocator>
+    class ThreadedAllocationBenchmarkFixture : public ::benchmark::Fixture
+    {
+        using TestAllocatorType = TAllocator;
+
+        void InternalSetUp(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_allocator = AZStd::make_unique<TestAllocatorType>();
+            }
+        }
+
+        void InternalTearDown(const ::benchmark::State& state)
+        {
+            if (state.thread_index() == 0)
+            {
+                m_allocator = nullptr;
+            }
+        }
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            InternalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            InternalTearDown(state);
+        }
+
+        void Benchmark(benchmark::State& state)
+        {
+            const AllocationSizeArray& allocationArray = s_allocationSizes[SMALL];
+            const size_t numberOfAllocations = static_cast<size_t>(state.range(0));
+            AZStd::vector<void*> allocations(numberOfAllocations, nullptr);
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    allocations[allocationIndex] = m_allocator->allocate(allocationArray[allocationIndex % allocationArray.size()], 0);
+                }
+                for (size_t allocationIndex = 0; allocationIndex < numberOfAllocations; ++allocationIndex)
+                {
+                    m_allocator->deallocate(allocations[allocationIndex], allocationArray[allocationIndex % allocationArray.size()]);
+                }
+            }
+
+            // Each item is an allocation and its deallocation
+            state.SetItemsProcessed(state.iterations() * numberOfAllocations);
+        }
+    private:
+        AZStd::unique_ptr<TestAllocatorType> m_allocator;
+    };
+
     template<typename TAllocator>
     class RecordedAllocationBenchmarkFixture : public ::benchmark::Fixture
     {
@@ -418,6 +515,12 @@ namespace Benchmark
     // Test under and over-subscription of threads vs the amount of CPUs available
     static const unsigned int MaxThreadRange = 2 * AZStd::thread::hardware_concurrency();
 
+    // Contention benchmarks run from 1 thread up to MaxThreadRange, measuring the wall time since the threads run concurrently
+    static void ContentionRunRanges(benchmark::internal::Benchmark* b)
+    {
+        b->Arg(1000)->ThreadRange(1, MaxThreadRange)->UseRealTime();
+    }
+
 #define BM_REGISTER_TEMPLATE(FIXTURE, TESTNAME, ...) \
         BENCHMARK_TEMPLATE_DEFINE_F(FIXTURE, TESTNAME, __VA_ARGS__)(benchmark::State& state) { Benchmark(state); } \
         BENCHMARK_REGISTER_F(FIXTURE, TESTNAME)
@@ -446,6 +549,22 @@ namespace Benchmark
     BM_REGISTER_ALLOCATOR(RawMallocAllocator, RawMallocAllocator);
     BM_REGISTER_ALLOCATOR(HphaSchemaAllocator, HphaSchemaAllocator);
     BM_REGISTER_ALLOCATOR(SystemAllocator, TestSystemAllocator);
+    namespace BM_HphaThreadCache
+    {
+        BM_REGISTER_TEMPLATE(ThreadedAllocationBenchmarkFixture, HphaSchemaAllocator_ThreadCache, HphaSchemaAllocator)->Apply(ContentionRunRanges);
+        BM_REGISTER_TEMPLATE(ThreadedAllocationBenchmarkFixture, HphaSchemaAllocator_NoThreadCache, HphaSchemaAllocatorNoThreadCache)->Apply(ContentionRunRanges);
+    }
+    namespace BM_SystemAllocatorSampled
+    {
+        BM_REGISTER_SIZE_FIXTURES(AllocationBenchmarkFixture, SystemAllocatorSampled, TestSystemAllocatorSampled);
+        BM_REGISTER_SIZE_FIXTURES(DeAllocationBenchmarkFixture, SystemAllocatorSampled, TestSystemAllocatorSampled);
+    }
+    // The frame arena only reallocates its most recent allocation, which the recorded allocations don't follow
+    namespace BM_FrameArenaAllocator
+    {
+        BM_REGISTER_SIZE_FIXTURES(AllocationBenchmarkFixture, FrameArenaAllocator, TestFrameArenaAllocator);
+        BM_REGISTER_SIZE_FIXTURES(DeAllocationBenchmarkFixture, FrameArenaAllocator, TestFrameArenaAllocator);
+    }
 
     //BM_REGISTER_SCHEMA(PoolSchema); // Requires special alignment requests while allocating
     // BM_REGISTER_ALLOCATOR(OSAllocator, OSAllocator); // Requires special treatment to initialize since it will be already initialized, maybe creating a different instance?
@@ -9,6 +9,9 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace UnitTest
 {
@@ -102,4 +105,118 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTest
+        : public LeakDetectionFixture
+    {
+    };
+
+    TEST_F(HphaSchemaThreadCacheTest, FreeOnAnotherThread_AllocatedBytesBalance)
+    {
+        AZ::HphaSchema hpha;
+        ASSERT_TRUE(hpha.IsThreadCacheEnabled());
+
+        constexpr size_t threadCount = 4;
+        constexpr size_t allocationCount = 2000;
+        AZStd::vector<void*, AZ::OSStdAllocator> allocations[threadCount];
+
+        // Sizes are multiples of the bucket granularity, so the allocated bytes are the requested ones
+        auto allocationSize = [](size_t index)
+        {
+            return 8 * (1 + index % 64);
+        };
+
+        size_t allocatedBytes = 0;
+        {
+            AZStd::thread threads[threadCount];
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads[threadIndex] = AZStd::thread(
+                    [&hpha, &allocations, &allocationSize, threadIndex]()
+                    {
+                        for (size_t i = 0; i < allocationCount; ++i)
+                        {
+                            void* allocation = hpha.allocate(allocationSize(i), 8);
+                            memset(allocation, static_cast<int>(threadIndex), allocationSize(i));
+                            allocations[threadIndex].push_back(allocation);
+                        }
+                    });
+                for (size_t i = 0; i < allocationCount; ++i)
+                {
+                    allocatedBytes += allocationSize(i);
+                }
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        EXPECT_EQ(allocatedBytes, hpha.NumAllocatedBytes());
+
+        // Every thread frees the allocations of the next one
+        {
+            AZStd::thread threads[threadCount];
+            for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+            {
+                threads[threadIndex] = AZStd::thread(
+                    [&hpha, &allocations, &allocationSize, threadIndex]()
+                    {
+                        const size_t ownerIndex = (threadIndex + 1) % threadCount;
+                        for (size_t i = 0; i < allocationCount; ++i)
+                        {
+                            EXPECT_EQ(static_cast<char>(ownerIndex), *static_cast<char*>(allocations[ownerIndex][i]));
+                            hpha.deallocate(allocations[ownerIndex][i], allocationSize(i), 8);
+                        }
+                    });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+        EXPECT_EQ(0, hpha.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTest, DestroyAllocator_ThreadStillRunning_CachedMemoryReturned)
+    {
+        // The debug schema asserts on destruction if pages are still used, which includes the elements cached by threads
+        auto hpha = AZStd::make_unique<AZ::HphaSchemaBase<true>>();
+        AZStd::binary_semaphore cached;
+        AZStd::binary_semaphore destroyed;
+
+        AZStd::thread thread(
+            [&hpha, &cached, &destroyed]()
+            {
+                for (size_t size = 8; size <= 512; size += 8)
+                {
+                    hpha->deallocate(hpha->allocate(size, 8), size, 8);
+                }
+                cached.release();
+                destroyed.acquire();
+
+                // The cache of the destroyed allocator is discarded when the thread needs it, or exits
+                AZ::HphaSchema otherHpha;
+                otherHpha.deallocate(otherHpha.allocate(16, 8), 16, 8);
+                EXPECT_EQ(0, otherHpha.NumAllocatedBytes());
+            });
+
+        cached.acquire();
+        EXPECT_EQ(0, hpha->NumAllocatedBytes());
+        hpha.reset();
+        destroyed.release();
+        thread.join();
+    }
+
+    TEST_F(HphaSchemaThreadCacheTest, ThreadCacheDisabled_AllocatesFromBuckets)
+    {
+        AZ::HphaSchema hpha;
+        hpha.SetThreadCacheEnabled(false);
+        EXPECT_FALSE(hpha.IsThreadCacheEnabled());
+
+        void* allocation = hpha.allocate(64, 8);
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_EQ(64, hpha.NumAllocatedBytes());
+        hpha.deallocate(allocation, 64, 8);
+        EXPECT_EQ(0, hpha.NumAllocatedBytes());
+    }
 }
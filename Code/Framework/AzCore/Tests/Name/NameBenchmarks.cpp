@@ -10,6 +10,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ::NameBenchmarks
 {
@@ -177,4 +178,180 @@ namespace AZ::NameBenchmarks
         state.SetItemsProcessed(state.iterations() * state.range(0));
     }
     BENCHMARK_REGISTER_F(NameBenchmarkFixture, NameLiteralCreateAndDestroy)->Arg(10)->Arg(100)->Arg(1000);
+
+    //! Fixture for benchmarks that run the same body on several threads.
+    //! The NameDictionary and the shared name pool are only created and destroyed by the first thread.
+    //! Google Benchmark synchronizes all threads before the first iteration and after the last one,
+    //! so the other threads never observe a missing dictionary.
+    class NameContentionBenchmarkFixture : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t PoolSize = 1000;
+
+        void SetUp(const ::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            if (st.thread_index() == 0)
+            {
+                CreateNamePool();
+            }
+        }
+
+        void SetUp(::benchmark::State& st) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(st);
+            if (st.thread_index() == 0)
+            {
+                CreateNamePool();
+            }
+        }
+
+        void TearDown(::benchmark::State& st) override
+        {
+            if (st.thread_index() == 0)
+            {
+                DestroyNamePool();
+            }
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+        void TearDown(const ::benchmark::State& st) override
+        {
+            if (st.thread_index() == 0)
+            {
+                DestroyNamePool();
+            }
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(st);
+        }
+
+    protected:
+        void CreateNamePool()
+        {
+            AZ::NameDictionary::Create();
+            m_existingNames.reserve(PoolSize);
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                m_existingNames.emplace_back(AZStd::string::format("name%zu", i));
+            }
+        }
+
+        void DestroyNamePool()
+        {
+            m_existingNames = {};
+            AZ::NameDictionary::Destroy();
+        }
+
+        AZStd::vector<AZ::Name> m_existingNames;
+    };
+
+    // Every thread resolves names that already exist in the dictionary by string
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MultiThreaded_CreateNameCacheHit)(::benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (const AZ::Name& existingName : m_existingNames)
+            {
+                benchmark::DoNotOptimize(AZ::Name(existingName.GetStringView()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MultiThreaded_CreateNameCacheHit)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    // Every thread resolves names that already exist in the dictionary by hash
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MultiThreaded_FindNameByHash)(::benchmark::State& state)
+    {
+        AZ::NameDictionary& nameDictionary = AZ::NameDictionary::Instance();
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (const AZ::Name& existingName : m_existingNames)
+            {
+                benchmark::DoNotOptimize(nameDictionary.FindName(existingName.GetHash()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MultiThreaded_FindNameByHash)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    // Every thread hammers the same handful of names, which all live in a few shards
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MultiThreaded_CreateNameCacheHit_SameName)(::benchmark::State& state)
+    {
+        constexpr size_t hotNameCount = 4;
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(m_existingNames[i % hotNameCount].GetStringView()));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MultiThreaded_CreateNameCacheHit_SameName)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    // Every thread adds and releases its own names, so the threads only contend on the shard mutexes
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MultiThreaded_CreateNameCacheMiss)(::benchmark::State& state)
+    {
+        constexpr size_t poolSize = 100;
+        AZStd::vector<AZStd::string> namesToCreate;
+        for (size_t i = 0; i < poolSize; ++i)
+        {
+            namesToCreate.emplace_back(AZStd::string::format("thread%d_name%zu", state.thread_index(), i));
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < poolSize; ++i)
+            {
+                benchmark::DoNotOptimize(AZ::Name(namesToCreate[i]));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * poolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MultiThreaded_CreateNameCacheMiss)
+        ->ThreadRange(1, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
+
+    // Most threads look up existing names while one thread keeps adding and releasing names
+    BENCHMARK_DEFINE_F(NameContentionBenchmarkFixture, MultiThreaded_MixedLookupAndInsert)(::benchmark::State& state)
+    {
+        const bool isWriter = state.thread_index() == 0;
+        AZStd::vector<AZStd::string> namesToCreate;
+        if (isWriter)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                namesToCreate.emplace_back(AZStd::string::format("transient%zu", i));
+            }
+        }
+
+        for ([[maybe_unused]] auto var_ : state)
+        {
+            for (size_t i = 0; i < PoolSize; ++i)
+            {
+                if (isWriter)
+                {
+                    benchmark::DoNotOptimize(AZ::Name(namesToCreate[i]));
+                }
+                else
+                {
+                    benchmark::DoNotOptimize(AZ::Name(m_existingNames[i].GetStringView()));
+                }
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * PoolSize);
+    }
+    BENCHMARK_REGISTER_F(NameContentionBenchmarkFixture, MultiThreaded_MixedLookupAndInsert)
+        ->ThreadRange(2, AZStd::thread::hardware_concurrency())
+        ->UseRealTime();
 } // namespace AZ::NameBenchmarks
@@ -50,9 +50,36 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const auto& GetDictionary()
+        static const auto& GetShards()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().m_shards;
+        }
+
+        static size_t GetDictionarySize()
+        {
+            size_t dictionarySize = 0;
+            for (const auto& shard : GetShards())
+            {
+                dictionarySize += shard.m_dictionary.size();
+            }
+            return dictionarySize;
+        }
+
+        static bool ContainsName(AZStd::string_view nameString)
+        {
+            for (const auto& shard : GetShards())
+            {
+                // Workaround VS2022 17.3 issue with incorrect detection of unused lambda captures assigning the nameString reference to a same type
+                auto it = AZStd::find_if(shard.m_dictionary.begin(), shard.m_dictionary.end(), [&nameString = nameString](const AZStd::pair<AZ::Name::Hash, AZ::NameDictionary::ScopedNameDataWrapper>& entry)
+                {
+                    return entry.second.m_nameData->GetName() == nameString;
+                });
+                if (it != shard.m_dictionary.end())
+                {
+                    return true;
+                }
+            }
+            return false;
         }
         
         static size_t GetEntryCount()
@@ -76,7 +103,7 @@ namespace UnitTest
                     break;
                 }
             }
-            return GetDictionary().size() - staticNameCount;
+            return GetDictionarySize() - staticNameCount;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -297,13 +324,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            // Workaround VS2022 17.3 issue with incorrect detection of unused lambda captures assigning the nameString reference to a same type
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString = nameString](const AZStd::pair<AZ::Name::Hash, AZ::NameDictionary::ScopedNameDataWrapper>& entry)
-            {
-                return entry.second.m_nameData->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::ContainsName(nameString)) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -673,6 +694,69 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(1, 2);
     }
 
+    TEST_F(NameTest, ConcurrencyDataTest_LookupsOfExistingNames_SucceedWhileOtherNamesAreAddedAndReleased)
+    {
+        // Enough names to force every shard to grow its lookup table several times
+        constexpr size_t heldNameCount = 4096;
+        AZStd::vector<AZ::Name> heldNames;
+        heldNames.reserve(heldNameCount);
+        for (size_t i = 0; i < heldNameCount; ++i)
+        {
+            heldNames.emplace_back(AZStd::string::format("held%zu", i));
+        }
+
+        AZStd::atomic_bool writersDone{ false };
+        AZStd::vector<AZStd::thread> writers;
+        for (size_t writerIndex = 0; writerIndex < 2; ++writerIndex)
+        {
+            writers.emplace_back([writerIndex]()
+            {
+                AZStd::vector<AZ::Name> transientNames;
+                for (size_t iteration = 0; iteration < 20; ++iteration)
+                {
+                    for (size_t i = 0; i < 512; ++i)
+                    {
+                        transientNames.emplace_back(AZStd::string::format("transient%zu_%zu", writerIndex, i));
+                    }
+                    transientNames.clear();
+                }
+            });
+        }
+
+        AZStd::atomic<size_t> failedLookups{ 0 };
+        AZStd::vector<AZStd::thread> readers;
+        for (size_t readerIndex = 0; readerIndex < 4; ++readerIndex)
+        {
+            readers.emplace_back([&heldNames, &writersDone, &failedLookups]()
+            {
+                do
+                {
+                    for (const AZ::Name& heldName : heldNames)
+                    {
+                        if (AZ::NameDictionary::Instance().FindName(heldName.GetHash()) != heldName ||
+                            AZ::Name(heldName.GetStringView()) != heldName)
+                        {
+                            ++failedLookups;
+                        }
+                    }
+                } while (!writersDone);
+            });
+        }
+
+        for (AZStd::thread& writer : writers)
+        {
+            writer.join();
+        }
+        writersDone = true;
+        for (AZStd::thread& reader : readers)
+        {
+            reader.join();
+        }
+
+        EXPECT_EQ(0, failedLookups.load());
+        EXPECT_EQ(heldNameCount, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, NameRef)
     {
         AZ::NameRef fromRValue = AZ::Name("test");
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/Utils.h>
+
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 2;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr size_t TestAlignmentBufferSize = 16_kib;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux({ "/" }, {}, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestAlignmentBufferSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_chunkCharacter = 'C';
+
+        void SetUp() override
+        {
+            if (!StorageDriveLinux::IsSupported())
+            {
+                GTEST_SKIP() << "io_uring is not available.";
+            }
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_dummyFilepath = m_tempDirectory->Resolve("Dummy.bin");
+            m_dummyRequestPath = RequestPath(m_dummyFilepath);
+            m_context = AZStd::make_unique<StreamerContext>();
+            m_options.m_minimalReporting = true;
+            m_storageDrive = CreateStorageDrive({ "/" }, {});
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            m_context.reset();
+            m_tempDirectory.reset();
+        }
+
+        AZStd::shared_ptr<StorageDriveLinux> CreateStorageDrive(
+            const AZStd::vector<AZStd::string_view>& mountPoints, const AZStd::vector<AZStd::string_view>& excludedPaths)
+        {
+            auto drive = AZStd::make_shared<StorageDriveLinux>(mountPoints, excludedPaths, TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestAlignmentBufferSize, m_options);
+            drive->SetContext(*m_context);
+            return drive;
+        }
+
+        // Create a file filled with a single character. If chunkOffset is non-zero, it will write in a specific character every
+        // chunkOffset bytes till the end of file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0)
+        {
+            AZStd::vector<char> buffer(fileSize, s_fileCharacter);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_WRITE_ONLY));
+            ASSERT_EQ(fileSize, file.Write(buffer.data(), fileSize));
+            file.Close();
+        }
+
+        FileRequest* QueueRead(void* output, size_t outputSize, u64 offset, u64 size)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, outputSize, m_dummyRequestPath, offset, size);
+            m_storageDrive->QueueRequest(request);
+            return request;
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::steady_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::steady_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZ::IO::Path m_dummyFilepath;
+        // Requests only store a reference to the path, so it needs to outlive them.
+        RequestPath m_dummyRequestPath;
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive;
+        StorageDriveLinux::ConstructionOptions m_options;
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_MultipleMountPoints_AllPathsAreIncludedInTheName)
+    {
+        m_storageDrive = CreateStorageDrive({ "/", "/home/", "/data" }, {});
+
+        const AZStd::string& name = m_storageDrive->GetName();
+        EXPECT_NE(AZStd::string::npos, name.find("(/,/home,/data)"));
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            AZStd::vector<AZStd::string_view>{}, TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0, TestQueueDepth, TestOverCommit,
+            TestAlignmentBufferSize, m_options);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(AZStd::vector<AZStd::string_view>{ "/" },
+            AZStd::vector<AZStd::string_view>{}, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+            TestLogicalSectorSize, TestQueueDepth, -(aznumeric_cast<s32>(TestQueueDepth) + 2), TestAlignmentBufferSize, m_options);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FullFileRead_ReturnsCorrectData)
+    {
+        constexpr size_t fileSize = 64_kib;
+        CreateDummyFile(fileSize, 1_kib);
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        FileRequest* request = QueueRead(buffer, fileSize, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        WaitTillCompleted();
+
+        for (size_t i = 0; i < fileSize; ++i)
+        {
+            ASSERT_EQ((i % 1_kib) == 0 ? s_chunkCharacter : s_fileCharacter, buffer[i]);
+        }
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetRead_ReturnsCorrectData)
+    {
+        constexpr u64 unalignedOffset = 40;
+        constexpr u64 numChunksToRead = 7;
+        constexpr u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr char unexpectedChar = 'Z';
+        CreateDummyFile(16_kib, unalignedOffset);
+
+        char buffer[unalignedSize + 4];
+        buffer[unalignedSize] = unexpectedChar;
+        QueueRead(buffer, unalignedSize + 4, unalignedOffset, unalignedSize);
+        WaitTillCompleted();
+
+        for (size_t offset = 0; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(s_chunkCharacter, buffer[offset * unalignedOffset]);
+            EXPECT_EQ(s_fileCharacter, buffer[offset * unalignedOffset + 1]);
+        }
+        // Check that the read didn't write past the requested size.
+        EXPECT_EQ(unexpectedChar, buffer[unalignedSize]);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedReadLargerThanAlignmentBuffer_ReturnsCorrectData)
+    {
+        constexpr u64 unalignedSize = 103630;
+        constexpr size_t bufferSize = unalignedSize + 8;
+        CreateDummyFile(unalignedSize);
+
+        AZStd::vector<char> buffer(bufferSize, 'Z');
+        FileRequest* request = QueueRead(buffer.data() + 1, bufferSize - 1, 0, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        WaitTillCompleted();
+
+        EXPECT_EQ('Z', buffer[0]);
+        for (size_t i = 1; i <= unalignedSize; ++i)
+        {
+            ASSERT_EQ(s_fileCharacter, buffer[i]);
+        }
+        for (size_t i = unalignedSize + 1; i < bufferSize; ++i)
+        {
+            ASSERT_EQ('Z', buffer[i]);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllReadsCompleteWithCorrectData)
+    {
+        constexpr size_t numReads = TestQueueDepth * 4;
+        constexpr size_t readSize = 1000;
+        CreateDummyFile(numReads * readSize, readSize);
+
+        AZStd::vector<char> buffer(numReads * readSize, 'Z');
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            FileRequest* request = QueueRead(buffer.data() + i * readSize, readSize, i * readSize, readSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    numCompleted++;
+                });
+        }
+        WaitTillCompleted();
+
+        EXPECT_EQ(numReads, numCompleted);
+        for (size_t i = 0; i < buffer.size(); ++i)
+        {
+            ASSERT_EQ((i % readSize) == 0 ? s_chunkCharacter : s_fileCharacter, buffer[i]);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_RequestFails)
+    {
+        CreateDummyFile(4_kib);
+
+        char buffer[1024];
+        FileRequest* request = QueueRead(buffer, sizeof(buffer), 4_kib - 10, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FileInExcludedPath_RequestIsForwarded)
+    {
+        CreateDummyFile(4_kib);
+        AZ::IO::Path parentDirectory = m_dummyFilepath.ParentPath().ParentPath();
+        m_storageDrive = CreateStorageDrive({ parentDirectory.Native() }, { m_dummyFilepath.ParentPath().Native() });
+
+        // There's no next entry in the stack to forward to, so the read completes without data.
+        char buffer[64] = {};
+        QueueRead(buffer, sizeof(buffer), 0, sizeof(buffer));
+        WaitTillCompleted();
+        EXPECT_EQ(0, buffer[0]);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(AZStd::get<Requests::FileExistsCheckData>(request.GetCommand()).m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_Directory_ReturnsCompletedWithFileNotFound)
+    {
+        RequestPath directoryPath{ AZ::IO::PathView(m_tempDirectory->GetDirectory()) };
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(directoryPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(AZStd::get<Requests::FileExistsCheckData>(request.GetCommand()).m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        constexpr size_t fileSize = 12345;
+        CreateDummyFile(fileSize);
+
+        // Read first so the file size is retrieved through the cached file handle.
+        char buffer[16];
+        QueueRead(buffer, sizeof(buffer), 0, sizeof(buffer));
+        WaitTillCompleted();
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([fileSize](const FileRequest& request)
+            {
+                auto& metaData = AZStd::get<Requests::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(metaData.m_found);
+                EXPECT_EQ(fileSize, metaData.m_fileSize);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_AfterReads_QueueDepthAndLatenciesAreReported)
+    {
+        constexpr size_t readSize = 4_kib;
+        CreateDummyFile(readSize * TestQueueDepth);
+
+        AZStd::vector<char> buffer(readSize * TestQueueDepth);
+        for (size_t i = 0; i < TestQueueDepth; ++i)
+        {
+            QueueRead(buffer.data() + i * readSize, readSize, i * readSize, readSize);
+        }
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+
+        auto FindStatistic = [&statistics](AZStd::string_view name) -> const Statistic*
+        {
+            auto it = AZStd::find_if(statistics.begin(), statistics.end(),
+                [name](const Statistic& statistic) { return statistic.GetName() == name; });
+            return it != statistics.end() ? &*it : nullptr;
+        };
+        const Statistic* queueDepth = FindStatistic("Queue depth");
+        ASSERT_NE(nullptr, queueDepth);
+        EXPECT_GT(AZStd::get<Statistic::FloatRange>(queueDepth->GetValue()).m_max, 1.0);
+
+        const Statistic* median = FindStatistic("Read latency (p50)");
+        const Statistic* tail = FindStatistic("Read latency (p99)");
+        ASSERT_NE(nullptr, median);
+        ASSERT_NE(nullptr, tail);
+        EXPECT_LE(AZStd::get<Statistic::Time>(median->GetValue()).m_value, AZStd::get<Statistic::Time>(tail->GetValue()).m_value);
+    }
+
+    TEST(Streamer_PercentileWindow, CalculatePercentile_FullAndWrappedWindow_ReturnsPercentileOfRecentEntries)
+    {
+        PercentileWindow<u32, 128> window;
+        EXPECT_EQ(0, window.CalculatePercentile(50.0));
+
+        for (u32 i = 1; i <= 128; ++i)
+        {
+            window.PushEntry(i);
+        }
+        EXPECT_EQ(65, window.CalculatePercentile(50.0));
+        EXPECT_EQ(127, window.CalculatePercentile(99.0));
+        EXPECT_EQ(1, window.CalculatePercentile(0.0));
+
+        // Overwrite the oldest half of the window.
+        for (u32 i = 129; i <= 192; ++i)
+        {
+            window.PushEntry(i);
+        }
+        EXPECT_EQ(65, window.CalculatePercentile(0.0));
+        EXPECT_EQ(192, window.CalculatePercentile(100.0));
+    }
+} // namespace AZ::IO
@@ -3766,6 +3766,127 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
         m_serializeContext->DisableRemoveReflection();
     }
 
+    namespace ClonePlan
+    {
+        struct Position
+        {
+            AZ_TYPE_INFO(Position, "{0B6D7C1E-4D2A-4B39-9A0B-6C1F3E2D8A51}");
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+            float m_z = 0.0f;
+        };
+
+        struct Record
+        {
+            AZ_TYPE_INFO(Record, "{5E1A8F4C-2B7D-4C63-8E95-1D3A7B6C0F24}");
+            int m_id = 0;
+            bool m_enabled = false;
+            Position m_position;
+            AZStd::vector<AZ::u32> m_indices;
+            AZStd::string m_name;
+            AZStd::vector<Position> m_path;
+            AZStd::vector<Position*> m_optional;
+        };
+    }
+
+    TEST_F(Serialization, Clone_ClassWithTriviallyCopyableFields_ClonesAllFields)
+    {
+        using namespace ClonePlan;
+        m_serializeContext->Class<Position>()
+            ->Field("x", &Position::m_x)
+            ->Field("y", &Position::m_y)
+            ->Field("z", &Position::m_z);
+        m_serializeContext->Class<Record>()
+            ->Field("id", &Record::m_id)
+            ->Field("enabled", &Record::m_enabled)
+            ->Field("position", &Record::m_position)
+            ->Field("indices", &Record::m_indices)
+            ->Field("name", &Record::m_name)
+            ->Field("path", &Record::m_path)
+            ->Field("optional", &Record::m_optional);
+
+        Record source;
+        source.m_id = 42;
+        source.m_enabled = true;
+        source.m_position = { 1.0f, 2.0f, 3.0f };
+        source.m_indices = { 3, 1, 4, 1, 5 };
+        source.m_name = "Record";
+        source.m_path = { { 4.0f, 5.0f, 6.0f }, { 7.0f, 8.0f, 9.0f } };
+        source.m_optional.push_back(aznew Position{ 10.0f, 11.0f, 12.0f });
+
+        auto verifyClone = [&source](const Record& clone)
+        {
+            EXPECT_EQ(source.m_id, clone.m_id);
+            EXPECT_EQ(source.m_enabled, clone.m_enabled);
+            EXPECT_EQ(source.m_position.m_z, clone.m_position.m_z);
+            EXPECT_EQ(source.m_indices, clone.m_indices);
+            EXPECT_EQ(source.m_name, clone.m_name);
+            ASSERT_EQ(source.m_path.size(), clone.m_path.size());
+            EXPECT_EQ(source.m_path[1].m_y, clone.m_path[1].m_y);
+            ASSERT_EQ(1, clone.m_optional.size());
+            EXPECT_NE(source.m_optional[0], clone.m_optional[0]);
+            EXPECT_EQ(source.m_optional[0]->m_x, clone.m_optional[0]->m_x);
+        };
+
+        Record* clone = m_serializeContext->CloneObject(&source);
+        ASSERT_NE(nullptr, clone);
+        verifyClone(*clone);
+
+        // Cloning in place replaces the contents of the containers instead of appending to them.
+        Record inplaceClone;
+        inplaceClone.m_indices = { 9, 9, 9, 9, 9, 9, 9, 9 };
+        inplaceClone.m_path.resize(5);
+        m_serializeContext->CloneObjectInplace(inplaceClone, &source);
+        verifyClone(inplaceClone);
+
+        for (Record* record : { &source, clone, &inplaceClone })
+        {
+            for (Position* position : record->m_optional)
+            {
+                delete position;
+            }
+        }
+        delete clone;
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<Record>();
+        m_serializeContext->Class<Position>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(Serialization, Clone_ReflectionChangesAfterClone_UsesNewReflection)
+    {
+        using namespace ClonePlan;
+        m_serializeContext->Class<Record>()
+            ->Field("id", &Record::m_id)
+            ->Field("name", &Record::m_name);
+
+        Record source;
+        source.m_id = 42;
+        source.m_name = "Record";
+
+        Record clone;
+        m_serializeContext->CloneObjectInplace(clone, &source);
+        EXPECT_EQ(42, clone.m_id);
+        EXPECT_EQ("Record", clone.m_name);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<Record>();
+        m_serializeContext->DisableRemoveReflection();
+
+        m_serializeContext->Class<Record>()
+            ->Field("name", &Record::m_name);
+
+        Record newClone;
+        m_serializeContext->CloneObjectInplace(newClone, &source);
+        EXPECT_EQ(0, newClone.m_id);
+        EXPECT_EQ("Record", newClone.m_name);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<Record>();
+        m_serializeContext->DisableRemoveReflection();
+    }
+
     /*
     * Error Testing
     */
@@ -6584,6 +6705,148 @@ namespace UnitTest
         AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get());
     }
 
+    struct ClassWithContiguousContainers
+    {
+        AZ_TYPE_INFO(ClassWithContiguousContainers, "{0C6E5B0A-2F4B-4C55-9C0B-6E3A7F19D284}");
+        AZ_CLASS_ALLOCATOR(ClassWithContiguousContainers, AZ::SystemAllocator);
+
+        static void Reflect(ReflectContext* context, unsigned int version = 0, SerializeContext::VersionConverter converter = nullptr)
+        {
+            if (auto serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ClassWithContiguousContainers>()
+                    ->Version(version, converter)
+                    ->Field("Floats", &ClassWithContiguousContainers::m_floats)
+                    ->Field("Ints", &ClassWithContiguousContainers::m_ints)
+                    ->Field("FixedDoubles", &ClassWithContiguousContainers::m_fixedDoubles)
+                    ->Field("Array", &ClassWithContiguousContainers::m_array)
+                    ->Field("Strings", &ClassWithContiguousContainers::m_strings)
+                    ;
+            }
+        }
+
+        static void Unreflect(SerializeContext* serializeContext)
+        {
+            serializeContext->EnableRemoveReflection();
+            Reflect(serializeContext);
+            serializeContext->DisableRemoveReflection();
+        }
+
+        void Fill()
+        {
+            m_floats.resize(1024);
+            for (size_t i = 0; i < m_floats.size(); ++i)
+            {
+                m_floats[i] = static_cast<float>(i) * 0.5f;
+            }
+            m_ints = { -3, 0, 42, 65536 };
+            m_fixedDoubles = { 1.25, -2.5 };
+            m_array = { 1, 2, 3, 4 };
+            m_strings = { "first", "second" };
+        }
+
+        void ExpectEqual(const ClassWithContiguousContainers& rhs) const
+        {
+            EXPECT_EQ(m_floats, rhs.m_floats);
+            EXPECT_EQ(m_ints, rhs.m_ints);
+            EXPECT_EQ(m_fixedDoubles, rhs.m_fixedDoubles);
+            EXPECT_EQ(m_array, rhs.m_array);
+            EXPECT_EQ(m_strings, rhs.m_strings);
+        }
+
+        AZStd::vector<float> m_floats;
+        AZStd::vector<AZ::s32> m_ints;
+        AZStd::fixed_vector<double, 8> m_fixedDoubles;
+        AZStd::array<AZ::u16, 4> m_array{};
+        AZStd::vector<AZStd::string> m_strings;
+    };
+
+    TEST_F(ObjectStreamSerialization, BinaryStream_ContiguousContainersOfTrivialTypes_StoredAsSingleBlockAndLoaded)
+    {
+        ClassWithContiguousContainers::Reflect(m_serializeContext.get());
+
+        ClassWithContiguousContainers saveObject;
+        saveObject.Fill();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        // Storing an element per float would need at least a flag byte and a type id for each of them.
+        EXPECT_LT(byteBuffer.size(), saveObject.m_floats.size() * (sizeof(float) + 2));
+
+        ClassWithContiguousContainers loadObject;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+        saveObject.ExpectEqual(loadObject);
+
+        ClassWithContiguousContainers::Unreflect(m_serializeContext.get());
+    }
+
+    TEST_F(ObjectStreamSerialization, BinaryStream_ContiguousContainerWithMismatchedLayoutHash_LoadsElementsOneByOne)
+    {
+        ClassWithContiguousContainers::Reflect(m_serializeContext.get());
+
+        ClassWithContiguousContainers saveObject;
+        saveObject.Fill();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        // The block of floats is preceded by a header that starts with the layout hash, the element size,
+        // the element version and a byte order mark. Changing the hash simulates a layout change of the element type.
+        constexpr size_t layoutHeaderSize = sizeof(AZ::u32) + sizeof(AZ::u32) + sizeof(AZ::u8) + sizeof(AZ::u16);
+        auto floatsBegin = reinterpret_cast<const AZ::u8*>(saveObject.m_floats.data());
+        auto floatsEnd = floatsBegin + saveObject.m_floats.size() * sizeof(float);
+        auto blockIt = AZStd::search(byteBuffer.begin(), byteBuffer.end(), floatsBegin, floatsEnd);
+        ASSERT_NE(byteBuffer.end(), blockIt);
+        ASSERT_GE(AZStd::distance(byteBuffer.begin(), blockIt), static_cast<ptrdiff_t>(layoutHeaderSize));
+        *(blockIt - layoutHeaderSize) ^= 0xFF;
+
+        ClassWithContiguousContainers loadObject;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+        saveObject.ExpectEqual(loadObject);
+
+        ClassWithContiguousContainers::Unreflect(m_serializeContext.get());
+    }
+
+    TEST_F(ObjectStreamSerialization, BinaryStream_ContiguousContainerInConvertedClass_ElementsAvailableToConverter)
+    {
+        ClassWithContiguousContainers::Reflect(m_serializeContext.get(), 1);
+
+        ClassWithContiguousContainers saveObject;
+        saveObject.Fill();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        ClassWithContiguousContainers::Unreflect(m_serializeContext.get());
+        ClassWithContiguousContainers::Reflect(m_serializeContext.get(), 2,
+            [](SerializeContext& context, SerializeContext::DataElementNode& classElement) -> bool
+            {
+                AZStd::vector<AZ::s32> ints;
+                if (!classElement.GetChildData(AZ_CRC_CE("Ints"), ints))
+                {
+                    return false;
+                }
+                AZStd::reverse(ints.begin(), ints.end());
+                classElement.RemoveElementByName(AZ_CRC_CE("Ints"));
+                return classElement.AddElementWithData(context, "Ints", ints) != -1;
+            });
+
+        ClassWithContiguousContainers loadObject;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+
+        AZStd::reverse(saveObject.m_ints.begin(), saveObject.m_ints.end());
+        saveObject.ExpectEqual(loadObject);
+
+        ClassWithContiguousContainers::Unreflect(m_serializeContext.get());
+    }
+
     class GenericClassInfoExplicitReflectFixture
         : public LeakDetectionFixture
     {
@@ -8,7 +8,10 @@
 
 #include <AzCore/PlatformDef.h>
 
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -205,6 +208,60 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithSomeDefaultsKept_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        AZStd::string_view json = description.m_jsonWithKeptDefaults;
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(loadInstance, stream, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithSomeDefaults_ResultMatchesLoadFromDocument)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+        AZStd::string_view json = description.m_jsonWithStrippedDefaults;
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        TypeParam documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+        TypeParam streamInstance;
+        ResultCode streamResult = AZ::JsonSerialization::LoadFromStream(streamInstance, stream, *this->m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetOutcome(), streamResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), streamResult.GetProcessing());
+        EXPECT_TRUE(streamInstance.Equals(documentInstance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonAdditionalFields_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kObjectType, this->m_jsonDocument->GetAllocator());
+
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        this->m_jsonDocument->Accept(writer);
+        AZ::IO::MemoryStream stream(buffer.GetString(), buffer.GetSize());
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(loadInstance, stream, *this->m_deserializationSettings);
+        ASSERT_NE(Processing::Halted, loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -334,6 +391,101 @@ namespace JsonSerializationTests
         EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
     }
 
+    // LoadFromStream
+
+    TEST_F(JsonSerializationTests, LoadFromStream_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::string_view json = "[13,42,88]";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(loadValues, stream, *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_ArrayLargerThanStreamBuffer_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        AZStd::vector<int> expectedValues;
+        AZStd::string json = "[";
+        for (int i = 0; i < 100000; ++i)
+        {
+            expectedValues.push_back(i * 7);
+            json += AZStd::string::format("%s%i", i == 0 ? "" : ",", i * 7);
+        }
+        json += "]";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(loadValues, stream, *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(expectedValues, loadValues);
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_PointerToSameClass_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+
+        AZStd::string_view json =
+            R"({
+                    "pointer": 
+                    {
+                        "$type": "BaseClass"
+                    }
+                })";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(instance, stream, *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::DefaultsUsed, loadResult.GetOutcome());
+
+        ASSERT_NE(nullptr, instance.m_pointer);
+        EXPECT_EQ(azrtti_typeid(instance.m_pointer), azrtti_typeid<BaseClass>());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_TruncatedJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        AZStd::string_view json = R"({ "var1": 42, "var2": )";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        SimpleClass instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(instance, stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_ContentAfterRootValue_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        AZStd::string_view json = R"({ "var1": 42 } { "var1": 88 })";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        SimpleClass instance;
+        ResultCode loadResult = AZ::JsonSerialization::LoadFromStream(instance, stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+    }
+
     // Store
 
     TEST_F(JsonSerializationTests, Store_PrimitiveAtTheRoot_ReturnsSuccessAndTheValueAtTheRoot)
@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/RapidJsonAllocator.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::JsonStreamingBenchmarks
+{
+    // A simplified version of the layout of a prefab, which is mostly made up of entities with a list of components.
+    struct BenchmarkComponent
+    {
+        AZ_TYPE_INFO(BenchmarkComponent, "{A0B3C6E2-5A0D-4C9E-9D61-1D6C0E7E3F51}");
+
+        AZStd::string m_type;
+        AZ::u64 m_id{ 0 };
+        float m_weight{ 0.0f };
+        bool m_enabled{ true };
+        AZStd::vector<float> m_values;
+    };
+
+    struct BenchmarkEntity
+    {
+        AZ_TYPE_INFO(BenchmarkEntity, "{7E4C1B0F-3D58-4A7A-8F0B-2C5E9A6D4B13}");
+
+        AZStd::string m_name;
+        AZ::u64 m_id{ 0 };
+        AZStd::vector<BenchmarkComponent> m_components;
+    };
+
+    struct BenchmarkPrefab
+    {
+        AZ_TYPE_INFO(BenchmarkPrefab, "{C2F9D3A4-8B61-4E0C-A5D7-6F1B2E8C9A70}");
+
+        AZStd::string m_name;
+        AZStd::vector<BenchmarkEntity> m_entities;
+    };
+
+    //! Generic stream over a string that tracks the peak memory use of the json and system allocators, sampled every time
+    //! the deserializer reads a block from the stream.
+    class PeakMemoryTrackingStream
+        : public AZ::IO::MemoryStream
+    {
+    public:
+        explicit PeakMemoryTrackingStream(const AZStd::string& json)
+            : AZ::IO::MemoryStream(json.data(), json.size())
+            , m_baseline(GetAllocatedBytes())
+        {
+        }
+
+        AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override
+        {
+            SamplePeakMemory();
+            return AZ::IO::MemoryStream::Read(bytes, oBuffer);
+        }
+
+        void SamplePeakMemory()
+        {
+            m_peak = AZStd::max(m_peak, GetAllocatedBytes());
+        }
+
+        size_t GetPeakMemory() const
+        {
+            return m_peak > m_baseline ? m_peak - m_baseline : 0;
+        }
+
+    private:
+        static size_t GetAllocatedBytes()
+        {
+            return AZ::AllocatorInstance<AZ::JSON::RapidJSONAllocator>::Get().NumAllocatedBytes() +
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().NumAllocatedBytes();
+        }
+
+        size_t m_baseline;
+        size_t m_peak{ 0 };
+    };
+
+    class JsonStreamingDeserializerBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpContexts();
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SetUpContexts();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            TearDownContexts();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDownContexts();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        //! Creates json for a prefab with the requested number of entities, each with a few components.
+        AZStd::string GeneratePrefabJson(int64_t entityCount)
+        {
+            BenchmarkPrefab prefab;
+            prefab.m_name = "BenchmarkPrefab";
+            prefab.m_entities.resize(entityCount);
+            for (int64_t entityIndex = 0; entityIndex < entityCount; ++entityIndex)
+            {
+                BenchmarkEntity& entity = prefab.m_entities[entityIndex];
+                entity.m_name = AZStd::string::format("Entity_%lli", static_cast<long long>(entityIndex));
+                entity.m_id = static_cast<AZ::u64>(entityIndex) * 7919;
+                entity.m_components.resize(4);
+                for (size_t componentIndex = 0; componentIndex < entity.m_components.size(); ++componentIndex)
+                {
+                    BenchmarkComponent& component = entity.m_components[componentIndex];
+                    component.m_type = AZStd::string::format("BenchmarkComponentType_%zu", componentIndex);
+                    component.m_id = entity.m_id + componentIndex;
+                    component.m_weight = static_cast<float>(componentIndex) * 0.25f;
+                    component.m_enabled = (componentIndex % 3) != 0;
+                    component.m_values.resize(16, static_cast<float>(entityIndex));
+                }
+            }
+
+            rapidjson::Document document;
+            AZ::JsonSerializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_jsonRegistrationContext.get();
+            AZ::JsonSerialization::Store(document, document.GetAllocator(), prefab, settings);
+
+            rapidjson::StringBuffer buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            document.Accept(writer);
+            return AZStd::string(buffer.GetString(), buffer.GetSize());
+        }
+
+        AZ::JsonDeserializerSettings GetDeserializerSettings()
+        {
+            AZ::JsonDeserializerSettings settings;
+            settings.m_serializeContext = m_serializeContext.get();
+            settings.m_registrationContext = m_jsonRegistrationContext.get();
+            return settings;
+        }
+
+    private:
+        void SetUpContexts()
+        {
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_jsonRegistrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            Reflect(m_serializeContext.get());
+            Reflect(m_jsonRegistrationContext.get());
+        }
+
+        void TearDownContexts()
+        {
+            m_serializeContext->EnableRemoveReflection();
+            m_jsonRegistrationContext->EnableRemoveReflection();
+            Reflect(m_serializeContext.get());
+            Reflect(m_jsonRegistrationContext.get());
+            m_serializeContext->DisableRemoveReflection();
+            m_jsonRegistrationContext->DisableRemoveReflection();
+
+            m_jsonRegistrationContext.reset();
+            m_serializeContext.reset();
+        }
+
+        static void Reflect(AZ::ReflectContext* context)
+        {
+            AZ::JsonSystemComponent::Reflect(context);
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<BenchmarkComponent>()
+                    ->Field("Type", &BenchmarkComponent::m_type)
+                    ->Field("Id", &BenchmarkComponent::m_id)
+                    ->Field("Weight", &BenchmarkComponent::m_weight)
+                    ->Field("Enabled", &BenchmarkComponent::m_enabled)
+                    ->Field("Values", &BenchmarkComponent::m_values);
+                serializeContext->Class<BenchmarkEntity>()
+                    ->Field("Name", &BenchmarkEntity::m_name)
+                    ->Field("Id", &BenchmarkEntity::m_id)
+                    ->Field("Components", &BenchmarkEntity::m_components);
+                serializeContext->Class<BenchmarkPrefab>()
+                    ->Field("Name", &BenchmarkPrefab::m_name)
+                    ->Field("Entities", &BenchmarkPrefab::m_entities);
+            }
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_jsonRegistrationContext;
+    };
+
+    BENCHMARK_DEFINE_F(JsonStreamingDeserializerBenchmark, LoadFromDocument)(benchmark::State& state)
+    {
+        AZStd::string json = GeneratePrefabJson(state.range(0));
+        AZ::JsonDeserializerSettings settings = GetDeserializerSettings();
+        size_t peakMemory = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            PeakMemoryTrackingStream stream(json);
+            BenchmarkPrefab prefab;
+            {
+                // Read the stream in the same way as JsonSerializationUtils::ReadJsonStream.
+                AZStd::string text;
+                text.resize_no_construct(stream.GetLength());
+                stream.Read(text.size(), text.data());
+                rapidjson::Document document;
+                document.Parse<rapidjson::kParseCommentsFlag>(text.data(), text.size());
+                AZ::JsonSerialization::Load(prefab, document, settings);
+                stream.SamplePeakMemory();
+            }
+            peakMemory = AZStd::max(peakMemory, stream.GetPeakMemory());
+
+            state.PauseTiming();
+            prefab = {};
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(json.size() * state.iterations());
+        state.counters["PeakMemory"] = benchmark::Counter(static_cast<double>(peakMemory), benchmark::Counter::kDefaults,
+            benchmark::Counter::kIs1024);
+    }
+    BENCHMARK_REGISTER_F(JsonStreamingDeserializerBenchmark, LoadFromDocument)
+        ->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+    BENCHMARK_DEFINE_F(JsonStreamingDeserializerBenchmark, LoadFromStream)(benchmark::State& state)
+    {
+        AZStd::string json = GeneratePrefabJson(state.range(0));
+        AZ::JsonDeserializerSettings settings = GetDeserializerSettings();
+        size_t peakMemory = 0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            PeakMemoryTrackingStream stream(json);
+            BenchmarkPrefab prefab;
+            AZ::JsonSerialization::LoadFromStream(prefab, stream, settings);
+            stream.SamplePeakMemory();
+            peakMemory = AZStd::max(peakMemory, stream.GetPeakMemory());
+
+            state.PauseTiming();
+            prefab = {};
+            state.ResumeTiming();
+        }
+
+        state.SetBytesProcessed(json.size() * state.iterations());
+        state.counters["PeakMemory"] = benchmark::Counter(static_cast<double>(peakMemory), benchmark::Counter::kDefaults,
+            benchmark::Counter::kIs1024);
+    }
+    BENCHMARK_REGISTER_F(JsonStreamingDeserializerBenchmark, LoadFromStream)
+        ->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+} // namespace AZ::JsonStreamingBenchmarks
+
+#endif // defined(HAVE_BENCHMARK)
@@ -722,6 +722,112 @@ tags=tools,renderer,metal)"
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/AnchorPath/Of/Settings"));
     }
 
+    class SettingsRegistryMergeUtilsSnapshotFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        void SetUp() override
+        {
+            m_registry = CreateRegistry();
+        }
+
+        void TearDown() override
+        {
+            m_registry.reset();
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> CreateRegistry()
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            const AZ::IO::FixedMaxPath testFolder = m_testFolder.GetDirectoryAsFixedMaxPath();
+            registry->Set(AZ::SettingsRegistryMergeUtils::FilePathKey_EngineRootFolder, (testFolder / "Engine").Native());
+            registry->Set(AZ::SettingsRegistryMergeUtils::FilePathKey_ProjectUserPath, (testFolder / "User").Native());
+            return registry;
+        }
+
+        size_t CountSnapshots()
+        {
+            size_t snapshotCount = 0;
+            const AZ::IO::FixedMaxPath snapshotFilter =
+                m_testFolder.GetDirectoryAsFixedMaxPath() / "User" / "SettingsRegistrySnapshots" / "*.setregbin";
+            AZ::IO::SystemFile::FindFiles(snapshotFilter.c_str(), [&snapshotCount](AZStd::string_view, bool isFile)
+            {
+                snapshotCount += isFile ? 1 : 0;
+                return true;
+            });
+            return snapshotCount;
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> m_registry;
+        AZ::Test::ScopedAutoTempDirectory m_testFolder;
+    };
+
+    TEST_F(SettingsRegistryMergeUtilsSnapshotFixture, MergeEngineRegistry_SecondMerge_MergedFromSnapshot)
+    {
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_testFolder, "Engine/Registry/engine.setreg",
+            R"({ "O3DE": { "Value": 1, "Text": "Engine" } })"));
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_testFolder, "Engine/Registry/override.setreg", R"({ "O3DE": { "Value": 2 } })"));
+
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(*m_registry, "", {}));
+        EXPECT_EQ(1, CountSnapshots());
+
+        auto registry = CreateRegistry();
+        AZStd::vector<AZStd::string> mergedFiles;
+        auto CollectMergedFiles = [&mergedFiles](const AZ::SettingsRegistryInterface::MergeEventArgs& mergeEventArgs)
+        {
+            mergedFiles.emplace_back(mergeEventArgs.m_mergeFilePath);
+        };
+        auto postMergeHandler = registry->RegisterPostMergeEvent(CollectMergedFiles);
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(*registry, "", {}));
+
+        ASSERT_EQ(1, mergedFiles.size());
+        EXPECT_TRUE(mergedFiles[0].ends_with(".setregbin"));
+        AZ::s64 value{};
+        EXPECT_TRUE(registry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(2, value);
+        AZ::SettingsRegistryInterface::FixedValueString text;
+        EXPECT_TRUE(registry->Get(text, "/O3DE/Text"));
+        EXPECT_EQ("Engine", text);
+    }
+
+    TEST_F(SettingsRegistryMergeUtilsSnapshotFixture, MergeEngineRegistry_FileAddedAfterSnapshot_FileMerged)
+    {
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_testFolder, "Engine/Registry/engine.setreg", R"({ "O3DE": { "Value": 1 } })"));
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(*m_registry, "", {}));
+        ASSERT_EQ(1, CountSnapshots());
+
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_testFolder, "Engine/Registry/override.setreg", R"({ "O3DE": { "Value": 2 } })"));
+        auto registry = CreateRegistry();
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(*registry, "", {}));
+
+        AZ::s64 value{};
+        EXPECT_TRUE(registry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(2, value);
+    }
+
+    TEST_F(SettingsRegistryMergeUtilsSnapshotFixture, MergeEngineRegistry_FileRemovesSetting_NoSnapshotWritten)
+    {
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_testFolder, "Engine/Registry/engine.setreg", R"({ "O3DE": { "Removed": null } })"));
+        ASSERT_TRUE(m_registry->Set("/O3DE/Removed", true));
+
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(*m_registry, "", {}));
+        EXPECT_EQ(0, CountSnapshots());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, m_registry->GetType("/O3DE/Removed"));
+    }
+
+    TEST_F(SettingsRegistryMergeUtilsSnapshotFixture, MergeEngineRegistry_SnapshotsDisabled_NoSnapshotWritten)
+    {
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_testFolder, "Engine/Registry/engine.setreg", R"({ "O3DE": { "Value": 1 } })"));
+        ASSERT_TRUE(m_registry->Set(AZ::SettingsRegistryMergeUtils::SettingsRegistrySnapshotsEnabledKey, false));
+
+        EXPECT_TRUE(AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(*m_registry, "", {}));
+        EXPECT_EQ(0, CountSnapshots());
+        AZ::s64 value{};
+        EXPECT_TRUE(m_registry->Get(value, "/O3DE/Value"));
+        EXPECT_EQ(1, value);
+    }
+
     using SettingsRegistryAncestorDescendantOrEqualPathFixture = SettingsRegistryMergeUtilsCommandLineFixture;
 
     TEST_F(SettingsRegistryAncestorDescendantOrEqualPathFixture, ValidateThatAncestorOrDescendantOrPathWithTheSameValue_Succeeds)
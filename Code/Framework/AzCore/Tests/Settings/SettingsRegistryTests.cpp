@@ -12,7 +12,9 @@
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
+#include <AzCore/Settings/SettingsRegistryCachedValue.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1787,4 +1789,182 @@ namespace SettingsRegistryTests
         // The message structure should contain the error message
         EXPECT_FALSE(result.GetMessages().empty());
     }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsSnapshot_SnapshotOfMergedFile_MatchesMergedSettings)
+    {
+        auto sourceFile = AZ::Test::CreateTestFile(m_tempDirectory, "Snapshot.setreg",
+            R"({
+                "O3DE": {
+                    "String": "Hello",
+                    "Signed": -42,
+                    "Unsigned": 18446744073709551615,
+                    "Double": 4.5,
+                    "Bool": true,
+                    "Array": [ 1, { "Nested": "Value" }, [] ],
+                    "EmptyObject": {},
+                    "Escaped/Key~Name": 7
+                }
+            })");
+        ASSERT_TRUE(sourceFile);
+        ASSERT_TRUE(m_registry->MergeSettingsFile(sourceFile->Native(), AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        const AZ::IO::FixedMaxPath snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Snapshot.setregbin";
+        const AZ::IO::Path sources[] = { AZ::IO::Path(sourceFile->Native()) };
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Write(snapshotPath.c_str(), *m_registry, sources));
+
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Open(snapshotPath.c_str()));
+        EXPECT_TRUE(snapshot.IsUpToDate());
+        AZStd::string_view snapshotString;
+        EXPECT_TRUE(snapshot.Get(snapshotString, "/O3DE/Array/1/Nested"));
+        EXPECT_EQ("Value", snapshotString);
+        AZ::s64 snapshotSigned{};
+        EXPECT_TRUE(snapshot.Get(snapshotSigned, "/O3DE/Escaped~1Key~0Name"));
+        EXPECT_EQ(7, snapshotSigned);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshot.GetType("/O3DE/Missing"));
+        snapshot.Close();
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        auto result = snapshotRegistry.MergeSettingsSnapshot(snapshotPath.Native(), "/Anchor");
+        ASSERT_TRUE(result) << result.GetMessages().c_str();
+
+        AZStd::string stringValue;
+        EXPECT_TRUE(snapshotRegistry.Get(stringValue, "/Anchor/O3DE/String"));
+        EXPECT_EQ("Hello", stringValue);
+        AZ::s64 signedValue{};
+        EXPECT_TRUE(snapshotRegistry.Get(signedValue, "/Anchor/O3DE/Signed"));
+        EXPECT_EQ(-42, signedValue);
+        AZ::u64 unsignedValue{};
+        EXPECT_TRUE(snapshotRegistry.Get(unsignedValue, "/Anchor/O3DE/Unsigned"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), unsignedValue);
+        double doubleValue{};
+        EXPECT_TRUE(snapshotRegistry.Get(doubleValue, "/Anchor/O3DE/Double"));
+        EXPECT_DOUBLE_EQ(4.5, doubleValue);
+        bool boolValue{};
+        EXPECT_TRUE(snapshotRegistry.Get(boolValue, "/Anchor/O3DE/Bool"));
+        EXPECT_TRUE(boolValue);
+        stringValue.clear();
+        EXPECT_TRUE(snapshotRegistry.Get(stringValue, "/Anchor/O3DE/Array/1/Nested"));
+        EXPECT_EQ("Value", stringValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, snapshotRegistry.GetType("/Anchor/O3DE/Array/2"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Object, snapshotRegistry.GetType("/Anchor/O3DE/EmptyObject"));
+        EXPECT_TRUE(snapshotRegistry.Get(signedValue, "/Anchor/O3DE/Escaped~1Key~0Name"));
+        EXPECT_EQ(7, signedValue);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsSnapshot_SourceFileRemoved_ReportsErrorAndLeavesRegistryUntouched)
+    {
+        auto sourceFile = AZ::Test::CreateTestFile(m_tempDirectory, "Snapshot.setreg", R"({ "O3DE": { "Value": 1 } })");
+        ASSERT_TRUE(sourceFile);
+        ASSERT_TRUE(m_registry->MergeSettingsFile(sourceFile->Native(), AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        const AZ::IO::FixedMaxPath snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Snapshot.setregbin";
+        const AZ::IO::Path sources[] = { AZ::IO::Path(sourceFile->Native()) };
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Write(snapshotPath.c_str(), *m_registry, sources));
+        ASSERT_TRUE(AZ::IO::SystemFile::Delete(sourceFile->c_str()));
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        auto result = snapshotRegistry.MergeSettingsSnapshot(snapshotPath.Native());
+        EXPECT_FALSE(result);
+        EXPECT_FALSE(result.GetMessages().empty());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType("/O3DE"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsSnapshot_DamagedSnapshot_ReportsErrorAndReturnsFalse)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "O3DE": { "Value": "Text" } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        const AZ::IO::FixedMaxPath snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Snapshot.setregbin";
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Write(snapshotPath.c_str(), *m_registry, {}));
+
+        AZ::IO::SystemFile snapshotFile;
+        ASSERT_TRUE(snapshotFile.Open(snapshotPath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_WRITE));
+        snapshotFile.Seek(snapshotFile.Length() - 1, AZ::IO::SystemFile::SF_SEEK_BEGIN);
+        constexpr char damagedByte = '!';
+        ASSERT_EQ(1u, snapshotFile.Write(&damagedByte, 1));
+        snapshotFile.Close();
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        auto result = snapshotRegistry.MergeSettingsSnapshot(snapshotPath.Native());
+        EXPECT_FALSE(result);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType("/O3DE"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsSnapshot_FileAddedToSourceFolder_ReportsErrorAndLeavesRegistryUntouched)
+    {
+        const AZ::IO::FixedMaxPath registryFolder =
+            m_tempDirectory.GetDirectoryAsFixedMaxPath() / AZ::SettingsRegistryInterface::RegistryFolder;
+        auto sourceFile = AZ::Test::CreateTestFile(m_tempDirectory,
+            AZ::IO::FixedMaxPath(AZ::SettingsRegistryInterface::RegistryFolder) / "Snapshot.setreg", R"({ "O3DE": { "Value": 1 } })");
+        ASSERT_TRUE(sourceFile);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder.Native(), { "editor", "test" }, {}));
+
+        const AZ::IO::FixedMaxPath snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Snapshot.setregbin";
+        const AZ::IO::Path sources[] = { AZ::IO::Path(sourceFile->Native()) };
+        const AZ::IO::Path sourceFolders[] = { AZ::IO::Path(registryFolder.Native()) };
+        ASSERT_TRUE(AZ::SettingsRegistrySnapshot::Write(snapshotPath.c_str(), *m_registry, sources, sourceFolders));
+
+        AZ::SettingsRegistrySnapshot snapshot;
+        ASSERT_TRUE(snapshot.Open(snapshotPath.c_str()));
+        EXPECT_TRUE(snapshot.IsUpToDate());
+
+        // A new file in the folder would be merged as well, so the snapshot no longer matches the merged settings
+        ASSERT_TRUE(AZ::Test::CreateTestFile(m_tempDirectory,
+            AZ::IO::FixedMaxPath(AZ::SettingsRegistryInterface::RegistryFolder) / "Added.setreg", R"({ "O3DE": { "Value": 2 } })"));
+        EXPECT_FALSE(snapshot.IsUpToDate());
+        snapshot.Close();
+
+        AZ::SettingsRegistryImpl snapshotRegistry;
+        auto result = snapshotRegistry.MergeSettingsSnapshot(snapshotPath.Native());
+        EXPECT_FALSE(result);
+        EXPECT_FALSE(result.GetMessages().empty());
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, snapshotRegistry.GetType("/O3DE"));
+    }
+
+    TEST_F(SettingsRegistryTest, WriteSettingsSnapshot_SettingsContainNull_Fails)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"([ { "op": "add", "path": "/O3DE", "value": { "Value": null } } ])",
+            AZ::SettingsRegistryInterface::Format::JsonPatch));
+        ASSERT_EQ(AZ::SettingsRegistryInterface::Type::Null, m_registry->GetType("/O3DE/Value"));
+
+        // A null would delete the setting when the snapshot is merged as a JSON merge patch
+        const AZ::IO::FixedMaxPath snapshotPath = m_tempDirectory.GetDirectoryAsFixedMaxPath() / "Snapshot.setregbin";
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Write(snapshotPath.c_str(), *m_registry, {}));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_FALSE(AZ::IO::SystemFile::Exists(snapshotPath.c_str()));
+    }
+
+    TEST_F(SettingsRegistryTest, CachedValue_SettingNotSet_ReturnsDefaultValue)
+    {
+        AZ::SettingsRegistryCachedValue<AZ::s64> cachedValue(*m_registry, "/O3DE/Cached", 42);
+        EXPECT_EQ(42, cachedValue.Get());
+    }
+
+    TEST_F(SettingsRegistryTest, CachedValue_SettingChanged_ReturnsUpdatedValue)
+    {
+        ASSERT_TRUE(m_registry->Set("/O3DE/Cached", 1.5));
+        AZ::SettingsRegistryCachedValue<double> cachedValue(*m_registry, "/O3DE/Cached");
+        EXPECT_DOUBLE_EQ(1.5, cachedValue.Get());
+
+        ASSERT_TRUE(m_registry->Set("/O3DE/Cached", 2.5));
+        EXPECT_DOUBLE_EQ(2.5, cachedValue.Get());
+
+        // A change to an unrelated setting keeps the cached value
+        ASSERT_TRUE(m_registry->Set("/O3DE/Other", 3.5));
+        EXPECT_DOUBLE_EQ(2.5, cachedValue.Get());
+    }
+
+    TEST_F(SettingsRegistryTest, CachedValue_AncestorMergedOrRemoved_ReturnsUpdatedValue)
+    {
+        AZ::SettingsRegistryCachedValue<bool> cachedValue(*m_registry, "/O3DE/Settings/Enabled");
+        EXPECT_FALSE(cachedValue.Get());
+
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "O3DE": { "Settings": { "Enabled": true } } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        EXPECT_TRUE(cachedValue.Get());
+
+        ASSERT_TRUE(m_registry->Remove("/O3DE/Settings"));
+        EXPECT_FALSE(cachedValue.Get());
+    }
 } // namespace SettingsRegistryTests
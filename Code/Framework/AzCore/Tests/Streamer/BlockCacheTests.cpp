@@ -1167,4 +1167,193 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+    /////////////////////////////////////////////////////////////
+    // Eviction and statistics block cache tests.
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheEvictionTest
+        : public BlockCacheTest
+    {
+    public:
+        static constexpr u32 NumBlocks = 4;
+        static constexpr u32 NumScanBlocks = 12;
+
+        void CreateTestEnvironment()
+        {
+            m_cacheSize = NumBlocks * m_blockSize;
+            m_fakeFileLength = NumScanBlocks * m_blockSize;
+            CreateTestEnvironmentImplementation(false);
+        }
+
+        //! Reads a small section from the middle of a block so only that block is read into the cache.
+        void ReadFromBlock(const RequestPath& path, u64 blockIndex)
+        {
+            ProcessRead(m_buffer, path, blockIndex * m_blockSize + 256, 512, IStreamerTypes::RequestStatus::Completed);
+            VerifyReadBuffer(blockIndex * m_blockSize + 256, 512);
+        }
+
+        void ScanFile(const RequestPath& path)
+        {
+            for (u64 i = 0; i < NumScanBlocks; ++i)
+            {
+                ReadFromBlock(path, i);
+            }
+        }
+
+        RequestPath m_scanPath{ "Scan" };
+    };
+
+    TEST_F(Streamer_BlockCacheEvictionTest, ReadFile_SequentialScanAfterReuse_ReusedBlockStaysCached)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ReadFromBlock(m_path, 0);
+        // Reading from the block again moves it to the protected segment.
+        ReadFromBlock(m_path, 0);
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(NumScanBlocks);
+        ScanFile(m_scanPath);
+
+        // The scan only recycles blocks on probation, so the block should still be cached.
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(0);
+        ReadFromBlock(m_path, 0);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, ReadFile_BlockReadAgainAfterEviction_BlockIsProtected)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        // Fill the cache and push the first block out of it.
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(NumBlocks + 2);
+        for (u64 i = 0; i <= NumBlocks; ++i)
+        {
+            ReadFromBlock(m_path, i);
+        }
+        // The first block was evicted before it was reused, so it'll be protected when it's read again.
+        ReadFromBlock(m_path, 0);
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(NumScanBlocks);
+        ScanFile(m_scanPath);
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(0);
+        ReadFromBlock(m_path, 0);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, ReadFile_SequentialScanWithoutReuse_OldestBlocksAreEvicted)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ReadFromBlock(m_path, 0);
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(NumScanBlocks);
+        ScanFile(m_scanPath);
+
+        // The block was never reused so it was evicted by the scan.
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ReadFromBlock(m_path, 0);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, GetFileCacheStatistics_ReadsFromMultipleFiles_HitsAndMissesAreCountedPerFile)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(3);
+        ReadFromBlock(m_path, 0);
+        ReadFromBlock(m_path, 0);
+        ReadFromBlock(m_path, 0);
+        ReadFromBlock(m_path, 1);
+        ReadFromBlock(m_scanPath, 0);
+
+        BlockCache::FileCacheStatistics fileStatistics = m_cache->GetFileCacheStatistics(m_path);
+        EXPECT_EQ(2, fileStatistics.m_hits);
+        EXPECT_EQ(2, fileStatistics.m_misses);
+
+        BlockCache::FileCacheStatistics scanStatistics = m_cache->GetFileCacheStatistics(m_scanPath);
+        EXPECT_EQ(0, scanStatistics.m_hits);
+        EXPECT_EQ(1, scanStatistics.m_misses);
+
+        BlockCache::FileCacheStatistics unknownStatistics = m_cache->GetFileCacheStatistics(RequestPath("Unknown"));
+        EXPECT_EQ(0, unknownStatistics.m_hits);
+        EXPECT_EQ(0, unknownStatistics.m_misses);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, Resize_QueueResizeRequest_CacheIsResizedAndCachedDataDiscarded)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ReadFromBlock(m_path, 0);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateCustom(AZStd::any(BlockCacheResizeData{ 2 * NumBlocks * m_blockSize }));
+        RunAndCompleteRequest(request, IStreamerTypes::RequestStatus::Completed);
+        EXPECT_EQ(2 * NumBlocks, m_cache->GetNumBlocks());
+        EXPECT_EQ(2 * NumBlocks * m_blockSize, m_cache->GetCacheSize());
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ReadFromBlock(m_path, 0);
+    }
+
+    TEST_F(Streamer_BlockCacheEvictionTest, Resize_ResizeWhileReadIsInFlight_ResizeAppliedAfterReadCompletes)
+    {
+        using ::testing::_;
+
+        using ::testing::Return;
+
+        CreateTestEnvironment();
+
+        // Hold on to the read into the cache block so it stays in-flight.
+        FileRequest* cacheRead = nullptr;
+        EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .WillRepeatedly([this, &cacheRead](FileRequest* request)
+                {
+                    if (AZStd::holds_alternative<Requests::ReadData>(request->GetCommand()))
+                    {
+                        cacheRead = request;
+                    }
+                    else
+                    {
+                        QueueReadRequest(request);
+                    }
+                });
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+
+        IStreamerTypes::RequestStatus result = IStreamerTypes::RequestStatus::Pending;
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, m_buffer, 512, m_path, 256, 512);
+        request->SetCompletionCallback([&result](const FileRequest& request)
+            {
+                result = request.GetStatus();
+            });
+        m_cache->QueueRequest(request);
+        RunProcessLoop();
+        ASSERT_NE(nullptr, cacheRead);
+
+        m_cache->ResizeCache(2 * NumBlocks * m_blockSize);
+        EXPECT_EQ(NumBlocks, m_cache->GetNumBlocks());
+
+        QueueReadRequest(cacheRead);
+        RunProcessLoop();
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, result);
+        VerifyReadBuffer(256, 512);
+        EXPECT_EQ(2 * NumBlocks, m_cache->GetNumBlocks());
+    }
 } // namespace AZ::IO
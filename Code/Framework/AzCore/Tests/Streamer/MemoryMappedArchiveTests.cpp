@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/MemoryMappedArchive.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class MemoryMappedArchiveTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<MemoryMappedArchive>
+    {
+    public:
+        MemoryMappedArchive CreateInstance() override
+        {
+            return MemoryMappedArchive(2, 0, false);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_MemoryMappedArchiveConformityTests, StreamStackEntryConformityTests, MemoryMappedArchiveTestDescription);
+
+    class Streamer_MemoryMappedArchiveTest
+        : public UnitTest::LeakDetectionFixture
+        , public CompressionBus::Handler
+    {
+    public:
+        static constexpr u64 ArchiveHeaderSize = 512;
+        static constexpr u64 PayloadSize = 64 * 1024;
+        static constexpr u64 MinViewSize = 1024;
+
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            m_tempDirectory = AZStd::make_unique<AZ::Test::ScopedAutoTempDirectory>();
+            m_archivePath = m_tempDirectory->Resolve("Archive.pak");
+            m_payloadPath = m_tempDirectory->Resolve("Payload.bin");
+            CreateArchive();
+
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_context = AZStd::make_unique<StreamerContext>();
+            m_mappedArchive = AZStd::make_shared<MemoryMappedArchive>(2, MinViewSize, true);
+            m_mappedArchive->SetContext(*m_context);
+            m_mappedArchive->SetNext(m_mock);
+
+            BusConnect();
+        }
+
+        void TearDown() override
+        {
+            BusDisconnect();
+
+            m_mappedArchive.reset();
+            m_mock.reset();
+            m_context.reset();
+            m_tempDirectory.reset();
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        //! Writes a header followed by the payload, which stores 4 byte integers that match their offset in the payload.
+        void CreateArchive()
+        {
+            AZStd::unique_ptr<u32[]> buffer(new u32[(ArchiveHeaderSize + PayloadSize) / sizeof(u32)]);
+            memset(buffer.get(), 0xFF, ArchiveHeaderSize);
+            u32* payload = buffer.get() + (ArchiveHeaderSize / sizeof(u32));
+            for (u32 i = 0; i < PayloadSize / sizeof(u32); ++i)
+            {
+                payload[i] = i * sizeof(u32);
+            }
+
+            constexpr int openMode = SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_WRITE_ONLY;
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_archivePath.c_str(), openMode));
+            ASSERT_EQ(ArchiveHeaderSize + PayloadSize, file.Write(buffer.get(), ArchiveHeaderSize + PayloadSize));
+            file.Close();
+        }
+
+        //@{ CompressionBus Handler implementation.
+        void FindCompressionInfo(bool& found, CompressionInfo& info, const AZ::IO::PathView filePath) override
+        {
+            if (filePath == m_payloadPath)
+            {
+                found = true;
+                info.m_archiveFilename = RequestPath(m_archivePath);
+                info.m_offset = ArchiveHeaderSize;
+                info.m_compressedSize = PayloadSize;
+                info.m_uncompressedSize = PayloadSize;
+                info.m_isCompressed = m_isCompressed;
+                info.m_conflictResolution = m_conflictResolution;
+            }
+        }
+        //@}
+
+        FileRequest* CreateViewRead(u64 offset, u64 size)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateReadRequest(RequestPath(m_payloadPath), &m_allocator, offset, size,
+                FileRequest::s_noDeadlineTime, IStreamerTypes::s_priorityMedium);
+            // The scheduler locks the allocator of read requests before they're prepared.
+            m_allocator.LockAllocator();
+            return request;
+        }
+
+        //! Prepares a read that's expected to be passed on to the next entry. The request is completed as failed so it's released.
+        void PrepareForwardedRead(FileRequest* request)
+        {
+            using ::testing::_;
+
+            EXPECT_CALL(*m_mock, PrepareRequest(_)).Times(1);
+            ON_CALL(*m_mock, PrepareRequest(_))
+                .WillByDefault([this](FileRequest* request)
+                    {
+                        auto data = AZStd::get_if<Requests::ReadRequestData>(&request->GetCommand());
+                        ASSERT_NE(nullptr, data);
+                        EXPECT_EQ(nullptr, data->m_output);
+                        request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                        m_context->MarkRequestAsCompleted(request);
+                    });
+
+            m_mappedArchive->PrepareRequest(request);
+            m_context->FinalizeCompletedRequests();
+        }
+
+        void VerifyView(const Requests::ReadRequestData& data, u64 offset, u64 size)
+        {
+            ASSERT_NE(nullptr, data.m_output);
+            EXPECT_EQ(IStreamerTypes::MemoryType::MappedView, data.m_memoryType);
+            EXPECT_EQ(size, data.m_outputSize);
+            const u32* values = reinterpret_cast<const u32*>(data.m_output);
+            for (u64 i = 0; i < size / sizeof(u32); ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would cause a large amount of log noise.
+                ASSERT_EQ(offset + i * sizeof(u32), values[i]);
+            }
+        }
+
+        IStreamerTypes::DefaultRequestMemoryAllocator m_allocator{ AZ::AllocatorInstance<AZ::SystemAllocator>::Get(), true };
+        AZStd::unique_ptr<AZ::Test::ScopedAutoTempDirectory> m_tempDirectory;
+        AZ::IO::Path m_archivePath;
+        AZ::IO::Path m_payloadPath;
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<MemoryMappedArchive> m_mappedArchive;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        ConflictResolution m_conflictResolution{ ConflictResolution::UseArchiveOnly };
+        bool m_isCompressed{ false };
+    };
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_UncompressedFileInArchive_CompletedWithView)
+    {
+        using ::testing::_;
+        EXPECT_CALL(*m_mock, PrepareRequest(_)).Times(0);
+
+        bool isCompleted = false;
+        FileRequest* request = CreateViewRead(0, PayloadSize);
+        request->SetCompletionCallback([this, &isCompleted](FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                VerifyView(AZStd::get<Requests::ReadRequestData>(request.GetCommand()), 0, PayloadSize);
+                isCompleted = true;
+            });
+
+        m_mappedArchive->PrepareRequest(request);
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_TRUE(isCompleted);
+        EXPECT_EQ(0, m_allocator.GetNumLocks());
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_PartialReadFromArchive_ViewStartsAtOffset)
+    {
+        constexpr u64 offset = 4096;
+        constexpr u64 size = 8192;
+
+        bool isCompleted = false;
+        FileRequest* request = CreateViewRead(offset, size);
+        request->SetCompletionCallback([this, &isCompleted, offset, size](FileRequest& request)
+            {
+                VerifyView(AZStd::get<Requests::ReadRequestData>(request.GetCommand()), offset, size);
+                isCompleted = true;
+            });
+
+        m_mappedArchive->PrepareRequest(request);
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_TRUE(isCompleted);
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_ViewOutlivesFlushedArchive_ViewRemainsValid)
+    {
+        using ::testing::_;
+
+        bool isCompleted = false;
+        FileRequest* request = CreateViewRead(0, PayloadSize);
+        request->SetCompletionCallback([this, &isCompleted](FileRequest& request)
+            {
+                VerifyView(AZStd::get<Requests::ReadRequestData>(request.GetCommand()), 0, PayloadSize);
+                isCompleted = true;
+            });
+        m_mappedArchive->PrepareRequest(request);
+
+        // Flush the archive before the completed request is released. The request still pins the mapping.
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1);
+        ON_CALL(*m_mock, QueueRequest(_)).WillByDefault(
+            [this](FileRequest* request)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            });
+        FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlushAll();
+        m_mappedArchive->QueueRequest(flushRequest);
+
+        m_context->FinalizeCompletedRequests();
+        EXPECT_TRUE(isCompleted);
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_AllocatorDoesNotAcceptViews_RequestIsForwarded)
+    {
+        IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateReadRequest(RequestPath(m_payloadPath), &allocator, 0, PayloadSize,
+            FileRequest::s_noDeadlineTime, IStreamerTypes::s_priorityMedium);
+        allocator.LockAllocator();
+
+        PrepareForwardedRead(request);
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_CompressedFile_RequestIsForwarded)
+    {
+        m_isCompressed = true;
+        PrepareForwardedRead(CreateViewRead(0, PayloadSize));
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_FilePrefersLooseFile_RequestIsForwarded)
+    {
+        m_conflictResolution = ConflictResolution::PreferFile;
+        PrepareForwardedRead(CreateViewRead(0, PayloadSize));
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_ReadSmallerThanMinimalViewSize_RequestIsForwarded)
+    {
+        PrepareForwardedRead(CreateViewRead(0, MinViewSize - sizeof(u32)));
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_ReadPastEndOfFile_RequestIsForwarded)
+    {
+        PrepareForwardedRead(CreateViewRead(PayloadSize - MinViewSize, 2 * MinViewSize));
+    }
+
+    TEST_F(Streamer_MemoryMappedArchiveTest, PrepareRequest_FileNotInArchive_RequestIsForwarded)
+    {
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateReadRequest(RequestPath(m_archivePath), &m_allocator, 0, PayloadSize,
+            FileRequest::s_noDeadlineTime, IStreamerTypes::s_priorityMedium);
+        m_allocator.LockAllocator();
+
+        PrepareForwardedRead(request);
+    }
+} // namespace AZ::IO
@@ -8,6 +8,10 @@
 
 #include <AzCore/Task/TaskGraph.h>
 #include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
@@ -17,9 +21,16 @@
 using AZ::TaskDescriptor;
 using AZ::TaskGraph;
 using AZ::TaskGraphEvent;
+using AZ::TaskToken;
 using AZ::TaskExecutor;
 using AZ::Internal::Task;
 using AZ::TaskPriority;
+using AZ::Job;
+using AZ::JobCompletion;
+using AZ::JobContext;
+using AZ::JobManager;
+using AZ::JobManagerDesc;
+using AZ::JobManagerThreadDesc;
 
 static TaskDescriptor defaultTD{ "TaskGraphTestTask", "TaskGraphTests" };
 
@@ -465,7 +476,7 @@ namespace UnitTest
         EXPECT_EQ(3, x);
     }
 
-    // Waiting inside a task is disallowed , test that it fails correctly
+    // Waiting inside a task runs other tasks on the waiting worker until the subgraph completes
     TEST_F(TaskGraphTestFixture, SpawnSubgraph)
     {
         AZStd::atomic<int> x = 0;
@@ -512,10 +523,7 @@ namespace UnitTest
                 f.Precedes(g);
                 TaskGraphEvent ev{ "ev" };
                 subgraph.SubmitOnExecutor(*m_executor, &ev);
-                // TaskGraphEvent::Wait asserts if called on a worker thread, suppress & validate assert
-                AZ_TEST_START_TRACE_SUPPRESSION;
                 ev.Wait();
-                AZ_TEST_STOP_TRACE_SUPPRESSION(1);
             });
         auto d = graph.AddTask(
             defaultTD,
@@ -624,6 +632,262 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraphUserData)
+    {
+        struct FrameData
+        {
+            int m_input = 0;
+            int m_output = 0;
+        };
+        FrameData frames[2][3];
+        AZStd::atomic<int> unboundCount = 0;
+
+        TaskGraph graph{ "RetainedGraphUserData" };
+        AZStd::vector<TaskToken> tokens;
+        for (int i = 0; i < 3; ++i)
+        {
+            tokens.push_back(graph.AddTask(
+                defaultTD,
+                [](FrameData* data)
+                {
+                    data->m_output = data->m_input * 2;
+                }));
+        }
+        // Nothing is ever bound to the last task, which receives nullptr
+        auto unbound = graph.AddTask(
+            defaultTD,
+            [&unboundCount](FrameData* data)
+            {
+                if (data == nullptr)
+                {
+                    ++unboundCount;
+                }
+            });
+        tokens[0].Precedes(tokens[1], tokens[2]);
+        unbound.Follows(tokens[1], tokens[2]);
+
+        // Bind before the graph is compiled for the first frame, and rebind the compiled graph for the following ones
+        for (int frame = 0; frame < 4; ++frame)
+        {
+            FrameData* frameData = frames[frame % 2];
+            for (int i = 0; i < 3; ++i)
+            {
+                frameData[i].m_input = frame * 10 + i;
+                graph.Bind(tokens[i], &frameData[i]);
+            }
+
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            for (int i = 0; i < 3; ++i)
+            {
+                EXPECT_EQ((frame * 10 + i) * 2, frameData[i].m_output);
+            }
+        }
+        EXPECT_EQ(4, unboundCount);
+    }
+
+    TEST_F(TaskGraphTestFixture, FineGrainedGraph)
+    {
+        constexpr int TaskCount = 10000;
+        constexpr int ChainCount = 64;
+        constexpr int ChainLength = 64;
+
+        AZStd::atomic<int> x = 0;
+        AZStd::atomic<int> outOfOrderCount = 0;
+        int chainPositions[ChainCount] = {};
+
+        TaskGraph graph{ "FineGrainedGraph" };
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                AZStd::fill(AZStd::begin(chainPositions), AZStd::end(chainPositions), 0);
+            });
+        auto join = graph.AddTask(
+            defaultTD,
+            []
+            {
+            });
+
+        // Many tiny independent tasks forking from the root
+        for (int i = 0; i < TaskCount; ++i)
+        {
+            auto task = graph.AddTask(
+                defaultTD,
+                [&x]
+                {
+                    ++x;
+                });
+            root.Precedes(task);
+            task.Precedes(join);
+        }
+
+        // Chains of tasks hinting they should run on the same worker
+        for (int chain = 0; chain < ChainCount; ++chain)
+        {
+            const TaskDescriptor chainTD{ "TaskGraphTestChainTask", "TaskGraphTests", TaskPriority::MEDIUM, aznumeric_cast<uint16_t>(chain + 1) };
+            AZStd::vector<TaskToken> chainTasks;
+            for (int position = 0; position < ChainLength; ++position)
+            {
+                chainTasks.push_back(graph.AddTask(
+                    chainTD,
+                    [&x, &outOfOrderCount, &chainPositions, chain, position]
+                    {
+                        if (chainPositions[chain]++ != position)
+                        {
+                            ++outOfOrderCount;
+                        }
+                        ++x;
+                    }));
+            }
+            root.Precedes(chainTasks.front());
+            for (int position = 1; position < ChainLength; ++position)
+            {
+                chainTasks[position - 1].Precedes(chainTasks[position]);
+            }
+            chainTasks.back().Precedes(join);
+        }
+
+        for (int submission = 0; submission < 2; ++submission)
+        {
+            x = 0;
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+
+            EXPECT_EQ(TaskCount + ChainCount * ChainLength, x);
+            EXPECT_EQ(0, outOfOrderCount);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, AffinityTasksRunOnTheSameWorker)
+    {
+        constexpr int TaskCount = 256;
+        const TaskDescriptor affinityTD{ "TaskGraphTestAffinityTask", "TaskGraphTests", TaskPriority::MEDIUM, 3 };
+        // Use several workers independent of the core count, so that there are workers which could steal
+        TaskExecutor executor(4);
+
+        AZStd::thread_id threadIds[TaskCount];
+        // The tasks are submitted from a worker when the root completes, and from the waiting thread otherwise
+        for (bool hasRoot : { false, true })
+        {
+            TaskGraph graph{ "AffinityTasks" };
+            auto root = graph.AddTask(
+                defaultTD,
+                []
+                {
+                });
+            for (int i = 0; i < TaskCount; ++i)
+            {
+                auto task = graph.AddTask(
+                    affinityTD,
+                    [&threadIds, i]
+                    {
+                        threadIds[i] = AZStd::this_thread::get_id();
+                    });
+                if (hasRoot)
+                {
+                    root.Precedes(task);
+                }
+            }
+
+            TaskGraphEvent ev{ "ev" };
+            graph.SubmitOnExecutor(executor, &ev);
+            ev.Wait();
+
+            // Tasks with an affinity aren't stolen while their worker keeps up, even while other workers are idle
+            for (int i = 1; i < TaskCount; ++i)
+            {
+                EXPECT_EQ(threadIds[0], threadIds[i]);
+            }
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, AffinityTasksStolenWhileTheirWorkerIsBusy)
+    {
+        constexpr int TaskCount = 16;
+        const TaskDescriptor affinityTD{ "TaskGraphTestAffinityTask", "TaskGraphTests", TaskPriority::MEDIUM, 1 };
+        TaskExecutor executor(2);
+
+        AZStd::atomic<int> completedCount = 0;
+        AZStd::thread_id threadIds[TaskCount];
+        TaskGraph innerGraph{ "AffinityTasksBehindBusyTask" };
+        for (int i = 0; i < TaskCount; ++i)
+        {
+            innerGraph.AddTask(
+                affinityTD,
+                [&threadIds, &completedCount, i]
+                {
+                    threadIds[i] = AZStd::this_thread::get_id();
+                    ++completedCount;
+                });
+        }
+
+        AZStd::thread_id busyThreadId;
+        TaskGraph graph{ "BusyAffinityTask" };
+        graph.AddTask(
+            affinityTD,
+            [&]
+            {
+                busyThreadId = AZStd::this_thread::get_id();
+                TaskGraphEvent innerEvent{ "innerEvent" };
+                innerGraph.SubmitOnExecutor(executor, &innerEvent);
+
+                // Stay busy until the idle worker took the tasks over, giving up after a while
+                const auto timeout = AZStd::chrono::steady_clock::now() + AZStd::chrono::seconds(5);
+                while (completedCount != TaskCount && AZStd::chrono::steady_clock::now() < timeout)
+                {
+                    AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                }
+                innerEvent.Wait();
+            });
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(TaskCount, completedCount);
+        for (int i = 0; i < TaskCount; ++i)
+        {
+            EXPECT_NE(busyThreadId, threadIds[i]);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, WaitInsideTask_WorkerParked_WokenUpWhenSignaled)
+    {
+        TaskExecutor executor(2);
+
+        AZStd::atomic<int> x = 0;
+        TaskGraph innerGraph{ "SlowInnerGraph" };
+        innerGraph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                // Long enough for the waiting worker to park
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(20));
+                ++x;
+            });
+
+        TaskGraph graph{ "WaitingGraph" };
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                TaskGraphEvent innerEvent{ "innerEvent" };
+                innerGraph.SubmitOnExecutor(executor, &innerEvent);
+                innerEvent.Wait();
+                EXPECT_EQ(1, x);
+                ++x;
+            });
+
+        TaskGraphEvent ev{ "ev" };
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+        EXPECT_EQ(2, x);
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -673,6 +937,223 @@ namespace Benchmark
         TaskExecutor* executor;
     };
 
+    // Fine grained graphs, to measure the scheduling overhead per task
+    constexpr int FineGrainedTaskCount = 100000;
+    constexpr int FineGrainedChainLength = 100;
+
+    class FineGrainedJobBenchmarkFixture : public ::benchmark::Fixture
+    {
+        void internalSetUp()
+        {
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            const uint32_t numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (uint32_t i = 0; i < numWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            jobManager = aznew JobManager(desc);
+            jobContext = aznew JobContext(*jobManager);
+        }
+
+        void internalTearDown()
+        {
+            delete jobContext;
+            delete jobManager;
+        }
+
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            internalSetUp();
+        }
+        void SetUp(benchmark::State&) override
+        {
+            internalSetUp();
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            internalTearDown();
+        }
+        void TearDown(benchmark::State&) override
+        {
+            internalTearDown();
+        }
+
+        JobManager* jobManager;
+        JobContext* jobContext;
+    };
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FineGrainedTasks)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraph fineGrainedGraph{ "FineGrainedTasks" };
+            for (int i = 0; i < FineGrainedTaskCount; ++i)
+            {
+                fineGrainedGraph.AddTask(
+                    descriptors[2],
+                    []
+                    {
+                        benchmark::ClobberMemory();
+                    });
+            }
+
+            TaskGraphEvent ev{ "ev" };
+            fineGrainedGraph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * FineGrainedTaskCount);
+    }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FineGrainedTasks_Retained)(benchmark::State& state)
+    {
+        for (int i = 0; i < FineGrainedTaskCount; ++i)
+        {
+            graph->AddTask(
+                descriptors[2],
+                []
+                {
+                    benchmark::ClobberMemory();
+                });
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * FineGrainedTaskCount);
+    }
+
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FineGrainedChains_Retained)(benchmark::State& state)
+    {
+        for (int chain = 0; chain < FineGrainedTaskCount / FineGrainedChainLength; ++chain)
+        {
+            AZStd::vector<TaskToken> chainTasks;
+            for (int position = 0; position < FineGrainedChainLength; ++position)
+            {
+                chainTasks.push_back(graph->AddTask(
+                    descriptors[2],
+                    []
+                    {
+                        benchmark::ClobberMemory();
+                    }));
+            }
+            for (int position = 1; position < FineGrainedChainLength; ++position)
+            {
+                chainTasks[position - 1].Precedes(chainTasks[position]);
+            }
+        }
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * FineGrainedTaskCount);
+    }
+
+    // A graph fed new data every frame, fanning out from a root task to FrameGraphTaskCount tasks joined by a final one
+    constexpr int FrameGraphTaskCount = 1024;
+
+    struct FrameGraphData
+    {
+        uint32_t m_input = 0;
+        uint32_t m_output = 0;
+    };
+
+    // The graph is rebuilt and compiled every frame, with its tasks capturing the frame data
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FrameGraph_Rebuilt)(benchmark::State& state)
+    {
+        AZStd::vector<FrameGraphData> frameData(FrameGraphTaskCount);
+        for ([[maybe_unused]] auto _ : state)
+        {
+            TaskGraph frameGraph{ "FrameGraph" };
+            auto root = frameGraph.AddTask(descriptors[2], [] {});
+            auto join = frameGraph.AddTask(descriptors[2], [] {});
+            for (FrameGraphData& data : frameData)
+            {
+                auto token = frameGraph.AddTask(
+                    descriptors[2],
+                    [&data]
+                    {
+                        data.m_output = data.m_input + 1;
+                    });
+                root.Precedes(token);
+                token.Precedes(join);
+            }
+
+            TaskGraphEvent ev{ "ev" };
+            frameGraph.SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * FrameGraphTaskCount);
+    }
+
+    // The graph is built once, and the frame data is rebound to its tasks every frame
+    BENCHMARK_F(TaskGraphBenchmarkFixture, FrameGraph_Retained)(benchmark::State& state)
+    {
+        AZStd::vector<FrameGraphData> frameData[2] = { AZStd::vector<FrameGraphData>(FrameGraphTaskCount),
+                                                       AZStd::vector<FrameGraphData>(FrameGraphTaskCount) };
+        AZStd::vector<TaskToken> tokens;
+        tokens.reserve(FrameGraphTaskCount);
+        auto root = graph->AddTask(descriptors[2], [] {});
+        auto join = graph->AddTask(descriptors[2], [] {});
+        for (int i = 0; i < FrameGraphTaskCount; ++i)
+        {
+            TaskToken& token = tokens.emplace_back(graph->AddTask(
+                descriptors[2],
+                [](FrameGraphData* data)
+                {
+                    data->m_output = data->m_input + 1;
+                }));
+            root.Precedes(token);
+            token.Precedes(join);
+        }
+
+        size_t frame = 0;
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZStd::vector<FrameGraphData>& data = frameData[frame++ % 2];
+            for (int i = 0; i < FrameGraphTaskCount; ++i)
+            {
+                graph->Bind(tokens[i], &data[i]);
+            }
+
+            TaskGraphEvent ev{ "ev" };
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+        }
+        state.SetItemsProcessed(state.iterations() * FrameGraphTaskCount);
+    }
+
+    // The same workload as FineGrainedTasks, run by the job manager
+    BENCHMARK_F(FineGrainedJobBenchmarkFixture, FineGrainedJobs)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            JobCompletion completion(jobContext);
+            for (int i = 0; i < FineGrainedTaskCount; ++i)
+            {
+                Job* job = AZ::CreateJobFunction(
+                    []
+                    {
+                        benchmark::ClobberMemory();
+                    },
+                    true, jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * FineGrainedTaskCount);
+    }
+
     BENCHMARK_F(TaskGraphBenchmarkFixture, QueueToDequeue)(benchmark::State& state)
     {
         graph->AddTask(
@@ -5,8 +5,11 @@
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
+#include <AzCore/Component/ParallelTickScheduler.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -65,3 +68,229 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
 }
+
+// ParallelTickBus handler with customizable tick-order and access.
+// When ticked it records the clock values at which its tick started and ended.
+struct ParallelTicker : public ParallelTickBus::Handler
+{
+    int m_order = TICK_DEFAULT; ///< Relative order on ParallelTickBus
+    bool m_declared = false; ///< Whether GetParallelTickAccess declares m_access
+    ParallelTickAccess m_access;
+    AZStd::atomic_int* m_clock = nullptr; ///< OnParallelTick, read the start and end times from this clock
+    int m_tickStart = -1;
+    int m_tickEnd = -1;
+    int m_tickCount = 0;
+    AZStd::thread::id m_tickThread;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // ParallelTickBus
+    int GetTickOrder() override { return m_order; }
+
+    bool GetParallelTickAccess(ParallelTickAccess& access) override
+    {
+        access = m_access;
+        return m_declared;
+    }
+
+    void OnParallelTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        m_tickThread = AZStd::this_thread::get_id();
+        m_tickStart = m_clock->fetch_add(1);
+        AZStd::this_thread::yield(); // Give conflicting handlers a chance to run while this one ticks
+        m_tickEnd = m_clock->fetch_add(1);
+        ++m_tickCount;
+    }
+    ///////////////////////////////////////////////////////////////////////////
+
+    bool ConflictsWith(const ParallelTicker& other) const
+    {
+        if (!m_declared || !other.m_declared)
+        {
+            return true;
+        }
+        auto accesses = [](const ParallelTickAccess::ResourceList& resources, Crc32 resource)
+        {
+            return AZStd::find(resources.begin(), resources.end(), resource) != resources.end();
+        };
+        for (Crc32 resource : m_access.m_writes)
+        {
+            if (accesses(other.m_access.m_reads, resource) || accesses(other.m_access.m_writes, resource))
+            {
+                return true;
+            }
+        }
+        for (Crc32 resource : m_access.m_reads)
+        {
+            if (accesses(other.m_access.m_writes, resource))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+class ParallelTickBusTest : public UnitTest::LeakDetectionFixture
+{
+public:
+    void SetUp() override
+    {
+        UnitTest::LeakDetectionFixture::SetUp();
+
+        m_executor = aznew TaskExecutor(4);
+        TaskExecutor::SetInstance(m_executor); // SetInstance is a null-op if there is already a default instance set
+    }
+
+    void TearDown() override
+    {
+        m_tickers.clear();
+        if (&TaskExecutor::Instance() == m_executor) // if this test created the default instance unset it before destroying it
+        {
+            TaskExecutor::SetInstance(nullptr);
+        }
+        azdestroy(m_executor);
+        UnitTest::LeakDetectionFixture::TearDown();
+    }
+
+protected:
+    ParallelTicker& AddTicker(int order, bool declared, ParallelTickAccess access = {})
+    {
+        ParallelTicker& ticker = m_tickers.emplace_back();
+        ticker.m_order = order;
+        ticker.m_declared = declared;
+        ticker.m_access = AZStd::move(access);
+        ticker.m_clock = &m_clock;
+        ticker.ParallelTickBus::Handler::BusConnect();
+        return ticker;
+    }
+
+    // Checks that every handler ticked once, and never concurrently with an earlier handler it conflicts with
+    void ValidateTicks()
+    {
+        AZStd::vector<ParallelTicker*> tickers;
+        for (ParallelTicker& ticker : m_tickers)
+        {
+            EXPECT_EQ(1, ticker.m_tickCount);
+            tickers.push_back(&ticker);
+            ticker.m_tickCount = 0;
+        }
+        AZStd::stable_sort(tickers.begin(), tickers.end(), [](const ParallelTicker* lhs, const ParallelTicker* rhs)
+        {
+            return lhs->m_order < rhs->m_order;
+        });
+        for (size_t later = 0; later < tickers.size(); ++later)
+        {
+            for (size_t earlier = 0; earlier < later; ++earlier)
+            {
+                if (tickers[earlier]->ConflictsWith(*tickers[later]))
+                {
+                    EXPECT_LT(tickers[earlier]->m_tickEnd, tickers[later]->m_tickStart)
+                        << "Handler " << earlier << " ticked concurrently with or after handler " << later;
+                }
+            }
+        }
+    }
+
+    static constexpr Crc32 Transforms = AZ_CRC_CE("TransformService");
+    static constexpr Crc32 Physics = AZ_CRC_CE("PhysicsService");
+
+    TaskExecutor* m_executor = nullptr;
+    AZStd::atomic_int m_clock{ 0 };
+    AZStd::list<ParallelTicker> m_tickers;
+};
+
+TEST_F(ParallelTickBusTest, TickSerial_HandlersFireInSortedOrder)
+{
+    AddTicker(7, true, { { Transforms }, {} });
+    AddTicker(5, false);
+    AddTicker(6, true, { {}, { Physics } });
+    AddTicker(3, true);
+    AddTicker(2, false);
+
+    ParallelTickScheduler scheduler;
+    scheduler.TickSerial(0.f, ScriptTimePoint{});
+    ValidateTicks();
+
+    AZStd::vector<int> tickOrder;
+    for (const ParallelTicker& ticker : m_tickers)
+    {
+        tickOrder.push_back(ticker.m_tickStart);
+    }
+    EXPECT_EQ((AZStd::vector<int>{ 8, 4, 6, 2, 0 }), tickOrder);
+}
+
+TEST_F(ParallelTickBusTest, BuildDependencies_OnlyConflictingHandlersDepend)
+{
+    // Readers don't depend on each other, the transform writer depends on all of them, and the next reader only on the writer
+    AddTicker(0, true, { { Transforms }, {} });
+    AddTicker(1, true, { { Transforms }, {} });
+    AddTicker(2, true, { { Transforms }, {} });
+    AddTicker(3, true, { { Transforms }, { Physics } });
+    AddTicker(4, true, { { Physics }, { Transforms } });
+    AddTicker(5, true, { { Transforms }, {} });
+
+    ParallelTickScheduler scheduler;
+    scheduler.TickSerial(0.f, ScriptTimePoint{});
+    EXPECT_EQ(5, scheduler.GetDependencyCount());
+    ValidateTicks();
+
+    // An undeclared handler only waits for the handlers nothing else waits for, and a declared handler after it only on it
+    AddTicker(6, false);
+    AddTicker(7, true, {});
+    scheduler.TickSerial(0.f, ScriptTimePoint{});
+    EXPECT_EQ(7, scheduler.GetDependencyCount());
+    ValidateTicks();
+}
+
+TEST_F(ParallelTickBusTest, TickOnExecutor_ConflictingHandlersNeverOverlap)
+{
+    constexpr Crc32 resources[] = { Transforms, Physics, AZ_CRC_CE("AnimationService"), AZ_CRC_CE("AudioService") };
+    AZ::SimpleLcgRandom random(1234);
+    for (int order = 0; order < 200; ++order)
+    {
+        const unsigned int kind = random.GetRandom() % 8;
+        if (kind == 0)
+        {
+            AddTicker(order, false);
+        }
+        else
+        {
+            ParallelTickAccess access;
+            access.m_reads.push_back(resources[random.GetRandom() % AZ_ARRAY_SIZE(resources)]);
+            if (kind < 3)
+            {
+                access.m_writes.push_back(resources[random.GetRandom() % AZ_ARRAY_SIZE(resources)]);
+            }
+            AddTicker(order, true, AZStd::move(access));
+        }
+    }
+
+    ParallelTickScheduler scheduler;
+    for (int tick = 0; tick < 3; ++tick)
+    {
+        scheduler.TickOnExecutor(*m_executor, 0.f, ScriptTimePoint{});
+        ValidateTicks();
+    }
+}
+
+TEST_F(ParallelTickBusTest, TickOnExecutor_UndeclaredHandlersTickOnCallingThread)
+{
+    for (int order = 0; order < 40; ++order)
+    {
+        AddTicker(order, order % 8 != 4, { { Transforms }, {} });
+    }
+
+    ParallelTickScheduler scheduler;
+    for (int tick = 0; tick < 3; ++tick)
+    {
+        scheduler.TickOnExecutor(*m_executor, 0.f, ScriptTimePoint{});
+        for (const ParallelTicker& ticker : m_tickers)
+        {
+            if (!ticker.m_declared)
+            {
+                EXPECT_EQ(AZStd::this_thread::get_id(), ticker.m_tickThread) << "Handler " << ticker.m_order << " ticked on a worker";
+            }
+        }
+        ValidateTicks();
+    }
+}
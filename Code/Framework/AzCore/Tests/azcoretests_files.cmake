@@ -111,6 +111,8 @@ set(FILES
     GenericStreamMock.h
     GenericStreamTests.cpp
     Math/AabbTests.cpp
+    Math/BatchMathPerformanceTests.cpp
+    Math/BatchMathTests.cpp
     Math/CapsuleTests.cpp
     Math/ColorTests.cpp
     Math/CrcTests.cpp
@@ -145,6 +147,7 @@ set(FILES
     Math/QuaternionPerformanceTests.cpp
     Math/QuaternionTests.cpp
     Math/RandomTests.cpp
+    Math/Sha1Tests.cpp
     Math/ShapeIntersectionPerformanceTests.cpp
     Math/ShapeIntersectionTests.cpp
     Math/SfmtTests.cpp
@@ -164,6 +167,7 @@ set(FILES
     Math/VectorNTests.cpp
     Math/VectorNPerformanceTests.cpp
     Math/PackedVectorTest.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorBenchmarks.cpp
     Memory/HphaAllocator.cpp
     Memory/HphaAllocatorErrorDetection.cpp
@@ -204,6 +208,7 @@ set(FILES
     Serialization/Json/JsonSerializationTests.h
     Serialization/Json/JsonSerializationTests.cpp
     Serialization/Json/JsonSerializationUtilsTests.cpp
+    Serialization/Json/JsonStreamingDeserializerBenchmarks.cpp
     Serialization/Json/JsonSerializerConformityTests.h
     Serialization/Json/JsonSerializerMock.h
     Serialization/Json/MapSerializerTests.cpp
@@ -253,6 +258,7 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/MemoryMappedArchiveTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
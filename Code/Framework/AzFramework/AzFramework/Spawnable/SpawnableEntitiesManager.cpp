@@ -8,9 +8,13 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
@@ -18,6 +22,55 @@
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 
+namespace AzFramework::SpawnableEntitiesManagerInternal
+{
+    //! Entity id map used by a single clone batch. Lookups go to the shared map with the pre-generated ids first, which isn't
+    //! modified while the batches run. Ids that weren't pre-generated are stored in a map that's local to the batch.
+    class BatchEntityIdMap
+    {
+    public:
+        using EntityIdMap = SpawnableEntitiesManager::EntityIdMap;
+        using value_type = EntityIdMap::value_type;
+        using iterator = const value_type*;
+
+        explicit BatchEntityIdMap(const EntityIdMap& sharedMap)
+            : m_sharedMap(sharedMap)
+        {
+        }
+
+        iterator find(const AZ::EntityId& id) const
+        {
+            if (auto it = m_sharedMap.find(id); it != m_sharedMap.end())
+            {
+                return &(*it);
+            }
+            if (auto it = m_localMap.find(id); it != m_localMap.end())
+            {
+                return &(*it);
+            }
+            return end();
+        }
+
+        iterator end() const
+        {
+            return nullptr;
+        }
+
+        AZStd::pair<iterator, bool> emplace(const AZ::EntityId& id, const AZ::EntityId& newId)
+        {
+            if (iterator it = find(id); it != end())
+            {
+                return { it, false };
+            }
+            auto result = m_localMap.emplace(id, newId);
+            return { &(*result.first), true };
+        }
+
+        const EntityIdMap& m_sharedMap;
+        EntityIdMap m_localMap;
+    };
+} // namespace AzFramework::SpawnableEntitiesManagerInternal
+
 namespace AzFramework
 {
     template<typename T>
@@ -44,6 +97,14 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 parallelCloneThreshold = m_parallelCloneThreshold;
+            settingsRegistry->Get(parallelCloneThreshold, "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold");
+            m_parallelCloneThreshold = aznumeric_cast<uint32_t>(AZStd::min(parallelCloneThreshold, AZ::u64{ AZStd::numeric_limits<uint32_t>::max() }));
+
+            AZ::u64 parallelCloneBatchSize = m_parallelCloneBatchSize;
+            settingsRegistry->Get(parallelCloneBatchSize, "/O3DE/AzFramework/Spawnables/ParallelCloneBatchSize");
+            m_parallelCloneBatchSize = aznumeric_cast<uint32_t>(AZStd::clamp(parallelCloneBatchSize, AZ::u64{ 1 }, AZ::u64{ AZStd::numeric_limits<uint32_t>::max() }));
         }
     }
 
@@ -411,6 +472,96 @@ namespace AzFramework
         }
     }
 
+    bool SpawnableEntitiesManager::CanCloneInParallel(size_t entityCount) const
+    {
+        if (m_parallelCloneThreshold == 0 || entityCount < m_parallelCloneThreshold)
+        {
+            return false;
+        }
+        auto taskGraphActiveInterface = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        return taskGraphActiveInterface && taskGraphActiveInterface->IsTaskGraphActive();
+    }
+
+    void SpawnableEntitiesManager::CloneAllEntitiesInParallel(
+        const Spawnable::EntityList& entityPrototypes,
+        AZ::Entity** clones,
+        EntityIdMap& prototypeToCloneMap,
+        AZ::SerializeContext& serializeContext)
+    {
+        using namespace SpawnableEntitiesManagerInternal;
+
+        // Must match the behavior of CloneSingleEntity.
+        constexpr bool allowDuplicateIds = false;
+
+        struct CloneBatches
+        {
+            const Spawnable::EntityList& m_prototypes;
+            AZ::Entity** m_clones;
+            AZ::SerializeContext& m_serializeContext;
+            AZStd::vector<BatchEntityIdMap> m_idMaps;
+            uint32_t m_batchSize;
+        };
+
+        const uint32_t entityCount = aznumeric_caster(entityPrototypes.size());
+        const uint32_t batchCount = (entityCount + m_parallelCloneBatchSize - 1) / m_parallelCloneBatchSize;
+        CloneBatches batches{ entityPrototypes, clones, serializeContext, {}, m_parallelCloneBatchSize };
+        batches.m_idMaps.reserve(batchCount);
+        for (uint32_t batch = 0; batch < batchCount; ++batch)
+        {
+            batches.m_idMaps.emplace_back(prototypeToCloneMap);
+        }
+
+        {
+            AZ_PROFILE_SCOPE(AzFramework, "SpawnableEntitiesManager::CloneAllEntitiesInParallel");
+            static const AZ::TaskDescriptor cloneBatchDescriptor{ "AzFramework::SpawnableEntitiesManager::CloneBatch", "AzFramework" };
+            AZ::TaskGraph graph("SpawnableEntitiesManager Clone");
+            for (uint32_t batch = 0; batch < batchCount; ++batch)
+            {
+                graph.AddTask(
+                    cloneBatchDescriptor,
+                    [&batches, batch, entityCount]()
+                    {
+                        const uint32_t begin = batch * batches.m_batchSize;
+                        const uint32_t end = AZStd::min(begin + batches.m_batchSize, entityCount);
+                        BatchEntityIdMap& idMap = batches.m_idMaps[batch];
+                        for (uint32_t i = begin; i < end; ++i)
+                        {
+                            batches.m_clones[i] =
+                                AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
+                                    batches.m_prototypes[i].get(), idMap, &batches.m_serializeContext);
+                        }
+                    });
+            }
+            AZ::TaskGraphEvent finishedEvent("SpawnableEntitiesManager Clone Wait");
+            graph.SubmitOnExecutor(AZ::TaskExecutor::Instance(), &finishedEvent);
+            finishedEvent.Wait();
+        }
+
+        // Fix-up pass, executed in batch order to keep the result deterministic. A batch that had to generate ids that weren't
+        // part of the pre-generated set would, when cloning serially, have made those ids visible to all entities that follow.
+        // This only happens for unusual entity data, so instead of tracking which clones could be affected, all clones after
+        // that batch are redone serially with the completed map.
+        bool hasGeneratedIds = false;
+        for (uint32_t batch = 0; batch < batchCount; ++batch)
+        {
+            if (hasGeneratedIds)
+            {
+                const uint32_t begin = batch * m_parallelCloneBatchSize;
+                const uint32_t end = AZStd::min(begin + m_parallelCloneBatchSize, entityCount);
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    delete clones[i];
+                    clones[i] = CloneSingleEntity(*entityPrototypes[i], prototypeToCloneMap, serializeContext);
+                }
+            }
+            else if (const EntityIdMap& generatedIds = batches.m_idMaps[batch].m_localMap; !generatedIds.empty())
+            {
+                prototypeToCloneMap.insert(generatedIds.begin(), generatedIds.end());
+                hasGeneratedIds = true;
+            }
+        }
+    }
+
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
         const Spawnable::EntityList& entities, EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned)
     {
@@ -476,7 +627,24 @@ namespace AzFramework
 
                 auto aliasIt = aliases.begin();
                 auto aliasEnd = aliases.end();
-                if (aliasIt == aliasEnd)
+                // Cloning in parallel requires that every prototype has a unique id, which is the case if every prototype got its own
+                // entry in the freshly initialized map. The ids are then not refreshed during cloning and the map stays unchanged.
+                if (aliasIt == aliasEnd && ticket.m_entityIdReferenceMap.size() == entitiesToSpawnSize &&
+                    CanCloneInParallel(entitiesToSpawnSize))
+                {
+                    for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
+                    {
+                        RefreshEntityIdMapping(
+                            entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                        spawnedEntityIndices.push_back(i);
+                    }
+
+                    spawnedEntities.resize(spawnedEntitiesInitialCount + entitiesToSpawnSize);
+                    CloneAllEntitiesInParallel(
+                        entitiesToSpawn, spawnedEntities.data() + spawnedEntitiesInitialCount, ticket.m_entityIdReferenceMap,
+                        *request.m_serializeContext);
+                }
+                else if (aliasIt == aliasEnd)
                 {
                     for (uint32_t i = 0; i < entitiesToSpawnSize; ++i)
                     {
@@ -277,6 +277,15 @@ namespace AzFramework
             const AZ::Entity::ComponentArrayType& componentPrototypes,
             EntityIdMap& prototypeToCloneMap,
             AZ::SerializeContext& serializeContext);
+        //! Clones all prototypes in batches on the task graph. The id map has to contain a unique mapping for every prototype and
+        //! isn't modified while the batches run. Ids that weren't pre-generated are tracked per batch and merged back in order
+        //! afterwards, so the result is the same as cloning the prototypes one after the other.
+        void CloneAllEntitiesInParallel(
+            const Spawnable::EntityList& entityPrototypes,
+            AZ::Entity** clones,
+            EntityIdMap& prototypeToCloneMap,
+            AZ::SerializeContext& serializeContext);
+        bool CanCloneInParallel(size_t entityCount) const;
         
         CommandResult ProcessRequest(SpawnAllEntitiesCommand& request);
         CommandResult ProcessRequest(SpawnEntitiesCommand& request);
@@ -311,6 +320,14 @@ namespace AzFramework
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The minimum number of entities a SpawnAllEntities call needs before the entities are cloned in parallel. Smaller
+        //! spawnables are cloned on the calling thread as the cost of scheduling the batches outweighs the gains. This value can
+        //! be configured through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/ParallelCloneThreshold", where
+        //! 0 disables cloning in parallel.
+        uint32_t m_parallelCloneThreshold { 256 };
+        //! The number of entities cloned by a single task. This value can be configured through the Settings Registry under the
+        //! key "/O3DE/AzFramework/Spawnables/ParallelCloneBatchSize".
+        uint32_t m_parallelCloneBatchSize { 64 };
 
         AZStd::unordered_map<EntitySpawnTicket::Id, Ticket*> m_entitySpawnTicketMap;
         AZStd::atomic_int m_totalTickets{ 0 };
@@ -6,6 +6,9 @@
  *
  */
 
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/UserSettings/UserSettingsComponent.h>
 #include <AzFramework/Application/Application.h>
@@ -98,6 +101,44 @@ namespace UnitTest
         AZ::EntityId m_parent;
     };
 
+    // Marks the task graph as active for the lifetime of the object so large spawnables are cloned in parallel.
+    class ScopedActiveTaskGraph : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        ScopedActiveTaskGraph()
+        {
+            if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get() == nullptr)
+            {
+                AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+                m_registered = true;
+            }
+            m_executor = aznew AZ::TaskExecutor(4);
+            AZ::TaskExecutor::SetInstance(m_executor); // SetInstance is a null-op if there is already a default instance set
+        }
+
+        ~ScopedActiveTaskGraph()
+        {
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+            if (m_registered)
+            {
+                AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+            }
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+    private:
+        AZ::TaskExecutor* m_executor{ nullptr };
+        bool m_registered{ false };
+    };
+
     class SpawnableEntitiesManagerTest : public LeakDetectionFixture
     {
     public:
@@ -622,6 +663,42 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_LargeSpawnableClonedInParallel_EntityIdsAreMappedCorrectly)
+    {
+        // Large enough to exceed the default parallel clone threshold and be split over multiple batches.
+        constexpr size_t NumEntities = 1000;
+        ScopedActiveTaskGraph activeTaskGraph;
+
+        for (EntityReferenceScheme refScheme :
+            { EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+              EntityReferenceScheme::AllReferenceNextCircular, EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            delete m_ticket;
+            m_ticket = aznew AzFramework::EntitySpawnTicket(*m_spawnableAsset);
+
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            size_t spawnedEntitiesCount = 0;
+            auto callback = [this, refScheme, &spawnedEntitiesCount]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                spawnedEntitiesCount += entities.size();
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+
+            // Spawn twice to verify the second call gets its own set of ids.
+            for (int spawns = 0; spawns < 2; spawns++)
+            {
+                AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+                optionalArgs.m_completionCallback = callback;
+                m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            }
+            ProcessQueueTillEmtpy();
+            EXPECT_EQ(2 * NumEntities, spawnedEntitiesCount);
+        }
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_DeleteTicketBeforeCall_NoCrash)
     {
         {
@@ -8,6 +8,9 @@
 #if defined(HAVE_BENCHMARK)
 
 #include <Prefab/Benchmark/Spawnable/SpawnableBenchmarkFixture.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesInterface.h>
 #include <AzToolsFramework/Prefab/Spawnable/SpawnableUtils.h>
 
@@ -126,6 +129,101 @@ namespace Benchmark
         ->Args({ 1000, 100 })
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    // Runs the spawn benchmarks with an active task graph so spawnables above the parallel clone threshold are cloned in batches.
+    class BM_SpawnAllEntitiesParallel
+        : public BM_Spawnable
+        , public AZ::TaskGraphActiveInterface
+    {
+    protected:
+        void SetUp(const benchmark::State& state) override
+        {
+            BM_Spawnable::SetUp(state);
+            SetUpTaskGraph();
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            BM_Spawnable::SetUp(state);
+            SetUpTaskGraph();
+        }
+
+        void TearDown(const benchmark::State& state) override
+        {
+            TearDownTaskGraph();
+            BM_Spawnable::TearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            TearDownTaskGraph();
+            BM_Spawnable::TearDown(state);
+        }
+
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+
+    private:
+        void SetUpTaskGraph()
+        {
+            if (AZ::Interface<AZ::TaskGraphActiveInterface>::Get() == nullptr)
+            {
+                AZ::Interface<AZ::TaskGraphActiveInterface>::Register(this);
+                m_registeredTaskGraphActive = true;
+            }
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+        }
+
+        void TearDownTaskGraph()
+        {
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+            m_executor = nullptr;
+            if (m_registeredTaskGraphActive)
+            {
+                AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(this);
+                m_registeredTaskGraphActive = false;
+            }
+        }
+
+        AZ::TaskExecutor* m_executor{ nullptr };
+        bool m_registeredTaskGraphActive{ false };
+    };
+
+    BENCHMARK_DEFINE_F(BM_SpawnAllEntitiesParallel, SingleSpawnCall_EntityCountVariable)(::benchmark::State& state)
+    {
+        const uint64_t entityCountInSpawnable = aznumeric_cast<uint64_t>(state.range());
+
+        SetUpSpawnableAsset(entityCountInSpawnable);
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            state.PauseTiming();
+            m_spawnTicket = aznew AzFramework::EntitySpawnTicket(m_spawnableAsset);
+            state.ResumeTiming();
+
+            AzFramework::SpawnableEntitiesInterface::Get()->SpawnAllEntities(*m_spawnTicket);
+            m_rootSpawnableInterface->ProcessSpawnableQueue();
+
+            state.PauseTiming();
+            delete m_spawnTicket;
+            m_spawnTicket = nullptr;
+            m_rootSpawnableInterface->ProcessSpawnableQueue();
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(entityCountInSpawnable);
+    }
+    // Uses the same range as BM_SpawnAllEntities::SingleSpawnCall_EntityCountVariable so the two can be compared directly.
+    BENCHMARK_REGISTER_F(BM_SpawnAllEntitiesParallel, SingleSpawnCall_EntityCountVariable)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 } // namespace Benchmark
 
 #endif
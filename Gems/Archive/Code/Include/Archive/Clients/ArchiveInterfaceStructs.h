@@ -74,6 +74,8 @@ namespace Archive
         //! + TOC File Path Index table
         //! + TOC File Path Blob table
         //! + TOC Block Offset table
+        //! + TOC Dictionary table
+        //! + TOC Path Hash table
         AZ::u64 GetUncompressedTocSize() const;
 
         //! If on the Compression algorithm the TOC is using a compression algorithm
@@ -184,11 +186,12 @@ namespace Archive
             return compressionIdInitArray;
         }();
 
-        //! Padding bytes added to ArchiveHeader
-        //! to ensure byte offsets 76-79 contains bytes with a value '\0'
-        //! This allows equivalent ArchiveHeader to be memcmp
+        //! Uncompressed size of the Table of Contents Dictionary table
+        //! Contains the compression dictionaries which files in the archive have been compressed with
+        //! Archives without dictionaries store 0, which is also the value the padding bytes
+        //! previously at this offset had
         //! offset = 76
-        const AZ::u32 m_padding{};
+        AZ::u32 m_tocDictionaryTableUncompressedSize{};
 
         //! Offset from the beginning of the file block section to the first
         //! deleted block.
@@ -197,7 +200,18 @@ namespace Archive
         //! offset = 80 (aligned on 8 byte boundary)
         AZ::u64 m_firstDeletedBlockOffset{ DeletedBlockOffsetSentinel };
 
-        //! total offset = 88
+        //! Uncompressed size of the Table of Contents Path Hash table
+        //! Contains a minimal perfect hash over the file paths which maps a path to its index in the TOC
+        //! Archives written before the path hash table was added store 0 here, as the header
+        //! is padded with 0 bytes up to the ArchiveDefaultBlockAlignment
+        //! offset = 88
+        AZ::u32 m_tocPathHashTableUncompressedSize{};
+
+        //! Add padding bytes to align the header on 8 byte boundary
+        //! offset = 92
+        AZ::u32 m_unused{};
+
+        //! total offset = 96
 
         //! Max FileCount
         //! Up to 2^32 files can be stored,
@@ -207,7 +221,7 @@ namespace Archive
         static constexpr AZ::u32 MaxFileCount{ (1 << 25) - 1 };
     };
 
-    static_assert(sizeof(ArchiveHeader) == 88, "Archive Header section should be less than 88 bytes per spec version 1");
+    static_assert(sizeof(ArchiveHeader) == 96, "Archive Header section should be 96 bytes per spec version 1");
     static_assert(sizeof(ArchiveHeader) <= ArchiveDefaultBlockAlignment, "Archive Header section should be less than 512 bytes");
 
     //! Error codes for when archive validation fails
@@ -288,9 +302,18 @@ namespace Archive
         AZ::Crc32 m_crc32{};
 
         //! offset = 20
+        //! 1-based index into the TOC Dictionary table of the dictionary the file was compressed with
+        //! The value of NoDictionaryIndex indicates the file was compressed without a dictionary
+        AZ::u16 m_dictionaryIndex{ NoDictionaryIndex };
+
+        //! offset = 22
         //! Add padding bytes to fill the File Metadata structure
         //! with 0 bytes on construction
-        AZStd::byte m_unused[12]{};
+        AZStd::byte m_unused[10]{};
+
+        //! Value of the m_dictionaryIndex when a file does not use a compression dictionary
+        //! Archives written before dictionaries were supported have 0 bytes at that offset
+        static constexpr AZ::u16 NoDictionaryIndex = 0;
     };
 
     static_assert(sizeof(ArchiveTocFileMetadata) == 32, "File Metadata size should be 16 bytes");
@@ -314,6 +337,47 @@ namespace Archive
 
     static_assert(sizeof(ArchiveTocFilePathIndex) == 8, "File Path Index entry should be 8 bytes");
 
+    //! Stores the size of a compression dictionary and its offset into the dictionary blob
+    //! The TOC Dictionary table starts with an 8-byte count of dictionaries,
+    //! followed by a dictionary index entry per dictionary and then the blob containing each dictionary
+    struct ArchiveTocDictionaryIndex
+    {
+        ArchiveTocDictionaryIndex();
+
+        //! Size of the dictionary in bytes
+        //! Cap is 24-bits as dictionaries trained for small files are around 100 KiB
+        AZ::u64 m_size : 24;
+
+        //! Offset from the beginning of the Dictionary blob to the start of the dictionary
+        AZ::u64 m_offset : 40;
+    };
+
+    static_assert(sizeof(ArchiveTocDictionaryIndex) == 8, "Dictionary Index entry should be 8 bytes");
+
+    //! The maximum number of dictionaries that can be referenced by the 16-bit file metadata dictionary index
+    constexpr size_t MaxDictionaryCount = AZStd::numeric_limits<AZ::u16>::max();
+
+    //! The maximum size of a single dictionary that can be stored in the 24-bit dictionary index size field
+    constexpr size_t MaxDictionarySize = (size_t{ 1 } << 24) - 1;
+
+    //! Header of the TOC Path Hash table
+    //! The Path Hash table is a minimal perfect hash built using the hash and displace algorithm.
+    //! A path hash selects one of the buckets and the 32-bit displacement stored for that bucket
+    //! is combined with the path hash to select a slot. The slot stores the index of the file within the TOC.
+    //! The header is followed by the displacement of each bucket and then the file index of each slot
+    //! There is exactly one slot per file path, so the table stores 4 bytes per file + 4 bytes per bucket
+    struct ArchiveTocPathHashTableHeader
+    {
+        //! Number of 32-bit displacement entries
+        AZ::u32 m_bucketCount{};
+        //! Number of 32-bit file index entries
+        AZ::u32 m_slotCount{};
+        //! Seed for the path hash function that the table was built with
+        AZ::u64 m_seed{};
+    };
+
+    static_assert(sizeof(ArchiveTocPathHashTableHeader) == 16, "Path Hash table header should be 16 bytes");
+
     //! There are 3 blocks per block line as 3 "2 MiB" chunks can be encoded in a 64-bit integer
     //! This is done by storing the compressed block size using 21-bits
     constexpr AZ::u64 BlocksPerBlockLine = 3;
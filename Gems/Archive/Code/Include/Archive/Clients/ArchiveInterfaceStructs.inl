@@ -70,7 +70,9 @@ namespace Archive
         , m_tocBlockOffsetTableUncompressedSize(other.m_tocBlockOffsetTableUncompressedSize)
         , m_compressionThreshold(other.m_compressionThreshold)
         , m_compressionAlgorithmsIds(other.m_compressionAlgorithmsIds)
+        , m_tocDictionaryTableUncompressedSize(other.m_tocDictionaryTableUncompressedSize)
         , m_firstDeletedBlockOffset(other.m_firstDeletedBlockOffset)
+        , m_tocPathHashTableUncompressedSize(other.m_tocPathHashTableUncompressedSize)
     {}
     inline ArchiveHeader& ArchiveHeader::operator=(const ArchiveHeader& other)
     {
@@ -88,7 +90,9 @@ namespace Archive
         m_tocBlockOffsetTableUncompressedSize = other.m_tocBlockOffsetTableUncompressedSize;
         m_compressionThreshold = other.m_compressionThreshold;
         m_compressionAlgorithmsIds = other.m_compressionAlgorithmsIds;
+        m_tocDictionaryTableUncompressedSize = other.m_tocDictionaryTableUncompressedSize;
         m_firstDeletedBlockOffset = other.m_firstDeletedBlockOffset;
+        m_tocPathHashTableUncompressedSize = other.m_tocPathHashTableUncompressedSize;
 
         return *this;
     }
@@ -113,13 +117,19 @@ namespace Archive
         // to the next multiple of 8
         uncompressedSize = AZ_SIZE_ALIGN_UP(uncompressedSize, 8);
 
-        // As the block offset table is the last section of the
-        // table of contents, no alignment constraints need to be accounted for
-        // To close out the information loop however, each block offset table
-        // entry stores a 8-byte integer which encodes either 3 2-MiB compressed block sizes
+        // Each block offset table entry stores a 8-byte integer which encodes either 3 2-MiB compressed block sizes
         // or a 16-bit block jump offset entry and 2 2-MiB compressed block sizes(21-bits each)
+        // so the dictionary table which follows it starts on an 8-byte boundary as well
         uncompressedSize += m_tocBlockOffsetTableUncompressedSize;
 
+        // The dictionary table is padded to a multiple of 8 bytes
+        // so the path hash table which follows it starts on an 8-byte boundary as well
+        uncompressedSize += m_tocDictionaryTableUncompressedSize;
+
+        // As the path hash table is the last section of the
+        // table of contents, no alignment constraints need to be accounted for
+        uncompressedSize += m_tocPathHashTableUncompressedSize;
+
         return uncompressedSize;
     }
 
@@ -166,6 +176,13 @@ namespace Archive
 
     }
 
+    // ArchiveTocDictionaryIndex constructor implementation
+    inline ArchiveTocDictionaryIndex::ArchiveTocDictionaryIndex()
+        : m_size{}
+        , m_offset{}
+    {
+    }
+
     // The ArchiveBlockLine constructor zero initializes each block line
     // Block lines are made up of 3 blocks at a time
     inline ArchiveBlockLine::ArchiveBlockLine()
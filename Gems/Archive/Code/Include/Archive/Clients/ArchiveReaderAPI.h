@@ -25,6 +25,8 @@ namespace AZ
 {
     template<typename T>
     class Interface;
+
+    class TaskGraphEvent;
 }
 
 namespace AZ::IO
@@ -81,6 +83,22 @@ namespace Archive
         //! Configures the maximum number of read task that can run in parallel
         //! For a value of 0 maps to a single read task
         AZ::u32 m_maxReadTasks{ 1 };
+
+        //! When an archive is mounted by path and its table of contents is uncompressed,
+        //! the table of contents is accessed through a memory mapping of the archive
+        //! instead of being read into memory
+        //! Combined with the path hash table, mounting an archive then only touches the
+        //! pages of the table of contents that lookups actually use
+        bool m_memoryMapTableOfContents{ true };
+
+        //! When an archive is mounted by path, the files in it are described to AZ::IO::Streamer
+        //! through the AZ::IO::CompressionBus, so that Streamer reads of those files are served from the archive
+        //! Files are looked up by their path without the alias, the same as files in pak archives
+        //! Compressed files are described along with the table of their compressed blocks, which lets
+        //! partial reads only read and decompress the blocks overlapping the requested range
+        //! The blocks are decompressed by the Compression gem's decompressor Streamer stack entry
+        //! NOTE: The archive must stay mounted until all Streamer reads of files in it have completed
+        bool m_registerWithStreamer{ false };
     };
 
     //! Settings for controlling how an individual file is extracted from an archive.
@@ -144,6 +162,43 @@ namespace Archive
         ResultOutcome m_resultOutcome;
     };
 
+    //! Describes a single file to extract as part of a batch of files
+    //! See IArchiveReader::ExtractFilesFromArchiveAsync
+    struct ArchiveExtractFileRequest
+    {
+        //! Identifier token of the file to extract
+        //! It can be queried using ListFileInArchive or EnumerateFilesInArchive
+        ArchiveFileToken m_filePathToken{ InvalidArchiveFileToken };
+        //! Pre-allocated buffer that should be large enough to store either the uncompressed size of the file
+        //! if `m_decompressFile` is true or the compressed size of the file if `m_decompressFile` is false
+        //! The buffer must stay valid until the file has been extracted
+        AZStd::span<AZStd::byte> m_outputSpan;
+        //! Decompress the file content if compressed
+        bool m_decompressFile{ true };
+        //! Pointer to a decompression options derived struct
+        //! This can be used to supply custom decompression options
+        //! Files compressed with a dictionary are always decompressed using the dictionary stored in the archive
+        const Compression::DecompressionOptions* m_decompressionOptions{};
+    };
+
+    //! Settings for controlling how a batch of files is extracted from an archive
+    struct ArchiveExtractBatchSettings
+    {
+        //! Callback which is invoked once for each request in the batch with the result of extracting that file
+        //! The requestIndex parameter is the index of the request within the span of requests of the batch
+        //! NOTE: The callback is invoked on the task executor threads of the ArchiveReader
+        //! and can be invoked concurrently for different files of the batch
+        using ExtractFileCallback = AZStd::function<void(size_t requestIndex, ArchiveExtractFileResult)>;
+        ExtractFileCallback m_extractFileCallback = [](size_t, ArchiveExtractFileResult) {};
+
+        //! Files whose data is at most this many bytes apart in the archive are read using a single read
+        //! Reading the bytes between the files and discarding them is cheaper than issuing another read
+        AZ::u64 m_maxReadGap{ 64_kib };
+        //! Caps the size of a single coalesced read
+        //! A file whose data is larger than the cap is read on its own
+        AZ::u64 m_maxReadSize{ 16_mib };
+    };
+
     //! Returns a result structure that indicates if removal of a content file from the
     //! archive was successful
     //! Metadata about the file is returned, such as its file path, compressed algorithm ID
@@ -248,6 +303,25 @@ namespace Archive
         virtual ArchiveExtractFileResult ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
             const ArchiveReaderFileSettings& fileSettings) = 0;
 
+        //! Extracts a batch of files from the archive asynchronously
+        //! The files are sorted by their offset in the archive, files stored near each other
+        //! are read using a single large read and the compressed blocks of every file in the batch
+        //! are decompressed in parallel.
+        //! The ArchiveExtractBatchSettings callback is invoked as soon as each file has been extracted
+        //! and the completion event is signaled once the callback has been invoked for every request.
+        //! The archive must stay mounted until the completion event is signaled.
+        //!
+        //! @param requests files to extract along with the pre-allocated buffer to extract each file into
+        //! The span of requests is copied, so it doesn't need to outlive this call
+        //! @param batchSettings settings containing the callback to invoke with the result of each file
+        //! and settings for how reads of neighboring files are coalesced
+        //! @param completionEvent event which is signaled when every file in the batch has been extracted
+        //! It must outlive the batch and cannot be reused for another batch
+        //! @return On success the batch has been submitted to the task executor.
+        //! On failure an error message is returned and neither the callback is invoked nor the event is signaled
+        virtual ResultOutcome ExtractFilesFromArchiveAsync(AZStd::span<const ArchiveExtractFileRequest> requests,
+            const ArchiveExtractBatchSettings& batchSettings, AZ::TaskGraphEvent* completionEvent) = 0;
+
         //! List the file metadata from the archive using the ArchiveFileToken
         //! @param filePathToken identifier token that can be used to quickly lookup
         //! metadata about the file
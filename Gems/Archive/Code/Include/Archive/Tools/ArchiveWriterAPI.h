@@ -18,6 +18,7 @@
 
 #include <Compression/CompressionInterfaceStructs.h>
 #include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/CompressionZStdAPI.h>
 
 namespace AZ
 {
@@ -293,6 +294,21 @@ namespace Archive
         //! @return true if metadata was successfully written
         virtual bool DumpArchiveMetadata(AZ::IO::GenericStream& metadataStream,
             const ArchiveMetadataSettings& metadataSettings = {}) const = 0;
+
+        //! Trains a zstd compression dictionary from sample file contents and stores it in the archive TOC
+        //! Small files such as json, settings and material files compress poorly on their own,
+        //! but files of the same type share most of their content with each other.
+        //! Files with the extension which are added afterwards using the ZStd compression algorithm
+        //! are compressed with the dictionary.
+        //! NOTE: The association of extension to dictionary only lasts for this writer instance
+        //! @param fileExtension extension including the leading dot of the files the dictionary is used for
+        //! @param samples contents of files with the extension to train the dictionary from
+        //! @param dictionaryCapacity maximum size of the trained dictionary. Must not exceed MaxDictionarySize
+        //! @return the 1-based index of the dictionary in the archive TOC dictionary table on success
+        using TrainDictionaryOutcome = AZStd::expected<AZ::u16, ResultString>;
+        virtual TrainDictionaryOutcome TrainCompressionDictionary(AZ::IO::PathView fileExtension,
+            AZStd::span<const AZStd::span<const AZStd::byte>> samples,
+            size_t dictionaryCapacity = CompressionZStd::DefaultDictionaryCapacity) = 0;
     };
 
     //! Factory which is used to creates instances of the ArchiveWriter class
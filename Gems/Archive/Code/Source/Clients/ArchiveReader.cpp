@@ -12,10 +12,13 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/OpenMode.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/Task/TaskGraph.h>
 
 #include <Archive/ArchiveTypeIds.h>
 
+#include <Compression/CompressionZStdAPI.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 
 namespace Archive
@@ -76,8 +79,47 @@ namespace Archive
         , m_tocView(AZStd::move(tocView))
     {}
 
+    // Stores the memory mapping of the archive which the ArchiveTableOfContentsView points into
+    ArchiveReader::ArchiveTableOfContentsReader::ArchiveTableOfContentsReader(AZ::IO::MemoryMappedFile mappedArchive,
+        ArchiveTableOfContentsView tocView)
+        : m_tocView(AZStd::move(tocView))
+        , m_mappedArchive(AZStd::move(mappedArchive))
+    {}
+
+    bool ArchiveReader::MapArchiveTOC(ArchiveTableOfContentsReader& archiveToc, const ArchiveHeader& archiveHeader,
+        AZ::IO::PathView archivePath)
+    {
+        AZ::IO::MemoryMappedFile mappedArchive;
+        if (!mappedArchive.Open(AZ::IO::FixedMaxPath(archivePath).c_str()))
+        {
+            return false;
+        }
+
+        // The TOC sections are accessed in place, so the TOC must be entirely within the mapping
+        // and start on an address aligned for the file metadata entries
+        const AZ::u64 tocOffset = archiveHeader.m_tocOffset;
+        const AZ::u64 tocSize = archiveHeader.GetUncompressedTocSize();
+        if (tocOffset + tocSize > mappedArchive.GetSize() || (tocOffset % alignof(ArchiveTocFileMetadata)) != 0)
+        {
+            return false;
+        }
+
+        auto tocSpan = AZStd::span(reinterpret_cast<const AZStd::byte*>(mappedArchive.GetData()) + tocOffset, tocSize);
+        if (auto tocView = ArchiveTableOfContentsView::CreateFromArchiveHeaderAndBuffer(archiveHeader, tocSpan);
+            tocView)
+        {
+            // The view points into the mapping, which is moved into the table of contents reader to keep it alive.
+            // Moving the mapping doesn't change the address of the mapped data
+            archiveToc = ArchiveTableOfContentsReader{ AZStd::move(mappedArchive), AZStd::move(tocView).value() };
+            return true;
+        }
+
+        // Fall back to reading the table of contents, which reports the validation error
+        return false;
+    }
+
     bool ArchiveReader::ReadArchiveTOC(ArchiveTableOfContentsReader& archiveToc, AZ::IO::GenericStream& archiveStream,
-        const ArchiveHeader& archiveHeader)
+        const ArchiveHeader& archiveHeader, AZ::IO::PathView archivePath)
     {
         // RAII structure which resets the archive stream to offset 0
         // when it goes out of scope
@@ -100,6 +142,15 @@ namespace Archive
             return false;
         }
 
+        // An uncompressed table of contents can be used directly from a memory mapping of the archive,
+        // which avoids reading it into memory
+        if (m_settings.m_memoryMapTableOfContents && !archivePath.empty()
+            && archiveHeader.m_tocCompressionAlgoIndex >= UncompressedAlgorithmIndex
+            && MapArchiveTOC(archiveToc, archiveHeader, archivePath))
+        {
+            return true;
+        }
+
         // Buffer which stores the raw table of contents data from the archive file
         AZStd::vector<AZStd::byte> tocBuffer;
 
@@ -196,6 +247,12 @@ namespace Archive
     {
         m_pathMap.clear();
 
+        // The path hash table of the TOC is used for lookups, so there is no need to map every path
+        if (!tocView.m_pathHashBucketTable.empty())
+        {
+            return true;
+        }
+
         // Build a map of file path view to within the FilePathIndex array of the TOC View
         auto BuildViewOfFilePaths = [this, filePathBlobTable = &tocView.m_filePathBlob, filePathIndex = 0]
         (AZ::u64 filePathBlobOffset, AZ::u16 filePathSize) mutable
@@ -229,13 +286,19 @@ namespace Archive
 
         // If the Archive header and TOC could not be read
         // then unmount the archive and return false
-        if (!ReadArchiveHeaderAndToc())
+        if (!ReadArchiveHeaderAndToc(mountPath))
         {
             // UnmountArchive is invoked to reset
             // the Archive Header, TOC and the path map structures
             UnmountArchive();
             return false;
         }
+
+        m_archivePath = mountPath;
+        if (m_settings.m_registerWithStreamer)
+        {
+            m_streamerCompressionHandler.BusConnect();
+        }
         return true;
     }
 
@@ -261,7 +324,7 @@ namespace Archive
         return true;
     }
 
-    bool ArchiveReader::ReadArchiveHeaderAndToc()
+    bool ArchiveReader::ReadArchiveHeaderAndToc(AZ::IO::PathView archivePath)
     {
         if (m_archiveStream == nullptr)
         {
@@ -269,7 +332,7 @@ namespace Archive
         }
 
         const bool mountResult = ReadArchiveHeader(m_archiveHeader, *m_archiveStream)
-            && ReadArchiveTOC(m_archiveToc, *m_archiveStream, m_archiveHeader)
+            && ReadArchiveTOC(m_archiveToc, *m_archiveStream, m_archiveHeader, archivePath)
             && BuildFilePathMap(m_archiveToc.m_tocView);
 
         return mountResult;
@@ -277,6 +340,10 @@ namespace Archive
 
     void ArchiveReader::UnmountArchive()
     {
+        // Stop describing files to the Streamer before the table of contents is released
+        m_streamerCompressionHandler.BusDisconnect();
+        m_archivePath.clear();
+
         if (m_archiveStream != nullptr && m_archiveStream->IsOpen())
         {
             // Clear the path mount on unmount as it has pointers
@@ -590,10 +657,19 @@ namespace Archive
         AZStd::span<AZStd::byte> decompressionRemainingSpan = decompressionResultSpan;
 
         // Get a reference to the the caller supplied decompression options if available
-        const auto& decompressionOptions = fileSettings.m_decompressionOptions != nullptr
+        const auto& fileDecompressionOptions = fileSettings.m_decompressionOptions != nullptr
             ? *fileSettings.m_decompressionOptions
             : Compression::DecompressionOptions{};
 
+        // Files compressed with a dictionary must be decompressed with the same dictionary from the TOC
+        // The decompressor digests the dictionary once and reuses it for each file compressed with it
+        CompressionZStd::ZStdDecompressionOptions dictionaryDecompressionOptions;
+        dictionaryDecompressionOptions.m_dictionary = GetDictionaryForFile(m_archiveToc.m_tocView,
+            m_archiveToc.m_tocView.m_fileMetadataTable[fileMetadataTableIndex]);
+        const Compression::DecompressionOptions& decompressionOptions = !dictionaryDecompressionOptions.m_dictionary.empty()
+            ? dictionaryDecompressionOptions
+            : fileDecompressionOptions;
+
         // m_maxDecompressTasks has a minimum value of 1
         // This makes sure there is never a scenario where the there are blocks to decompress
         // but the decompress task count is 0
@@ -676,6 +752,507 @@ namespace Archive
         return decompressionResultSpan.subspan(startOffset, endOffset);
     }
 
+    namespace
+    {
+        //! State of a file that is extracted as part of a batch
+        struct ExtractBatchFile
+        {
+            //! Index of the file request within the batch
+            size_t m_requestIndex{};
+            //! Result which is passed to the extract file callback once the file has been extracted
+            ArchiveExtractFileResult m_extractResult;
+            //! Buffer supplied by the request to extract the file into
+            AZStd::span<AZStd::byte> m_outputSpan;
+            //! Size of the file data as stored in the archive
+            AZ::u64 m_rawSize{};
+            //! Set for compressed files which should be decompressed
+            Compression::IDecompressionInterface* m_decompressionInterface{};
+            //! Decompression options supplied by the request
+            const Compression::DecompressionOptions* m_requestDecompressionOptions{};
+            //! Contains the dictionary from the TOC if the file was compressed with one
+            CompressionZStd::ZStdDecompressionOptions m_dictionaryDecompressionOptions;
+            //! Range of work items within the batch which extract the file
+            size_t m_firstWorkItem{};
+            size_t m_workItemCount{};
+        };
+
+        //! Contiguous range of the archive which contains the data of one or more files of the batch
+        struct ExtractBatchRead
+        {
+            AZ::u64 m_offset{};
+            AZ::u64 m_size{};
+            //! [first, last) range of the files contained in the read
+            size_t m_firstFile{};
+            size_t m_lastFile{};
+            //! A read of a single file which doesn't need decompression is read directly into
+            //! the output buffer of the file
+            bool m_readIntoOutput{};
+            //! Stores the data of the read until the files within it have been extracted
+            AZStd::vector<AZStd::byte> m_readBuffer;
+            ResultOutcome m_readOutcome;
+        };
+
+        //! Either decompresses a single block of a file or copies the data of a file
+        //! that does not need to be decompressed out of the read buffer
+        struct ExtractBatchWorkItem
+        {
+            size_t m_fileIndex{};
+            //! Range of the input data within the read buffer
+            AZ::u64 m_readBufferOffset{};
+            AZ::u64 m_inputSize{};
+            //! Span within the output buffer of the file to write to
+            AZStd::span<AZStd::byte> m_outputSpan;
+            ResultOutcome m_outcome;
+        };
+
+        //! Shared between the tasks of a batch and freed once the last task completes
+        struct ExtractBatchState
+        {
+            ArchiveExtractBatchSettings::ExtractFileCallback m_extractFileCallback;
+            AZStd::vector<ExtractBatchFile> m_files;
+            AZStd::vector<ExtractBatchRead> m_reads;
+            AZStd::vector<ExtractBatchWorkItem> m_workItems;
+            //! Requests for files which cannot be extracted, the results contain the reason
+            AZStd::vector<AZStd::pair<size_t, ArchiveExtractFileResult>> m_failedRequests;
+            Compression::DecompressionOptions m_defaultDecompressionOptions;
+        };
+    } // namespace
+
+    ArchiveReader::StreamerCompressionHandler::StreamerCompressionHandler(const ArchiveReader& archiveReader)
+        : m_archiveReader(archiveReader)
+    {}
+
+    void ArchiveReader::StreamerCompressionHandler::FindCompressionInfo(bool& found, AZ::IO::CompressionInfo& info,
+        const AZ::IO::PathView filePath)
+    {
+        m_archiveReader.FindStreamerCompressionInfo(found, info, filePath);
+    }
+
+    void ArchiveReader::FindStreamerCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, AZ::IO::PathView filePath) const
+    {
+        if (found || m_archivePath.empty())
+        {
+            return;
+        }
+
+        // The Streamer passes the path without its alias, which can leave a leading path separator
+        AZStd::string_view relativePath = filePath.Native();
+        if (const size_t firstNonSeparator = relativePath.find_first_not_of(R"(/\)");
+            firstNonSeparator != AZStd::string_view::npos)
+        {
+            relativePath.remove_prefix(firstNonSeparator);
+        }
+
+        const ArchiveFileToken archiveFileToken = FindFileToken(AZ::IO::PathView(relativePath, filePath.PreferredSeparator()));
+        if (archiveFileToken == InvalidArchiveFileToken)
+        {
+            return;
+        }
+
+        const ArchiveListFileResult listResult = ListFileInArchive(archiveFileToken);
+        if (!listResult)
+        {
+            return;
+        }
+
+        const auto fileMetadataTableIndex = static_cast<AZ::u64>(archiveFileToken);
+        const bool isFileCompressed = listResult.m_compressionAlgorithm != Compression::Uncompressed
+            && listResult.m_compressionAlgorithm != Compression::Invalid;
+
+        AZ::IO::CompressionInfo fileInfo;
+        fileInfo.m_archiveFilename = m_archivePath;
+        fileInfo.m_offset = listResult.m_offset;
+        fileInfo.m_compressedSize = listResult.m_compressedSize;
+        fileInfo.m_uncompressedSize = listResult.m_uncompressedSize;
+        fileInfo.m_isCompressed = isFileCompressed;
+        fileInfo.m_isSharedPak = true;
+        if (isFileCompressed)
+        {
+            auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+            Compression::IDecompressionInterface* decompressionInterface = decompressionRegistrar != nullptr
+                ? decompressionRegistrar->FindDecompressionInterface(listResult.m_compressionAlgorithm)
+                : nullptr;
+            auto blockLineSpanOutcome = GetBlockLineSpanForFile(m_archiveToc.m_tocView, fileMetadataTableIndex);
+            if (decompressionInterface == nullptr || !blockLineSpanOutcome)
+            {
+                // The file can't be decompressed, so let other handlers or the next Streamer node look for it
+                return;
+            }
+
+            // Every 2 MiB block is compressed independently and the compressed blocks of a file are stored contiguously,
+            // with each block aligned to the archive block alignment
+            const AZ::u64 blockCount = GetBlockCountIfCompressed(listResult.m_uncompressedSize);
+            fileInfo.m_blockSize = ArchiveBlockSizeForCompression;
+            fileInfo.m_blocks.reserve(blockCount);
+            size_t blockOffset = 0;
+            for (AZ::u64 blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+            {
+                AZ::IO::CompressedBlock& block = fileInfo.m_blocks.emplace_back();
+                block.m_offset = blockOffset;
+                block.m_compressedSize = GetCompressedSizeForBlock(blockLineSpanOutcome.value(), blockCount, blockIndex);
+                blockOffset += AZ_SIZE_ALIGN_UP(block.m_compressedSize, ArchiveDefaultBlockAlignment);
+            }
+
+            fileInfo.m_compressionTag.m_code = static_cast<AZ::u32>(listResult.m_compressionAlgorithm);
+            // Files compressed with a dictionary must be decompressed with the same dictionary from the TOC
+            AZStd::span<const AZStd::byte> dictionary = GetDictionaryForFile(m_archiveToc.m_tocView,
+                m_archiveToc.m_tocView.m_fileMetadataTable[fileMetadataTableIndex]);
+            fileInfo.m_decompressor = [decompressionInterface, dictionary](const AZ::IO::CompressionInfo&,
+                const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)
+            {
+                CompressionZStd::ZStdDecompressionOptions dictionaryDecompressionOptions;
+                dictionaryDecompressionOptions.m_dictionary = dictionary;
+                const Compression::DecompressionOptions defaultDecompressionOptions;
+                const Compression::DecompressionOptions& decompressionOptions = !dictionary.empty()
+                    ? dictionaryDecompressionOptions
+                    : defaultDecompressionOptions;
+
+                Compression::DecompressionResultData decompressionResult = decompressionInterface->DecompressBlock(
+                    AZStd::span(static_cast<AZStd::byte*>(uncompressed), uncompressedBufferSize),
+                    AZStd::span(static_cast<const AZStd::byte*>(compressed), compressedSize),
+                    decompressionOptions);
+                return static_cast<bool>(decompressionResult);
+            };
+        }
+
+        info = AZStd::move(fileInfo);
+        found = true;
+    }
+
+    ArchiveExtractFileResult ArchiveReader::ListFileForExtractRequest(const ArchiveExtractFileRequest& request) const
+    {
+        ArchiveListFileResult listResult = ListFileInArchive(request.m_filePathToken);
+
+        ArchiveExtractFileResult extractResult;
+        extractResult.m_relativeFilePath = AZStd::move(listResult.m_relativeFilePath);
+        extractResult.m_filePathToken = listResult.m_filePathToken;
+        extractResult.m_compressionAlgorithm = listResult.m_compressionAlgorithm;
+        extractResult.m_uncompressedSize = listResult.m_uncompressedSize;
+        extractResult.m_compressedSize = listResult.m_compressedSize;
+        extractResult.m_offset = listResult.m_offset;
+        extractResult.m_crc32 = listResult.m_crc32;
+        extractResult.m_resultOutcome = AZStd::move(listResult.m_resultOutcome);
+        if (!extractResult)
+        {
+            return extractResult;
+        }
+
+        const bool isFileCompressed = extractResult.m_compressionAlgorithm != Compression::Uncompressed
+            && extractResult.m_compressionAlgorithm != Compression::Invalid;
+        const AZ::u64 requiredSize = isFileCompressed && !request.m_decompressFile
+            ? extractResult.m_compressedSize
+            : extractResult.m_uncompressedSize;
+        if (request.m_outputSpan.size() < requiredSize)
+        {
+            extractResult.m_resultOutcome = AZStd::unexpected(ResultString::format(
+                R"(Buffer size is not large enough to extract file "%s". Buffer size is %zu, while %llu is required.)",
+                extractResult.m_relativeFilePath.c_str(), request.m_outputSpan.size(), requiredSize));
+        }
+
+        return extractResult;
+    }
+
+    ResultOutcome ArchiveReader::ExtractFilesFromArchiveAsync(AZStd::span<const ArchiveExtractFileRequest> requests,
+        const ArchiveExtractBatchSettings& batchSettings, AZ::TaskGraphEvent* completionEvent)
+    {
+        if (!IsMounted())
+        {
+            return AZStd::unexpected(ResultString("No archive is mounted to extract the batch of files from."));
+        }
+        if (completionEvent == nullptr)
+        {
+            return AZStd::unexpected(ResultString("A completion event must be supplied to extract a batch of files."));
+        }
+
+        auto batchState = AZStd::make_shared<ExtractBatchState>();
+        batchState->m_extractFileCallback = batchSettings.m_extractFileCallback;
+        batchState->m_files.reserve(requests.size());
+
+        auto decompressionRegistrar = Compression::DecompressionRegistrar::Get();
+        for (size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex)
+        {
+            const ArchiveExtractFileRequest& request = requests[requestIndex];
+            ArchiveExtractFileResult extractResult = ListFileForExtractRequest(request);
+            if (!extractResult)
+            {
+                batchState->m_failedRequests.emplace_back(requestIndex, AZStd::move(extractResult));
+                continue;
+            }
+
+            const bool isFileCompressed = extractResult.m_compressionAlgorithm != Compression::Uncompressed
+                && extractResult.m_compressionAlgorithm != Compression::Invalid;
+            Compression::IDecompressionInterface* decompressionInterface{};
+            if (isFileCompressed && request.m_decompressFile)
+            {
+                decompressionInterface = decompressionRegistrar != nullptr
+                    ? decompressionRegistrar->FindDecompressionInterface(extractResult.m_compressionAlgorithm)
+                    : nullptr;
+                if (decompressionInterface == nullptr)
+                {
+                    extractResult.m_resultOutcome = AZStd::unexpected(ResultString::format("Compression Algorithm with ID %x"
+                        " is not registered with the decompression registrar.",
+                        static_cast<AZ::u32>(extractResult.m_compressionAlgorithm)));
+                    batchState->m_failedRequests.emplace_back(requestIndex, AZStd::move(extractResult));
+                    continue;
+                }
+            }
+
+            ExtractBatchFile& batchFile = batchState->m_files.emplace_back();
+            batchFile.m_requestIndex = requestIndex;
+            batchFile.m_outputSpan = request.m_outputSpan;
+            batchFile.m_rawSize = isFileCompressed ? extractResult.m_compressedSize : extractResult.m_uncompressedSize;
+            batchFile.m_decompressionInterface = decompressionInterface;
+            if (decompressionInterface != nullptr)
+            {
+                batchFile.m_requestDecompressionOptions = request.m_decompressionOptions;
+                batchFile.m_dictionaryDecompressionOptions.m_dictionary = GetDictionaryForFile(m_archiveToc.m_tocView,
+                    m_archiveToc.m_tocView.m_fileMetadataTable[static_cast<AZ::u64>(extractResult.m_filePathToken)]);
+            }
+            batchFile.m_extractResult = AZStd::move(extractResult);
+        }
+
+        // Sort the files by their offset in the archive, so that files which are stored
+        // near each other can be read using a single read
+        AZStd::sort(batchState->m_files.begin(), batchState->m_files.end(),
+            [](const ExtractBatchFile& lhs, const ExtractBatchFile& rhs)
+            {
+                return static_cast<AZ::u64>(lhs.m_extractResult.m_offset) < static_cast<AZ::u64>(rhs.m_extractResult.m_offset);
+            });
+
+        for (size_t fileIndex = 0; fileIndex < batchState->m_files.size(); ++fileIndex)
+        {
+            const ExtractBatchFile& batchFile = batchState->m_files[fileIndex];
+            const AZ::u64 fileOffset = batchFile.m_extractResult.m_offset;
+            const AZ::u64 fileEndOffset = fileOffset + batchFile.m_rawSize;
+            if (!batchState->m_reads.empty())
+            {
+                // Extend the previous read to cover the file as long as the gap between them is small enough
+                // and the read does not grow beyond the max read size
+                ExtractBatchRead& previousRead = batchState->m_reads.back();
+                const AZ::u64 readEndOffset = AZStd::max(previousRead.m_offset + previousRead.m_size, fileEndOffset);
+                if (fileOffset <= previousRead.m_offset + previousRead.m_size + batchSettings.m_maxReadGap
+                    && readEndOffset - previousRead.m_offset <= batchSettings.m_maxReadSize)
+                {
+                    previousRead.m_size = readEndOffset - previousRead.m_offset;
+                    previousRead.m_lastFile = fileIndex + 1;
+                    continue;
+                }
+            }
+
+            ExtractBatchRead& batchRead = batchState->m_reads.emplace_back();
+            batchRead.m_offset = fileOffset;
+            batchRead.m_size = batchFile.m_rawSize;
+            batchRead.m_firstFile = fileIndex;
+            batchRead.m_lastFile = fileIndex + 1;
+        }
+
+        // Split the extraction of each file into work items that can run in parallel
+        // Compressed files get a work item per compressed block
+        for (ExtractBatchRead& batchRead : batchState->m_reads)
+        {
+            batchRead.m_readIntoOutput = batchRead.m_lastFile - batchRead.m_firstFile == 1
+                && batchState->m_files[batchRead.m_firstFile].m_decompressionInterface == nullptr;
+
+            for (size_t fileIndex = batchRead.m_firstFile; fileIndex < batchRead.m_lastFile; ++fileIndex)
+            {
+                ExtractBatchFile& batchFile = batchState->m_files[fileIndex];
+                batchFile.m_firstWorkItem = batchState->m_workItems.size();
+                const AZ::u64 fileReadOffset = batchFile.m_extractResult.m_offset - batchRead.m_offset;
+                if (batchFile.m_decompressionInterface != nullptr)
+                {
+                    const auto fileMetadataTableIndex = static_cast<AZ::u64>(batchFile.m_extractResult.m_filePathToken);
+                    auto blockLineSpanOutcome = GetBlockLineSpanForFile(m_archiveToc.m_tocView, fileMetadataTableIndex);
+                    if (!blockLineSpanOutcome)
+                    {
+                        batchFile.m_extractResult.m_resultOutcome = AZStd::unexpected(AZStd::move(blockLineSpanOutcome.error()));
+                        continue;
+                    }
+
+                    // The compressed blocks of a file are stored contiguously, with each block aligned
+                    // to the archive block alignment, while each decompressed block is 2 MiB except for the last
+                    const AZ::u64 blockCount = GetBlockCountIfCompressed(batchFile.m_extractResult.m_uncompressedSize);
+                    AZ::u64 blockReadOffset = fileReadOffset;
+                    AZStd::span<AZStd::byte> decompressionRemainingSpan = batchFile.m_outputSpan
+                        .first(batchFile.m_extractResult.m_uncompressedSize);
+                    for (AZ::u64 blockIndex = 0; blockIndex < blockCount; ++blockIndex)
+                    {
+                        const AZ::u64 blockCompressedSize = GetCompressedSizeForBlock(blockLineSpanOutcome.value(),
+                            blockCount, blockIndex);
+                        const auto decompressedBlockSize = AZStd::min<size_t>(decompressionRemainingSpan.size(),
+                            ArchiveBlockSizeForCompression);
+
+                        ExtractBatchWorkItem& workItem = batchState->m_workItems.emplace_back();
+                        workItem.m_fileIndex = fileIndex;
+                        workItem.m_readBufferOffset = blockReadOffset;
+                        workItem.m_inputSize = blockCompressedSize;
+                        workItem.m_outputSpan = decompressionRemainingSpan.first(decompressedBlockSize);
+
+                        decompressionRemainingSpan = decompressionRemainingSpan.subspan(decompressedBlockSize);
+                        blockReadOffset += AZ_SIZE_ALIGN_UP(blockCompressedSize, ArchiveDefaultBlockAlignment);
+                    }
+
+                    batchFile.m_extractResult.m_fileSpan = batchFile.m_outputSpan
+                        .first(batchFile.m_extractResult.m_uncompressedSize);
+                }
+                else
+                {
+                    // Files that are not decompressed are copied out of the read buffer,
+                    // unless they were read directly into their output buffer
+                    if (!batchRead.m_readIntoOutput && batchFile.m_rawSize > 0)
+                    {
+                        ExtractBatchWorkItem& workItem = batchState->m_workItems.emplace_back();
+                        workItem.m_fileIndex = fileIndex;
+                        workItem.m_readBufferOffset = fileReadOffset;
+                        workItem.m_inputSize = batchFile.m_rawSize;
+                        workItem.m_outputSpan = batchFile.m_outputSpan.first(batchFile.m_rawSize);
+                    }
+
+                    batchFile.m_extractResult.m_fileSpan = batchFile.m_outputSpan.first(batchFile.m_rawSize);
+                }
+                batchFile.m_workItemCount = batchState->m_workItems.size() - batchFile.m_firstWorkItem;
+            }
+        }
+
+        AZ::TaskGraph taskGraph{ "Archive Extract Batch Tasks" };
+        AZ::TaskDescriptor readTaskDescriptor{ "Read Files", "Archive Extract Batch" };
+        AZ::TaskDescriptor workTaskDescriptor{ "Extract File Data", "Archive Extract Batch" };
+        AZ::TaskDescriptor completeTaskDescriptor{ "Complete Files", "Archive Extract Batch" };
+
+        // Report the files that cannot be extracted
+        // This also makes sure the task graph is never empty, so the completion event is always signaled
+        taskGraph.AddTask(completeTaskDescriptor, [batchState]()
+        {
+            for (auto& [requestIndex, extractResult] : batchState->m_failedRequests)
+            {
+                batchState->m_extractFileCallback(requestIndex, AZStd::move(extractResult));
+            }
+        });
+
+        // The reads are serialized on the archive stream mutex, so reads are chained to
+        // only occupy up to m_maxReadTasks executor threads at a time. This leaves the remaining
+        // threads free to extract the files of the reads that have completed
+        const AZ::u32 maxReadTasks = AZStd::max(1U, m_settings.m_maxReadTasks);
+        AZStd::vector<AZ::TaskToken> readTaskTokens;
+        readTaskTokens.reserve(batchState->m_reads.size());
+        for (size_t readIndex = 0; readIndex < batchState->m_reads.size(); ++readIndex)
+        {
+            auto readTask = [this, batchState, readIndex]()
+            {
+                ExtractBatchRead& batchRead = batchState->m_reads[readIndex];
+                AZStd::span<AZStd::byte> readSpan;
+                if (batchRead.m_readIntoOutput)
+                {
+                    readSpan = batchState->m_files[batchRead.m_firstFile].m_outputSpan.first(batchRead.m_size);
+                }
+                else
+                {
+                    // The read buffer is only allocated when the read runs to limit the memory
+                    // in use by the batch at a time
+                    batchRead.m_readBuffer.resize_no_construct(batchRead.m_size);
+                    readSpan = batchRead.m_readBuffer;
+                }
+
+                AZStd::scoped_lock archiveReadLock(m_archiveStreamMutex);
+                if (AZ::IO::SizeType bytesRead = m_archiveStream->ReadAtOffset(readSpan.size(), readSpan.data(),
+                    batchRead.m_offset);
+                    bytesRead < readSpan.size())
+                {
+                    batchRead.m_readOutcome = AZStd::unexpected(ResultString::format("Attempted to read %zu bytes from the"
+                        " archive at offset %llu. But only %llu bytes were able to be read.",
+                        readSpan.size(), batchRead.m_offset, bytesRead));
+                }
+            };
+            AZ::TaskToken& readToken = readTaskTokens.emplace_back(taskGraph.AddTask(readTaskDescriptor, AZStd::move(readTask)));
+            if (readIndex >= maxReadTasks)
+            {
+                readTaskTokens[readIndex - maxReadTasks].Precedes(readToken);
+            }
+
+            // Validates the extraction of each file within the read and invokes the callback for it
+            auto completeTask = [batchState, readIndex]()
+            {
+                ExtractBatchRead& batchRead = batchState->m_reads[readIndex];
+                for (size_t fileIndex = batchRead.m_firstFile; fileIndex < batchRead.m_lastFile; ++fileIndex)
+                {
+                    ExtractBatchFile& batchFile = batchState->m_files[fileIndex];
+                    if (batchFile.m_extractResult && !batchRead.m_readOutcome)
+                    {
+                        batchFile.m_extractResult.m_resultOutcome = batchRead.m_readOutcome;
+                    }
+
+                    for (size_t workItemIndex = batchFile.m_firstWorkItem;
+                        batchFile.m_extractResult && workItemIndex < batchFile.m_firstWorkItem + batchFile.m_workItemCount;
+                        ++workItemIndex)
+                    {
+                        batchFile.m_extractResult.m_resultOutcome = batchState->m_workItems[workItemIndex].m_outcome;
+                    }
+
+                    if (!batchFile.m_extractResult)
+                    {
+                        batchFile.m_extractResult.m_fileSpan = {};
+                    }
+                    batchState->m_extractFileCallback(batchFile.m_requestIndex, AZStd::move(batchFile.m_extractResult));
+                }
+
+                // Release the read buffer as soon as the files within it have been extracted
+                AZStd::vector<AZStd::byte>{}.swap(batchRead.m_readBuffer);
+            };
+            AZ::TaskToken completeToken = taskGraph.AddTask(completeTaskDescriptor, AZStd::move(completeTask));
+            readToken.Precedes(completeToken);
+
+            const ExtractBatchRead& batchRead = batchState->m_reads[readIndex];
+            const size_t firstWorkItem = batchState->m_files[batchRead.m_firstFile].m_firstWorkItem;
+            const size_t lastWorkItem = batchState->m_files[batchRead.m_lastFile - 1].m_firstWorkItem
+                + batchState->m_files[batchRead.m_lastFile - 1].m_workItemCount;
+            for (size_t workItemIndex = firstWorkItem; workItemIndex < lastWorkItem; ++workItemIndex)
+            {
+                auto workTask = [batchState, readIndex, workItemIndex]()
+                {
+                    const ExtractBatchRead& batchRead = batchState->m_reads[readIndex];
+                    if (!batchRead.m_readOutcome)
+                    {
+                        return;
+                    }
+
+                    ExtractBatchWorkItem& workItem = batchState->m_workItems[workItemIndex];
+                    const ExtractBatchFile& batchFile = batchState->m_files[workItem.m_fileIndex];
+                    AZStd::span<const AZStd::byte> inputSpan = AZStd::span<const AZStd::byte>(batchRead.m_readBuffer)
+                        .subspan(workItem.m_readBufferOffset, workItem.m_inputSize);
+                    if (batchFile.m_decompressionInterface == nullptr)
+                    {
+                        ::memcpy(workItem.m_outputSpan.data(), inputSpan.data(), inputSpan.size());
+                        return;
+                    }
+
+                    // Files compressed with a dictionary must be decompressed with the same dictionary from the TOC
+                    const Compression::DecompressionOptions& requestDecompressionOptions =
+                        batchFile.m_requestDecompressionOptions != nullptr
+                        ? *batchFile.m_requestDecompressionOptions
+                        : batchState->m_defaultDecompressionOptions;
+                    const Compression::DecompressionOptions& decompressionOptions =
+                        !batchFile.m_dictionaryDecompressionOptions.m_dictionary.empty()
+                        ? batchFile.m_dictionaryDecompressionOptions
+                        : requestDecompressionOptions;
+                    if (Compression::DecompressionResultData decompressedBlockResult = batchFile.m_decompressionInterface->DecompressBlock(
+                        workItem.m_outputSpan, inputSpan, decompressionOptions);
+                        !decompressedBlockResult)
+                    {
+                        workItem.m_outcome = AZStd::unexpected(AZStd::move(decompressedBlockResult.m_decompressionOutcome.m_resultString));
+                    }
+                };
+                AZ::TaskToken workToken = taskGraph.AddTask(workTaskDescriptor, AZStd::move(workTask));
+                readToken.Precedes(workToken);
+                workToken.Precedes(completeToken);
+            }
+        }
+
+        // The task graph owns the batch state through the task lambdas,
+        // so it is detached to free the tasks once the batch completes
+        taskGraph.Detach();
+        taskGraph.SubmitOnExecutor(m_taskExecutor, completionEvent);
+        return {};
+    }
+
     ArchiveListFileResult ArchiveReader::ListFileInArchive(ArchiveFileToken archiveFileToken) const
     {
         if (static_cast<AZ::u64>(archiveFileToken) > m_archiveToc.m_tocView.m_filePathIndexTable.size())
@@ -753,8 +1330,8 @@ namespace Archive
                 ResultString("An empty file path has been supplied and cannot be found in the archive."));
             return errorResult;
         }
-        auto foundIt = m_pathMap.find(relativePath);
-        if (foundIt == m_pathMap.end())
+        const ArchiveFileToken archiveFileToken = FindFileToken(relativePath);
+        if (archiveFileToken == InvalidArchiveFileToken)
         {
             ArchiveListFileResult errorResult;
             errorResult.m_relativeFilePath = AZStd::move(relativePath);
@@ -766,12 +1343,23 @@ namespace Archive
 
         // Now that the file has been found, pass in the ArchiveFileToken to the
         // the other overload
-        return ListFileInArchive(static_cast<ArchiveFileToken>(foundIt->second));
+        return ListFileInArchive(archiveFileToken);
+    }
+
+    ArchiveFileToken ArchiveReader::FindFileToken(AZ::IO::PathView relativePath) const
+    {
+        if (!m_archiveToc.m_tocView.m_pathHashBucketTable.empty())
+        {
+            return FindFileInPathHashTable(m_archiveToc.m_tocView, relativePath);
+        }
+
+        auto foundIt = m_pathMap.find(relativePath);
+        return foundIt != m_pathMap.end() ? static_cast<ArchiveFileToken>(foundIt->second) : InvalidArchiveFileToken;
     }
 
     bool ArchiveReader::ContainsFile(AZ::IO::PathView relativePath) const
     {
-        return static_cast<bool>(ListFileInArchive(relativePath));
+        return !relativePath.empty() && FindFileToken(relativePath) != InvalidArchiveFileToken;
     }
 
     EnumerateArchiveResult ArchiveReader::EnumerateFilesInArchive(ListFileCallback listFileCallback) const
@@ -13,6 +13,8 @@
 
 #include <Clients/ArchiveTOCView.h>
 
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/MemoryMappedFile.h>
 #include <AzCore/Memory/Memory_fwd.h>
 #include <AzCore/RTTI/RTTIMacros.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -81,6 +83,25 @@ namespace Archive
         ArchiveExtractFileResult ExtractFileFromArchive(AZStd::span<AZStd::byte> outputSpan,
             const ArchiveReaderFileSettings& fileSettings) override;
 
+        //! Extracts a batch of files from the archive asynchronously
+        //! The files are sorted by their offset in the archive, files stored near each other
+        //! are read using a single large read and the compressed blocks of every file in the batch
+        //! are decompressed in parallel.
+        //! The ArchiveExtractBatchSettings callback is invoked as soon as each file has been extracted
+        //! and the completion event is signaled once the callback has been invoked for every request.
+        //! The archive must stay mounted until the completion event is signaled.
+        //!
+        //! @param requests files to extract along with the pre-allocated buffer to extract each file into
+        //! The span of requests is copied, so it doesn't need to outlive this call
+        //! @param batchSettings settings containing the callback to invoke with the result of each file
+        //! and settings for how reads of neighboring files are coalesced
+        //! @param completionEvent event which is signaled when every file in the batch has been extracted
+        //! It must outlive the batch and cannot be reused for another batch
+        //! @return On success the batch has been submitted to the task executor.
+        //! On failure an error message is returned and neither the callback is invoked nor the event is signaled
+        ResultOutcome ExtractFilesFromArchiveAsync(AZStd::span<const ArchiveExtractFileRequest> requests,
+            const ArchiveExtractBatchSettings& batchSettings, AZ::TaskGraphEvent* completionEvent) override;
+
         //! List the file metadata from the archive using the ArchiveFileToken
         //! @param filePathToken identifier token that can be used to quickly lookup
         //! metadata about the file
@@ -121,20 +142,35 @@ namespace Archive
         //! Reads the Archive Header into memory.
         //! Afterwards the Archive Header is used to read the TOC into memory
         //! and build any structures for acceleration of lookups
-        bool ReadArchiveHeaderAndToc();
+        //! @param archivePath path of the mounted archive if it was mounted by path.
+        //! It is used to memory map the table of contents
+        bool ReadArchiveHeaderAndToc(AZ::IO::PathView archivePath = {});
         //! Reads the archive header from the generic stream
         bool ReadArchiveHeader(ArchiveHeader& archiveHeader, AZ::IO::GenericStream& archiveStream);
         //! Reads the archive table of contents from the generic stream by using the archive header
         //! to determine the offset and size of the table of contents
+        //! If the table of contents is uncompressed and the archive path is not empty,
+        //! the table of contents is viewed through a memory mapping of the archive instead
         struct ArchiveTableOfContentsReader;
         bool ReadArchiveTOC(ArchiveTableOfContentsReader& archiveToc, AZ::IO::GenericStream& archiveStream,
-            const ArchiveHeader& archiveHeader);
+            const ArchiveHeader& archiveHeader, AZ::IO::PathView archivePath);
+
+        //! Maps the table of contents of the archive at the archive path into memory
+        //! @return true if the archive could be mapped and the archiveToc has been updated with a view into the mapping
+        bool MapArchiveTOC(ArchiveTableOfContentsReader& archiveToc, const ArchiveHeader& archiveHeader,
+            AZ::IO::PathView archivePath);
 
         //! Creates a mapping of views to the file paths within the archive to the ArchiveFileToken
         //! The ArchiveFileToken currently corresponds to the index within the table of contents
         //! ArchiveTocFilePathIndex, ArchiveTocFileMetadata and ArchiveFilePath vector structures
+        //! The mapping is only built for archives without a TOC Path Hash table
         bool BuildFilePathMap(const ArchiveTableOfContentsView& archiveToc);
 
+        //! Looks up the ArchiveFileToken of a relative path using the TOC Path Hash table
+        //! or the file path map for archives without one
+        //! @return the ArchiveFileToken of the file or InvalidArchiveFileToken if the file is not in the archive
+        ArchiveFileToken FindFileToken(AZ::IO::PathView relativePath) const;
+
         //! Read data from offset within archive directly to span
         //! @param fileBuffer pre-allocated span to populate buffer with data
         //! @param offset absolute file within mounted archive to start reading data from
@@ -166,6 +202,31 @@ namespace Archive
             const ArchiveReaderFileSettings& fileSettings,
             const ArchiveExtractFileResult& extractFileResult);
 
+        //! Lists the file of a batch request and validates that the output span of the request
+        //! is large enough to store the extracted file
+        //! @return extract file result with the metadata of the file,
+        //! or with the error that prevents the file from being extracted
+        ArchiveExtractFileResult ListFileForExtractRequest(const ArchiveExtractFileRequest& request) const;
+
+        //! Describes a file within the archive to the Streamer
+        //! @param found set to true if the file is in the archive and info has been populated
+        //! @param info populated with the location of the file in the archive and the table of its compressed blocks
+        //! @param filePath path of the file without its alias as requested from the Streamer
+        void FindStreamerCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, AZ::IO::PathView filePath) const;
+
+        //! Connects to the AZ::IO::CompressionBus while an archive is mounted by path
+        //! with the ArchiveReaderSettings::m_registerWithStreamer setting enabled
+        //! A separate handler is used, as the AZ::IO::Compression bus interface would hide the Compression namespace
+        class StreamerCompressionHandler
+            : public AZ::IO::CompressionBus::Handler
+        {
+        public:
+            explicit StreamerCompressionHandler(const ArchiveReader& archiveReader);
+            void FindCompressionInfo(bool& found, AZ::IO::CompressionInfo& info, const AZ::IO::PathView filePath) override;
+
+        private:
+            const ArchiveReader& m_archiveReader;
+        };
 
         // Private Member variables section
 
@@ -188,15 +249,20 @@ namespace Archive
             // Stores the buffer containing the Table of Contents raw data
             // and an ArchiveTableOfContentsView instance which is a read-only view into that raw data
             ArchiveTableOfContentsReader(AZStd::vector<AZStd::byte> tocBuffer, ArchiveTableOfContentsView tocView);
+            // Stores the memory mapping of the archive
+            // and an ArchiveTableOfContentsView instance which is a read-only view into the mapped Table of Contents
+            ArchiveTableOfContentsReader(AZ::IO::MemoryMappedFile mappedArchive, ArchiveTableOfContentsView tocView);
 
             ArchiveTableOfContentsView m_tocView;
         private:
             AZStd::vector<AZStd::byte> m_tocBuffer;
+            AZ::IO::MemoryMappedFile m_mappedArchive;
         };
         ArchiveTableOfContentsReader m_archiveToc;
 
         //! Stores mapping of FilePath to index within the file path table in the Archive TOC
         //! The index is used to as the ArchiveFileToken
+        //! It is empty if the Archive TOC contains a path hash table
         //! IMPORTANT: The PathView is a view into the m_archiveToc TOC buffer
         //! and therefore this map should be cleared before reading another archive TOC
         using FilePathTable = AZStd::unordered_map<AZ::IO::PathView, size_t>;
@@ -205,6 +271,10 @@ namespace Archive
         //! GenericStream pointer which stores the open archive
         ArchiveStreamPtr m_archiveStream;
 
+        //! Path of the archive if it was mounted by path
+        //! Streamer reads of files in the archive are issued against this path
+        AZ::IO::Path m_archivePath;
+
         //! Protects reads within the archive stream
         //! NOTE: This does restrict read jobs to be done on one thread at a time
         //! if done using the AZ::IO::GenericStream API as it maintains a single seek position
@@ -212,5 +282,8 @@ namespace Archive
 
         //! Task Executor used to decompress blocks of a file in parallel
         AZ::TaskExecutor m_taskExecutor;
+
+        //! Answers the Streamer queries for files within the mounted archive
+        StreamerCompressionHandler m_streamerCompressionHandler{ *this };
     };
 } // namespace Archive
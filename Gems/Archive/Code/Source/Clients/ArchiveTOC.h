@@ -88,6 +88,19 @@ namespace Archive
 
         //! vector storing the block offset table for each file
         AZStd::vector<ArchiveBlockLineUnion> m_blockOffsetTable{};
+
+        //! vector storing a copy of each compression dictionary
+        //! The ArchiveTocFileMetadata::m_dictionaryIndex of a file is a 1-based index into this vector
+        using CompressionDictionary = AZStd::vector<AZStd::byte>;
+        AZStd::vector<CompressionDictionary> m_dictionaries;
+
+        //! Builds the TOC Path Hash table, which is a minimal perfect hash of the non-empty file paths
+        //! The path hash table isn't stored in this structure as it must be rebuilt whenever a file is added or removed
+        //! @return the raw path hash table section, which is a ArchiveTocPathHashTableHeader followed by the
+        //!         bucket displacement table and slot file index table and padded to a multiple of 8 bytes.
+        //!         An empty vector is returned if there are no file paths or a perfect hash could not be found, such as when
+        //!         the table of contents contains paths which only differ in case.
+        AZStd::vector<AZStd::byte> BuildPathHashTable() const;
     };
 } // namespace Archive
 
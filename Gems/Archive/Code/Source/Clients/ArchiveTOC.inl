@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <AzCore/std/sort.h>
+
 #include "ArchiveTOCView.h"
 
 namespace Archive
@@ -112,7 +114,192 @@ namespace Archive
             filePath = pathView.LexicallyNormal();
         }
 
+        // Copy each compression dictionary out of the dictionary blob
+        tableOfContents.m_dictionaries.reserve(tocView.m_dictionaryIndexTable.size());
+        for (const ArchiveTocDictionaryIndex& dictionaryIndexEntry : tocView.m_dictionaryIndexTable)
+        {
+            auto dictionary = tocView.m_dictionaryBlob.subspan(dictionaryIndexEntry.m_offset, dictionaryIndexEntry.m_size);
+            tableOfContents.m_dictionaries.emplace_back(dictionary.begin(), dictionary.end());
+        }
+
         return tableOfContents;
     }
+    inline AZStd::vector<AZStd::byte> ArchiveTableOfContents::BuildPathHashTable() const
+    {
+        struct PathHashEntry
+        {
+            AZ::u64 m_hash{};
+            AZ::u32 m_fileIndex{};
+        };
+
+        // Average number of paths per bucket
+        // Larger buckets reduce the size of the table, but take longer to place
+        constexpr AZ::u64 PathsPerBucket = 4;
+        // Bounds the search for a displacement that places a bucket in free slots
+        // before giving up and rebuilding the table with a different seed
+        constexpr AZ::u32 MaxDisplacement = AZStd::numeric_limits<AZ::u32>::max() >> 4;
+        constexpr AZ::u64 MaxSeedAttempts = 8;
+        // Marks a slot which hasn't been claimed by a path yet
+        constexpr AZ::u32 InvalidSlotFileIndex = AZStd::numeric_limits<AZ::u32>::max();
+
+        AZStd::vector<PathHashEntry> pathHashEntries;
+        pathHashEntries.reserve(m_filePaths.size());
+        for (size_t fileIndex = 0; fileIndex < m_filePaths.size(); ++fileIndex)
+        {
+            if (!m_filePaths[fileIndex].empty())
+            {
+                pathHashEntries.push_back({ 0, static_cast<AZ::u32>(fileIndex) });
+            }
+        }
+
+        if (pathHashEntries.empty())
+        {
+            return {};
+        }
+
+        const AZ::u64 slotCount = pathHashEntries.size();
+        const AZ::u64 bucketCount = (slotCount + PathsPerBucket - 1) / PathsPerBucket;
+
+        AZStd::vector<AZ::u32> bucketDisplacements;
+        AZStd::vector<AZ::u32> slotFileIndices;
+        AZStd::vector<AZ::u32> bucketOrder;
+        AZStd::vector<AZ::u32> bucketStartIndices;
+        for (AZ::u64 seedAttempt = 0; seedAttempt < MaxSeedAttempts; ++seedAttempt)
+        {
+            const AZ::u64 seed = seedAttempt * 0x9e37'79b9'7f4a'7c15;
+            for (PathHashEntry& pathHashEntry : pathHashEntries)
+            {
+                pathHashEntry.m_hash = HashArchiveFilePath(m_filePaths[pathHashEntry.m_fileIndex].Native(), seed);
+            }
+
+            // Group the paths by bucket
+            AZStd::sort(pathHashEntries.begin(), pathHashEntries.end(),
+                [bucketCount](const PathHashEntry& left, const PathHashEntry& right)
+                {
+                    const AZ::u64 leftBucket = GetPathHashBucket(left.m_hash, bucketCount);
+                    const AZ::u64 rightBucket = GetPathHashBucket(right.m_hash, bucketCount);
+                    return leftBucket != rightBucket ? leftBucket < rightBucket : left.m_hash < right.m_hash;
+                });
+
+            // Paths with the same hash can't be placed in different slots
+            // This happens for paths which only differ by case or path separators
+            // and for a 64-bit hash collision, which a different seed resolves
+            bool hasDuplicateHash = false;
+            for (size_t entryIndex = 1; entryIndex < pathHashEntries.size(); ++entryIndex)
+            {
+                if (pathHashEntries[entryIndex - 1].m_hash == pathHashEntries[entryIndex].m_hash)
+                {
+                    hasDuplicateHash = true;
+                    break;
+                }
+            }
+            if (hasDuplicateHash)
+            {
+                continue;
+            }
+
+            bucketStartIndices.assign(bucketCount + 1, 0);
+            for (const PathHashEntry& pathHashEntry : pathHashEntries)
+            {
+                ++bucketStartIndices[GetPathHashBucket(pathHashEntry.m_hash, bucketCount) + 1];
+            }
+            for (size_t bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                bucketStartIndices[bucketIndex + 1] += bucketStartIndices[bucketIndex];
+            }
+
+            // Place the largest buckets first while most of the slots are still free
+            bucketOrder.resize(bucketCount);
+            for (AZ::u32 bucketIndex = 0; bucketIndex < bucketCount; ++bucketIndex)
+            {
+                bucketOrder[bucketIndex] = bucketIndex;
+            }
+            AZStd::sort(bucketOrder.begin(), bucketOrder.end(),
+                [&bucketStartIndices](AZ::u32 left, AZ::u32 right)
+                {
+                    const AZ::u32 leftSize = bucketStartIndices[left + 1] - bucketStartIndices[left];
+                    const AZ::u32 rightSize = bucketStartIndices[right + 1] - bucketStartIndices[right];
+                    return leftSize != rightSize ? leftSize > rightSize : left < right;
+                });
+
+            bucketDisplacements.assign(bucketCount, 0);
+            slotFileIndices.assign(slotCount, InvalidSlotFileIndex);
+            bool allBucketsPlaced = true;
+            for (const AZ::u32 bucketIndex : bucketOrder)
+            {
+                const auto bucketEntries = AZStd::span(pathHashEntries).subspan(bucketStartIndices[bucketIndex],
+                    bucketStartIndices[bucketIndex + 1] - bucketStartIndices[bucketIndex]);
+                if (bucketEntries.empty())
+                {
+                    // Buckets are ordered by size, so the remaining buckets are empty as well
+                    break;
+                }
+
+                bool bucketPlaced = false;
+                for (AZ::u32 displacement = 0; displacement < MaxDisplacement && !bucketPlaced; ++displacement)
+                {
+                    // Claim a slot for each path in the bucket and release the claimed slots
+                    // if any path in the bucket lands on a slot which is already taken
+                    size_t claimedCount = 0;
+                    for (; claimedCount < bucketEntries.size(); ++claimedCount)
+                    {
+                        const AZ::u64 slotIndex = GetPathHashSlot(bucketEntries[claimedCount].m_hash, displacement, slotCount);
+                        if (slotFileIndices[slotIndex] != InvalidSlotFileIndex)
+                        {
+                            break;
+                        }
+                        slotFileIndices[slotIndex] = bucketEntries[claimedCount].m_fileIndex;
+                    }
+
+                    if (claimedCount == bucketEntries.size())
+                    {
+                        bucketDisplacements[bucketIndex] = displacement;
+                        bucketPlaced = true;
+                    }
+                    else
+                    {
+                        for (size_t releaseIndex = 0; releaseIndex < claimedCount; ++releaseIndex)
+                        {
+                            slotFileIndices[GetPathHashSlot(bucketEntries[releaseIndex].m_hash, displacement, slotCount)] =
+                                InvalidSlotFileIndex;
+                        }
+                    }
+                }
+
+                if (!bucketPlaced)
+                {
+                    allBucketsPlaced = false;
+                    break;
+                }
+            }
+
+            if (!allBucketsPlaced)
+            {
+                continue;
+            }
+
+            // Serialize the path hash table
+            ArchiveTocPathHashTableHeader pathHashTableHeader;
+            pathHashTableHeader.m_bucketCount = static_cast<AZ::u32>(bucketCount);
+            pathHashTableHeader.m_slotCount = static_cast<AZ::u32>(slotCount);
+            pathHashTableHeader.m_seed = seed;
+
+            const auto bucketTableBytes = AZStd::as_bytes(AZStd::span(bucketDisplacements));
+            const auto slotTableBytes = AZStd::as_bytes(AZStd::span(slotFileIndices));
+            AZStd::vector<AZStd::byte> pathHashTable;
+            pathHashTable.reserve(AZ_SIZE_ALIGN_UP(sizeof(pathHashTableHeader) + bucketTableBytes.size() + slotTableBytes.size(),
+                sizeof(AZ::u64)));
+            const auto headerBytes = AZStd::as_bytes(AZStd::span(&pathHashTableHeader, 1));
+            pathHashTable.insert(pathHashTable.end(), headerBytes.begin(), headerBytes.end());
+            pathHashTable.insert(pathHashTable.end(), bucketTableBytes.begin(), bucketTableBytes.end());
+            pathHashTable.insert(pathHashTable.end(), slotTableBytes.begin(), slotTableBytes.end());
+            // Pad the path hash table to an 8 byte boundary
+            pathHashTable.resize(AZ_SIZE_ALIGN_UP(pathHashTable.size(), sizeof(AZ::u64)), AZStd::byte{});
+            return pathHashTable;
+        }
+
+        return {};
+    }
+
 } // namespace Archive
 
@@ -9,11 +9,13 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/function/function_fwd.h>
 
+#include <Archive/Clients/ArchiveBaseAPI.h>
 #include <Archive/Clients/ArchiveInterfaceStructs.h>
 
 namespace Archive
@@ -25,7 +27,9 @@ namespace Archive
         InvalidMagicBytes = 1,
         FileMetadataTableSizeMismatch,
         FileIndexTableSizeMismatch,
-        BlockOffsetTableCountMismatch
+        BlockOffsetTableCountMismatch,
+        DictionaryTableSizeMismatch,
+        PathHashTableSizeMismatch
     };
 
     //! Stores the error code and any error messages related to failing
@@ -48,7 +52,7 @@ namespace Archive
         //! and a buffer containing the uncompressed table of contents data from storage
         using CreateTOCViewOutcome = AZStd::expected<ArchiveTableOfContentsView, ArchiveTocValidationResult>;
         static CreateTOCViewOutcome CreateFromArchiveHeaderAndBuffer(const ArchiveHeader& archiveHeader,
-            AZStd::span<AZStd::byte> tocBuffer);
+            AZStd::span<const AZStd::byte> tocBuffer);
 
         //! 8-byte magic bytes entry used to indicate that the read table of contents is valid
         AZ::u64 m_magicBytes = ArchiveTocMagicBytes;
@@ -65,6 +69,20 @@ namespace Archive
 
         //! pointer to block offset table which stores the compressed size of all blocks within the archive
         AZStd::span<ArchiveBlockLineUnion const> m_blockOffsetTable{};
+
+        //! pointer to the dictionary index table which stores the size and offset of each compression dictionary
+        //! The ArchiveTocFileMetadata::m_dictionaryIndex of a file is a 1-based index into this table
+        AZStd::span<ArchiveTocDictionaryIndex const> m_dictionaryIndexTable{};
+        //! view into the blob containing the compression dictionaries
+        AZStd::span<AZStd::byte const> m_dictionaryBlob{};
+
+        //! Seed of the path hash function used to build the path hash table
+        AZ::u64 m_pathHashSeed{};
+        //! pointer to the displacement of each bucket of the path hash table
+        //! It is empty if the archive was written without a path hash table
+        AZStd::span<AZ::u32 const> m_pathHashBucketTable{};
+        //! pointer to the file index stored in each slot of the path hash table
+        AZStd::span<AZ::u32 const> m_pathHashSlotTable{};
     };
 
     //! Options which allows configuring which sections of the table of contents
@@ -148,6 +166,39 @@ namespace Archive
     using GetRawFileSizeOutcome = AZStd::expected<AZ::u64, ResultString>;
     GetRawFileSizeOutcome GetRawFileSize(const ArchiveTocFileMetadata& fileMetadata,
         AZStd::span<const ArchiveBlockLineUnion> tocBlockOffsetTable);
+
+    //! Retrieves the compression dictionary a file was compressed with
+    //! @param tocView readonly view into the Archive TOC
+    //! @param fileMetadata TOC file metadata entry of the file whose m_dictionaryIndex is looked up
+    //! @return a view of the dictionary in the TOC dictionary blob or an empty span
+    //!         if the file was compressed without a dictionary or the index is out of range
+    AZStd::span<const AZStd::byte> GetDictionaryForFile(const ArchiveTableOfContentsView& tocView,
+        const ArchiveTocFileMetadata& fileMetadata);
+
+   //! Hashes a relative file path for the TOC path hash table
+   //! Both path separators are treated as '/', consecutive separators are hashed as one
+   //! and ASCII characters are hashed as lowercase, so that the hash is consistent with how
+   //! AZ::IO::PathView compares paths on every platform
+   //! NOTE: The hash is stored in the archive, so it must not change between versions
+   //! @param filePath relative file path to hash
+   //! @param seed seed stored in the path hash table header
+   //! @return 64-bit hash of the file path
+    constexpr AZ::u64 HashArchiveFilePath(AZStd::string_view filePath, AZ::u64 seed);
+
+   //! Returns the bucket of the path hash table a file path hash belongs to
+    constexpr AZ::u64 GetPathHashBucket(AZ::u64 filePathHash, AZ::u64 bucketCount);
+   //! Returns the slot of the path hash table a file path hash is placed in with the displacement of its bucket
+    constexpr AZ::u64 GetPathHashSlot(AZ::u64 filePathHash, AZ::u32 displacement, AZ::u64 slotCount);
+
+   //! Looks up the index of a file within the TOC using the path hash table
+   //! The lookup hashes the path once and compares it against a single path in the file path blob
+   //! so it doesn't allocate any memory
+   //! @param tocView readonly view into the Archive TOC
+   //! @param relativePath path of the file to lookup
+   //! @return index of the file in the TOC or InvalidArchiveFileToken if the path is not in the archive
+   //!         or the archive does not have a path hash table
+    ArchiveFileToken FindFileInPathHashTable(const ArchiveTableOfContentsView& tocView,
+        AZ::IO::PathView relativePath);
 }
 
 // Implementation for any struct functions
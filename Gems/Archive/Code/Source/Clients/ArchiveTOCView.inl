@@ -16,7 +16,7 @@ namespace Archive
     inline ArchiveTableOfContentsView::ArchiveTableOfContentsView() = default;
 
     inline auto ArchiveTableOfContentsView::CreateFromArchiveHeaderAndBuffer(const ArchiveHeader& archiveHeader,
-        AZStd::span<AZStd::byte> tocBuffer) -> CreateTOCViewOutcome
+        AZStd::span<const AZStd::byte> tocBuffer) -> CreateTOCViewOutcome
     {
         // A valid table of contents must have at least 8 bytes to store the Magic Bytes
         if (tocBuffer.size() < sizeof(ArchiveTocMagicBytes))
@@ -56,7 +56,7 @@ namespace Archive
             sizeof(ArchiveBlockLineUnion));
 
         // Cast the first 8 of the TOC buffer
-        tocView.m_magicBytes = *reinterpret_cast<decltype(tocView.m_magicBytes)*>(tocBuffer.data() + MagicBytesOffset);
+        tocView.m_magicBytes = *reinterpret_cast<const decltype(tocView.m_magicBytes)*>(tocBuffer.data() + MagicBytesOffset);
         // create a span to the file metadata entries
         tocView.m_fileMetadataTable = AZStd::span(
             reinterpret_cast<const ArchiveTocFileMetadata*>(tocBuffer.data() + FileMetadataTableOffset),
@@ -80,6 +80,86 @@ namespace Archive
             blockOffsetTableBegin,
             blockOffsetTableEnd);
 
+        // The dictionary table follows the block offset table and starts with the count of dictionaries
+        // followed by the dictionary index entries and the dictionary blob
+        if (archiveHeader.m_tocDictionaryTableUncompressedSize >= sizeof(AZ::u64))
+        {
+            const size_t DictionaryTableOffset = BlockOffsetTableOffset + archiveHeader.m_tocBlockOffsetTableUncompressedSize;
+            const size_t DictionaryTableEndOffset = DictionaryTableOffset + archiveHeader.m_tocDictionaryTableUncompressedSize;
+            if (DictionaryTableEndOffset > tocBuffer.size())
+            {
+                ArchiveTocValidationResult tocValidationResult;
+                tocValidationResult.m_errorCode = ArchiveTocErrorCode::DictionaryTableSizeMismatch;
+                tocValidationResult.m_errorMessage = ArchiveTocValidationResult::ErrorString::format(
+                    "The Archive TOC Dictionary table ends at offset %zu, which is outside of the TOC buffer of size %zu",
+                    DictionaryTableEndOffset, tocBuffer.size());
+                return CreateTOCViewOutcome(AZStd::unexpected(AZStd::move(tocValidationResult)));
+            }
+
+            const AZ::u64 dictionaryCount = *reinterpret_cast<const AZ::u64*>(tocBuffer.data() + DictionaryTableOffset);
+            const size_t DictionaryIndexTableOffset = DictionaryTableOffset + sizeof(AZ::u64);
+            const size_t DictionaryBlobOffset = DictionaryIndexTableOffset + dictionaryCount * sizeof(ArchiveTocDictionaryIndex);
+            if (dictionaryCount > MaxDictionaryCount || DictionaryBlobOffset > DictionaryTableEndOffset)
+            {
+                ArchiveTocValidationResult tocValidationResult;
+                tocValidationResult.m_errorCode = ArchiveTocErrorCode::DictionaryTableSizeMismatch;
+                tocValidationResult.m_errorMessage = ArchiveTocValidationResult::ErrorString::format(
+                    "The Archive TOC Dictionary table count of %llu dictionaries does not fit in the dictionary table size %u",
+                    dictionaryCount, archiveHeader.m_tocDictionaryTableUncompressedSize);
+                return CreateTOCViewOutcome(AZStd::unexpected(AZStd::move(tocValidationResult)));
+            }
+
+            tocView.m_dictionaryIndexTable = AZStd::span(
+                reinterpret_cast<const ArchiveTocDictionaryIndex*>(tocBuffer.data() + DictionaryIndexTableOffset),
+                dictionaryCount);
+            tocView.m_dictionaryBlob = AZStd::span<const AZStd::byte>(
+                tocBuffer.data() + DictionaryBlobOffset,
+                tocBuffer.data() + DictionaryTableEndOffset);
+        }
+
+        // The path hash table follows the dictionary table and starts with the path hash table header
+        // followed by the bucket displacement entries and the slot file index entries
+        if (archiveHeader.m_tocPathHashTableUncompressedSize >= sizeof(ArchiveTocPathHashTableHeader))
+        {
+            const size_t PathHashTableOffset = BlockOffsetTableOffset + archiveHeader.m_tocBlockOffsetTableUncompressedSize
+                + archiveHeader.m_tocDictionaryTableUncompressedSize;
+            const size_t PathHashTableEndOffset = PathHashTableOffset + archiveHeader.m_tocPathHashTableUncompressedSize;
+            if (PathHashTableEndOffset > tocBuffer.size())
+            {
+                ArchiveTocValidationResult tocValidationResult;
+                tocValidationResult.m_errorCode = ArchiveTocErrorCode::PathHashTableSizeMismatch;
+                tocValidationResult.m_errorMessage = ArchiveTocValidationResult::ErrorString::format(
+                    "The Archive TOC Path Hash table ends at offset %zu, which is outside of the TOC buffer of size %zu",
+                    PathHashTableEndOffset, tocBuffer.size());
+                return CreateTOCViewOutcome(AZStd::unexpected(AZStd::move(tocValidationResult)));
+            }
+
+            const auto& pathHashTableHeader = *reinterpret_cast<const ArchiveTocPathHashTableHeader*>(
+                tocBuffer.data() + PathHashTableOffset);
+            const size_t BucketTableOffset = PathHashTableOffset + sizeof(ArchiveTocPathHashTableHeader);
+            const size_t SlotTableOffset = BucketTableOffset + pathHashTableHeader.m_bucketCount * sizeof(AZ::u32);
+            const size_t SlotTableEndOffset = SlotTableOffset + pathHashTableHeader.m_slotCount * sizeof(AZ::u32);
+            if (pathHashTableHeader.m_bucketCount == 0 || pathHashTableHeader.m_slotCount == 0
+                || SlotTableEndOffset > PathHashTableEndOffset)
+            {
+                ArchiveTocValidationResult tocValidationResult;
+                tocValidationResult.m_errorCode = ArchiveTocErrorCode::PathHashTableSizeMismatch;
+                tocValidationResult.m_errorMessage = ArchiveTocValidationResult::ErrorString::format(
+                    "The Archive TOC Path Hash table with %u buckets and %u slots does not fit in the path hash table size %u",
+                    pathHashTableHeader.m_bucketCount, pathHashTableHeader.m_slotCount,
+                    archiveHeader.m_tocPathHashTableUncompressedSize);
+                return CreateTOCViewOutcome(AZStd::unexpected(AZStd::move(tocValidationResult)));
+            }
+
+            tocView.m_pathHashSeed = pathHashTableHeader.m_seed;
+            tocView.m_pathHashBucketTable = AZStd::span(
+                reinterpret_cast<const AZ::u32*>(tocBuffer.data() + BucketTableOffset),
+                pathHashTableHeader.m_bucketCount);
+            tocView.m_pathHashSlotTable = AZStd::span(
+                reinterpret_cast<const AZ::u32*>(tocBuffer.data() + SlotTableOffset),
+                pathHashTableHeader.m_slotCount);
+        }
+
         ArchiveTocValidationOptions validationSettings;
         // Skip over validating the block Offset table has that is a potentially slow operation
         validationSettings.m_validateBlockOffsetTable = false;
@@ -130,6 +210,20 @@ namespace Archive
             return tocValidationResult;
         }
 
+        for (const ArchiveTocDictionaryIndex& dictionaryIndex : tocView.m_dictionaryIndexTable)
+        {
+            if (dictionaryIndex.m_offset + dictionaryIndex.m_size > tocView.m_dictionaryBlob.size())
+            {
+                ArchiveTocValidationResult tocValidationResult;
+                tocValidationResult.m_errorCode = ArchiveTocErrorCode::DictionaryTableSizeMismatch;
+                tocValidationResult.m_errorMessage = ArchiveTocValidationResult::ErrorString::format(
+                    "The Archive TOC Dictionary at offset %llu with size %llu is outside of the dictionary blob of size %zu",
+                    static_cast<AZ::u64>(dictionaryIndex.m_offset), static_cast<AZ::u64>(dictionaryIndex.m_size),
+                    tocView.m_dictionaryBlob.size());
+                return tocValidationResult;
+            }
+        }
+
         if (validationOptions.m_validateBlockOffsetTable)
         {
             // Validate the number blocks line offset table entries matches the total number of block
@@ -345,4 +439,101 @@ namespace Archive
         return compressedSize;
     }
 
+    inline AZStd::span<const AZStd::byte> GetDictionaryForFile(const ArchiveTableOfContentsView& tocView,
+        const ArchiveTocFileMetadata& fileMetadata)
+    {
+        if (fileMetadata.m_dictionaryIndex == ArchiveTocFileMetadata::NoDictionaryIndex
+            || fileMetadata.m_dictionaryIndex > tocView.m_dictionaryIndexTable.size())
+        {
+            return {};
+        }
+
+        const ArchiveTocDictionaryIndex& dictionaryIndex = tocView.m_dictionaryIndexTable[fileMetadata.m_dictionaryIndex - 1];
+        return tocView.m_dictionaryBlob.subspan(dictionaryIndex.m_offset, dictionaryIndex.m_size);
+    }
+
+    constexpr AZ::u64 HashArchiveFilePath(AZStd::string_view filePath, AZ::u64 seed)
+    {
+        // FNV-1a over the normalized characters of the path
+        AZ::u64 hash = 0xcbf2'9ce4'8422'2325 ^ seed;
+        bool previousCharIsSeparator = false;
+        for (char pathChar : filePath)
+        {
+            if (pathChar == AZ::IO::WindowsPathSeparator || pathChar == AZ::IO::PosixPathSeparator)
+            {
+                if (previousCharIsSeparator)
+                {
+                    continue;
+                }
+                pathChar = AZ::IO::PosixPathSeparator;
+                previousCharIsSeparator = true;
+            }
+            else
+            {
+                if (pathChar >= 'A' && pathChar <= 'Z')
+                {
+                    pathChar = static_cast<char>(pathChar - 'A' + 'a');
+                }
+                previousCharIsSeparator = false;
+            }
+
+            hash ^= static_cast<AZ::u8>(pathChar);
+            hash *= 0x100'0000'01b3;
+        }
+
+        // FNV-1a distributes its high bits poorly, so finish with the splitmix64 finalizer
+        hash ^= hash >> 30;
+        hash *= 0xbf58'476d'1ce4'e5b9;
+        hash ^= hash >> 27;
+        hash *= 0x94d0'49bb'1331'11eb;
+        hash ^= hash >> 31;
+        return hash;
+    }
+
+    constexpr AZ::u64 GetPathHashBucket(AZ::u64 filePathHash, AZ::u64 bucketCount)
+    {
+        return (filePathHash >> 32) % bucketCount;
+    }
+
+    constexpr AZ::u64 GetPathHashSlot(AZ::u64 filePathHash, AZ::u32 displacement, AZ::u64 slotCount)
+    {
+        // Remix the hash with the displacement so that each displacement value
+        // places the paths of a bucket in unrelated slots
+        AZ::u64 slotHash = filePathHash ^ (displacement * 0x9e37'79b9'7f4a'7c15);
+        slotHash ^= slotHash >> 33;
+        slotHash *= 0xff51'afd7'ed55'8ccd;
+        slotHash ^= slotHash >> 33;
+        return slotHash % slotCount;
+    }
+
+    inline ArchiveFileToken FindFileInPathHashTable(const ArchiveTableOfContentsView& tocView,
+        AZ::IO::PathView relativePath)
+    {
+        if (tocView.m_pathHashBucketTable.empty() || tocView.m_pathHashSlotTable.empty())
+        {
+            return InvalidArchiveFileToken;
+        }
+
+        const AZ::u64 filePathHash = HashArchiveFilePath(relativePath.Native(), tocView.m_pathHashSeed);
+        const AZ::u32 displacement = tocView.m_pathHashBucketTable[
+            GetPathHashBucket(filePathHash, tocView.m_pathHashBucketTable.size())];
+        const AZ::u32 fileIndex = tocView.m_pathHashSlotTable[
+            GetPathHashSlot(filePathHash, displacement, tocView.m_pathHashSlotTable.size())];
+        if (fileIndex >= tocView.m_filePathIndexTable.size())
+        {
+            return InvalidArchiveFileToken;
+        }
+
+        // A perfect hash maps every path to a slot, including paths that aren't in the archive
+        // so the path stored in the TOC for the file in the slot is compared against the relative path
+        const ArchiveTocFilePathIndex& filePathIndex = tocView.m_filePathIndexTable[fileIndex];
+        if (filePathIndex.m_size == 0 || filePathIndex.m_offset + filePathIndex.m_size > tocView.m_filePathBlob.size())
+        {
+            return InvalidArchiveFileToken;
+        }
+
+        const AZ::IO::PathView archivedPath(tocView.m_filePathBlob.substr(filePathIndex.m_offset, filePathIndex.m_size));
+        return archivedPath == relativePath ? static_cast<ArchiveFileToken>(fileIndex) : InvalidArchiveFileToken;
+    }
+
 } // namespace Archive
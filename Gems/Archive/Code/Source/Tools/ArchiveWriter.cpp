@@ -20,6 +20,8 @@
 #include <Archive/ArchiveTypeIds.h>
 
 #include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/CompressionZStdAPI.h>
+#include <Compression/CompressionZStdDictionaryAPI.h>
 #include <Compression/DecompressionInterfaceAPI.h>
 
 namespace Archive
@@ -581,13 +583,33 @@ namespace Archive
         m_archiveHeader.m_tocBlockOffsetTableUncompressedSize = static_cast<AZ::u32>(
             AZStd::span(m_archiveToc.m_blockOffsetTable).size_bytes());
 
+        // Update the Archive uncompressed TOC dictionary table size
+        // Archives without dictionaries don't store a dictionary table at all
+        m_archiveHeader.m_tocDictionaryTableUncompressedSize = 0;
+        if (!m_archiveToc.m_dictionaries.empty())
+        {
+            AZ::u64 dictionaryTableSize = sizeof(AZ::u64) + m_archiveToc.m_dictionaries.size() * sizeof(ArchiveTocDictionaryIndex);
+            for (const ArchiveTableOfContents::CompressionDictionary& dictionary : m_archiveToc.m_dictionaries)
+            {
+                dictionaryTableSize += dictionary.size();
+            }
+            m_archiveHeader.m_tocDictionaryTableUncompressedSize = static_cast<AZ::u32>(
+                AZ_SIZE_ALIGN_UP(dictionaryTableSize, sizeof(AZ::u64)));
+        }
+
+        // Build the path hash table which allows readers to lookup files in the archive without first
+        // building a map of every file path. The table is only omitted if a perfect hash couldn't be found
+        // in which case readers fall back to mapping the paths themselves
+        const AZStd::vector<AZStd::byte> pathHashTable = m_archiveToc.BuildPathHashTable();
+        m_archiveHeader.m_tocPathHashTableUncompressedSize = static_cast<AZ::u32>(pathHashTable.size());
+
         // 2. Write the Archive Table of Contents
         // Both buffers lifetime must be encompass the tocWriteSpan below
         // to make sure the span points to a valid buffer
         AZStd::vector<AZStd::byte> tocRawBuffer;
         AZStd::vector<AZStd::byte> tocCompressBuffer;
 
-        WriteTocRawResult rawTocResult = WriteTocRaw(tocRawBuffer);
+        WriteTocRawResult rawTocResult = WriteTocRaw(tocRawBuffer, pathHashTable);
         if (!rawTocResult)
         {
             CommitResult result;
@@ -672,7 +694,8 @@ namespace Archive
         return m_errorString.empty();
     }
 
-    auto ArchiveWriter::WriteTocRaw(AZStd::vector<AZStd::byte>& tocOutputBuffer) -> WriteTocRawResult
+    auto ArchiveWriter::WriteTocRaw(AZStd::vector<AZStd::byte>& tocOutputBuffer,
+        AZStd::span<const AZStd::byte> pathHashTable) -> WriteTocRawResult
     {
         tocOutputBuffer.reserve(m_archiveHeader.GetUncompressedTocSize());
 
@@ -740,6 +763,46 @@ namespace Archive
         AZStd::span<ArchiveBlockLineUnion> blockOffsetTableView = m_archiveToc.m_blockOffsetTable;
         tocOutputStream.Write(blockOffsetTableView.size_bytes(), blockOffsetTableView.data());
 
+        // Write out the dictionary table if there are any compression dictionaries
+        // It is made up of the dictionary count, followed by the dictionary index entries
+        // and then the dictionary blob
+        if (!m_archiveToc.m_dictionaries.empty())
+        {
+            const AZ::u64 dictionaryCount = m_archiveToc.m_dictionaries.size();
+            tocOutputStream.Write(sizeof(dictionaryCount), &dictionaryCount);
+
+            AZ::u64 dictionaryOffset{};
+            for (const ArchiveTableOfContents::CompressionDictionary& dictionary : m_archiveToc.m_dictionaries)
+            {
+                ArchiveTocDictionaryIndex dictionaryIndex;
+                dictionaryIndex.m_size = dictionary.size();
+                dictionaryIndex.m_offset = dictionaryOffset;
+                dictionaryOffset += dictionary.size();
+                tocOutputStream.Write(sizeof(dictionaryIndex), &dictionaryIndex);
+            }
+
+            for (const ArchiveTableOfContents::CompressionDictionary& dictionary : m_archiveToc.m_dictionaries)
+            {
+                tocOutputStream.Write(dictionary.size(), dictionary.data());
+            }
+
+            // Pad the dictionary blob to an 8 byte boundary
+            constexpr AZ::u64 DictionaryBlobAlignment = 8;
+            if (const AZ::u64 dictionaryBlobCurAlignment = dictionaryOffset % DictionaryBlobAlignment;
+                dictionaryBlobCurAlignment > 0)
+            {
+                AZStd::byte paddingBytes[DictionaryBlobAlignment]{};
+                tocOutputStream.Write(DictionaryBlobAlignment - dictionaryBlobCurAlignment, paddingBytes);
+            }
+        }
+
+        // Write out the path hash table last
+        // It is already padded to an 8 byte boundary
+        if (!pathHashTable.empty())
+        {
+            tocOutputStream.Write(pathHashTable.size(), pathHashTable.data());
+        }
+
         WriteTocRawResult result;
         result.m_tocSpan = tocOutputBuffer;
         return result;
@@ -890,6 +953,61 @@ namespace Archive
     }
 
 
+    auto ArchiveWriter::TrainCompressionDictionary(AZ::IO::PathView fileExtension,
+        AZStd::span<const AZStd::span<const AZStd::byte>> samples, size_t dictionaryCapacity) -> TrainDictionaryOutcome
+    {
+        if (fileExtension.empty())
+        {
+            return AZStd::unexpected(ResultString("The file extension is empty. A dictionary cannot be trained for it."));
+        }
+
+        if (m_archiveToc.m_dictionaries.size() >= MaxDictionaryCount)
+        {
+            return AZStd::unexpected(ResultString::format("The archive already contains the maximum of %zu dictionaries.",
+                MaxDictionaryCount));
+        }
+
+        // The dictionary size is stored in a 24-bit field of the TOC dictionary index,
+        // a larger dictionary would have its size truncated
+        if (dictionaryCapacity > MaxDictionarySize)
+        {
+            return AZStd::unexpected(ResultString::format("The dictionary capacity %zu exceeds the maximum dictionary size of %zu bytes.",
+                dictionaryCapacity, MaxDictionarySize));
+        }
+
+        auto trainOutcome = CompressionZStd::TrainDictionary(samples, dictionaryCapacity);
+        if (!trainOutcome)
+        {
+            return AZStd::unexpected(ResultString::format(R"(Unable to train a dictionary for extension "%.*s": %s)",
+                AZ_PATH_ARG(fileExtension), trainOutcome.error().c_str()));
+        }
+
+        // Dictionaries are only ever appended, as files which have already been written to the archive
+        // reference a dictionary by its index
+        m_archiveToc.m_dictionaries.emplace_back(AZStd::move(trainOutcome.value()));
+        const auto dictionaryIndex = static_cast<AZ::u16>(m_archiveToc.m_dictionaries.size());
+
+        AZ::IO::Path extensionKey(fileExtension);
+        AZStd::to_lower(extensionKey.Native());
+        m_extensionToDictionaryIndexMap[AZStd::move(extensionKey)] = dictionaryIndex;
+        return dictionaryIndex;
+    }
+
+    AZ::u16 ArchiveWriter::FindDictionaryIndexForFile(const ArchiveWriterFileSettings& fileSettings) const
+    {
+        if (fileSettings.m_compressionAlgorithm != CompressionZStd::GetZStdCompressionAlgorithmId())
+        {
+            return ArchiveTocFileMetadata::NoDictionaryIndex;
+        }
+
+        AZ::IO::Path extensionKey(fileSettings.m_relativeFilePath.Extension());
+        AZStd::to_lower(extensionKey.Native());
+        auto dictionaryIndexIt = m_extensionToDictionaryIndexMap.find(extensionKey);
+        return dictionaryIndexIt != m_extensionToDictionaryIndexMap.end()
+            ? dictionaryIndexIt->second
+            : ArchiveTocFileMetadata::NoDictionaryIndex;
+    }
+
     auto ArchiveWriter::CompressContentFileAsync(AZStd::vector<AZStd::byte>& compressionDataBuffer,
         const ArchiveWriterFileSettings& fileSettings,
         AZStd::span<const AZStd::byte> inputDataSpan) -> CompressContentOutcome
@@ -941,10 +1059,27 @@ namespace Archive
             return contentFileBlocks;
         }
 
-        const Compression::CompressionOptions& compressionOptions = fileSettings.m_compressionOptions != nullptr
+        const Compression::CompressionOptions& fileCompressionOptions = fileSettings.m_compressionOptions != nullptr
             ? *fileSettings.m_compressionOptions
             : Compression::CompressionOptions{};
 
+        // Files compressed with zstd whose extension has a trained dictionary are compressed with that dictionary
+        // The compression level from any supplied zstd options is kept
+        CompressionZStd::ZStdCompressionOptions dictionaryCompressionOptions;
+        AZ::u16 dictionaryIndex = FindDictionaryIndexForFile(fileSettings);
+        if (dictionaryIndex != ArchiveTocFileMetadata::NoDictionaryIndex)
+        {
+            if (auto zstdOptions = azrtti_cast<const CompressionZStd::ZStdCompressionOptions*>(&fileCompressionOptions);
+                zstdOptions != nullptr)
+            {
+                dictionaryCompressionOptions = *zstdOptions;
+            }
+            dictionaryCompressionOptions.m_dictionary = m_archiveToc.m_dictionaries[dictionaryIndex - 1];
+        }
+        const Compression::CompressionOptions& compressionOptions = dictionaryIndex != ArchiveTocFileMetadata::NoDictionaryIndex
+            ? dictionaryCompressionOptions
+            : fileCompressionOptions;
+
         // Due to check earlier validating that the inputDataSpan is not empty,
         // the compressedBlockCount will be at least 1 due to rounding up to the nearest block
         AZ::u32 compressedBlockCount = GetBlockCountIfCompressed(inputDataSpan.size());
@@ -1064,6 +1199,8 @@ namespace Archive
 
         // Set the compression algorithm index once compression has completed successfully for all blocks of the file
         contentFileBlocks.m_compressionAlgorithmIndex = static_cast<AZ::u8>(compressionAlgorithmIndex);
+        // The dictionary is only needed to decompress the file when it is stored compressed
+        contentFileBlocks.m_dictionaryIndex = dictionaryIndex;
         // The file has been successfully compressed, so store a span to the buffer
         contentFileBlocks.m_writeSpan = compressionDataBuffer;
         // Store the compressed size of each block without taking any alignment into account
@@ -1127,6 +1264,7 @@ namespace Archive
         fileMetadata.m_compressionAlgoIndex = contentFileData.m_contentFileBlocks.m_compressionAlgorithmIndex;
         fileMetadata.m_offset = ExtractWriteBlockOffset(alignedFileSize);
         fileMetadata.m_crc32 = AZ::Crc32(contentFileData.m_uncompressedSpan);
+        fileMetadata.m_dictionaryIndex = contentFileData.m_contentFileBlocks.m_dictionaryIndex;
 
         ArchiveTableOfContents::Path& filePath = m_archiveToc.m_filePaths[archiveFileIndex];
         filePath = contentFileData.m_relativeFilePath;
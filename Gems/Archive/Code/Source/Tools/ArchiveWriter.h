@@ -146,6 +146,17 @@ namespace Archive
         bool DumpArchiveMetadata(AZ::IO::GenericStream& metadataStream,
             const ArchiveMetadataSettings& metadataSettings = {}) const override;
 
+        //! Trains a zstd compression dictionary from sample file contents and stores it in the archive TOC
+        //! Files with the extension which are added afterwards using the ZStd compression algorithm
+        //! are compressed with the dictionary
+        //! @param fileExtension extension including the leading dot of the files the dictionary is used for
+        //! @param samples contents of files with the extension to train the dictionary from
+        //! @param dictionaryCapacity maximum size of the trained dictionary
+        //! @return the 1-based index of the dictionary in the archive TOC dictionary table on success
+        TrainDictionaryOutcome TrainCompressionDictionary(AZ::IO::PathView fileExtension,
+            AZStd::span<const AZStd::span<const AZStd::byte>> samples,
+            size_t dictionaryCapacity = CompressionZStd::DefaultDictionaryCapacity) override;
+
     private:
 
         bool ReadArchiveHeaderAndToc();
@@ -175,6 +186,8 @@ namespace Archive
             //! Stores the total compressed size of all blocks of the file
             //! if they were stored without alignment
             AZ::u64 m_totalUnalignedSize{};
+            //! 1-based index of the dictionary in the TOC the file was compressed with
+            AZ::u16 m_dictionaryIndex{ ArchiveTocFileMetadata::NoDictionaryIndex };
 
         };
         using CompressContentOutcome = AZStd::expected<ContentFileBlocks, ResultString>;
@@ -190,6 +203,10 @@ namespace Archive
         CompressContentOutcome CompressContentFileAsync(AZStd::vector<AZStd::byte>& compressionBuffer,
             const ArchiveWriterFileSettings& fileSettings, AZStd::span<const AZStd::byte> inputDataSpan);
 
+        //! Returns the index of the dictionary trained for the extension of the file
+        //! or NoDictionaryIndex if the file isn't compressed using zstd or no dictionary was trained for its extension
+        AZ::u16 FindDictionaryIndexForFile(const ArchiveWriterFileSettings& fileSettings) const;
+
         //! In-memory structure which stores metadata about the file contents after being
         //! sent through any compression algorithm and path normalization
         struct ContentFileData
@@ -265,10 +282,11 @@ namespace Archive
         };
         //! Writes the Table of Contents into a raw buffer
         //! @param tocOutputBuffer output buffer to write uncompressed raw TOC data
-        //! @param tocUncompressedInputSpan input buffer of the raw table of contents data to write
+        //! @param pathHashTable raw TOC Path Hash table section to write after the other TOC sections
         //! @return a result structure containing a span in the output buffer containing
         //! the raw TOC data and its actual size
-        WriteTocRawResult WriteTocRaw(AZStd::vector<AZStd::byte>& tocOutputBuffer);
+        WriteTocRawResult WriteTocRaw(AZStd::vector<AZStd::byte>& tocOutputBuffer,
+            AZStd::span<const AZStd::byte> pathHashTable);
 
         //! Encapsulates the result of compression a raw buffer of table of contents data
         //! data
@@ -330,6 +348,13 @@ namespace Archive
         using RemovedFileIndexSet = AZStd::set<AZ::u64>;
         RemovedFileIndexSet m_removedFileIndices;
 
+        //! Maps a lowercase file extension to the 1-based index of the dictionary trained for it
+        //! in the Archive TOC dictionary table
+        //! The mapping only lasts for this ArchiveWriter instance, the dictionary index of each file
+        //! is what is stored in the archive
+        using ExtensionToDictionaryIndexMap = AZStd::unordered_map<AZ::IO::Path, AZ::u16>;
+        ExtensionToDictionaryIndexMap m_extensionToDictionaryIndexMap;
+
         //! Stores a table that maps the unused size represented by the
         //! deleted raw block data to a sorted set of offsets into the mounted archive stream
         //! where the deleted block data starts
@@ -9,12 +9,17 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/std/ranges/ranges_algorithm.h>
+#include <AzCore/Task/TaskGraph.h>
+
+#include <AzTest/Utils.h>
 
 #include <Archive/Clients/ArchiveReaderAPI.h>
 #include <Archive/Tools/ArchiveWriterAPI.h>
 
 #include <Compression/CompressionLZ4API.h>
+#include <Compression/CompressionZStdAPI.h>
 
 // Archive Gem private implementation includes
 #include <Clients/ArchiveReaderFactory.h>
@@ -970,4 +975,349 @@ namespace Archive::Test
             EXPECT_TRUE(AZStd::ranges::equal(requestedFileData, expectedResultData));
         }
     }
+
+    TEST_F(ArchiveReaderFixture, ExtractFileFromArchive_FilesCompressedWithTrainedDictionary_Succeeds)
+    {
+        // Small files of the same type which share most of their content
+        auto CreateMaterialDocument = [](size_t documentIndex)
+        {
+            return AZStd::string::format(R"({
+    "materialType": "Materials/Types/StandardPBR.materialtype",
+    "materialTypeVersion": %zu,
+    "propertyValues": {
+        "baseColor.textureMap": "Textures/Asset_%zu_basecolor.png",
+        "normal.textureMap": "Textures/Asset_%zu_normal.png",
+        "roughness.factor": 0.%zu
+    }
+})", documentIndex % 5, documentIndex, documentIndex, documentIndex * 13);
+        };
+
+        constexpr size_t SampleCount = 1000;
+        AZStd::vector<AZStd::string> sampleDocuments;
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        sampleDocuments.reserve(SampleCount);
+        for (size_t documentIndex = 0; documentIndex < SampleCount; ++documentIndex)
+        {
+            samples.push_back(AZStd::as_bytes(AZStd::span(sampleDocuments.emplace_back(CreateMaterialDocument(documentIndex)))));
+        }
+
+        constexpr size_t ArchivedFileCount = 8;
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            auto trainOutcome = archiveWriter->TrainCompressionDictionary(".material", samples, 4_kib);
+            ASSERT_TRUE(trainOutcome) << trainOutcome.error().c_str();
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_compressionAlgorithm = CompressionZStd::GetZStdCompressionAlgorithmId();
+            for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+            {
+                AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("materials/asset_%zu.material", fileIndex));
+                fileSettings.m_relativeFilePath = filePath;
+                EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(sampleDocuments[fileIndex])), fileSettings));
+            }
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        EXPECT_TRUE(archiveReader->IsMounted());
+
+        for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+        {
+            AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("materials/asset_%zu.material", fileIndex));
+            const ArchiveListFileResult archiveListFileResult = archiveReader->ListFileInArchive(filePath);
+            ASSERT_TRUE(archiveListFileResult);
+            EXPECT_EQ(CompressionZStd::GetZStdCompressionAlgorithmId(), archiveListFileResult.m_compressionAlgorithm);
+
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(archiveListFileResult.m_uncompressedSize);
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = archiveListFileResult.m_filePathToken;
+
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, AZStd::as_bytes(AZStd::span(sampleDocuments[fileIndex]))));
+        }
+    }
+
+    TEST_F(ArchiveReaderFixture, MountArchive_FromPath_LooksUpFilesWithMemoryMappedPathHashTable_Succeeds)
+    {
+        constexpr size_t ArchivedFileCount = 1000;
+        auto GetFileContent = [](size_t fileIndex)
+        {
+            return AZStd::string::format("Content of file %zu", fileIndex);
+        };
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+            {
+                fileSettings.m_relativeFilePath = AZ::IO::Path(AZStd::string::format("levels/level%zu/file%zu.txt", fileIndex % 7, fileIndex));
+                const AZStd::string fileContent = GetFileContent(fileIndex);
+                EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fileContent)), fileSettings));
+            }
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        // Write the archive to disk so that it is mounted by path, which allows the table of contents to be memory mapped
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        auto archivePath = AZ::Test::CreateTestFile(tempDirectory, "pathhash.o3ar", archiveBuffer);
+        ASSERT_TRUE(archivePath);
+
+        auto createArchiveReaderResult = CreateArchiveReader(*archivePath);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+        {
+            const AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("levels/level%zu/file%zu.txt", fileIndex % 7, fileIndex));
+            EXPECT_TRUE(archiveReader->ContainsFile(filePath));
+
+            const ArchiveListFileResult archiveListFileResult = archiveReader->ListFileInArchive(filePath);
+            ASSERT_TRUE(archiveListFileResult);
+            EXPECT_EQ(filePath, archiveListFileResult.m_relativeFilePath);
+
+            AZStd::vector<AZStd::byte> fileBuffer;
+            fileBuffer.resize_no_construct(archiveListFileResult.m_uncompressedSize);
+            ArchiveReaderFileSettings fileSettings;
+            fileSettings.m_filePathIdentifier = archiveListFileResult.m_filePathToken;
+            const ArchiveExtractFileResult archiveExtractFileResult = archiveReader->ExtractFileFromArchive(
+                fileBuffer, fileSettings);
+            ASSERT_TRUE(archiveExtractFileResult);
+            const AZStd::string fileContent = GetFileContent(fileIndex);
+            EXPECT_TRUE(AZStd::ranges::equal(archiveExtractFileResult.m_fileSpan, AZStd::as_bytes(AZStd::span(fileContent))));
+        }
+
+        // Paths with Windows path separators are found as well
+        EXPECT_TRUE(archiveReader->ContainsFile(AZ::IO::PathView("levels\\level1\\file1.txt", AZ::IO::WindowsPathSeparator)));
+        // Paths that are not in the archive are not found
+        EXPECT_FALSE(archiveReader->ContainsFile("levels/level0/file1.txt"));
+        EXPECT_FALSE(archiveReader->ContainsFile("levels/level0"));
+        EXPECT_FALSE(archiveReader->ContainsFile(""));
+
+        // Unmounting the archive releases the memory mapping
+        archiveReader->UnmountArchive();
+        EXPECT_FALSE(archiveReader->ContainsFile("levels/level1/file1.txt"));
+    }
+
+    TEST_F(ArchiveReaderFixture, MountArchive_WithRegisterWithStreamer_DescribesCompressedBlocksOfFiles)
+    {
+        // Generate a file which is compressed in 3 blocks, where each block has different content
+        constexpr size_t FileSize = ArchiveBlockSizeForCompression * 2 + 7;
+        AZStd::vector<AZStd::byte> compressedFileContent;
+        compressedFileContent.resize_no_construct(FileSize);
+        for (size_t byteIndex = 0; byteIndex < FileSize; ++byteIndex)
+        {
+            compressedFileContent[byteIndex] = static_cast<AZStd::byte>((byteIndex / ArchiveBlockSizeForCompression) + 'A');
+        }
+        constexpr AZStd::string_view uncompressedFileContent = "Hello World";
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            fileSettings.m_compressionAlgorithm = CompressionLZ4::GetLZ4CompressionAlgorithmId();
+            fileSettings.m_relativeFilePath = "textures/multiblock.bin";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(compressedFileContent, fileSettings));
+
+            fileSettings.m_compressionAlgorithm = Compression::Uncompressed;
+            fileSettings.m_relativeFilePath = "textures/uncompressed.txt";
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(uncompressedFileContent)), fileSettings));
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        auto archivePath = AZ::Test::CreateTestFile(tempDirectory, "streamer.o3ar", archiveBuffer);
+        ASSERT_TRUE(archivePath);
+
+        {
+            // Archives are only described to the Streamer when requested
+            auto createArchiveReaderResult = CreateArchiveReader(*archivePath);
+            ASSERT_TRUE(createArchiveReaderResult);
+            AZ::IO::CompressionInfo info;
+            EXPECT_FALSE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "textures/multiblock.bin"));
+        }
+
+        ArchiveReaderSettings readerSettings;
+        readerSettings.m_registerWithStreamer = true;
+        auto createArchiveReaderResult = CreateArchiveReader(*archivePath, readerSettings);
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        {
+            // The Streamer passes the path without its alias, so it can start with a path separator
+            AZ::IO::CompressionInfo info;
+            ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "/textures/multiblock.bin"));
+            EXPECT_EQ(*archivePath, AZ::IO::PathView(info.m_archiveFilename.GetRelativePath()));
+            EXPECT_TRUE(info.m_isCompressed);
+            EXPECT_EQ(FileSize, info.m_uncompressedSize);
+            ASSERT_TRUE(info.m_decompressor);
+            EXPECT_EQ(ArchiveBlockSizeForCompression, info.m_blockSize);
+            ASSERT_EQ(3, info.m_blocks.size());
+
+            // Every block can be decompressed on its own from its location in the archive
+            size_t compressedEnd = 0;
+            for (size_t blockIndex = 0; blockIndex < info.m_blocks.size(); ++blockIndex)
+            {
+                const AZ::IO::CompressedBlock& block = info.m_blocks[blockIndex];
+                const size_t blockStart = blockIndex * ArchiveBlockSizeForCompression;
+                const size_t blockSize = AZStd::min<size_t>(ArchiveBlockSizeForCompression, FileSize - blockStart);
+                AZStd::vector<AZStd::byte> decompressedBlock;
+                decompressedBlock.resize_no_construct(blockSize);
+                ASSERT_LE(info.m_offset + block.m_offset + block.m_compressedSize, archiveBuffer.size());
+                EXPECT_TRUE(info.m_decompressor(info, archiveBuffer.data() + info.m_offset + block.m_offset, block.m_compressedSize,
+                    decompressedBlock.data(), decompressedBlock.size()));
+                EXPECT_TRUE(AZStd::ranges::equal(decompressedBlock, AZStd::span(compressedFileContent).subspan(blockStart, blockSize)));
+                compressedEnd = block.m_offset + block.m_compressedSize;
+            }
+            EXPECT_EQ(info.m_compressedSize, compressedEnd);
+        }
+
+        {
+            // Uncompressed files are read directly from their offset in the archive
+            AZ::IO::CompressionInfo info;
+            ASSERT_TRUE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "textures/uncompressed.txt"));
+            EXPECT_FALSE(info.m_isCompressed);
+            EXPECT_TRUE(info.m_blocks.empty());
+            ASSERT_EQ(uncompressedFileContent.size(), info.m_uncompressedSize);
+            EXPECT_TRUE(AZStd::ranges::equal(AZStd::span(archiveBuffer).subspan(info.m_offset, info.m_uncompressedSize),
+                AZStd::as_bytes(AZStd::span(uncompressedFileContent))));
+        }
+
+        AZ::IO::CompressionInfo info;
+        EXPECT_FALSE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "textures/missing.bin"));
+
+        // Once the archive is unmounted its files are no longer described to the Streamer
+        archiveReader->UnmountArchive();
+        EXPECT_FALSE(AZ::IO::CompressionUtils::FindCompressionInfo(info, "textures/multiblock.bin"));
+    }
+
+    TEST_F(ArchiveReaderFixture, ExtractFilesFromArchiveAsync_ExtractsBatchOfFiles_Succeeds)
+    {
+        constexpr size_t ArchivedFileCount = 64;
+        auto GetFileContent = [](size_t fileIndex)
+        {
+            // Every eighth file spans multiple 2 MiB compression blocks
+            AZStd::string fileContent = AZStd::string::format("Content of file %zu", fileIndex);
+            if (fileIndex % 8 == 0)
+            {
+                fileContent.append(ArchiveBlockSizeForCompression * 2, static_cast<char>('a' + fileIndex % 26));
+                fileContent += AZStd::string::format("End of file %zu", fileIndex);
+            }
+            return fileContent;
+        };
+
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+        {
+            IArchiveWriter::ArchiveStreamPtr archiveWriterStreamPtr(&archiveStream, { false });
+            auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveWriterStreamPtr));
+            ASSERT_TRUE(createArchiveWriterResult);
+            AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+            ArchiveWriterFileSettings fileSettings;
+            for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+            {
+                // Alternate between compressed and uncompressed files
+                fileSettings.m_compressionAlgorithm = fileIndex % 2 == 0
+                    ? CompressionLZ4::GetLZ4CompressionAlgorithmId()
+                    : Compression::Uncompressed;
+                fileSettings.m_relativeFilePath = AZ::IO::Path(AZStd::string::format("batch/file%zu.txt", fileIndex));
+                const AZStd::string fileContent = GetFileContent(fileIndex);
+                EXPECT_TRUE(archiveWriter->AddFileToArchive(AZStd::as_bytes(AZStd::span(fileContent)), fileSettings));
+            }
+
+            IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+            ASSERT_TRUE(commitResult);
+        }
+
+        IArchiveReader::ArchiveStreamPtr archiveReaderStreamPtr(&archiveStream, { false });
+        auto createArchiveReaderResult = CreateArchiveReader(AZStd::move(archiveReaderStreamPtr));
+        ASSERT_TRUE(createArchiveReaderResult);
+        AZStd::unique_ptr<IArchiveReader> archiveReader = AZStd::move(createArchiveReaderResult.value());
+        ASSERT_TRUE(archiveReader->IsMounted());
+
+        // Request the files in reverse order to validate that the results are reported
+        // for the correct request after the batch is sorted by archive offset
+        AZStd::vector<AZStd::vector<AZStd::byte>> fileBuffers(ArchivedFileCount);
+        AZStd::vector<ArchiveExtractFileRequest> requests;
+        for (size_t fileIndex = ArchivedFileCount; fileIndex-- > 0;)
+        {
+            const ArchiveListFileResult archiveListFileResult = archiveReader->ListFileInArchive(
+                AZ::IO::Path(AZStd::string::format("batch/file%zu.txt", fileIndex)));
+            ASSERT_TRUE(archiveListFileResult);
+            fileBuffers[fileIndex].resize_no_construct(archiveListFileResult.m_uncompressedSize);
+
+            ArchiveExtractFileRequest& request = requests.emplace_back();
+            request.m_filePathToken = archiveListFileResult.m_filePathToken;
+            request.m_outputSpan = fileBuffers[fileIndex];
+        }
+
+        // Add a request whose buffer is too small to store the file
+        AZStd::array<AZStd::byte, 4> smallBuffer{};
+        ArchiveExtractFileRequest& smallBufferRequest = requests.emplace_back();
+        smallBufferRequest.m_filePathToken = requests.front().m_filePathToken;
+        smallBufferRequest.m_outputSpan = smallBuffer;
+
+        // Callbacks can run concurrently, but each one only writes the result slot of its own request
+        AZStd::vector<ArchiveExtractFileResult> extractResults(requests.size());
+        AZStd::atomic<size_t> callbackCount{};
+
+        ArchiveExtractBatchSettings batchSettings;
+        batchSettings.m_extractFileCallback = [&extractResults, &callbackCount](size_t requestIndex, ArchiveExtractFileResult extractResult)
+        {
+            extractResults[requestIndex] = AZStd::move(extractResult);
+            ++callbackCount;
+        };
+        // Use a small read size to have the batch coalesce the files into several reads
+        batchSettings.m_maxReadSize = 64_kib;
+
+        AZ::TaskGraphEvent batchCompleteEvent{ "Archive Extract Batch Test" };
+        ASSERT_TRUE(archiveReader->ExtractFilesFromArchiveAsync(requests, batchSettings, &batchCompleteEvent));
+        batchCompleteEvent.Wait();
+
+        EXPECT_EQ(requests.size(), callbackCount);
+        for (size_t requestIndex = 0; requestIndex < ArchivedFileCount; ++requestIndex)
+        {
+            const size_t fileIndex = ArchivedFileCount - 1 - requestIndex;
+            const ArchiveExtractFileResult& extractResult = extractResults[requestIndex];
+            ASSERT_TRUE(extractResult);
+            EXPECT_EQ(AZ::IO::Path(AZStd::string::format("batch/file%zu.txt", fileIndex)), extractResult.m_relativeFilePath);
+            const AZStd::string fileContent = GetFileContent(fileIndex);
+            EXPECT_TRUE(AZStd::ranges::equal(extractResult.m_fileSpan, AZStd::as_bytes(AZStd::span(fileContent))));
+            EXPECT_EQ(extractResult.m_crc32, AZ::Crc32(extractResult.m_fileSpan));
+        }
+
+        EXPECT_FALSE(extractResults.back());
+        EXPECT_TRUE(extractResults.back().m_fileSpan.empty());
+    }
 }
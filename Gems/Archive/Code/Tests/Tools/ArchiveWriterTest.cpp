@@ -14,8 +14,10 @@
 #include <Archive/Tools/ArchiveWriterAPI.h>
 
 #include <Compression/CompressionLZ4API.h>
+#include <Compression/CompressionZStdAPI.h>
 
 // Archive Gem private implementation includes
+#include <Clients/ArchiveTOCView.h>
 #include <Tools/ArchiveWriterFactory.h>
 
 namespace Archive::Test
@@ -940,4 +942,129 @@ namespace Archive::Test
             EXPECT_EQ(sizeof(ArchiveBlockLineUnion), archiveHeader->m_tocBlockOffsetTableUncompressedSize);
         }
     }
+
+    TEST_F(ArchiveWriterFixture, TrainCompressionDictionary_StoresDictionaryInTableOfContents_Succeeds)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        IArchiveWriter::ArchiveStreamPtr archiveStreamPtr(&archiveStream, { false });
+        auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveStreamPtr));
+        ASSERT_TRUE(createArchiveWriterResult);
+        AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+        AZStd::vector<AZStd::string> sampleDocuments;
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        constexpr size_t SampleCount = 1000;
+        sampleDocuments.reserve(SampleCount);
+        for (size_t documentIndex = 0; documentIndex < SampleCount; ++documentIndex)
+        {
+            sampleDocuments.push_back(AZStd::string::format(
+                R"({ "name": "Setting%zu", "value": %zu, "enabled": %s })",
+                documentIndex, documentIndex * 31, documentIndex % 2 == 0 ? "true" : "false"));
+            samples.push_back(StringToByteSpan(sampleDocuments.back()));
+        }
+
+        // A dictionary cannot be trained without a file extension or without samples
+        EXPECT_FALSE(archiveWriter->TrainCompressionDictionary("", samples));
+        EXPECT_FALSE(archiveWriter->TrainCompressionDictionary(".setreg", {}));
+
+        auto trainOutcome = archiveWriter->TrainCompressionDictionary(".setreg", samples, 4_kib);
+        ASSERT_TRUE(trainOutcome) << trainOutcome.error().c_str();
+        // Dictionary indices are 1-based, as 0 indicates a file compressed without a dictionary
+        EXPECT_EQ(1, trainOutcome.value());
+
+        ArchiveWriterFileSettings fileSettings;
+        fileSettings.m_relativeFilePath = "registry/setting.setreg";
+        fileSettings.m_compressionAlgorithm = CompressionZStd::GetZStdCompressionAlgorithmId();
+        auto addFileResult = archiveWriter->AddFileToArchive(samples.front(), fileSettings);
+        EXPECT_TRUE(addFileResult);
+        EXPECT_EQ(CompressionZStd::GetZStdCompressionAlgorithmId(), addFileResult.m_compressionAlgorithm);
+
+        IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+        ASSERT_TRUE(commitResult);
+
+        ASSERT_GE(archiveBuffer.size(), sizeof(ArchiveHeader));
+        auto archiveHeader = reinterpret_cast<const ArchiveHeader*>(archiveBuffer.data());
+        // The dictionary table stores the dictionary count, one dictionary index entry and the dictionary itself
+        EXPECT_GT(archiveHeader->m_tocDictionaryTableUncompressedSize, sizeof(AZ::u64) + sizeof(ArchiveTocDictionaryIndex));
+        EXPECT_EQ(0, archiveHeader->m_tocDictionaryTableUncompressedSize % sizeof(AZ::u64));
+        // The dictionary table is part of the table of contents, which is stored at the end of the archive
+        EXPECT_EQ(archiveBuffer.size(), archiveHeader->m_tocOffset + archiveHeader->GetTocStoredSize());
+    }
+
+    TEST_F(ArchiveWriterFixture, TrainCompressionDictionary_CapacityLargerThanMaxDictionarySize_Fails)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        IArchiveWriter::ArchiveStreamPtr archiveStreamPtr(&archiveStream, { false });
+        auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveStreamPtr));
+        ASSERT_TRUE(createArchiveWriterResult);
+        AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+        constexpr AZStd::string_view sampleDocument = R"({ "name": "Setting", "value": 31, "enabled": true })";
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples(16, StringToByteSpan(sampleDocument));
+
+        // The dictionary size must fit in the 24-bit size field of the TOC dictionary index
+        auto trainOutcome = archiveWriter->TrainCompressionDictionary(".setreg", samples, MaxDictionarySize + 1);
+        EXPECT_FALSE(trainOutcome);
+        trainOutcome = archiveWriter->TrainCompressionDictionary(".setreg", samples, 16_mib);
+        EXPECT_FALSE(trainOutcome);
+
+        // No dictionary is stored in the archive for the rejected requests
+        IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+        ASSERT_TRUE(commitResult);
+        ASSERT_GE(archiveBuffer.size(), sizeof(ArchiveHeader));
+        auto archiveHeader = reinterpret_cast<const ArchiveHeader*>(archiveBuffer.data());
+        EXPECT_EQ(0, archiveHeader->m_tocDictionaryTableUncompressedSize);
+    }
+
+    TEST_F(ArchiveWriterFixture, Commit_WritesPathHashTable_ThatLocatesEachFile_Succeeds)
+    {
+        AZStd::vector<AZStd::byte> archiveBuffer;
+        AZ::IO::ByteContainerStream archiveStream(&archiveBuffer);
+
+        IArchiveWriter::ArchiveStreamPtr archiveStreamPtr(&archiveStream, { false });
+        auto createArchiveWriterResult = CreateArchiveWriter(AZStd::move(archiveStreamPtr));
+        ASSERT_TRUE(createArchiveWriterResult);
+        AZStd::unique_ptr<IArchiveWriter> archiveWriter = AZStd::move(createArchiveWriterResult.value());
+
+        constexpr size_t ArchivedFileCount = 1000;
+        constexpr AZStd::string_view fileContent = "Hello World";
+        ArchiveWriterFileSettings fileSettings;
+        for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+        {
+            fileSettings.m_relativeFilePath = AZ::IO::Path(AZStd::string::format("folder%zu/file%zu.txt", fileIndex % 10, fileIndex));
+            EXPECT_TRUE(archiveWriter->AddFileToArchive(StringToByteSpan(fileContent), fileSettings));
+        }
+
+        IArchiveWriter::CommitResult commitResult = archiveWriter->Commit();
+        ASSERT_TRUE(commitResult);
+
+        ASSERT_GE(archiveBuffer.size(), sizeof(ArchiveHeader));
+        const ArchiveHeader archiveHeader = *reinterpret_cast<const ArchiveHeader*>(archiveBuffer.data());
+        // The path hash table stores a 4-byte slot per file in addition to its header and buckets
+        EXPECT_GT(archiveHeader.m_tocPathHashTableUncompressedSize,
+            sizeof(ArchiveTocPathHashTableHeader) + ArchivedFileCount * sizeof(AZ::u32));
+        EXPECT_EQ(0, archiveHeader.m_tocPathHashTableUncompressedSize % sizeof(AZ::u64));
+        EXPECT_EQ(archiveBuffer.size(), archiveHeader.m_tocOffset + archiveHeader.GetTocStoredSize());
+
+        auto tocView = ArchiveTableOfContentsView::CreateFromArchiveHeaderAndBuffer(archiveHeader,
+            AZStd::span(archiveBuffer).subspan(archiveHeader.m_tocOffset, archiveHeader.GetTocStoredSize()));
+        ASSERT_TRUE(tocView) << tocView.error().m_errorMessage.c_str();
+        EXPECT_EQ(ArchivedFileCount, tocView->m_pathHashSlotTable.size());
+
+        for (size_t fileIndex = 0; fileIndex < ArchivedFileCount; ++fileIndex)
+        {
+            const AZ::IO::Path filePath = AZ::IO::Path(AZStd::string::format("folder%zu/file%zu.txt", fileIndex % 10, fileIndex));
+            const ArchiveFileToken fileToken = FindFileInPathHashTable(tocView.value(), filePath);
+            ASSERT_NE(InvalidArchiveFileToken, fileToken);
+            EXPECT_EQ(archiveWriter->FindFile(filePath), fileToken);
+        }
+
+        // Paths which are not in the archive are not found even though the perfect hash maps them to a slot
+        EXPECT_EQ(InvalidArchiveFileToken, FindFileInPathHashTable(tocView.value(), "folder0/file1.txt"));
+        EXPECT_EQ(InvalidArchiveFileToken, FindFileInPathHashTable(tocView.value(), "folder0"));
+    }
 }
@@ -34,4 +34,7 @@ namespace Compression
     inline constexpr const char* CompressionOptionsTypeId = "{037B2A25-E195-4C5D-B402-6108CE978280}";
 
     inline constexpr const char* DecompressionOptionsTypeId = "{EA85CCE4-B630-47B8-892F-3A5B1C9ECD99}";
+
+    inline constexpr const char* ZStdCompressionOptionsTypeId = "{5C3E9A71-2D4B-4F86-A1E7-93B0C6D85F24}";
+    inline constexpr const char* ZStdDecompressionOptionsTypeId = "{B87D1F46-0E93-4A2C-8D5B-7F61E2A9C03D}";
 } // namespace Compression
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/string/string_view.h>
+
+#include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/CompressionTypeIds.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+namespace CompressionZStd
+{
+    //! Returns the CompressionAlgorithmId associated with the ZStd Compressor
+    //! @return ZStd Compression AlgorithmId
+    constexpr Compression::CompressionAlgorithmId GetZStdCompressionAlgorithmId();
+
+    //! Human readable name associated with the compression algorithm
+    constexpr AZStd::string_view GetZStdCompressionAlgorithmName()
+    {
+        return "ZStd";
+    }
+
+    constexpr Compression::CompressionAlgorithmId GetZStdCompressionAlgorithmId()
+    {
+        constexpr Compression::CompressionAlgorithmId AlgorithmId{ AZ::u32(AZStd::hash<AZStd::string_view>{}(GetZStdCompressionAlgorithmName())) };
+        return AlgorithmId;
+    }
+
+    //! Default capacity of a trained dictionary
+    //! zstd recommends dictionaries of around 100 KiB, which is enough to capture the structure
+    //! shared by files of the same type
+    constexpr size_t DefaultDictionaryCapacity = 112 * 1024;
+
+    //! Options for the ZStd compressor
+    //! Small files compress poorly on their own as there is little repetition within a single file.
+    //! Files of the same type do share most of their structure, which a dictionary trained from those files can supply
+    //! to the compressor up front.
+    struct ZStdCompressionOptions
+        : Compression::CompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(ZStdCompressionOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! zstd compression level. Higher levels compress better at the cost of compression speed,
+        //! decompression speed is roughly the same for all levels
+        int m_compressionLevel{ 3 };
+        //! Dictionary to compress with. Data compressed with a dictionary can only be decompressed with the same dictionary.
+        //! The compressor digests a dictionary once and reuses it for every block compressed with the same dictionary.
+        AZStd::span<const AZStd::byte> m_dictionary;
+    };
+
+    //! Options for the ZStd decompressor
+    struct ZStdDecompressionOptions
+        : Compression::DecompressionOptions
+    {
+        AZ_TYPE_INFO_WITH_NAME_DECL(ZStdDecompressionOptions);
+        AZ_RTTI_NO_TYPE_INFO_DECL();
+
+        //! Dictionary the data was compressed with.
+        //! The decompressor digests a dictionary once and reuses it for every block decompressed with the same dictionary.
+        AZStd::span<const AZStd::byte> m_dictionary;
+    };
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(ZStdCompressionOptions, "ZStdCompressionOptions",
+        Compression::ZStdCompressionOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(ZStdCompressionOptions, Compression::CompressionOptions);
+
+    AZ_TYPE_INFO_WITH_NAME_IMPL_INLINE(ZStdDecompressionOptions, "ZStdDecompressionOptions",
+        Compression::ZStdDecompressionOptionsTypeId);
+    AZ_RTTI_NO_TYPE_INFO_IMPL_INLINE(ZStdDecompressionOptions, Compression::DecompressionOptions);
+} // namespace CompressionZStd
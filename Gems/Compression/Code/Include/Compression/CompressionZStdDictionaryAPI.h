@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/span.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utility/expected.h>
+
+#include <Compression/CompressionInterfaceAPI.h>
+#include <Compression/CompressionZStdAPI.h>
+
+// Declarations of the zdict.h functions used by TrainDictionary, so the zstd headers don't have to be
+// on the include path of every target that uses this API
+extern "C"
+{
+    size_t ZDICT_trainFromBuffer(void* dictBuffer, size_t dictBufferCapacity,
+        const void* samplesBuffer, const size_t* samplesSizes, unsigned nbSamples);
+    unsigned ZDICT_isError(size_t errorCode);
+    const char* ZDICT_getErrorName(size_t errorCode);
+}
+
+namespace CompressionZStd
+{
+    //! Trains a zstd dictionary from sample file contents
+    //! The samples should be files of a single type, for example only material files, as the dictionary
+    //! captures the content those files have in common.
+    //! As a rule of thumb the samples should add up to about 100 times the dictionary capacity.
+    //! @param samples contents of the files to train the dictionary from. Empty samples are skipped
+    //! @param dictionaryCapacity maximum size of the trained dictionary
+    //! @return On success the trained dictionary, which is not larger than the dictionary capacity.
+    //!         Training fails when there are too few samples or they are too small, in which case the files
+    //!         should be compressed without a dictionary.
+    using TrainDictionaryOutcome = AZStd::expected<AZStd::vector<AZStd::byte>, Compression::CompressionResultString>;
+    inline TrainDictionaryOutcome TrainDictionary(AZStd::span<const AZStd::span<const AZStd::byte>> samples,
+        size_t dictionaryCapacity = DefaultDictionaryCapacity)
+    {
+        // ZDICT expects all samples concatenated in a single buffer along with the size of each sample
+        size_t totalSampleSize{};
+        for (AZStd::span<const AZStd::byte> sample : samples)
+        {
+            totalSampleSize += sample.size();
+        }
+
+        AZStd::vector<AZStd::byte> sampleBuffer;
+        sampleBuffer.reserve(totalSampleSize);
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (AZStd::span<const AZStd::byte> sample : samples)
+        {
+            if (!sample.empty())
+            {
+                sampleBuffer.insert(sampleBuffer.end(), sample.begin(), sample.end());
+                sampleSizes.push_back(sample.size());
+            }
+        }
+
+        if (sampleSizes.empty())
+        {
+            return AZStd::unexpected(Compression::CompressionResultString("No samples were supplied to train the dictionary from"));
+        }
+
+        AZStd::vector<AZStd::byte> dictionary;
+        dictionary.resize_no_construct(dictionaryCapacity);
+        const size_t dictionarySize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+            sampleBuffer.data(), sampleSizes.data(), static_cast<unsigned int>(sampleSizes.size()));
+        if (ZDICT_isError(dictionarySize))
+        {
+            return AZStd::unexpected(Compression::CompressionResultString::format(
+                "Training a dictionary from %zu samples with a total size of %zu has failed: %s",
+                sampleSizes.size(), sampleBuffer.size(), ZDICT_getErrorName(dictionarySize)));
+        }
+
+        dictionary.resize(dictionarySize);
+        return dictionary;
+    }
+} // namespace CompressionZStd
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "DecompressorZStdImpl.h"
+
+#include <Compression/CompressionZStdAPI.h>
+#include <CompressionZStdUtils.h>
+
+namespace CompressionZStd
+{
+    // Definitions for ZStd Decompressor
+    DecompressorZStd::DecompressorZStd() = default;
+    DecompressorZStd::~DecompressorZStd() = default;
+
+    void DecompressorZStd::DigestedDictionaryDeleter::operator()(ZSTD_DDict* dictionary) const
+    {
+        ZSTD_freeDDict(dictionary);
+    }
+
+    Compression::CompressionAlgorithmId DecompressorZStd::GetCompressionAlgorithmId() const
+    {
+        return GetZStdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view DecompressorZStd::GetCompressionAlgorithmName() const
+    {
+        return GetZStdCompressionAlgorithmName();
+    }
+
+    const ZSTD_DDict* DecompressorZStd::FindOrCreateDigestedDictionary(AZStd::span<const AZStd::byte> dictionary) const
+    {
+        const AZ::u32 dictionaryId = Internal::GetDictionaryId(dictionary);
+        {
+            AZStd::shared_lock lock(m_digestedDictionariesMutex);
+            if (auto it = m_digestedDictionaries.find(dictionaryId); it != m_digestedDictionaries.end())
+            {
+                return it->second.get();
+            }
+        }
+
+        AZStd::unique_lock lock(m_digestedDictionariesMutex);
+        // Another thread could have digested the dictionary while the lock was released
+        DigestedDictionaryPtr& digestedDictionary = m_digestedDictionaries[dictionaryId];
+        if (digestedDictionary == nullptr)
+        {
+            digestedDictionary.reset(ZSTD_createDDict(dictionary.data(), dictionary.size()));
+        }
+        return digestedDictionary.get();
+    }
+
+    Compression::DecompressionResultData DecompressorZStd::DecompressBlock(
+        AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+        const Compression::DecompressionOptions& decompressionOptions) const
+    {
+        Compression::DecompressionResultData resultData;
+
+        ZSTD_DCtx* decompressionContext = Internal::GetThreadDecompressionContext();
+        if (decompressionContext == nullptr)
+        {
+            resultData.m_decompressionOutcome.m_resultString = "Unable to create a zstd decompression context";
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        AZStd::span<const AZStd::byte> dictionary;
+        if (auto zstdOptions = azrtti_cast<const ZStdDecompressionOptions*>(&decompressionOptions); zstdOptions != nullptr)
+        {
+            dictionary = zstdOptions->m_dictionary;
+        }
+
+        size_t decompressedSize{};
+        if (!dictionary.empty())
+        {
+            const ZSTD_DDict* digestedDictionary = FindOrCreateDigestedDictionary(dictionary);
+            if (digestedDictionary == nullptr)
+            {
+                resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString::format(
+                    "Unable to digest the decompression dictionary of size %zu", dictionary.size());
+                resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+                return resultData;
+            }
+
+            decompressedSize = ZSTD_decompress_usingDDict(decompressionContext,
+                decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size(),
+                digestedDictionary);
+        }
+        else
+        {
+            decompressedSize = ZSTD_decompressDCtx(decompressionContext,
+                decompressionBuffer.data(), decompressionBuffer.size(),
+                compressedData.data(), compressedData.size());
+        }
+
+        if (ZSTD_isError(decompressedSize))
+        {
+            // zstd fails for malformed data, an output buffer that is too small and when the
+            // dictionary doesn't match the one the data was compressed with
+            resultData.m_decompressionOutcome.m_resultString = Compression::DecompressionResultString::format(
+                "zstd decompression has failed: %s. Dest buffer capacity: %zu, source stream size: %zu",
+                ZSTD_getErrorName(decompressedSize), decompressionBuffer.size(), compressedData.size());
+            resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the decompressed data and
+        // the correct decompressed size
+        resultData.m_uncompressedBuffer = decompressionBuffer.subspan(0, decompressedSize);
+        resultData.m_decompressionOutcome.m_result = Compression::DecompressionResult::Complete;
+        return resultData;
+    }
+} // namespace CompressionZStd
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Compression/DecompressionInterfaceAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZStd
+{
+    class DecompressorZStd
+        : public Compression::IDecompressionInterface
+    {
+    public:
+        DecompressorZStd();
+        ~DecompressorZStd() override;
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the ZStd decompressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Decompresses the compressed data into the decompression buffer
+        //! Data compressed with a dictionary requires ZStdDecompressionOptions which supply the same dictionary
+        //! @return a DecompressionResultData instance to indicate if decompression operation has succeeded
+        [[nodiscard]] Compression::DecompressionResultData DecompressBlock(
+            AZStd::span<AZStd::byte> decompressionBuffer, const AZStd::span<const AZStd::byte>& compressedData,
+            const Compression::DecompressionOptions& decompressionOptions = {}) const override;
+
+    private:
+        //! Returns the digested version of the dictionary, digesting it on first use
+        const ZSTD_DDict* FindOrCreateDigestedDictionary(AZStd::span<const AZStd::byte> dictionary) const;
+
+        struct DigestedDictionaryDeleter
+        {
+            void operator()(ZSTD_DDict* dictionary) const;
+        };
+        using DigestedDictionaryPtr = AZStd::unique_ptr<ZSTD_DDict, DigestedDictionaryDeleter>;
+
+        //! Small files are decompressed far more often than the handful of dictionaries change,
+        //! so each dictionary is digested once and kept for the lifetime of the decompressor
+        mutable AZStd::unordered_map<AZ::u32, DigestedDictionaryPtr> m_digestedDictionaries;
+        mutable AZStd::shared_mutex m_digestedDictionariesMutex;
+    };
+} // namespace CompressionZStd
@@ -77,6 +77,21 @@ namespace Compression
         m_decompressionDurationMicroSec.PushEntry(1);
     }
 
+    DecompressorRegistrarEntry::~DecompressorRegistrarEntry()
+    {
+        // Requests are completed by the decompression tasks before the task graph has finished, so wait for the remaining tasks
+        // as they still signal the task graph event.
+        if (m_taskGraphEvent != nullptr && !m_taskGraphEvent->IsSignaled())
+        {
+            m_taskGraphEvent->Wait();
+        }
+
+        for (AZ::u32 i = 0; i < m_maxNumTasks; ++i)
+        {
+            ReleasePartialBlockBuffers(m_processingJobs[i]);
+        }
+    }
+
     void DecompressorRegistrarEntry::PrepareRequest(AZ::IO::FileRequest* request)
     {
         AZ_Assert(request, "PrepareRequest was provided a null request.");
@@ -207,7 +222,7 @@ namespace Compression
                 auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
                 AZ_Assert(data, "Compressed request in the decompression queue in DecompressorRegistrarEntry didn't contain compression read data.");
 
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = GetArchiveReadInformation(*data).m_size;
                 auto decompressionDuration = AZStd::chrono::microseconds(
                     static_cast<AZ::u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                 auto timeInProcessing = now - m_processingJobs[i].m_jobStartTime;
@@ -258,7 +273,7 @@ namespace Compression
             AZ::IO::FileRequest* compressedRequest = m_readRequests[i]->GetParent();
             auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
 
-            size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+            size_t bytesToDecompress = GetArchiveReadInformation(*data).m_size;
             auto decompressionDuration = AZStd::chrono::microseconds(
                 static_cast<AZ::u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
             smallestDecompressionDuration = AZStd::min(smallestDecompressionDuration, decompressionDuration);
@@ -295,7 +310,7 @@ namespace Compression
         if (data)
         {
             AZStd::chrono::microseconds processingTime = decompressionDelay;
-            size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+            size_t bytesToDecompress = GetArchiveReadInformation(*data).m_size;
             processingTime += AZStd::chrono::microseconds(
                 static_cast<AZ::u64>((bytesToDecompress * totalDecompressionDurationUs) / totalBytesDecompressed));
 
@@ -372,6 +387,51 @@ namespace Compression
             && m_numRunningTasks == 0;
     }
 
+    bool DecompressorRegistrarEntry::IsCompressedInBlocks(const AZ::IO::CompressionInfo& info)
+    {
+        return info.m_blockSize != 0 && !info.m_blocks.empty();
+    }
+
+    AZStd::pair<size_t, size_t> DecompressorRegistrarEntry::GetBlockRange(const AZ::IO::Requests::CompressedReadData& data)
+    {
+        const AZ::IO::CompressionInfo& info = data.m_compressionInfo;
+        const size_t blockCount = info.m_blocks.size();
+        // Always include at least one block so empty reads still go through the regular read and decompression path.
+        const size_t firstBlock = AZStd::min(aznumeric_cast<size_t>(data.m_readOffset / info.m_blockSize), blockCount - 1);
+        const size_t endBlock = aznumeric_cast<size_t>((data.m_readOffset + data.m_readSize + info.m_blockSize - 1) / info.m_blockSize);
+        return { firstBlock, AZStd::clamp(endBlock, firstBlock + 1, blockCount) };
+    }
+
+    auto DecompressorRegistrarEntry::GetArchiveReadInformation(const AZ::IO::Requests::CompressedReadData& data) const
+        -> ArchiveReadInformation
+    {
+        const AZ::IO::CompressionInfo& info = data.m_compressionInfo;
+
+        ArchiveReadInformation result;
+        if (IsCompressedInBlocks(info))
+        {
+            // Only read the blocks that overlap with the requested range. The blocks of a file are stored back to back, so this is
+            // still a single read.
+            auto [firstBlock, endBlock] = GetBlockRange(data);
+            const AZ::IO::CompressedBlock& first = info.m_blocks[firstBlock];
+            const AZ::IO::CompressedBlock& last = info.m_blocks[endBlock - 1];
+            result.m_offset = info.m_offset + first.m_offset;
+            result.m_size = (last.m_offset + last.m_compressedSize) - first.m_offset;
+        }
+        else
+        {
+            result.m_offset = info.m_offset;
+            result.m_size = info.m_compressedSize;
+        }
+
+        // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
+        // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
+        // the BlockCache's prolog and epilog are read into aligned buffers.
+        result.m_alignmentOffset = result.m_offset - AZ_SIZE_ALIGN_DOWN(result.m_offset, aznumeric_cast<size_t>(m_alignment));
+        result.m_bufferSize = AZ_SIZE_ALIGN_UP((result.m_size + result.m_alignmentOffset), aznumeric_cast<size_t>(m_alignment));
+        return result;
+    }
+
     void DecompressorRegistrarEntry::PrepareReadRequest(AZ::IO::FileRequest* request, AZ::IO::Requests::ReadRequestData& data)
     {
         if (AZ::IO::CompressionInfo info; AZ::IO::CompressionUtils::FindCompressionInfo(info, data.m_path.GetRelativePath()))
@@ -381,6 +441,9 @@ namespace Compression
             {
                 AZ_Assert(info.m_decompressor,
                     "DecompressorRegistrarEntry::PrepareRequest found a compressed file, but no decompressor to decompress with.");
+                AZ_Assert(info.m_blockSize == 0 || info.m_blocks.size() == (info.m_uncompressedSize + info.m_blockSize - 1) / info.m_blockSize,
+                    "DecompressorRegistrarEntry::PrepareRequest found a file compressed in blocks of %zu bytes, but %zu blocks don't match "
+                    "the uncompressed size of %zu bytes.", info.m_blockSize, info.m_blocks.size(), info.m_uncompressedSize);
                 nextRequest->CreateCompressedRead(request, AZStd::move(info), data.m_output, data.m_offset, data.m_size);
             }
             else
@@ -523,18 +586,14 @@ namespace Compression
                 AZ::IO::CompressionInfo& info = data->m_compressionInfo;
                 AZ_Assert(info.m_decompressor, "DecompressorRegistrarEntry is planning to a queue a request for reading but couldn't find a decompressor.");
 
-                // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
-                // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
-                // the BlockCache's prolog and epilog are read into aligned buffers.
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                ArchiveReadInformation archiveRead = GetArchiveReadInformation(*data);
                 m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
-                    bufferSize, m_alignment));
-                m_memoryUsage += bufferSize;
+                    archiveRead.m_bufferSize, m_alignment));
+                m_memoryUsage += archiveRead.m_bufferSize;
 
                 AZ::IO::FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
-                archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
-                    info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+                archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + archiveRead.m_alignmentOffset,
+                    archiveRead.m_bufferSize, info.m_archiveFilename, archiveRead.m_offset, archiveRead.m_size, info.m_isSharedPak);
 
                 auto ArchiveReadCommandComplete = [this, readSlot = i](AZ::IO::FileRequest& request)
                 {
@@ -579,9 +638,7 @@ namespace Compression
         {
             auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
             AZ_Assert(data, "Compressed request in DecompressorRegistrarEntry that finished unsuccessfully didn't contain compression read data.");
-            AZ::IO::CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+            size_t bufferSize = GetArchiveReadInformation(*data).m_bufferSize;
             m_memoryUsage -= bufferSize;
 
             if (m_readBuffers[readSlot] != nullptr)
@@ -653,11 +710,14 @@ namespace Compression
                     AZ_Assert(data, "Compressed request in DecompressorRegistrarEntry that's starting decompression didn't contain compression read data.");
                     AZ_Assert(data->m_compressionInfo.m_decompressor, "DecompressorRegistrarEntry is queuing a decompression job but couldn't find a decompressor.");
 
-                    info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
-                        AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
+                    info.m_alignmentOffset = aznumeric_caster(GetArchiveReadInformation(*data).m_alignmentOffset);
 
                     AZ::TaskDescriptor taskDescriptor{ "Decompress file", "Compression" };
-                    if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
+                    if (IsCompressedInBlocks(data->m_compressionInfo))
+                    {
+                        AddBlockDecompressionTasks(taskGraph, finishToken, info, *data);
+                    }
+                    else if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
                     {
                         auto decompressTask = [this, &info]()
                         {
@@ -714,11 +774,11 @@ namespace Compression
         AZ_Assert(compressedRequest, "A wait request attached to DecompressorRegistrarEntry was completed but didn't have a parent compressed request.");
         auto data = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
         AZ_Assert(data, "Compressed request in DecompressorRegistrarEntry that completed decompression didn't contain compression read data.");
-        AZ::IO::CompressionInfo& info = data->m_compressionInfo;
-        size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-        size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        ArchiveReadInformation archiveRead = GetArchiveReadInformation(*data);
+        size_t bufferSize = archiveRead.m_bufferSize;
         m_memoryUsage -= bufferSize;
-        if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
+        if (!IsCompressedInBlocks(data->m_compressionInfo) &&
+            (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize))
         {
             m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
         }
@@ -727,7 +787,7 @@ namespace Compression
             jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
         m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
             endTime - jobInfo.m_jobStartTime).count());
-        m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+        m_bytesDecompressed.PushEntry(archiveRead.m_size);
 
         AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
         jobInfo.m_compressedData = nullptr;
@@ -783,6 +843,129 @@ namespace Compression
         context->WakeUpSchedulingThread();
     }
 
+    void DecompressorRegistrarEntry::AddBlockDecompressionTasks(AZ::TaskGraph& taskGraph, AZ::TaskToken& finishToken,
+        DecompressionInformation& info, const AZ::IO::Requests::CompressedReadData& data)
+    {
+        // Reads that don't cover the entire file may only need part of their first and last block.
+        if (data.m_readOffset != 0 || data.m_readSize != data.m_compressionInfo.m_uncompressedSize)
+        {
+            ReservePartialBlockBuffers(info, data.m_compressionInfo.m_blockSize);
+        }
+
+        auto startTask = [&info]()
+        {
+            info.m_jobStartTime = AZStd::chrono::steady_clock::now();
+            info.m_blockFailed = false;
+        };
+        AZ::TaskToken startToken = taskGraph.AddTask(
+            AZ::TaskDescriptor{ "Start block decompression", "Compression" }, AZStd::move(startTask));
+
+        auto completeTask = [this, &info]()
+        {
+            FinishBlockDecompression(m_context, info);
+        };
+        AZ::TaskToken completeToken = taskGraph.AddTask(
+            AZ::TaskDescriptor{ "Complete block decompression", "Compression" }, AZStd::move(completeTask));
+
+        // Every block gets its own task so the blocks of a single large file are spread over all task workers.
+        auto [firstBlock, endBlock] = GetBlockRange(data);
+        AZ::TaskDescriptor blockTaskDescriptor{ "Decompress block", "Compression" };
+        for (size_t blockIndex = firstBlock; blockIndex < endBlock; ++blockIndex)
+        {
+            auto blockTask = [&info, firstBlock = firstBlock, blockIndex]()
+            {
+                BlockDecompression(info, firstBlock, blockIndex);
+            };
+            AZ::TaskToken blockToken = taskGraph.AddTask(blockTaskDescriptor, AZStd::move(blockTask));
+            startToken.Precedes(blockToken);
+            blockToken.Precedes(completeToken);
+        }
+        completeToken.Precedes(finishToken);
+    }
+
+    void DecompressorRegistrarEntry::ReservePartialBlockBuffers(DecompressionInformation& info, size_t blockSize)
+    {
+        if (info.m_partialBlockBufferSize < blockSize)
+        {
+            ReleasePartialBlockBuffers(info);
+            for (Buffer& buffer : info.m_partialBlockBuffers)
+            {
+                buffer = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(blockSize, m_alignment));
+            }
+            info.m_partialBlockBufferSize = blockSize;
+            m_memoryUsage += AZ_ARRAY_SIZE(info.m_partialBlockBuffers) * blockSize;
+        }
+    }
+
+    void DecompressorRegistrarEntry::ReleasePartialBlockBuffers(DecompressionInformation& info)
+    {
+        if (info.m_partialBlockBufferSize != 0)
+        {
+            for (Buffer& buffer : info.m_partialBlockBuffers)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, info.m_partialBlockBufferSize, m_alignment);
+                buffer = nullptr;
+            }
+            m_memoryUsage -= AZ_ARRAY_SIZE(info.m_partialBlockBuffers) * info.m_partialBlockBufferSize;
+            info.m_partialBlockBufferSize = 0;
+        }
+    }
+
+    void DecompressorRegistrarEntry::BlockDecompression(DecompressionInformation& info, size_t firstBlock, size_t blockIndex)
+    {
+        AZ::IO::FileRequest* compressedRequest = info.m_waitRequest->GetParent();
+        AZ_Assert(compressedRequest, "A wait request attached to DecompressorRegistrarEntry was completed but didn't have a parent compressed request.");
+        auto request = AZStd::get_if<AZ::IO::Requests::CompressedReadData>(&compressedRequest->GetCommand());
+        AZ_Assert(request, "Compressed request in DecompressorRegistrarEntry that's running block decompression didn't contain compression read data.");
+        const AZ::IO::CompressionInfo& compressionInfo = request->m_compressionInfo;
+        AZ_Assert(compressionInfo.m_decompressor, "Block decompressor job started, but there's no decompressor callback assigned.");
+
+        // The read buffer starts at the first block that overlaps with the request.
+        const AZ::IO::CompressedBlock& block = compressionInfo.m_blocks[blockIndex];
+        const AZ::u8* compressedBlock = info.m_compressedData + info.m_alignmentOffset +
+            (block.m_offset - compressionInfo.m_blocks[firstBlock].m_offset);
+
+        const AZ::u64 blockStart = aznumeric_cast<AZ::u64>(blockIndex) * compressionInfo.m_blockSize;
+        const AZ::u64 blockSize = AZStd::min<AZ::u64>(compressionInfo.m_blockSize, compressionInfo.m_uncompressedSize - blockStart);
+        const AZ::u64 readStart = AZStd::max(blockStart, request->m_readOffset);
+        const AZ::u64 readEnd = AZStd::max(readStart, AZStd::min(blockStart + blockSize, request->m_readOffset + request->m_readSize));
+        AZ::u8* output = reinterpret_cast<AZ::u8*>(request->m_output) + (readStart - request->m_readOffset);
+
+        bool success;
+        if (readStart == blockStart && readEnd == blockStart + blockSize)
+        {
+            // The entire block is requested so it can be decompressed directly into the output.
+            success = compressionInfo.m_decompressor(compressionInfo, compressedBlock, block.m_compressedSize, output, blockSize);
+        }
+        else
+        {
+            // Only part of the block is requested, which only happens for the first and last block of a read. Those two can
+            // be decompressed at the same time, so each has its own scratch buffer.
+            AZ_Assert(info.m_partialBlockBufferSize >= blockSize, "Partial block decompression started without a scratch buffer.");
+            Buffer decompressionBuffer = info.m_partialBlockBuffers[blockIndex == firstBlock ? 0 : 1];
+            success = compressionInfo.m_decompressor(compressionInfo, compressedBlock, block.m_compressedSize,
+                decompressionBuffer, blockSize);
+            if (success)
+            {
+                memcpy(output, decompressionBuffer + (readStart - blockStart), readEnd - readStart);
+            }
+        }
+
+        if (!success)
+        {
+            info.m_blockFailed = true;
+        }
+    }
+
+    void DecompressorRegistrarEntry::FinishBlockDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info)
+    {
+        info.m_waitRequest->SetStatus(info.m_blockFailed ?
+            AZ::IO::IStreamerTypes::RequestStatus::Failed : AZ::IO::IStreamerTypes::RequestStatus::Completed);
+
+        context->MarkRequestAsCompleted(info.m_waitRequest);
+        context->WakeUpSchedulingThread();
+    }
+
     void DecompressorRegistrarEntry::Report(const AZ::IO::Requests::ReportData& data) const
     {
         switch (data.m_reportType)
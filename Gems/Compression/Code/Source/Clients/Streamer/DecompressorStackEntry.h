@@ -14,7 +14,9 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/utils.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 #include <AzCore/Task/TaskExecutor.h>
 #include <AzCore/Task/TaskGraph.h>
@@ -22,9 +24,11 @@
 namespace AZ::IO
 {
     class RequestPath;
+    struct CompressionInfo;
 }
 namespace AZ::IO::Requests
 {
+    struct CompressedReadData;
     struct ReadRequestData;
     struct ReportData;
 }
@@ -52,7 +56,8 @@ namespace Compression
 
         //! Maximum number of reads that are kept in flight.
         AZ::u32 m_maxNumReads{ 2 };
-        //! Maximum number of decompression tasks that can run simultaneously.
+        //! Maximum number of files that can be decompressed simultaneously. The blocks of a file that was compressed in blocks
+        //! are decompressed in parallel and can use all task workers.
         AZ::u32 m_maxNumTasks{ 2 };
     };
 
@@ -66,12 +71,15 @@ namespace Compression
     //! Finally, the lack of an upper limit also means that the duration of the decompression job
     //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
     //! the main job system from working.
+    //! Files that were compressed in independent blocks, such as the 2 MiB blocks in archives
+    //! created by the Archive Gem, are the exception. For those files only the blocks that overlap
+    //! with the requested range are read and every block is decompressed in a separate task.
     class DecompressorRegistrarEntry
         : public AZ::IO::StreamStackEntry
     {
     public:
         DecompressorRegistrarEntry(AZ::u32 maxNumReads, AZ::u32 maxNumTasks, AZ::u32 alignment);
-        ~DecompressorRegistrarEntry() override = default;
+        ~DecompressorRegistrarEntry() override;
 
         void PrepareRequest(AZ::IO::FileRequest* request) override;
         void QueueRequest(AZ::IO::FileRequest* request) override;
@@ -102,10 +110,29 @@ namespace Compression
             Buffer m_compressedData{ nullptr };
             AZ::IO::FileRequest* m_waitRequest{ nullptr };
             AZ::u32 m_alignmentOffset{ 0 };
+            AZStd::atomic_bool m_blockFailed{ false }; //!< Set by any of the block tasks of a file if that block fails to decompress.
+            //! Scratch buffers for the first and last block of a read when only part of those blocks is requested. They're kept
+            //! with the job slot for the next job and only grow when a file with larger blocks is decompressed.
+            Buffer m_partialBlockBuffers[2]{ nullptr, nullptr };
+            size_t m_partialBlockBufferSize{ 0 };
+        };
+
+        //! The section of the archive that is read for a compressed read request.
+        struct ArchiveReadInformation
+        {
+            size_t m_offset{ 0 }; //!< Offset in the archive to start reading from.
+            size_t m_size{ 0 }; //!< Number of bytes to read from the archive.
+            size_t m_alignmentOffset{ 0 }; //!< Offset in the read buffer where the data starts.
+            size_t m_bufferSize{ 0 }; //!< Size of the aligned read buffer.
         };
 
         bool IsIdle() const;
 
+        static bool IsCompressedInBlocks(const AZ::IO::CompressionInfo& info);
+        //! Returns the first and one past the last block that overlap with the read. Only valid for files compressed in blocks.
+        static AZStd::pair<size_t, size_t> GetBlockRange(const AZ::IO::Requests::CompressedReadData& data);
+        ArchiveReadInformation GetArchiveReadInformation(const AZ::IO::Requests::CompressedReadData& data) const;
+
         void PrepareReadRequest(AZ::IO::FileRequest* request, AZ::IO::Requests::ReadRequestData& data);
         void PrepareDedicatedCache(AZ::IO::FileRequest* request, const AZ::IO::RequestPath& path);
         void FileExistsCheck(AZ::IO::FileRequest* checkRequest);
@@ -120,6 +147,12 @@ namespace Compression
 
         static void FullDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
         static void PartialDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
+        void AddBlockDecompressionTasks(AZ::TaskGraph& taskGraph, AZ::TaskToken& finishToken, DecompressionInformation& info,
+            const AZ::IO::Requests::CompressedReadData& data);
+        void ReservePartialBlockBuffers(DecompressionInformation& info, size_t blockSize);
+        void ReleasePartialBlockBuffers(DecompressionInformation& info);
+        static void BlockDecompression(DecompressionInformation& info, size_t firstBlock, size_t blockIndex);
+        static void FinishBlockDecompression(AZ::IO::StreamerContext* context, DecompressionInformation& info);
 
         void Report(const AZ::IO::Requests::ReportData& data) const;
 
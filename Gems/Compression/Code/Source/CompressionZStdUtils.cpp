@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressionZStdUtils.h"
+
+#include <AzCore/Math/Crc.h>
+
+namespace CompressionZStd::Internal
+{
+    AZ::u32 GetDictionaryId(AZStd::span<const AZStd::byte> dictionary)
+    {
+        if (const AZ::u32 dictionaryId = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+            dictionaryId != 0)
+        {
+            return dictionaryId;
+        }
+        return static_cast<AZ::u32>(AZ::Crc32(dictionary));
+    }
+
+    ZSTD_CCtx* GetThreadCompressionContext()
+    {
+        struct CompressionContext
+        {
+            ~CompressionContext()
+            {
+                ZSTD_freeCCtx(m_context);
+            }
+            ZSTD_CCtx* m_context = ZSTD_createCCtx();
+        };
+        static thread_local CompressionContext compressionContext;
+        return compressionContext.m_context;
+    }
+
+    ZSTD_DCtx* GetThreadDecompressionContext()
+    {
+        struct DecompressionContext
+        {
+            ~DecompressionContext()
+            {
+                ZSTD_freeDCtx(m_context);
+            }
+            ZSTD_DCtx* m_context = ZSTD_createDCtx();
+        };
+        static thread_local DecompressionContext decompressionContext;
+        return decompressionContext.m_context;
+    }
+} // namespace CompressionZStd::Internal
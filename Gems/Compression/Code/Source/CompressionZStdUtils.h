@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/span.h>
+
+#include <zstd.h>
+
+//! Helpers shared by the zstd compressor and decompressor
+namespace CompressionZStd::Internal
+{
+    //! Returns the id zstd stores in a trained dictionary
+    //! Dictionaries that only contain raw content don't have an id, so one is derived from the content
+    AZ::u32 GetDictionaryId(AZStd::span<const AZStd::byte> dictionary);
+
+    //! Compression contexts hold several hundred KiB of work memory,
+    //! so every thread that compresses blocks reuses a single context
+    ZSTD_CCtx* GetThreadCompressionContext();
+
+    //! Every thread that decompresses blocks reuses a single decompression context
+    ZSTD_DCtx* GetThreadDecompressionContext();
+} // namespace CompressionZStd::Internal
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "CompressorZStdImpl.h"
+
+#include <Compression/CompressionZStdAPI.h>
+#include <CompressionZStdUtils.h>
+
+namespace CompressionZStd
+{
+    // Definitions for ZStd Compressor
+    CompressorZStd::CompressorZStd() = default;
+    CompressorZStd::~CompressorZStd() = default;
+
+    void CompressorZStd::DigestedDictionaryDeleter::operator()(ZSTD_CDict* dictionary) const
+    {
+        ZSTD_freeCDict(dictionary);
+    }
+
+    Compression::CompressionAlgorithmId CompressorZStd::GetCompressionAlgorithmId() const
+    {
+        return GetZStdCompressionAlgorithmId();
+    }
+
+    AZStd::string_view CompressorZStd::GetCompressionAlgorithmName() const
+    {
+        return GetZStdCompressionAlgorithmName();
+    }
+
+    size_t CompressorZStd::CompressBound(size_t uncompressedBufferSize) const
+    {
+        return ZSTD_compressBound(uncompressedBufferSize);
+    }
+
+    const ZSTD_CDict* CompressorZStd::FindOrCreateDigestedDictionary(AZStd::span<const AZStd::byte> dictionary,
+        int compressionLevel) const
+    {
+        const AZ::u64 dictionaryKey = (static_cast<AZ::u64>(Internal::GetDictionaryId(dictionary)) << 32)
+            | static_cast<AZ::u32>(compressionLevel);
+        {
+            AZStd::shared_lock lock(m_digestedDictionariesMutex);
+            if (auto it = m_digestedDictionaries.find(dictionaryKey); it != m_digestedDictionaries.end())
+            {
+                return it->second.get();
+            }
+        }
+
+        AZStd::unique_lock lock(m_digestedDictionariesMutex);
+        // Another thread could have digested the dictionary while the lock was released
+        DigestedDictionaryPtr& digestedDictionary = m_digestedDictionaries[dictionaryKey];
+        if (digestedDictionary == nullptr)
+        {
+            digestedDictionary.reset(ZSTD_createCDict(dictionary.data(), dictionary.size(), compressionLevel));
+        }
+        return digestedDictionary.get();
+    }
+
+    Compression::CompressionResultData CompressorZStd::CompressBlock(
+        AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+        const Compression::CompressionOptions& compressionOptions) const
+    {
+        Compression::CompressionResultData resultData;
+
+        ZSTD_CCtx* compressionContext = Internal::GetThreadCompressionContext();
+        if (compressionContext == nullptr)
+        {
+            resultData.m_compressionOutcome.m_resultString = "Unable to create a zstd compression context";
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        int compressionLevel = ZStdCompressionOptions{}.m_compressionLevel;
+        AZStd::span<const AZStd::byte> dictionary;
+        if (auto zstdOptions = azrtti_cast<const ZStdCompressionOptions*>(&compressionOptions); zstdOptions != nullptr)
+        {
+            compressionLevel = zstdOptions->m_compressionLevel;
+            dictionary = zstdOptions->m_dictionary;
+        }
+
+        size_t compressedSize{};
+        if (!dictionary.empty())
+        {
+            const ZSTD_CDict* digestedDictionary = FindOrCreateDigestedDictionary(dictionary, compressionLevel);
+            if (digestedDictionary == nullptr)
+            {
+                resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                    "Unable to digest the compression dictionary of size %zu", dictionary.size());
+                resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+                return resultData;
+            }
+
+            compressedSize = ZSTD_compress_usingCDict(compressionContext,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                digestedDictionary);
+        }
+        else
+        {
+            compressedSize = ZSTD_compressCCtx(compressionContext,
+                compressionBuffer.data(), compressionBuffer.size(),
+                uncompressedData.data(), uncompressedData.size(),
+                compressionLevel);
+        }
+
+        if (ZSTD_isError(compressedSize))
+        {
+            // zstd fails when the output buffer is too small to store the compressed data
+            resultData.m_compressionOutcome.m_resultString = Compression::CompressionResultString::format(
+                "zstd compression has failed: %s. The source buffer size is %zu and the output buffer"
+                " has capacity of %zu", ZSTD_getErrorName(compressedSize), uncompressedData.size(), compressionBuffer.size());
+            resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Failed;
+            return resultData;
+        }
+
+        // Update the result buffer span to point at the beginning of the compressed data and
+        // the correct compressed size
+        resultData.m_compressedBuffer = compressionBuffer.subspan(0, compressedSize);
+        resultData.m_compressionOutcome.m_result = Compression::CompressionResult::Complete;
+        return resultData;
+    }
+} // namespace CompressionZStd
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Compression/CompressionInterfaceAPI.h>
+
+#include <zstd.h>
+
+namespace CompressionZStd
+{
+    class CompressorZStd
+        : public Compression::ICompressionInterface
+    {
+    public:
+        CompressorZStd();
+        ~CompressorZStd() override;
+        //! Retrieves the 32-bit compression algorithm ID associated with this interface
+        Compression::CompressionAlgorithmId GetCompressionAlgorithmId() const override;
+        //! Retrieves the human readable associated with the ZStd compressor
+        AZStd::string_view GetCompressionAlgorithmName() const override;
+        //! Compresses the uncompressed data into the compressed buffer
+        //! If ZStdCompressionOptions are supplied, their compression level and dictionary are used
+        //! @return a CompressionResultData instance to indicate if compression operation has succeeded
+        [[nodiscard]] Compression::CompressionResultData CompressBlock(
+            AZStd::span<AZStd::byte> compressionBuffer, const AZStd::span<const AZStd::byte>& uncompressedData,
+            const Compression::CompressionOptions& compressionOptions = {}) const override;
+
+        [[nodiscard]] size_t CompressBound(size_t uncompressedBufferSize) const override;
+
+    private:
+        //! Returns the digested version of the dictionary for the compression level, digesting it on first use
+        const ZSTD_CDict* FindOrCreateDigestedDictionary(AZStd::span<const AZStd::byte> dictionary, int compressionLevel) const;
+
+        struct DigestedDictionaryDeleter
+        {
+            void operator()(ZSTD_CDict* dictionary) const;
+        };
+        using DigestedDictionaryPtr = AZStd::unique_ptr<ZSTD_CDict, DigestedDictionaryDeleter>;
+
+        //! Digesting a dictionary costs more than compressing a small file with it, so digested dictionaries are kept
+        //! for the lifetime of the compressor. The key combines the dictionary id with the compression level.
+        mutable AZStd::unordered_map<AZ::u64, DigestedDictionaryPtr> m_digestedDictionaries;
+        mutable AZStd::shared_mutex m_digestedDictionariesMutex;
+    };
+} // namespace CompressionZStd
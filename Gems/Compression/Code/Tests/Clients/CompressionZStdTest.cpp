@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <Compression/CompressionZStdAPI.h>
+#include <Clients/DecompressorZStdImpl.h>
+
+namespace CompressionZStdTest
+{
+    class DecompressionZStdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        DecompressionZStdFixture() = default;
+
+        ~DecompressionZStdFixture() = default;
+
+    protected:
+        // zstd frame for "Hello World" with a raw block and the frame content size stored in the header
+        static constexpr AZStd::string_view CompressedHelloWorld{
+            "\x28\xb5\x2f\xfd\x20\x0b\x59\x00\x00" R"(Hello World)", 20 };
+    };
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZStd::GetZStdCompressionAlgorithmId();
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+
+        EXPECT_EQ(compressionAlgorithmId, decompressorZStd->GetCompressionAlgorithmId());
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        constexpr size_t DecompressBufferSize = CompressedHelloWorld.size() * 10;
+        decompressionBuffer.resize_no_construct(DecompressBufferSize);
+
+        AZStd::span compressedData(reinterpret_cast<const AZStd::byte*>(CompressedHelloWorld.data()), CompressedHelloWorld.size());
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData)) << decompressionResultData.m_decompressionOutcome.m_resultString.c_str();
+        EXPECT_TRUE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        EXPECT_NE(nullptr, decompressionResultData.GetUncompressedByteData());
+
+        AZStd::string_view uncompressedString(reinterpret_cast<char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+
+        EXPECT_EQ("Hello World", uncompressedString);
+    }
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+
+        AZStd::span compressedData(reinterpret_cast<const AZStd::byte*>(CompressedHelloWorld.data()), CompressedHelloWorld.size());
+
+        // The decompression output buffer has a size of zero, so decompression should fail
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData.m_decompressionOutcome));
+        EXPECT_EQ(0, decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(nullptr, decompressionResultData.GetUncompressedByteData());
+    }
+
+    TEST_F(DecompressionZStdFixture, ZStdDecompressor_DecompressBlock_WithMalformedData_Fails)
+    {
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+
+        constexpr AZStd::string_view malformedData = R"(Hello World)";
+        AZStd::span compressedData(reinterpret_cast<const AZStd::byte*>(malformedData.data()), malformedData.size());
+
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(64);
+
+        Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+            decompressionBuffer, compressedData);
+
+        EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+    }
+}
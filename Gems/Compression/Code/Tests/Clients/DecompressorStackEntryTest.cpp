@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Clients/Streamer/DecompressorStackEntry.h>
+
+namespace CompressionTest
+{
+    //! Serves reads from an in-memory archive and records the reads that were requested.
+    class InMemoryArchiveEntry
+        : public AZ::IO::StreamStackEntry
+    {
+    public:
+        explicit InMemoryArchiveEntry(const AZStd::vector<AZ::u8>& archive)
+            : AZ::IO::StreamStackEntry("In-memory archive")
+            , m_archive(archive)
+        {
+        }
+
+        void QueueRequest(AZ::IO::FileRequest* request) override
+        {
+            if (auto data = AZStd::get_if<AZ::IO::Requests::ReadData>(&request->GetCommand()); data != nullptr)
+            {
+                m_reads.emplace_back(data->m_offset, data->m_size);
+                memcpy(data->m_output, m_archive.data() + data->m_offset, data->m_size);
+                request->SetStatus(AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            else
+            {
+                AZ::IO::StreamStackEntry::QueueRequest(request);
+            }
+        }
+
+        const AZStd::vector<AZ::u8>& m_archive;
+        AZStd::vector<AZStd::pair<AZ::u64, AZ::u64>> m_reads;
+    };
+
+    class DecompressorStackEntryBlockFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        static constexpr size_t BlockSize = 4096;
+        static constexpr size_t BlockCount = 10;
+        //! The last block is only partially filled.
+        static constexpr size_t FileSize = BlockSize * BlockCount - 1000;
+        //! Blocks are padded in the archive to make sure the exact compressed block sizes are used.
+        static constexpr size_t BlockPadding = 512;
+        static constexpr size_t FileOffset = 1024;
+        static constexpr AZ::u8 CompressionKey = 0xA5;
+
+        void SetUp() override
+        {
+            UnitTest::LeakDetectionFixture::SetUp();
+
+            // Task graphs use the default executor for bookkeeping, which is normally set by the TaskGraphSystemComponent.
+            m_executor = aznew AZ::TaskExecutor();
+            AZ::TaskExecutor::SetInstance(m_executor);
+
+            m_context = AZStd::make_unique<AZ::IO::StreamerContext>();
+            m_archiveEntry = AZStd::make_shared<InMemoryArchiveEntry>(m_archive);
+            m_decompressor = AZStd::make_shared<Compression::DecompressorRegistrarEntry>(2, 2, 512);
+            m_decompressor->SetNext(m_archiveEntry);
+            m_decompressor->SetContext(*m_context);
+
+            CreateArchive();
+        }
+
+        void TearDown() override
+        {
+            m_decompressor.reset();
+            m_archiveEntry.reset();
+            m_context.reset();
+            m_archive.set_capacity(0);
+            m_output.set_capacity(0);
+            m_compressionInfo.m_blocks.set_capacity(0);
+            m_compressionInfo.m_decompressor = nullptr;
+
+            if (&AZ::TaskExecutor::Instance() == m_executor)
+            {
+                AZ::TaskExecutor::SetInstance(nullptr);
+            }
+            azdestroy(m_executor);
+
+            UnitTest::LeakDetectionFixture::TearDown();
+        }
+
+        //! Stores the file as blocks in an archive. The file stores 4 byte integers that match their offset in the file and the
+        //! blocks are "compressed" by xor-ing every byte with a key.
+        void CreateArchive()
+        {
+            m_archive.resize(FileOffset, AZ::u8(0xFF));
+            for (size_t blockIndex = 0; blockIndex < BlockCount; ++blockIndex)
+            {
+                const size_t blockStart = blockIndex * BlockSize;
+                const size_t blockSize = AZStd::min(BlockSize, FileSize - blockStart);
+
+                AZ::IO::CompressedBlock& block = m_compressionInfo.m_blocks.emplace_back();
+                block.m_offset = m_archive.size() - FileOffset;
+                block.m_compressedSize = blockSize;
+
+                for (size_t i = 0; i < blockSize; i += sizeof(AZ::u32))
+                {
+                    AZ::u32 value = aznumeric_cast<AZ::u32>(blockStart + i);
+                    const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(&value);
+                    for (size_t byte = 0; byte < sizeof(AZ::u32); ++byte)
+                    {
+                        m_archive.push_back(bytes[byte] ^ CompressionKey);
+                    }
+                }
+                m_archive.resize(m_archive.size() + BlockPadding, AZ::u8(0xFF));
+            }
+
+            m_compressionInfo.m_offset = FileOffset;
+            m_compressionInfo.m_compressedSize = m_archive.size() - FileOffset;
+            m_compressionInfo.m_uncompressedSize = FileSize;
+            m_compressionInfo.m_isCompressed = true;
+            m_compressionInfo.m_blockSize = BlockSize;
+            m_compressionInfo.m_decompressor = [this](const AZ::IO::CompressionInfo&, const void* compressed, size_t compressedSize,
+                void* uncompressed, size_t uncompressedBufferSize) -> bool
+            {
+                m_numDecompressedBlocks++;
+                if (m_corruptData || compressedSize != uncompressedBufferSize)
+                {
+                    return false;
+                }
+                const AZ::u8* source = reinterpret_cast<const AZ::u8*>(compressed);
+                AZ::u8* target = reinterpret_cast<AZ::u8*>(uncompressed);
+                for (size_t i = 0; i < compressedSize; ++i)
+                {
+                    target[i] = source[i] ^ CompressionKey;
+                }
+                return true;
+            };
+        }
+
+        AZ::IO::IStreamerTypes::RequestStatus ProcessCompressedRead(AZ::u64 offset, AZ::u64 size)
+        {
+            m_output.resize(size / sizeof(AZ::u32));
+
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, m_compressionInfo, m_output.data(), offset, size);
+            AZ::IO::IStreamerTypes::RequestStatus result = AZ::IO::IStreamerTypes::RequestStatus::Pending;
+            request->SetCompletionCallback([&result](const AZ::IO::FileRequest& request)
+                {
+                    result = request.GetStatus();
+                });
+
+            m_decompressor->QueueRequest(request);
+            bool hasCompleted = false;
+            while (m_decompressor->ExecuteRequests() || !hasCompleted)
+            {
+                AZ::IO::StreamStackEntry::Status status;
+                m_decompressor->UpdateStatus(status);
+                hasCompleted = status.m_isIdle;
+
+                m_context->FinalizeCompletedRequests();
+            }
+            return result;
+        }
+
+        AZ::u64 GetBufferMemory() const
+        {
+            AZStd::vector<AZ::IO::Statistic> statistics;
+            m_decompressor->CollectStatistics(statistics);
+            for (const AZ::IO::Statistic& statistic : statistics)
+            {
+                if (statistic.GetName() == "Buffer memory")
+                {
+                    return AZStd::get<AZ::IO::Statistic::ByteSize>(statistic.GetValue()).m_value;
+                }
+            }
+            return 0;
+        }
+
+        void VerifyOutput(AZ::u64 offset)
+        {
+            for (size_t i = 0; i < m_output.size(); ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would cause a large amount of log noise.
+                ASSERT_EQ(offset + i * sizeof(AZ::u32), m_output[i]);
+            }
+        }
+
+        AZStd::vector<AZ::u8> m_archive;
+        AZStd::vector<AZ::u32> m_output;
+        AZ::IO::CompressionInfo m_compressionInfo;
+        AZ::TaskExecutor* m_executor{ nullptr };
+        AZStd::unique_ptr<AZ::IO::StreamerContext> m_context;
+        AZStd::shared_ptr<InMemoryArchiveEntry> m_archiveEntry;
+        AZStd::shared_ptr<Compression::DecompressorRegistrarEntry> m_decompressor;
+        AZStd::atomic_uint32_t m_numDecompressedBlocks{ 0 };
+        bool m_corruptData{ false };
+    };
+
+    TEST_F(DecompressorStackEntryBlockFixture, CompressedRead_FullFile_AllBlocksDecompressed)
+    {
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessCompressedRead(0, FileSize));
+        VerifyOutput(0);
+
+        EXPECT_EQ(BlockCount, m_numDecompressedBlocks.load());
+        ASSERT_EQ(1, m_archiveEntry->m_reads.size());
+        EXPECT_EQ(FileOffset, m_archiveEntry->m_reads[0].first);
+        EXPECT_EQ(m_compressionInfo.m_compressedSize - BlockPadding, m_archiveEntry->m_reads[0].second);
+    }
+
+    TEST_F(DecompressorStackEntryBlockFixture, CompressedRead_PartialRead_OnlyOverlappingBlocksAreReadAndDecompressed)
+    {
+        constexpr AZ::u64 offset = BlockSize + 1024;
+        constexpr AZ::u64 size = BlockSize + 2048;
+
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessCompressedRead(offset, size));
+        VerifyOutput(offset);
+
+        EXPECT_EQ(2, m_numDecompressedBlocks.load());
+        ASSERT_EQ(1, m_archiveEntry->m_reads.size());
+        EXPECT_EQ(FileOffset + m_compressionInfo.m_blocks[1].m_offset, m_archiveEntry->m_reads[0].first);
+        EXPECT_EQ(m_compressionInfo.m_blocks[2].m_offset + BlockSize - m_compressionInfo.m_blocks[1].m_offset,
+            m_archiveEntry->m_reads[0].second);
+    }
+
+    TEST_F(DecompressorStackEntryBlockFixture, CompressedRead_ReadInLastBlock_OnlyLastBlockIsDecompressed)
+    {
+        constexpr AZ::u64 offset = BlockSize * (BlockCount - 1) + 256;
+        constexpr AZ::u64 size = FileSize - offset;
+
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessCompressedRead(offset, size));
+        VerifyOutput(offset);
+
+        EXPECT_EQ(1, m_numDecompressedBlocks.load());
+        ASSERT_EQ(1, m_archiveEntry->m_reads.size());
+        EXPECT_EQ(FileOffset + m_compressionInfo.m_blocks[BlockCount - 1].m_offset, m_archiveEntry->m_reads[0].first);
+    }
+
+    TEST_F(DecompressorStackEntryBlockFixture, CompressedRead_RepeatedPartialReads_PartialBlockBuffersReusedAndCounted)
+    {
+        constexpr AZ::u64 offset = BlockSize + 1024;
+        constexpr AZ::u64 size = BlockSize + 2048;
+
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessCompressedRead(offset, size));
+        VerifyOutput(offset);
+        // The read buffer is released once the read completes, but the scratch buffers for the partially read first and last
+        // block are kept for the next job.
+        const AZ::u64 bufferMemory = GetBufferMemory();
+        EXPECT_EQ(2 * BlockSize, bufferMemory);
+
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, ProcessCompressedRead(offset, size));
+        VerifyOutput(offset);
+        EXPECT_EQ(bufferMemory, GetBufferMemory());
+    }
+
+    TEST_F(DecompressorStackEntryBlockFixture, CompressedRead_CorruptedBlock_RequestFails)
+    {
+        m_corruptData = true;
+        EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, ProcessCompressedRead(0, FileSize));
+    }
+} // namespace CompressionTest
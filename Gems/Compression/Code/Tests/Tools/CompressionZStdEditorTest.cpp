@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/string/string.h>
+
+#include <Compression/CompressionZStdAPI.h>
+#include <Compression/CompressionZStdDictionaryAPI.h>
+#include <Clients/DecompressorZStdImpl.h>
+#include <Tools/CompressorZStdImpl.h>
+
+namespace CompressionZStdTest
+{
+    class CompressionZStdFixture
+        : public UnitTest::LeakDetectionFixture
+    {
+    public:
+        CompressionZStdFixture() = default;
+
+        ~CompressionZStdFixture() = default;
+
+    protected:
+        //! Creates small json documents which share their structure, similar to the material files of a project
+        static AZStd::vector<AZStd::string> CreateSimilarDocuments(size_t documentCount)
+        {
+            AZStd::vector<AZStd::string> documents;
+            documents.reserve(documentCount);
+            for (size_t documentIndex = 0; documentIndex < documentCount; ++documentIndex)
+            {
+                documents.push_back(AZStd::string::format(R"({
+    "materialType": "Materials/Types/StandardPBR.materialtype",
+    "materialTypeVersion": %zu,
+    "propertyValues": {
+        "baseColor.color": [ %zu.25, 0.%zu, 1.0 ],
+        "baseColor.textureMap": "Textures/Asset_%zu_basecolor.png",
+        "normal.textureMap": "Textures/Asset_%zu_normal.png",
+        "roughness.factor": 0.%zu,
+        "metallic.factor": 0.%zu
+    }
+})", documentIndex % 5, documentIndex % 3, documentIndex * 7, documentIndex, documentIndex, documentIndex * 13, documentIndex * 17));
+            }
+            return documents;
+        }
+
+        static AZStd::span<const AZStd::byte> AsBytes(AZStd::string_view text)
+        {
+            return { reinterpret_cast<const AZStd::byte*>(text.data()), text.size() };
+        }
+    };
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_Succeeds)
+    {
+        auto compressionAlgorithmId = CompressionZStd::GetZStdCompressionAlgorithmId();
+        auto compressorZStd = AZStd::make_unique<CompressionZStd::CompressorZStd>();
+
+        EXPECT_EQ(compressionAlgorithmId, compressorZStd->GetCompressionAlgorithmId());
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+        size_t compressBufferUpperBound = compressorZStd->CompressBound(dataToCompress.size());
+        EXPECT_GT(compressBufferUpperBound, 0);
+
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        compressionBuffer.resize_no_construct(compressBufferUpperBound);
+
+        Compression::CompressionResultData compressionResultData = compressorZStd->CompressBlock(
+            compressionBuffer, AsBytes(dataToCompress));
+
+        EXPECT_TRUE(static_cast<bool>(compressionResultData));
+        EXPECT_GT(compressionResultData.GetCompressedByteCount(), 0);
+        EXPECT_NE(nullptr, compressionResultData.GetCompressedByteData());
+
+        // Round trip the compressed data through the decompressor
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        decompressionBuffer.resize_no_construct(dataToCompress.size());
+        Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+            decompressionBuffer, compressionResultData.m_compressedBuffer);
+        ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+        AZStd::string_view uncompressedString(reinterpret_cast<const char*>(decompressionResultData.GetUncompressedByteData()),
+            decompressionResultData.GetUncompressedByteCount());
+        EXPECT_EQ(dataToCompress, uncompressedString);
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_WithBufferTooSmall_Fails)
+    {
+        auto compressorZStd = AZStd::make_unique<CompressionZStd::CompressorZStd>();
+
+        constexpr AZStd::string_view dataToCompress = R"(Hello World)";
+
+        // The compression output buffer has a size of zero, so compression should fail
+        AZStd::vector<AZStd::byte> compressionBuffer;
+
+        Compression::CompressionResultData compressionResultData = compressorZStd->CompressBlock(
+            compressionBuffer, AsBytes(dataToCompress));
+
+        EXPECT_FALSE(static_cast<bool>(compressionResultData));
+        EXPECT_FALSE(static_cast<bool>(compressionResultData.m_compressionOutcome));
+        EXPECT_EQ(0, compressionResultData.GetCompressedByteCount());
+        EXPECT_EQ(nullptr, compressionResultData.GetCompressedByteData());
+    }
+
+    TEST_F(CompressionZStdFixture, TrainDictionary_WithNoSamples_Fails)
+    {
+        auto trainOutcome = CompressionZStd::TrainDictionary({});
+        EXPECT_FALSE(trainOutcome);
+    }
+
+    TEST_F(CompressionZStdFixture, ZStdCompressor_CompressBlock_WithTrainedDictionary_CompressesSmallFilesBetter)
+    {
+        AZStd::vector<AZStd::string> documents = CreateSimilarDocuments(1000);
+        AZStd::vector<AZStd::span<const AZStd::byte>> samples;
+        for (const AZStd::string& document : documents)
+        {
+            samples.push_back(AsBytes(document));
+        }
+
+        constexpr size_t DictionaryCapacity = 4 * 1024;
+        auto trainOutcome = CompressionZStd::TrainDictionary(samples, DictionaryCapacity);
+        ASSERT_TRUE(trainOutcome) << trainOutcome.error().c_str();
+        const AZStd::vector<AZStd::byte>& dictionary = trainOutcome.value();
+        EXPECT_FALSE(dictionary.empty());
+        EXPECT_LE(dictionary.size(), DictionaryCapacity);
+
+        auto compressorZStd = AZStd::make_unique<CompressionZStd::CompressorZStd>();
+        auto decompressorZStd = AZStd::make_unique<CompressionZStd::DecompressorZStd>();
+
+        CompressionZStd::ZStdCompressionOptions dictionaryCompressionOptions;
+        dictionaryCompressionOptions.m_dictionary = dictionary;
+        CompressionZStd::ZStdDecompressionOptions dictionaryDecompressionOptions;
+        dictionaryDecompressionOptions.m_dictionary = dictionary;
+
+        // Use documents which weren't part of the training set
+        AZStd::vector<AZStd::string> newDocuments = CreateSimilarDocuments(1010);
+        size_t compressedSizeWithoutDictionary{};
+        size_t compressedSizeWithDictionary{};
+        AZStd::vector<AZStd::byte> compressionBuffer;
+        AZStd::vector<AZStd::byte> decompressionBuffer;
+        for (size_t documentIndex = 1000; documentIndex < newDocuments.size(); ++documentIndex)
+        {
+            AZStd::span<const AZStd::byte> uncompressedData = AsBytes(newDocuments[documentIndex]);
+            compressionBuffer.resize_no_construct(compressorZStd->CompressBound(uncompressedData.size()));
+
+            Compression::CompressionResultData compressionResultData = compressorZStd->CompressBlock(
+                compressionBuffer, uncompressedData);
+            ASSERT_TRUE(static_cast<bool>(compressionResultData));
+            compressedSizeWithoutDictionary += compressionResultData.GetCompressedByteCount();
+
+            compressionResultData = compressorZStd->CompressBlock(compressionBuffer, uncompressedData, dictionaryCompressionOptions);
+            ASSERT_TRUE(static_cast<bool>(compressionResultData));
+            compressedSizeWithDictionary += compressionResultData.GetCompressedByteCount();
+
+            // Data compressed with a dictionary can't be decompressed without it
+            decompressionBuffer.resize_no_construct(uncompressedData.size());
+            Compression::DecompressionResultData decompressionResultData = decompressorZStd->DecompressBlock(
+                decompressionBuffer, compressionResultData.m_compressedBuffer);
+            EXPECT_FALSE(static_cast<bool>(decompressionResultData));
+
+            decompressionResultData = decompressorZStd->DecompressBlock(
+                decompressionBuffer, compressionResultData.m_compressedBuffer, dictionaryDecompressionOptions);
+            ASSERT_TRUE(static_cast<bool>(decompressionResultData));
+            AZStd::string_view uncompressedString(reinterpret_cast<const char*>(decompressionResultData.GetUncompressedByteData()),
+                decompressionResultData.GetUncompressedByteCount());
+            EXPECT_EQ(newDocuments[documentIndex], uncompressedString);
+        }
+
+        EXPECT_LT(compressedSizeWithDictionary * 2, compressedSizeWithoutDictionary);
+    }
+}
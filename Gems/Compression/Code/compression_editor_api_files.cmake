@@ -6,4 +6,5 @@
 
 
 set(FILES
+    Include/Compression/CompressionZStdDictionaryAPI.h
 )
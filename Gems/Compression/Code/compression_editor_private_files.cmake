@@ -9,6 +9,8 @@ set(FILES
     Source/Tools/CompressionEditorSystemComponent.h
     Source/Tools/CompressorLZ4Impl.cpp
     Source/Tools/CompressorLZ4Impl.h
+    Source/Tools/CompressorZStdImpl.cpp
+    Source/Tools/CompressorZStdImpl.h
     Source/Tools/CompressionRegistrarImpl.h
     Source/Tools/CompressionRegistrarImpl.cpp
 )
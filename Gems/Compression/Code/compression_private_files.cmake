@@ -7,12 +7,16 @@
 set(FILES
     Source/CompressionModuleInterface.cpp
     Source/CompressionModuleInterface.h
+    Source/CompressionZStdUtils.cpp
+    Source/CompressionZStdUtils.h
     Source/Clients/CompressionSystemComponent.cpp
     Source/Clients/CompressionSystemComponent.h
     Source/Clients/DecompressionRegistrarImpl.cpp
     Source/Clients/DecompressionRegistrarImpl.h
     Source/Clients/DecompressorLZ4Impl.cpp
     Source/Clients/DecompressorLZ4Impl.h
+    Source/Clients/DecompressorZStdImpl.cpp
+    Source/Clients/DecompressorZStdImpl.h
     Source/Clients/Streamer/DecompressorStackEntry.cpp
     Source/Clients/Streamer/DecompressorStackEntry.h
 )
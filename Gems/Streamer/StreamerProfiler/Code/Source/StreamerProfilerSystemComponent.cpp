@@ -168,6 +168,17 @@ namespace Streamer
                                 "impact the ability to retrieve meaningful information.");
                 }
 
+                if (ImGui::CollapsingHeader("Cache hits"))
+                {
+                    DrawCacheHits(*streamer);
+                }
+                else
+                {
+                    DrawToolTip("The number of times cacheable parts of files were found in a cache or had to be read, per file. Use these "
+                                "to see which files benefit from caching and how large caches need to be. Counters are only kept for a "
+                                "limited number of files per cache, so rarely read files may not be listed.");
+                }
+
                 if (ImGui::CollapsingHeader("File locks"))
                 {
                     DrawFileLocks(*streamer);
@@ -368,6 +379,58 @@ namespace Streamer
 #endif // #if defined(IMGUI_ENABLED)
     }
 
+    void StreamerProfilerSystemComponent::DrawCacheHits([[maybe_unused]] AZ::IO::IStreamer& streamer)
+    {
+#if defined(IMGUI_ENABLED)
+        // The report is only requested on demand as it can be large. The results are kept until the next refresh.
+        bool refresh = !m_cacheHitsRequested;
+        if (m_cacheHitsAvailable)
+        {
+            refresh = ImGui::Button("Refresh");
+        }
+
+        if (refresh)
+        {
+            m_cacheHitsAvailable = false;
+            m_cacheHitsRequested = true;
+            m_cacheHits.clear();
+            AZ::IO::FileRequestPtr request = streamer.Report(m_cacheHits, AZ::IO::IStreamerTypes::ReportType::CacheHits);
+            auto callback = [this](AZ::IO::FileRequestHandle)
+            {
+                m_cacheHitsAvailable = true;
+            };
+            streamer.SetRequestCompleteCallback(request, AZStd::move(callback));
+            streamer.QueueRequest(request);
+        }
+        else if (m_cacheHitsAvailable)
+        {
+            if (ImGui::BeginTable("Cache hits", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable))
+            {
+                ImGui::TableSetupColumn("Node", ImGuiTableColumnFlags_WidthStretch, 0.20f);
+                ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch, 0.10f);
+                ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthStretch, 0.70f);
+                ImGui::TableHeadersRow();
+
+                for (AZ::IO::Statistic& stat : m_cacheHits)
+                {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.*s", AZ_STRING_ARG(stat.GetOwner()));
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.*s", AZ_STRING_ARG(stat.GetName()));
+
+                    ImGui::TableNextColumn();
+                    DrawStatisticValue(stat.GetValue());
+                }
+
+                ImGui::EndTable();
+            }
+        }
+#endif // #if defined(IMGUI_ENABLED)
+    }
+
     void StreamerProfilerSystemComponent::DrawFileLocks([[maybe_unused]] AZ::IO::IStreamer& streamer)
     {
 #if defined(IMGUI_ENABLED)
@@ -78,6 +78,7 @@ namespace Streamer
         void DrawHardwareInfo(AZ::IO::IStreamer& streamer);
         void DrawStackConfiguration(AZ::IO::IStreamer& streamer);
         void DrawFileLocks(AZ::IO::IStreamer& streamer);
+        void DrawCacheHits(AZ::IO::IStreamer& streamer);
         void DrawGraph(const AZ::IO::Statistic::Value& value, GraphStore& values, bool useHistogram);
         void DrawStatisticValue(
             const AZ::IO::Statistic::Value& value,
@@ -98,6 +99,9 @@ namespace Streamer
         AZStd::atomic<StatsContainer*> m_transferFileLocks{  };
         StatsContainer* m_displayingFileLocks{ m_fileLocks + 1};
         AZStd::atomic_bool m_stackConfigurationAvailable{ false };
+        StatsContainer m_cacheHits;
+        AZStd::atomic_bool m_cacheHitsAvailable{ false };
+        bool m_cacheHitsRequested{ false };
     };
 
 } // namespace Streamer